@@ -23,9 +23,14 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_ML_APP_ML_RUNNER_LOG_LEVEL);
 #define SHIFT_FRAMES		CONFIG_ML_APP_ML_RUNNER_FRAME_SHIFT
 
 #define APP_CONTROLS_ML_MODE	IS_ENABLED(CONFIG_ML_APP_MODE_EVENTS)
+#define PIPELINE		IS_ENABLED(CONFIG_ML_APP_ML_RUNNER_PIPELINE)
 
 /* Make sure that event handlers will not be preempted by the EI wrapper's callback. */
 BUILD_ASSERT(CONFIG_SYSTEM_WORKQUEUE_PRIORITY < CONFIG_EI_WRAPPER_THREAD_PRIORITY);
+#if CONFIG_ML_APP_ML_RUNNER_PIPELINE
+BUILD_ASSERT(CONFIG_SYSTEM_WORKQUEUE_PRIORITY <
+	     CONFIG_EI_WRAPPER_PIPELINE_CAPTURE_THREAD_PRIORITY);
+#endif /* CONFIG_ML_APP_ML_RUNNER_PIPELINE */
 
 /**
  * @brief Enumeration of possible current module states
@@ -81,6 +86,34 @@ static void submit_result(void)
 	APP_EVENT_SUBMIT(evt);
 }
 
+#if CONFIG_ML_APP_ML_RUNNER_INFERENCE_RATE_LOG
+static void inference_rate_update(void)
+{
+	static uint32_t inference_cnt;
+	static int64_t inference_rate_start;
+
+	int64_t now = k_uptime_get();
+
+	if (inference_cnt == 0) {
+		inference_rate_start = now;
+	}
+
+	inference_cnt++;
+
+	int64_t elapsed = now - inference_rate_start;
+
+	if (elapsed >= CONFIG_ML_APP_ML_RUNNER_INFERENCE_RATE_LOG_INTERVAL_MS) {
+		/* Inferences per second, multiplied by 100. */
+		uint32_t rate = (uint32_t)((inference_cnt - 1) * 100 * MSEC_PER_SEC / elapsed);
+
+		LOG_INF("Inferences per second: %u.%02u", rate / 100, rate % 100);
+
+		inference_cnt = 1;
+		inference_rate_start = now;
+	}
+}
+#endif /* CONFIG_ML_APP_ML_RUNNER_INFERENCE_RATE_LOG */
+
 static int buf_cleanup(void)
 {
 	bool cancelled = false;
@@ -145,8 +178,45 @@ static void start_prediction(void)
 	}
 }
 
+#if CONFIG_ML_APP_ML_RUNNER_PIPELINE
+static void window_captured_cb(void)
+{
+	k_sched_lock();
+
+	ml_control &= ~ML_RUNNING;
+
+	/* The wrapper drops the results of the windows captured before the cleanup. */
+	if (ml_control & ML_CLEANUP_REQUIRED) {
+		(void)buf_cleanup();
+	}
+
+	ml_control &= ~ML_DROP_RESULT;
+
+	if (state == STATE_ACTIVE) {
+		start_prediction();
+	}
+
+	k_sched_unlock();
+}
+#endif /* CONFIG_ML_APP_ML_RUNNER_PIPELINE */
+
 static void result_ready_cb(int err)
 {
+#if CONFIG_ML_APP_ML_RUNNER_INFERENCE_RATE_LOG
+	inference_rate_update();
+#endif /* CONFIG_ML_APP_ML_RUNNER_INFERENCE_RATE_LOG */
+
+	if (PIPELINE) {
+		if (err) {
+			LOG_ERR("Result ready callback returned error (err: %d)", err);
+			report_error();
+		} else if (state != STATE_ERROR) {
+			submit_result();
+		}
+
+		return;
+	}
+
 	k_sched_lock();
 
 	bool drop_result = (err) || (ml_control & ML_DROP_RESULT) || (state == STATE_ERROR);
@@ -174,7 +244,17 @@ static int init(void)
 {
 	ml_control |= ML_FIRST_PREDICTION;
 
-	int err = ei_wrapper_init(result_ready_cb);
+	int err = 0;
+
+#if CONFIG_ML_APP_ML_RUNNER_PIPELINE
+	err = ei_wrapper_set_window_captured_cb(window_captured_cb);
+	if (err) {
+		LOG_ERR("Cannot set window captured callback (err: %d)", err);
+		return err;
+	}
+#endif /* CONFIG_ML_APP_ML_RUNNER_PIPELINE */
+
+	err = ei_wrapper_init(result_ready_cb);
 
 	if (err) {
 		LOG_ERR("Edge Impulse wrapper failed to initialize (err: %d)", err);
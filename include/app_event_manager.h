@@ -91,6 +91,40 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 #define APP_EVENT_LISTENER(lname, cb_fn) _APP_EVENT_LISTENER(lname, cb_fn)
 
 
+/** @brief Create an event listener object that handles events in batches.
+ *
+ * When an event type with a batch listener subscribed is processed, all events of that type
+ * that are queued in the same lane are collected and processed together, in the submission
+ * order. Regular listeners are notified about every event of the batch one by one, while
+ * the batch listener is notified once with the list of events that were not consumed by
+ * the preceding listeners.
+ *
+ * The events of a batch are processed before the other events waiting in the lane, including
+ * events of other types submitted between them. Events processed in different lanes are not
+ * ordered with respect to each other, with or without batching.
+ *
+ * The handler function should have a form
+ * `bool batch_fn(sys_slist_t *events, size_t count)` and return true to consume all the
+ * events of the batch. The list of events must not be modified by the handler.
+ *
+ * @note
+ * For this macro to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS} option needs to be enabled.
+ *
+ * @param lname     Module name.
+ * @param batch_fn  Pointer to the batch handler function.
+ */
+#define APP_EVENT_LISTENER_BATCH(lname, batch_fn) _APP_EVENT_LISTENER_BATCH(lname, batch_fn)
+
+
+/** @brief Iterate over the events passed to a batch handler function.
+ *
+ * @param events  Pointer to the list of events.
+ * @param aeh     Name of the iterator, a pointer to the struct app_event_header.
+ */
+#define APP_EVENT_BATCH_FOREACH(events, aeh) SYS_SLIST_FOR_EACH_CONTAINER(events, aeh, node)
+
+
 /** @brief Subscribe a listener to an event type as first module that is
  *  being notified.
  *
@@ -143,6 +177,19 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 #define APP_EVENT_TYPE_DECLARE(ename) _APP_EVENT_TYPE_DECLARE(ename)
 
 
+/** @brief Declare an event type with a given event pool size.
+ *
+ * This macro works like @ref APP_EVENT_TYPE_DECLARE, but if
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_POOLS} is enabled, the pool of the event type
+ * holds @p max_cnt events instead of @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_POOL_SIZE}.
+ * Set it to the maximum number of events of this type that can exist at the same time.
+ *
+ * @param ename    Name of the event.
+ * @param max_cnt  Number of events in the pool. Use 0 to always allocate from the heap.
+ */
+#define APP_EVENT_TYPE_POOL_DECLARE(ename, max_cnt) _APP_EVENT_TYPE_POOL_DECLARE(ename, max_cnt)
+
+
 /** @brief Declare an event type with dynamic data size.
  *
  * This macro provides declarations required for an event to be used
@@ -178,6 +225,22 @@ static inline bool app_event_get_type_flag(const struct event_type *et,
 	_APP_EVENT_TYPE_DEFINE(ename, log_fn, ev_info_struct, app_event_type_flags)
 
 
+/** @brief Process an event type in a given lane.
+ *
+ * Each lane has its own event queue. Lane 0 is processed in the system workqueue and is used
+ * for all the event types that are not assigned to any other lane. The other lanes are
+ * processed by dedicated workqueue threads, with the priority increasing with the lane ID.
+ * The order of events is preserved within a lane.
+ *
+ * The assignment takes effect when the Application Event Manager is initialized.
+ * An event type can be assigned to only one lane.
+ *
+ * @param ename  Name of the event.
+ * @param lane   Lane ID, lower than @kconfig{CONFIG_APP_EVENT_MANAGER_LANES}.
+ */
+#define APP_EVENT_TYPE_LANE_SET(ename, lane) _APP_EVENT_TYPE_LANE_SET(ename, lane)
+
+
 /** @brief Verify if an event ID is valid.
  *
  * The pointer to an event type structure is used as its ID. This macro
@@ -403,6 +466,113 @@ void *app_event_manager_alloc(size_t size);
 void app_event_manager_free(void *addr);
 
 
+/** @brief Event type statistics. */
+struct app_event_manager_stats {
+	/** Lane processing the events of this type. */
+	uint8_t lane;
+
+	/** Number of events waiting in the queue. */
+	uint16_t queued;
+
+	/** Maximum number of events waiting in the queue. */
+	uint16_t queued_max;
+
+	/** Number of processed events. */
+	uint32_t dispatched;
+
+	/** Moving average of the time from event submission to processing, in microseconds. */
+	uint32_t latency_avg_us;
+
+	/** Maximum time from event submission to processing, in microseconds. */
+	uint32_t latency_max_us;
+};
+
+/** @brief Get the statistics of an event type.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_STATS} option needs to be enabled.
+ *
+ * @param et     Pointer to the event type.
+ * @param stats  Pointer to the structure to fill.
+ */
+void app_event_manager_stats_get(const struct event_type *et,
+				 struct app_event_manager_stats *stats);
+
+/** @brief Reset the statistics of all event types.
+ *
+ * The number of queued events is not affected.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_STATS} option needs to be enabled.
+ */
+void app_event_manager_stats_reset(void);
+
+
+/** @brief Event pool statistics. */
+struct app_event_manager_pool_stats {
+	/** Size of a pool block in bytes. */
+	size_t block_size;
+
+	/** Number of blocks in the pool. */
+	uint32_t total;
+
+	/** Number of blocks in use. */
+	uint32_t used;
+
+	/** Maximum number of blocks in use. */
+	uint32_t used_max;
+
+	/** Number of events allocated from the heap because the pool was exhausted. */
+	uint32_t heap_fallbacks;
+};
+
+/** @brief Allocate an event from the pool of its type.
+ *
+ * If the pool of the event type is exhausted, or the event type has no pool, the event is
+ * allocated using @ref app_event_manager_alloc.
+ * This function is called by the allocator functions generated for event types
+ * without dynamic data.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_POOLS} option needs to be enabled.
+ *
+ * @param et    Pointer to the event type.
+ * @param size  Size of the event in bytes.
+ * @retval Address of the allocated memory if successful, otherwise NULL.
+ */
+void *app_event_manager_pool_alloc(const struct event_type *et, size_t size);
+
+/** @brief Return an event to the pool of its type.
+ *
+ * Events are returned to their pool after they have been processed.
+ * Use this function only to free an event that has not been submitted,
+ * and call @ref app_event_manager_free if it returns false.
+ *
+ * @param addr  Pointer to the event.
+ * @retval true  If the event was allocated from a pool and has been returned to it.
+ * @retval false If the event was not allocated from a pool.
+ */
+bool app_event_manager_pool_free(void *addr);
+
+/** @brief Get the pool statistics of an event type.
+ *
+ * @note
+ * For this function to be available the
+ * @kconfig{CONFIG_APP_EVENT_MANAGER_EVENT_POOLS} option needs to be enabled.
+ *
+ * @param et     Pointer to the event type.
+ * @param stats  Pointer to the structure to fill.
+ *
+ * @retval 0 If the operation was successful.
+ * @retval -ENOENT If the event type has no pool.
+ */
+int app_event_manager_pool_stats_get(const struct event_type *et,
+				     struct app_event_manager_pool_stats *stats);
+
+
 /** @brief Log event.
  *
  * This helper macro simplifies event logging.
@@ -109,6 +109,44 @@ struct audio_data {
 	struct audio_metadata meta;
 };
 
+/**
+ * @brief Reference counted descriptor for an audio data buffer sent by a module.
+ *
+ * All the destinations of a module share the same data buffer, which is returned to the
+ * module's data slab when the last destination has consumed it.
+ */
+struct audio_module_buffer {
+	/* Number of destinations yet to consume the data buffer. */
+	atomic_t ref_count;
+};
+
+/**
+ * @brief Statistics for the audio data queued to a module.
+ */
+struct audio_module_stats {
+	/* Number of audio data items queued to the module's RX FIFO. */
+	uint32_t queued;
+
+	/* Number of audio data items dropped because they could not be queued. */
+	uint32_t dropped;
+
+	/* Number of audio data items waiting in the module's RX FIFO. */
+	uint32_t queue_depth;
+
+	/* Largest number of audio data items waiting in the module's RX FIFO. */
+	uint32_t queue_depth_max;
+
+	/* Average time from queuing an audio data item to the start of its processing,
+	 * in microseconds.
+	 */
+	uint32_t latency_avg_us;
+
+	/* Longest time from queuing an audio data item to the start of its processing,
+	 * in microseconds.
+	 */
+	uint32_t latency_max_us;
+};
+
 /**
  * @brief Module's private handle.
  */
@@ -314,12 +352,26 @@ struct audio_module_handle {
 	/* Number of destination modules. */
 	uint8_t dest_count;
 
-	/* Semaphore to count messages between modules and on a module's TX FIFO. */
-	struct k_sem sem;
+	/* Descriptors for the audio data buffers sent by the module, shared by all destinations. */
+	struct audio_module_buffer buffers[CONFIG_AUDIO_MODULE_BUFFERS_NUM];
+
+	/* Bitmap of the buffer descriptors in use. */
+	ATOMIC_DEFINE(buffers_used, CONFIG_AUDIO_MODULE_BUFFERS_NUM);
 
 	/* Mutex to make the above destinations list thread safe. */
 	struct k_mutex dest_mutex;
 
+	/* Statistics for the audio data queued to the module. */
+	struct {
+		atomic_t queued;
+		atomic_t dropped;
+		atomic_t queue_depth;
+		atomic_val_t queue_depth_max;
+		uint64_t latency_sum_us;
+		uint32_t latency_count;
+		uint32_t latency_max_us;
+	} stats;
+
 	/* Module's thread configuration. */
 	struct audio_module_thread_configuration thread;
 
@@ -339,6 +391,14 @@ struct audio_module_message {
 
 	/* Callback for when the audio data has been consumed. */
 	audio_module_response_cb response_cb;
+
+	/* Descriptor of the data buffer shared with the other destinations, NULL if the
+	 * audio data is not sent by a module.
+	 */
+	struct audio_module_buffer *buffer;
+
+	/* Time the message was queued, in cycles. */
+	uint32_t sent_cycles;
 };
 
 /**
@@ -537,6 +597,20 @@ int audio_module_state_get(struct audio_module_handle const *const handle,
  */
 int audio_module_number_channels_calculate(uint32_t locations, int8_t *number_channels);
 
+/**
+ * @brief Get the statistics for the audio data queued to a module.
+ *
+ * @note In a graph, each connection into a module is an edge, and the statistics of the
+ *       receiving module give the queue depth and latency of its input edges.
+ *
+ * @param handle  [in]   The handle to the module instance.
+ * @param stats   [out]  Pointer to the module's statistics.
+ *
+ * @return 0 if successful, error otherwise.
+ */
+int audio_module_stats_get(struct audio_module_handle const *const handle,
+			   struct audio_module_stats *stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -23,11 +23,19 @@ extern "C" {
 #endif
 
 /** @brief Sensor data aggregator event.
+ *
+ *  Timestamps are expressed as system uptime in milliseconds.
  */
 struct sensor_data_aggregator_event {
 	struct app_event_header header;
 	const char *sensor_descr;
 	struct sensor_value *samples;
+	/** Timestamp of every sample or NULL if per-sample timestamps are not available. */
+	const int64_t *timestamps;
+	/** Timestamp of the first sample in the buffer. */
+	int64_t first_timestamp;
+	/** Timestamp of the last sample in the buffer. */
+	int64_t last_timestamp;
 	enum sensor_state sensor_state;
 	uint8_t sample_cnt;
 	uint8_t values_in_sample;
@@ -43,8 +51,22 @@ struct sensor_data_aggregator_release_buffer_event {
 	const char *sensor_descr;
 };
 
+/** @brief Sensor data aggregator buffer pressure event.
+ *
+ *  The event is submitted when the number of free buffers of an aggregator drops to
+ *  :kconfig:option:`CONFIG_CAF_SENSOR_DATA_AGGREGATOR_PRESSURE_THRESHOLD` and again when it
+ *  rises above the threshold. Consumers can use it to throttle before samples are dropped.
+ */
+struct sensor_data_aggregator_pressure_event {
+	struct app_event_header header;
+	const char *sensor_descr;
+	uint8_t free_buf_cnt;
+	bool high;
+};
+
 APP_EVENT_TYPE_DECLARE(sensor_data_aggregator_event);
 APP_EVENT_TYPE_DECLARE(sensor_data_aggregator_release_buffer_event);
+APP_EVENT_TYPE_DECLARE(sensor_data_aggregator_pressure_event);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _SENSOR_DATA_AGGREGATOR_H_
+#define _SENSOR_DATA_AGGREGATOR_H_
+
+/**
+ * @file
+ * @defgroup caf_sensor_data_aggregator CAF Sensor Data Aggregator
+ * @{
+ * @brief CAF Sensor Data Aggregator direct write API.
+ *
+ * The API allows a sample producer running on the same core as the aggregator to write
+ * samples directly into the aggregator buffers instead of submitting a sensor_event for
+ * every sample. Only one producer may write to a given aggregator.
+ */
+
+#include <stdint.h>
+#include <zephyr/drivers/sensor.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** @brief Get the aggregator handle for the given sensor.
+ *
+ * The handle should be obtained once and used for all subsequent calls.
+ *
+ * @param sensor_descr Sensor description.
+ *
+ * @retval Non-negative handle on success.
+ * @retval -ENOENT if there is no aggregator for the sensor.
+ */
+int sensor_data_aggregator_handle_get(const char *sensor_descr);
+
+/** @brief Get the memory for the next sample.
+ *
+ * The returned memory can hold the number of sensor values configured as the aggregator
+ * sample size. The sample must be completed with either
+ * @ref sensor_data_aggregator_sample_commit or @ref sensor_data_aggregator_sample_abort.
+ *
+ * @param handle Aggregator handle.
+ *
+ * @return Pointer to the sample memory or NULL if there is no free buffer.
+ */
+struct sensor_value *sensor_data_aggregator_sample_get(int handle);
+
+/** @brief Commit the sample written to the memory obtained from the aggregator.
+ *
+ * The buffer is sent as soon as it is full.
+ *
+ * @param handle    Aggregator handle.
+ * @param timestamp Sample timestamp (system uptime in milliseconds).
+ */
+void sensor_data_aggregator_sample_commit(int handle, int64_t timestamp);
+
+/** @brief Discard the sample memory obtained from the aggregator.
+ *
+ * @param handle Aggregator handle.
+ */
+void sensor_data_aggregator_sample_abort(int handle);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _SENSOR_DATA_AGGREGATOR_H_ */
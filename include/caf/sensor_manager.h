@@ -85,6 +85,15 @@ struct sm_sensor_config {
 	 * @brief Flag to indicate whether sensor should be suspended or not.
 	 */
 	bool suspend;
+	/**
+	 * @brief Number of samples in a single sensor_event
+	 *
+	 * If set to a value greater than one, samples are collected directly in
+	 * the event memory and a single event carries the given number of
+	 * consecutive samples. Otherwise, every sample is sent in a separate
+	 * event.
+	 */
+	uint8_t batch_size;
 };
 
 #ifdef __cplusplus
@@ -31,6 +31,24 @@ struct data_fifo_msgq {
 	size_t size;
 };
 
+#if defined(CONFIG_DATA_FIFO_SPSC) || defined(__DOXYGEN__)
+/* Indices of a FIFO in single-producer single-consumer mode. The blocks are used in order, and
+ * the indices run from zero to twice the number of elements, so that a full FIFO can be told
+ * apart from an empty one. The alloc and head indices are only written by the producer, the
+ * read and tail indices only by the consumer.
+ */
+struct data_fifo_spsc {
+	atomic_t alloc;
+	atomic_t head;
+	atomic_t read;
+	atomic_t tail;
+	atomic_t vacant_wait;
+	atomic_t filled_wait;
+	struct k_sem vacant_sem;
+	struct k_sem filled_sem;
+};
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 struct data_fifo {
 	char *msgq_buffer;
 	char *slab_buffer;
@@ -39,6 +57,10 @@ struct data_fifo {
 	uint32_t elements_max;
 	size_t block_size_max;
 	bool initialized;
+#if defined(CONFIG_DATA_FIFO_SPSC) || defined(__DOXYGEN__)
+	bool spsc_mode;
+	struct data_fifo_spsc spsc;
+#endif /* CONFIG_DATA_FIFO_SPSC */
 };
 
 #define DATA_FIFO_DEFINE(name, elements_max_in, block_size_max_in)                                 \
@@ -52,6 +74,29 @@ struct data_fifo {
 				 .elements_max = elements_max_in,                                  \
 				 .initialized = false}
 
+#if defined(CONFIG_DATA_FIFO_SPSC) || defined(__DOXYGEN__)
+/**
+ * @brief Define a data_fifo in single-producer single-consumer mode.
+ *
+ * The FIFO has the same API as one defined with DATA_FIFO_DEFINE, but the blocks are passed
+ * between the producer and the consumer with atomic indices, without using a memory slab or a
+ * message queue. Only one thread or ISR can produce, and only one can consume. The producer must
+ * lock the blocks in the order they were taken, and the consumer must free them in the order they
+ * were received. The producer can free the block it took last, instead of locking it.
+ */
+#define DATA_FIFO_SPSC_DEFINE(name, elements_max_in, block_size_max_in)                            \
+	char __aligned(WB_UP(                                                                      \
+		1)) _msgq_buffer_##name[(elements_max_in) * sizeof(struct data_fifo_msgq)] = {0};  \
+	char __aligned(WB_UP(1)) _slab_buffer_##name[(elements_max_in) * (block_size_max_in)] = {  \
+		0};                                                                                \
+	struct data_fifo name = {.msgq_buffer = _msgq_buffer_##name,                               \
+				 .slab_buffer = _slab_buffer_##name,                               \
+				 .block_size_max = block_size_max_in,                              \
+				 .elements_max = elements_max_in,                                  \
+				 .initialized = false,                                             \
+				 .spsc_mode = true}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 /**
  * @brief Get pointer to the first vacant block in slab.
  *
@@ -126,6 +171,71 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
  */
 void data_fifo_block_free(struct data_fifo *data_fifo, void *data);
 
+/**
+ * @brief Get pointers to several vacant blocks.
+ *
+ * Gives pointers to up to the given number of vacant blocks, and at least one if successful.
+ * The blocks are given in the order they must be locked in.
+ *
+ * @param data_fifo Pointer to the data_fifo structure.
+ * @param data Array of pointers to be set to the memory blocks.
+ * @param num Maximum number of blocks to get. Set to the number of blocks given on success.
+ * @param timeout Waiting period for the first block. Use K_NO_WAIT to return without waiting,
+ *	or K_FOREVER to wait as long as necessary.
+ *
+ * @retval 0		Memory allocated.
+ * @retval -EINVAL	The number of blocks is zero.
+ * @retval value	Return values from data_fifo_pointer_first_vacant_get.
+ */
+int data_fifo_pointers_first_vacant_get(struct data_fifo *data_fifo, void **data, uint32_t *num,
+					k_timeout_t timeout);
+
+/**
+ * @brief Confirm that the use of several memory blocks has finished, and put them into the
+ * message queue.
+ *
+ * In single-producer single-consumer mode, the blocks are made available to the consumer at once.
+ *
+ * @param data_fifo Pointer to the data_fifo structure.
+ * @param data Array of pointers to the memory blocks that have been written to.
+ * @param size Array of the number of bytes written to each block.
+ * @param num Number of blocks.
+ *
+ * @retval 0		Blocks have been submitted to the message queue.
+ * @retval value	Return values from data_fifo_block_lock. No block is submitted in
+ *			single-producer single-consumer mode, the blocks before the failing
+ *			one are submitted otherwise.
+ */
+int data_fifo_blocks_lock(struct data_fifo *data_fifo, void **data, size_t const *size,
+			  uint32_t num);
+
+/**
+ * @brief Get pointers to several filled blocks, oldest first.
+ *
+ * @param data_fifo Pointer to the data_fifo structure.
+ * @param data Array of pointers to be set to the blocks.
+ * @param size Array of the sizes in bytes of the stored data.
+ * @param num Maximum number of blocks to get. Set to the number of blocks given on success.
+ * @param timeout Waiting period for the first block. Use K_NO_WAIT to return without waiting,
+ *	or K_FOREVER to wait as long as necessary.
+ *
+ * @retval 0		Memory pointers retrieved.
+ * @retval -EINVAL	The number of blocks is zero.
+ * @retval value	Return values from data_fifo_pointer_last_filled_get.
+ */
+int data_fifo_pointers_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+				       uint32_t *num, k_timeout_t timeout);
+
+/**
+ * @brief Free several data blocks after reading.
+ *
+ * @param data_fifo Pointer to the data_fifo structure.
+ * @param data Array of pointers to the memory blocks to be freed, in the order they were
+ *	received.
+ * @param num Number of blocks.
+ */
+void data_fifo_blocks_free(struct data_fifo *data_fifo, void **data, uint32_t num);
+
 /**
  * @brief See how many alloced and locked blocks are in the system.
  *
@@ -15,12 +15,37 @@
 #define DFU_TARGET_MCUBOOT_H__
 
 #include <stddef.h>
+#include <stdint.h>
+#include <zephyr/toolchain.h>
+#include <zephyr/sys/util.h>
 #include <dfu/dfu_target.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Magic word of a compressed MCUboot image, "MBCZ" in little-endian byte order. */
+#define DFU_TARGET_MCUBOOT_COMPRESSED_MAGIC 0x5a43424d
+
+/** The ARM thumb filter was applied to the image before compression. */
+#define DFU_TARGET_MCUBOOT_COMPRESSED_FLAG_ARM_THUMB BIT(0)
+
+/**
+ * @brief Header of a compressed MCUboot image.
+ *
+ * The header is followed by the image compressed to an lzma2 stream in the nRF Compression
+ * library format. The image is decompressed while it is written, so the secondary slot holds
+ * the plain image. All fields are little-endian.
+ */
+struct dfu_target_mcuboot_compressed_header {
+	/** Must be #DFU_TARGET_MCUBOOT_COMPRESSED_MAGIC. */
+	uint32_t magic;
+	/** Size of the decompressed image. */
+	uint32_t image_size;
+	/** Bitmask of DFU_TARGET_MCUBOOT_COMPRESSED_FLAG_* flags. */
+	uint32_t flags;
+} __packed;
+
 /**
  * @brief Set buffer to use for flash write operations.
  *
@@ -31,6 +56,10 @@ int dfu_target_mcuboot_set_buf(uint8_t *buf, size_t len);
 /**
  * @brief See if data in buf indicates MCUBoot style upgrade.
  *
+ * If @kconfig{CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS} is enabled, compressed MCUboot images are
+ * identified as well, and the following call to @ref dfu_target_mcuboot_init prepares the
+ * decompression of the image.
+ *
  * @retval true if data matches, false otherwise.
  */
 bool dfu_target_mcuboot_identify(const void *const buf);
@@ -49,6 +78,11 @@ int dfu_target_mcuboot_init(size_t file_size, int img_num, dfu_target_callback_t
 /**
  * @brief Get offset of firmware
  *
+ * For compressed images, the offset is the amount of compressed data received since
+ * the initialization. A compressed image that was interrupted by a reset is downloaded again
+ * from the beginning, but the already written part of the decompressed image is not
+ * written again.
+ *
  * @param[out] offset Returns the offset of the firmware upgrade.
  *
  * @return 0 if success, otherwise negative value if unable to get the offset
@@ -33,6 +33,16 @@ extern "C" {
  */
 typedef void (*ei_wrapper_result_ready_cb)(int err);
 
+/**
+ * @typedef ei_wrapper_window_captured_cb
+ * @brief Callback executed by the wrapper in the pipelined mode, when the
+ *        input window has been taken out of the input buffer.
+ *
+ * The next prediction can be started from this callback, while the
+ * classifier still processes the captured window.
+ */
+typedef void (*ei_wrapper_window_captured_cb)(void);
+
 
 /** Check if classifier calculates anomaly value.
  *
@@ -95,6 +105,53 @@ const char *ei_wrapper_get_classifier_label(size_t idx);
  */
 int ei_wrapper_add_data(const float *data, size_t data_size);
 
+/** Add quantized 16-bit input data for the library.
+ *
+ * Size of the added data must be divisible by input frame size. Each value
+ * is multiplied by the data scale to get the input value of the classifier.
+ * If the data is stored as 16-bit integers, it is copied as is.
+ *
+ * @param[in] data       Pointer to the buffer with input data.
+ * @param[in] data_size  Size of the data (number of values).
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ * @retval -ENOTSUP If the data is stored as 8-bit integers.
+ */
+int ei_wrapper_add_data_int16(const int16_t *data, size_t data_size);
+
+/** Add quantized 8-bit input data for the library.
+ *
+ * Size of the added data must be divisible by input frame size. Each value
+ * is multiplied by the data scale to get the input value of the classifier.
+ * If the data is stored as 8-bit integers, it is copied as is.
+ *
+ * @param[in] data       Pointer to the buffer with input data.
+ * @param[in] data_size  Size of the data (number of values).
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int ei_wrapper_add_data_int8(const int8_t *data, size_t data_size);
+
+/** Set the scale of quantized input data.
+ *
+ * The scale is the input value of the classifier that corresponds to one
+ * step of the quantized data. It is used to convert the data added with
+ * @ref ei_wrapper_add_data_int16 or @ref ei_wrapper_add_data_int8 and, if
+ * the data is stored as integers, the data added with
+ * @ref ei_wrapper_add_data. The default scale is 1.
+ *
+ * The scale must be set before adding data, as the buffered data is not
+ * converted again.
+ *
+ * @param[in] scale  Value of one quantization step. Must be positive.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int ei_wrapper_set_data_scale(float scale);
+
 
 /** Clear all buffered data.
  *
@@ -189,6 +246,43 @@ int ei_wrapper_get_timing(int *dsp_time, int *classification_time,
 			  int *anomaly_time);
 
 
+/** Get time spent providing the input data to the classifier.
+ *
+ * This function can be executed only from the wrapper's callback context.
+ * Otherwise, it returns a (negative) error code.
+ *
+ * The time covers reading the input window from the wrapper's buffer, and
+ * converting it to floating-point values if it is stored as integers, for
+ * all the reads done by the classifier during the last prediction.
+ *
+ * @param[out] copy_time  Pointer to the variable that is used to store the
+ *                        copy time in microseconds.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int ei_wrapper_get_data_copy_time(int *copy_time);
+
+/** Set the callback executed when an input window is captured.
+ *
+ * The function is available only if the pipelined mode is enabled using
+ * the CONFIG_EI_WRAPPER_PIPELINE Kconfig option. In this mode, a capture
+ * thread takes each input window out of the input buffer as soon as it is
+ * complete, and the buffer is ready for the next prediction while the
+ * classifier runs. Up to CONFIG_EI_WRAPPER_PIPELINE_DEPTH captured windows
+ * wait for the classifier. Results are always reported in the order of the
+ * predictions, and the results of windows captured before the data is
+ * cleared are dropped.
+ *
+ * The callback must be set before the wrapper is initialized.
+ *
+ * @param[in] cb Callback, or NULL to remove it.
+ *
+ * @retval 0 If the operation was successful.
+ *           Otherwise, a (negative) error code is returned.
+ */
+int ei_wrapper_set_window_captured_cb(ei_wrapper_window_captured_cb cb);
+
 /** Initialize the Edge Impulse wrapper.
  *
  * @param[in] cb Callback used to receive results.
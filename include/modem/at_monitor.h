@@ -34,6 +34,32 @@ extern "C" {
  */
 typedef void (*at_monitor_handler_t)(const char *notif);
 
+#if defined(CONFIG_AT_MONITOR_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief AT monitor library statistics.
+ */
+struct at_monitor_stats {
+	/** Number of notifications dispatched in the workqueue. */
+	uint32_t dispatched;
+	/** Number of notifications dropped because the notification buffer was full. */
+	uint32_t dropped;
+	/** Highest number of bytes used in the notification buffer. */
+	uint32_t buf_used_peak;
+};
+
+/**
+ * @brief AT monitor statistics.
+ */
+struct at_monitor_entry_stats {
+	/** Number of notifications dispatched to the monitor in the workqueue. */
+	uint32_t dispatched;
+	/** Highest latency from reception of a notification to its dispatch, in microseconds. */
+	uint32_t latency_max_us;
+	/** Moving average of the dispatch latency, in microseconds. */
+	uint32_t latency_avg_us;
+};
+#endif /* CONFIG_AT_MONITOR_STATS */
+
 /**
  * @brief AT monitor entry.
  */
@@ -46,6 +72,16 @@ struct at_monitor_entry {
 		uint8_t paused : 1; /* Monitor is paused. */
 		uint8_t direct : 1; /* Dispatch in ISR. */
 	} flags;
+	/** @cond INTERNAL_HIDDEN */
+	/* Internal, do not use. Length of the filter, set at initialization. */
+	uint16_t filter_len;
+	/* Internal, do not use. Next monitor in the same match list. */
+	struct at_monitor_entry *next;
+	/** @endcond */
+#if defined(CONFIG_AT_MONITOR_STATS) || defined(__DOXYGEN__)
+	/** Monitor statistics. */
+	struct at_monitor_entry_stats stats;
+#endif
 };
 
 /** Wildcard. Match any notifications. */
@@ -117,6 +153,22 @@ static inline void at_monitor_resume(struct at_monitor_entry *mon)
 	mon->flags.paused = false;
 }
 
+#if defined(CONFIG_AT_MONITOR_STATS) || defined(__DOXYGEN__)
+/**
+ * @brief Get the AT monitor library statistics.
+ *
+ * Statistics of each monitor are found in the @c stats field of the monitor.
+ *
+ * @param[out] stats Copy of the library statistics.
+ */
+void at_monitor_stats_get(struct at_monitor_stats *stats);
+
+/**
+ * @brief Reset the statistics of the AT monitor library and of all monitors.
+ */
+void at_monitor_stats_reset(void);
+#endif /* CONFIG_AT_MONITOR_STATS */
+
 /** @} */
 
 #ifdef __cplusplus
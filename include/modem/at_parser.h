@@ -8,7 +8,9 @@
 #define AT_PARSER_H__
 
 #include <stdbool.h>
+#include <stddef.h>
 #include <zephyr/types.h>
+#include <zephyr/toolchain.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -55,6 +57,213 @@ struct at_parser {
 	uint32_t init_sentinel;
 };
 
+/** @brief Types of the fields decoded by @ref at_parser_decode. */
+enum at_parser_field_type {
+	/** Signed 16-bit integer. */
+	AT_PARSER_FIELD_TYPE_INT16,
+	/** Unsigned 16-bit integer. */
+	AT_PARSER_FIELD_TYPE_UINT16,
+	/** Signed 32-bit integer. */
+	AT_PARSER_FIELD_TYPE_INT32,
+	/** Unsigned 32-bit integer. */
+	AT_PARSER_FIELD_TYPE_UINT32,
+	/** Signed 64-bit integer. */
+	AT_PARSER_FIELD_TYPE_INT64,
+	/** Unsigned 64-bit integer. */
+	AT_PARSER_FIELD_TYPE_UINT64,
+	/** String copied to a character array and null-terminated. */
+	AT_PARSER_FIELD_TYPE_STRING,
+	/** Pointer to a string in the AT command string, see @ref at_parser_str. */
+	AT_PARSER_FIELD_TYPE_STRING_PTR,
+	/** Quoted hexadecimal string converted to an unsigned integer. */
+	AT_PARSER_FIELD_TYPE_HEX,
+	/** Subparameter that is not decoded. */
+	AT_PARSER_FIELD_TYPE_SKIP,
+	/** Group of subparameters repeated until the end of the AT command line. */
+	AT_PARSER_FIELD_TYPE_GROUP,
+};
+
+/** The field can be empty or absent. The destination is left untouched in that case. */
+#define AT_PARSER_FIELD_FLAG_OPTIONAL 0x01
+/** A subparameter that cannot be decoded into the field is treated as absent. */
+#define AT_PARSER_FIELD_FLAG_LENIENT  0x02
+
+/** @brief String decoded without copying. */
+struct at_parser_str {
+	/** Pointer to the string in the AT command string. Not null-terminated. */
+	const char *ptr;
+	/** Length of the string. */
+	size_t len;
+};
+
+/**
+ * @brief Description of one subparameter in an AT command line.
+ *
+ * Use the @c AT_PARSER_FIELD macros to define fields.
+ */
+struct at_parser_field {
+	/** Field type, see @ref at_parser_field_type. */
+	uint8_t type;
+	/** Field flags. */
+	uint8_t flags;
+	/** Offset of the destination in the output structure. */
+	uint16_t offset;
+	/** Size of the destination, or size of one group element. */
+	uint16_t size;
+	/** Maximum number of group elements. */
+	uint16_t max;
+	/** Offset of the group element count in the output structure. */
+	uint16_t count_offset;
+	/** Size of the group element count. */
+	uint8_t count_size;
+	/** Number of fields in a group element. */
+	uint8_t fields_count;
+	/** Fields of a group element. */
+	const struct at_parser_field *fields;
+};
+
+/** @brief Schema of an AT command line, decoded by @ref at_parser_decode. */
+struct at_parser_schema {
+	/** Fields, in the order of the subparameters following the command prefix. */
+	const struct at_parser_field *fields;
+	/** Number of fields. */
+	size_t fields_count;
+};
+
+/** @cond INTERNAL_HIDDEN */
+#define AT_PARSER_MEMBER(_struct, _member) (((_struct *)0)->_member)
+
+#define AT_PARSER_FIELD_TYPE_OF(_struct, _member)                                                  \
+	_Generic(AT_PARSER_MEMBER(_struct, _member),                                               \
+		int16_t : AT_PARSER_FIELD_TYPE_INT16,                                              \
+		uint16_t : AT_PARSER_FIELD_TYPE_UINT16,                                            \
+		int32_t : AT_PARSER_FIELD_TYPE_INT32,                                              \
+		uint32_t : AT_PARSER_FIELD_TYPE_UINT32,                                            \
+		int64_t : AT_PARSER_FIELD_TYPE_INT64,                                              \
+		uint64_t : AT_PARSER_FIELD_TYPE_UINT64,                                            \
+		char * : AT_PARSER_FIELD_TYPE_STRING,                                              \
+		struct at_parser_str : AT_PARSER_FIELD_TYPE_STRING_PTR)
+
+#define AT_PARSER_FIELD_INIT(_type, _flags, _struct, _member)                                      \
+	{                                                                                          \
+		.type = (_type),                                                                   \
+		.flags = (_flags),                                                                 \
+		.offset = offsetof(_struct, _member),                                              \
+		.size = sizeof(AT_PARSER_MEMBER(_struct, _member)),                                \
+	}
+/** @endcond */
+
+/**
+ * @brief Define a field decoded into @p _member of @p _struct.
+ *
+ * The field type is selected from the type of @p _member, which can be a fixed-width integer,
+ * a character array, or a @ref at_parser_str.
+ *
+ * @param _struct Output structure type.
+ * @param _member Member of the output structure.
+ */
+#define AT_PARSER_FIELD(_struct, _member)                                                          \
+	AT_PARSER_FIELD_INIT(AT_PARSER_FIELD_TYPE_OF(_struct, _member), 0, _struct, _member)
+
+/**
+ * @brief Define an optional field decoded into @p _member of @p _struct.
+ *
+ * @p _member is left untouched if the subparameter is empty or absent.
+ *
+ * @param _struct Output structure type.
+ * @param _member Member of the output structure.
+ */
+#define AT_PARSER_FIELD_OPTIONAL(_struct, _member)                                                 \
+	AT_PARSER_FIELD_INIT(AT_PARSER_FIELD_TYPE_OF(_struct, _member),                            \
+			     AT_PARSER_FIELD_FLAG_OPTIONAL, _struct, _member)
+
+/**
+ * @brief Define an optional field holding a quoted hexadecimal string, such as a cell ID.
+ *
+ * The value is converted and stored in the unsigned integer @p _member of @p _struct.
+ *
+ * @param _struct Output structure type.
+ * @param _member Member of the output structure.
+ */
+#define AT_PARSER_FIELD_HEX_OPTIONAL(_struct, _member)                                             \
+	AT_PARSER_FIELD_INIT(AT_PARSER_FIELD_TYPE_HEX, AT_PARSER_FIELD_FLAG_OPTIONAL, _struct,     \
+			     _member)
+
+/**
+ * @brief Define an optional field decoded into @p _member of @p _struct, ignoring invalid values.
+ *
+ * @p _member is left untouched if the subparameter is empty, absent, or cannot be decoded into
+ * it, for example because a string is too long or a number is out of range.
+ *
+ * @param _struct Output structure type.
+ * @param _member Member of the output structure.
+ */
+#define AT_PARSER_FIELD_LENIENT(_struct, _member)                                                  \
+	AT_PARSER_FIELD_INIT(AT_PARSER_FIELD_TYPE_OF(_struct, _member),                            \
+			     AT_PARSER_FIELD_FLAG_OPTIONAL | AT_PARSER_FIELD_FLAG_LENIENT,         \
+			     _struct, _member)
+
+/**
+ * @brief Define an optional hexadecimal string field, ignoring invalid values.
+ *
+ * Same as @ref AT_PARSER_FIELD_HEX_OPTIONAL, except that @p _member is also left untouched if
+ * the subparameter is not a valid hexadecimal string or does not fit in @p _member.
+ *
+ * @param _struct Output structure type.
+ * @param _member Member of the output structure.
+ */
+#define AT_PARSER_FIELD_HEX_LENIENT(_struct, _member)                                              \
+	AT_PARSER_FIELD_INIT(AT_PARSER_FIELD_TYPE_HEX,                                             \
+			     AT_PARSER_FIELD_FLAG_OPTIONAL | AT_PARSER_FIELD_FLAG_LENIENT,         \
+			     _struct, _member)
+
+/** @brief Define a field for a subparameter that is not decoded. */
+#define AT_PARSER_FIELD_SKIP                                                                       \
+	{                                                                                          \
+		.type = AT_PARSER_FIELD_TYPE_SKIP, .flags = AT_PARSER_FIELD_FLAG_OPTIONAL,         \
+	}
+
+/**
+ * @brief Define a group of fields repeated until the end of the AT command line.
+ *
+ * Each repetition is decoded into the next element of the array @p _array of @p _struct, using
+ * the fields of the schema @p _schema. The number of decoded elements is stored in @p _count.
+ * A group must be the last field of a schema and cannot contain another group.
+ *
+ * @param _struct Output structure type.
+ * @param _array  Array member of the output structure.
+ * @param _count  Unsigned integer member of the output structure for the element count.
+ * @param _schema Schema of one element, defined with @ref AT_PARSER_SCHEMA_DEFINE.
+ */
+#define AT_PARSER_FIELD_GROUP(_struct, _array, _count, _schema)                                    \
+	{                                                                                          \
+		.type = AT_PARSER_FIELD_TYPE_GROUP,                                                \
+		.flags = AT_PARSER_FIELD_FLAG_OPTIONAL,                                            \
+		.offset = offsetof(_struct, _array),                                               \
+		.size = sizeof(AT_PARSER_MEMBER(_struct, _array)[0]),                              \
+		.max = sizeof(AT_PARSER_MEMBER(_struct, _array)) /                                 \
+		       sizeof(AT_PARSER_MEMBER(_struct, _array)[0]),                               \
+		.count_offset = offsetof(_struct, _count),                                         \
+		.count_size = sizeof(AT_PARSER_MEMBER(_struct, _count)),                           \
+		.fields_count = sizeof(_schema##_fields) / sizeof(_schema##_fields[0]),            \
+		.fields = _schema##_fields,                                                        \
+	}
+
+/**
+ * @brief Define a schema for @ref at_parser_decode.
+ *
+ * A schema used only as the element of a group does not need to be referenced otherwise.
+ *
+ * @param _name Schema name.
+ * @param ...   Fields, in the order of the subparameters following the command prefix.
+ */
+#define AT_PARSER_SCHEMA_DEFINE(_name, ...)                                                        \
+	static const struct at_parser_field _name##_fields[] = {__VA_ARGS__};                      \
+	static const struct at_parser_schema _name __maybe_unused = {                              \
+		.fields = _name##_fields,                                                          \
+		.fields_count = sizeof(_name##_fields) / sizeof(_name##_fields[0]),                \
+	}
+
 /**
  * @brief Type-generic macro for getting an integer value.
  *
@@ -347,6 +556,36 @@ int at_parser_string_get(struct at_parser *parser, size_t index, char *str, size
 int at_parser_string_ptr_get(struct at_parser *parser, size_t index, const char **str_ptr,
 			     size_t *len);
 
+/**
+ * @brief Decode the current AT command line into a structure in a single pass.
+ *
+ * The subparameters following the command prefix are decoded in order, as described by
+ * @p schema, and written to @p out. Each subparameter is tokenized once, so the cost of decoding
+ * grows linearly with the length of the AT command line.
+ *
+ * Optional fields that are empty or absent leave their destination untouched, so @p out should
+ * be initialized with default values. Lenient fields also leave their destination untouched when
+ * the subparameter cannot be decoded into it. Subparameters beyond the last field are ignored.
+ *
+ * @param[in]  parser AT parser.
+ * @param[in]  schema Schema of the AT command line.
+ * @param[out] out    Output structure.
+ *
+ * @return Number of fields present in the AT command line, including empty optional fields,
+ *         if the operation was successful.
+ *         Otherwise, a (negative) error code is returned.
+ * @retval -EINVAL     One or more of the supplied parameters are invalid.
+ * @retval -EPERM      @p parser has not been initialized.
+ * @retval -EOPNOTSUPP The type of a subparameter does not match its field.
+ * @retval -ENODATA    A field that is not optional is empty or absent.
+ * @retval -ERANGE     Parsed integer value is out of range for its field.
+ * @retval -ENOMEM     A string does not fit in its field.
+ * @retval -E2BIG      A group has more elements than its array can hold. The output is filled
+ *                     with the elements that fit.
+ * @retval -EBADMSG    The AT command string is malformed.
+ */
+int at_parser_decode(struct at_parser *parser, const struct at_parser_schema *schema, void *out);
+
 /** @} */
 
 #ifdef __cplusplus
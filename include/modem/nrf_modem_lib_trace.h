@@ -114,6 +114,52 @@ int nrf_modem_lib_trace_clear(void);
 uint32_t nrf_modem_lib_trace_backend_bitrate_get(void);
 #endif /* defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_BITRATE) || defined(__DOXYGEN__) */
 
+/** @brief Trace backend storage statistics. */
+struct nrf_modem_lib_trace_backend_stats {
+	/** Number of trace bytes stored by the backend. */
+	uint64_t bytes_in;
+	/** Number of bytes written to the storage, after compression. */
+	uint64_t bytes_out;
+};
+
+/** @brief Get the storage statistics of the trace backend.
+ *
+ * The ratio between the two values is the compression ratio of the backend.
+ *
+ * @note This operation is only supported with some trace backends. If not supported, the function
+ *       returns -ENOTSUP.
+ *
+ * @param[out] stats Statistics of the trace backend.
+ *
+ * @return 0 on success, negative errno on failure.
+ */
+int nrf_modem_lib_trace_backend_stats_get(struct nrf_modem_lib_trace_backend_stats *stats);
+
+/** @brief Trace pipeline statistics, for trace backends with asynchronous writes. */
+struct nrf_modem_lib_trace_pipeline_stats {
+	/** Number of times the trace thread waited for the backend queue to have space. */
+	uint32_t backpressure_count;
+	/** Total time the trace thread waited for the backend queue to have space, in ms. */
+	uint32_t backpressure_ms;
+	/** Number of trace bytes released to the modem without being written by the backend. */
+	uint32_t dropped_bytes;
+	/** Number of trace bytes queued in the backend. */
+	uint32_t queued_bytes;
+	/** Largest number of trace bytes queued in the backend. */
+	uint32_t queued_bytes_max;
+};
+
+/** @brief Get the trace pipeline statistics.
+ *
+ * @note This operation is only supported with trace backends that implement asynchronous
+ *       writes. If not supported, the function returns -ENOTSUP.
+ *
+ * @param[out] stats Statistics of the trace pipeline.
+ *
+ * @return 0 on success, negative errno on failure.
+ */
+int nrf_modem_lib_trace_pipeline_stats_get(struct nrf_modem_lib_trace_pipeline_stats *stats);
+
 /** @} */
 
 #ifdef __cplusplus
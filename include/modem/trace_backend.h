@@ -23,6 +23,20 @@ extern "C" {
  */
 typedef int (*trace_backend_processed_cb)(size_t len);
 
+/** @brief callback to signal the trace module that some amount of the trace data queued
+ * with an asynchronous write has been processed.
+ *
+ * The trace data is processed in the order it was queued. The callback can be called
+ * from an interrupt.
+ *
+ * @param len Number of bytes processed.
+ * @param err 0 if the bytes were written, or a (negative) error code if they were dropped.
+ */
+typedef void (*trace_backend_write_done_cb)(size_t len, int err);
+
+struct nrf_modem_lib_trace_backend_stats;
+struct nrf_modem_trace_data;
+
 /**
  * @brief The trace backend interface, implemented by the trace backend.
  */
@@ -66,6 +80,32 @@ struct nrf_modem_lib_trace_backend {
 	 */
 	int (*write)(const void *data, size_t len);
 
+	/**
+	 * @brief Queue trace data for an asynchronous write to the compile-time selected trace
+	 *        backend.
+	 *
+	 * The backend writes the fragments in order, directly from the modem shared memory, and
+	 * reports the processed trace data with @p done_cb. The trace data is released to the
+	 * modem only when it is reported as processed.
+	 * When this operation is implemented, it is used instead of @c write.
+	 *
+	 * @note Set to @c NULL if this operation is not supported by the trace backend.
+	 *
+	 * @param frags   Scatter-gather list of trace fragments. The list is only valid during the
+	 *                call, the backend must copy the fragment descriptors it queues.
+	 * @param n_frags Number of fragments in the list.
+	 * @param done_cb Function to call when queued trace data has been processed.
+	 *
+	 * @returns Number of fragments queued if the operation was successful, which can be less
+	 *          than @p n_frags if the backend queue is full.
+	 *          Otherwise, a (negative) error code is returned.
+	 *          Especially,
+	 *          -EAGAIN if the backend queue is full. The trace module waits for queued trace
+	 *                  data to be processed and retries the operation.
+	 */
+	int (*write_async)(const struct nrf_modem_trace_data *frags, size_t n_frags,
+			   trace_backend_write_done_cb done_cb);
+
 	/**
 	 * @brief Get the number of bytes stored in the compile-time selected trace backend.
 	 *
@@ -125,6 +165,17 @@ struct nrf_modem_lib_trace_backend {
 	 * @return 0 on success, negative errno on failure.
 	 */
 	int (*resume)(void);
+
+	/**
+	 * @brief Get the storage statistics of the trace backend.
+	 *
+	 * @note Set to @c NULL if this operation is not supported by the trace backend.
+	 *
+	 * @param stats Statistics of the trace backend.
+	 *
+	 * @return 0 on success, negative errno on failure.
+	 */
+	int (*stats_get)(struct nrf_modem_lib_trace_backend_stats *stats);
 };
 
 /**@} */ /* defgroup trace_backend */
@@ -57,6 +57,9 @@ enum downloader_evt_id {
 	 * - -EHOSTUNREACH: Failed to resolve the target address.
 	 * - -EMSGSIZE: TLS packet is larger than the nRF91 Modem can handle.
 	 * - -EMLINK: Maximum number of redirects reached.
+	 * - -ESTALE: The file has changed on the server since the download was resumed.
+	 *   The progress is reset and the download restarts from the beginning.
+	 *   The application must discard the data it has stored so far.
 	 *
 	 * In case of @c ECONNRESET errors, returning zero from the callback will let the
 	 * library attempt to reconnect to the server and download the last fragment again.
@@ -139,6 +142,13 @@ struct downloader_cfg {
 	char *buf;
 	/** Downloader buffer size. */
 	size_t buf_size;
+	/**
+	 * Name of the resume store record of this instance.
+	 * Instances that use the resume store must have different names.
+	 * Use NULL for the default name.
+	 * Requires @kconfig{CONFIG_DOWNLOADER_RESUME}.
+	 */
+	const char *resume_name;
 };
 
 /**
@@ -202,6 +212,15 @@ struct downloader_host_cfg {
 	 * Use 0 to set the value of CONFIG_DOWNLOADER_MAX_REDIRECTS.
 	 */
 	uint8_t redirects_max;
+	/**
+	 * Resume the download from the resume store.
+	 * The progress is persisted through settings, in the record of the downloader instance,
+	 * and the download continues from the stored offset if the URL matches the stored one,
+	 * otherwise it starts from the beginning. The offset given to @ref downloader_get() is
+	 * ignored.
+	 * Requires @kconfig{CONFIG_DOWNLOADER_RESUME}.
+	 */
+	bool resume;
 };
 
 /**
@@ -247,6 +266,10 @@ struct downloader {
 	const struct dl_transport *transport;
 	/** Transport parameters. */
 	uint8_t transport_internal[CONFIG_DOWNLOADER_TRANSPORT_PARAMS_SIZE];
+#if defined(CONFIG_DOWNLOADER_RESUME) || defined(__DOXYGEN__)
+	/** Resume store state. */
+	uint8_t resume_internal[CONFIG_DOWNLOADER_RESUME_STATE_SIZE] __aligned(4);
+#endif
 
 	/** Ensure that thread is ready for download. */
 	struct k_sem event_sem;
@@ -365,6 +388,48 @@ int downloader_file_size_get(struct downloader *dl, size_t *size);
  */
 int downloader_downloaded_size_get(struct downloader *dl, size_t *size);
 
+/**
+ * @brief Retrieve the offset stored in the resume store for a URL.
+ *
+ * Use this before starting a download with @c downloader_host_cfg.resume set,
+ * to know from which offset the application will receive data.
+ *
+ * @param[in]  dl	Downloader instance.
+ * @param[in]  url	URL of the file, as given to @ref downloader_get().
+ * @param[out] offset	Number of bytes already downloaded and accepted by the application.
+ *
+ * @retval 0 On success.
+ * @retval -ENOENT If there is no valid record for this URL.
+ * @return A negative error code on other failures.
+ */
+int downloader_resume_offset_get(struct downloader *dl, const char *url, size_t *offset);
+
+/**
+ * @brief Remove the record of a downloader instance from the resume store.
+ *
+ * The next download started with @c downloader_host_cfg.resume set starts from the beginning.
+ *
+ * @param[in] dl	Downloader instance.
+ *
+ * @return Zero on success, a negative error code otherwise.
+ */
+int downloader_resume_clear(struct downloader *dl);
+
+/**
+ * @brief Retrieve the SHA-256 digest of a file downloaded with the resume store.
+ *
+ * The digest covers the whole file, including the bytes downloaded before a restart.
+ * It is available once the @c DOWNLOADER_EVT_DONE event has been received.
+ *
+ * @param[in]  dl	Downloader instance.
+ * @param[out] digest	SHA-256 digest.
+ *
+ * @retval 0 On success.
+ * @retval -ENODATA If the download is not complete or was not started with the resume flag.
+ * @retval -EINVAL If a parameter is NULL.
+ */
+int downloader_resume_sha256_get(struct downloader *dl, uint8_t digest[32]);
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,6 +24,11 @@
 struct downloader_transport_http_cfg {
 	/** Socket receive timeout in milliseconds */
 	uint32_t sock_recv_timeo_ms;
+	/**
+	 * Number of range requests sent ahead on the connection, before their responses are
+	 * received. Zero uses @kconfig{CONFIG_DOWNLOADER_TRANSPORT_HTTP_PIPELINE_DEPTH}.
+	 */
+	uint8_t pipeline_depth;
 };
 
 /**
@@ -178,6 +178,10 @@ int nrf_cloud_coap_pgps_url_get(struct nrf_cloud_rest_pgps_request const *const
  *  The sensor message is sent either as a non-confirmable or confirmable CoAP message.
  *  Use non-confirmable when sending low priority information for which some data loss is
  *  acceptable.
+ *  If CONFIG_NRF_CLOUD_COAP_SENSOR_BATCH is enabled, non-confirmable values are collected
+ *  and sent together in one message once the next value would not fit in a single CoAP block.
+ *  If sending the collected values fails, the error is returned, and the new value is
+ *  collected for the next message.
  *
  * @param[in]     app_id The app ID identifying the type of data. See the values
  *                       that begin with NRF_CLOUD_JSON_APPID_ in nrf_cloud_defs.h. You may
@@ -194,6 +198,20 @@ int nrf_cloud_coap_pgps_url_get(struct nrf_cloud_rest_pgps_request const *const
  */
 int nrf_cloud_coap_sensor_send(const char *app_id, double value, int64_t ts_ms, bool confirmable);
 
+/**
+ * @brief Send the sensor values collected by nrf_cloud_coap_sensor_send() to nRF Cloud.
+ *
+ *  Requires CONFIG_NRF_CLOUD_COAP_SENSOR_BATCH. The values are sent as one bulk JSON
+ *  message in a non-confirmable CoAP message. Nothing is sent if no values are collected.
+ *
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @return 0 If successful, nonzero if failed.
+ *           Negative values are device-side errors defined in errno.h.
+ *           Positive values are cloud-side errors (CoAP result codes)
+ *           defined in zephyr/net/coap.h.
+ */
+int nrf_cloud_coap_sensor_batch_flush(void);
+
 /**
  * @brief Send a message to nRF Cloud.
  *
@@ -454,6 +472,65 @@ int nrf_cloud_coap_bytes_send(uint8_t *buf, size_t buf_len, bool confirmable);
  */
 int nrf_cloud_coap_obj_send(struct nrf_cloud_obj *const obj, bool confirmable);
 
+/** @brief Statistics of the telemetry queue. */
+struct nrf_cloud_coap_telemetry_stats {
+	/** Samples added to the queue */
+	uint32_t samples;
+	/** Samples received by nRF Cloud */
+	uint32_t samples_sent;
+	/** Samples lost because the queue was full or nRF Cloud rejected the message */
+	uint32_t samples_dropped;
+	/** Messages received by nRF Cloud */
+	uint32_t uplinks;
+	/** Payload bytes received by nRF Cloud */
+	uint32_t bytes_sent;
+	/** Average payload size of a message */
+	uint32_t bytes_per_uplink;
+	/** Messages saved by sending the samples together instead of one by one */
+	uint32_t uplinks_avoided;
+};
+
+/**
+ * @brief Add a sensor value to the telemetry queue.
+ *
+ *  Requires CONFIG_NRF_CLOUD_COAP_TELEMETRY. The value is stored in the queue and sent to
+ *  nRF Cloud later, together with the other queued values, in one bulk message.
+ *  The queue is sent when it holds CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_THRESHOLD bytes,
+ *  CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_TIMEOUT_S seconds after the oldest value was added,
+ *  or, if CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_ON_RRC is enabled, when the LTE RRC
+ *  connection is set up for other traffic.
+ *
+ * @param[in]     app_id The app ID identifying the type of data, at most 255 characters.
+ * @param[in]     value  Sensor reading.
+ * @param[in]     ts_ms  Timestamp the data was measured, or NRF_CLOUD_NO_TIMESTAMP to use
+ *                       the current time.
+ *
+ * @retval -EINVAL The app ID is empty or too long.
+ * @retval -ENOMEM The queue is full; the value is dropped.
+ * @retval 0 If successful.
+ */
+int nrf_cloud_coap_telemetry_add(const char *app_id, double value, int64_t ts_ms);
+
+/**
+ * @brief Send the values in the telemetry queue to nRF Cloud without waiting for a trigger.
+ *
+ *  Requires CONFIG_NRF_CLOUD_COAP_TELEMETRY. The values are sent from the system workqueue,
+ *  so the function returns before they have been received by nRF Cloud.
+ *
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @retval 0 If successful.
+ */
+int nrf_cloud_coap_telemetry_flush(void);
+
+/**
+ * @brief Get the statistics of the telemetry queue.
+ *
+ *  Requires CONFIG_NRF_CLOUD_COAP_TELEMETRY.
+ *
+ * @param[out]    stats  Statistics since boot.
+ */
+void nrf_cloud_coap_telemetry_stats_get(struct nrf_cloud_coap_telemetry_stats *const stats);
+
 /** @} */
 
 #ifdef __cplusplus
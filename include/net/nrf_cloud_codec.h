@@ -39,6 +39,10 @@ enum nrf_cloud_obj_type {
 	 *  using the corresponding field in the union in struct nrf_cloud_obj_coap_cbor.
 	 */
 	NRF_CLOUD_OBJ_TYPE_COAP_CBOR,
+	/** This object type writes JSON directly to a caller-provided buffer as items are added,
+	 *  without allocating memory. Use @ref NRF_CLOUD_OBJ_JSON_WRITER_DEFINE to define it.
+	 */
+	NRF_CLOUD_OBJ_TYPE_JSON_WRITER,
 
 	NRF_CLOUD_OBJ_TYPE__LAST,
 };
@@ -80,6 +84,33 @@ struct nrf_cloud_obj_coap_cbor {
 	int64_t ts;
 };
 
+/** @brief Maximum nesting depth of objects and arrays in a JSON writer object. */
+#define NRF_CLOUD_OBJ_JSON_WRITER_DEPTH_MAX 8
+
+/** @brief State of an nRF Cloud JSON writer object.
+ *
+ * Items are written to the buffer in the order they are added, so all items added with
+ * data_child set must be added one after the other.
+ */
+struct nrf_cloud_obj_json_writer {
+	/** Buffer for the JSON text */
+	char *buf;
+	/** Size of the buffer */
+	size_t size;
+	/** Length of the JSON text written so far */
+	size_t len;
+	/** Number of open objects and arrays */
+	uint8_t depth;
+	/** Bit n is set if the container at depth n + 1 is an array */
+	uint8_t array_mask;
+	/** Bit n is set if the container at depth n + 1 contains items */
+	uint8_t item_mask;
+	/** The "data" child object is open */
+	bool data_open;
+	/** The "data" child object has been closed and cannot be added to */
+	bool data_closed;
+};
+
 /** @brief Object used for building nRF Cloud messages. */
 struct nrf_cloud_obj {
 
@@ -87,6 +118,7 @@ struct nrf_cloud_obj {
 	union {
 		cJSON *json;
 		struct nrf_cloud_obj_coap_cbor *coap_cbor;
+		struct nrf_cloud_obj_json_writer *writer;
 	};
 
 	/** Source of encoded data */
@@ -192,6 +224,24 @@ struct nrf_cloud_obj_shadow_data {
 				       .enc_src = NRF_CLOUD_ENC_SRC_NONE, \
 				       .encoded_data = { .ptr = NULL, .len = 0 } }
 
+/** @brief Define an nRF Cloud JSON writer object.
+ *
+ * This macro defines a codec object with the type of NRF_CLOUD_OBJ_TYPE_JSON_WRITER
+ * and its writer state. No memory is allocated when building or encoding the object;
+ * @ref nrf_cloud_obj_cloud_encode sets the encoded data to point to the provided buffer.
+ *
+ * @param _name	Name of the object.
+ * @param _buf	Buffer for the JSON text; must be valid for the life of the object.
+ * @param _size	Size of the buffer.
+ */
+#define NRF_CLOUD_OBJ_JSON_WRITER_DEFINE(_name, _buf, _size) \
+	struct nrf_cloud_obj_json_writer _name##_json_writer = { .buf = (_buf), \
+								 .size = (_size) }; \
+	struct nrf_cloud_obj _name = { .type = NRF_CLOUD_OBJ_TYPE_JSON_WRITER, \
+				       .writer = &_name##_json_writer, \
+				       .enc_src = NRF_CLOUD_ENC_SRC_NONE, \
+				       .encoded_data = { .ptr = NULL, .len = 0 } }
+
 /** @brief Define an nRF Cloud codec object of the specified type.
  *
  * @param _name	Name of the object.
@@ -529,6 +579,8 @@ int nrf_cloud_obj_null_add(struct nrf_cloud_obj *const obj, const char *const ke
  *
  * @details If successful, obj_to_add will be reset with @ref nrf_cloud_obj_reset
  *          since its data has been moved to obj.
+ *          If obj is a JSON writer object, obj_to_add must also be a JSON writer object;
+ *          its JSON text is copied to obj.
  *
  * @param[out] obj Object to contain key and object.
  * @param[in] key Key string; must be valid and constant for the life of the object.
@@ -591,6 +643,8 @@ int nrf_cloud_obj_str_array_add(struct nrf_cloud_obj *const obj, const char *con
  * @details If successful, memory is allocated for the encoded data.
  *          The @ref nrf_cloud_obj_cloud_encoded_free function should
  *          be called when finished with the object.
+ *          For a JSON writer object, the open objects and arrays are closed and the encoded
+ *          data points to the object's buffer; no memory is allocated.
  *
  * @param[out] obj Object to encode.
  *
@@ -75,16 +75,34 @@ typedef int (*nrf_compress_deinit_func_t)(void *inst);
 typedef int (*nrf_compress_reset_func_t)(void *inst, size_t decompressed_size);
 
 /**
- * @typedef		nrf_compress_compress_func_t
- * @brief		Placeholder function for future use, do not use.
+ * @typedef			nrf_compress_compress_func_t
+ * @brief			Compress portion of data. This function will need to be called one
+ *				or more times with the data to compress it into its compressed form.
  *
- * @param[in] inst	Implementation specific initialization context.
- *			Concrete implementation may cast it to predefined type.
+ * @param[in] inst		Implementation specific initialization context.
+ *				Concrete implementation may cast it to predefined type.
+ * @param[in] input		Input data buffer, containing the data to compress. Can be NULL if
+ *				@p input_size is 0.
+ * @param[in] input_size	Size of the input data buffer.
+ * @param[in] last_part		Last part of data. This should be set to true if this is the final
+ *				part of the input data. Implementations may hold back output until
+ *				then, so the function must be called again, with the input data
+ *				that was not used yet, until it returns no output.
+ * @param[out] offset		Input data offset pointer. This will be updated with the amount of
+ *				bytes used from the input buffer. The next call to this function
+ *				should be offset the input data buffer by this amount of bytes.
+ * @param[out] output		Output data buffer pointer to pointer. This will be set to the
+ *				compression's output buffer when compressed data is available to
+ *				be used or copied. The buffer is valid until the next call.
+ * @param[out] output_size	Size of data in output data buffer pointer. Data should only be
+ *				read when the value in this pointer is greater than 0.
  *
- * @retval		0 Success.
- * @retval		-errno Negative errno code on other failure.
+ * @retval			0 Success.
+ * @retval			-errno Negative errno code on other failure.
  */
-typedef int (*nrf_compress_compress_func_t)(void *inst);
+typedef int (*nrf_compress_compress_func_t)(void *inst, const uint8_t *input, size_t input_size,
+					    bool last_part, uint32_t *offset, uint8_t **output,
+					    size_t *output_size);
 
 /**
  * @brief		Return chunk size of data to provide to next call of
@@ -141,6 +159,9 @@ enum nrf_compress_types {
 	/** ARM thumb filter */
 	NRF_COMPRESS_TYPE_ARM_THUMB,
 
+	/** LZ encoder, the output is decompressed with #NRF_COMPRESS_TYPE_LZMA (lzma2) */
+	NRF_COMPRESS_TYPE_LZ,
+
 	/** Marks end/count of nRF supported filters */
 	NRF_COMPRESS_TYPE_COUNT,
 
@@ -21,6 +21,12 @@
  * @{
  */
 
+/** Gain value that leaves an input of pcm_mix_multi unchanged (Q16.16 fixed point). */
+#define PCM_MIX_GAIN_UNITY (1UL << 16)
+
+/** Largest accepted gain value for an input of pcm_mix_multi. */
+#define PCM_MIX_GAIN_MAX (INT32_MAX)
+
 enum pcm_mix_mode {
 	B_STEREO_INTO_A_STEREO,
 	B_MONO_INTO_A_MONO,
@@ -52,6 +58,44 @@ enum pcm_mix_mode {
 int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t size_b,
 	    enum pcm_mix_mode mix_mode);
 
+/**
+ * @brief Input descriptor for pcm_mix_multi.
+ */
+struct pcm_mix_input {
+	/** Pointer to the PCM data of the input. A NULL input is skipped. */
+	void const *pcm;
+
+	/** Gain applied to the input, in Q16.16 fixed point. */
+	uint32_t gain;
+};
+
+/**
+ * @brief Mixes N buffers of PCM data into one output buffer in a single pass.
+ *
+ * @note Each input is scaled by its gain and saturated to the sample range,
+ * and then added to the output using a saturating add. The inputs are
+ * accumulated in array order. All inputs must have the same channel layout
+ * and length as the output buffer. The output buffer may be one of the inputs.
+ * Where the core supports the DSP extension, the 16-bit path processes two
+ * samples per instruction using packed saturating arithmetic.
+ *
+ * 16-bit samples are stored as int16_t, while 24-bit and 32-bit samples are
+ * stored in int32_t carriers.
+ *
+ * @param pcm_out       [out] Pointer to the PCM output buffer.
+ * @param size          [in]  Size of the PCM output buffer and each input (in bytes).
+ * @param inputs        [in]  Array of input descriptors.
+ * @param num_inputs    [in]  Number of input descriptors. Zero gives a silent output.
+ * @param pcm_bit_depth [in]  Bit depth of the PCM samples (16, 24 or 32).
+ *
+ * @retval 0            Success. Result stored in pcm_out.
+ * @retval -EINVAL      pcm_out is NULL, size is zero or not a multiple of the
+ *			carrier size, inputs is NULL while num_inputs is nonzero,
+ *			a gain is larger than PCM_MIX_GAIN_MAX or the bit depth is invalid.
+ */
+int pcm_mix_multi(void *const pcm_out, size_t size, struct pcm_mix_input const *const inputs,
+		  uint8_t num_inputs, uint8_t pcm_bit_depth);
+
 /**
  * @}
  */
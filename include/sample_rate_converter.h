@@ -172,6 +172,126 @@ int sample_rate_converter_process(struct sample_rate_converter_ctx *ctx,
 				  size_t output_size, size_t *output_written,
 				  uint32_t output_sample_rate);
 
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE
+/** Number of phases in each polyphase coefficient bank. Must be a power of two. */
+#define SAMPLE_RATE_CONVERTER_POLY_PHASES 32
+
+/** Largest supported clock drift correction, in parts per billion. */
+#define SAMPLE_RATE_CONVERTER_POLY_DRIFT_PPB_MAX 1000000
+
+/** Maximum number of filter taps per phase of the polyphase coefficient banks. */
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_DOWNSAMPLING
+#define SAMPLE_RATE_CONVERTER_POLY_TAPS_MAX 64
+#else
+#define SAMPLE_RATE_CONVERTER_POLY_TAPS_MAX 24
+#endif
+
+/**
+ * The history must hold the filter taps carried over from the previous block in addition to a
+ * full input block.
+ */
+#define SAMPLE_RATE_CONVERTER_POLY_HISTORY_SIZE                                                    \
+	(SAMPLE_RATE_CONVERTER_POLY_TAPS_MAX + CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX)
+
+#ifdef CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+typedef q15_t sample_rate_converter_poly_sample_t;
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+typedef q31_t sample_rate_converter_poly_sample_t;
+#endif
+
+struct sample_rate_converter_poly_bank;
+
+/** Context for the polyphase sample rate conversion */
+struct sample_rate_converter_poly_ctx {
+	/* Input and output sample rate to be used for the conversion. */
+	uint32_t sample_rate_input;
+	uint32_t sample_rate_output;
+
+	/* Coefficient bank selected for the conversion ratio. */
+	struct sample_rate_converter_poly_bank const *bank;
+
+	/* Nominal distance between output samples, in input samples (Q32.32). The fraction
+	 * that does not fit in 32 bits is kept as a remainder in units of 1 / output rate, so
+	 * the nominal conversion is exact over any stream length.
+	 */
+	uint64_t step_nominal;
+	uint32_t step_remainder;
+	uint32_t remainder_acc;
+
+	/* Requested drift correction and the resulting step, in input samples (Q32.32). */
+	int32_t drift_ppb;
+	uint64_t step;
+
+	/* Position of the next output sample relative to the start of the history (Q32.32). */
+	uint64_t pos;
+
+	/* Input samples kept between process calls to fill the filter. */
+	size_t samples_in_history;
+	sample_rate_converter_poly_sample_t history[SAMPLE_RATE_CONVERTER_POLY_HISTORY_SIZE];
+};
+
+/**
+ * @brief	Open the polyphase sample rate converter for a new context.
+ *
+ * @details	Sets the entire context to 0, including the drift correction. This should be
+ *		done before a context is used with a new stream.
+ *
+ * @param[out]	ctx	Pointer to the polyphase sample rate conversion context.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	NULL pointer given for context.
+ */
+int sample_rate_converter_poly_open(struct sample_rate_converter_poly_ctx *ctx);
+
+/**
+ * @brief	Trim the conversion rate to compensate for clock drift.
+ *
+ * @details	A positive value makes the converter consume input samples faster, producing
+ *		fewer output samples per input sample. The correction is applied by moving the
+ *		filter phase, so no samples are dropped or inserted. The correction is kept if the
+ *		sample rates change.
+ *
+ * @param[in,out]	ctx		Pointer to the polyphase sample rate conversion context.
+ * @param[in]		drift_ppb	Drift correction in parts per billion.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	NULL pointer given for context, or the correction is larger than
+ *			SAMPLE_RATE_CONVERTER_POLY_DRIFT_PPB_MAX.
+ */
+int sample_rate_converter_poly_drift_set(struct sample_rate_converter_poly_ctx *ctx,
+					 int32_t drift_ppb);
+
+/**
+ * @brief	Process input samples and produce output samples with any new sample rate.
+ *
+ * @details	Converts between two arbitrary sample rates with a single polyphase filter.
+ *		The filter phase is interpolated between the phases of a precomputed coefficient
+ *		bank, so rational ratios such as 44.1 kHz to 48 kHz are handled without chaining
+ *		several conversions. As with sample_rate_converter_process, the context is
+ *		re-initialized if the sample rates change between calls. The number of output
+ *		samples varies between calls, and the output buffer must be able to hold
+ *		ceil(input samples * output rate / input rate) + 1 samples.
+ *
+ * @param[in,out]	ctx			Pointer to the polyphase conversion context.
+ * @param[in]		input			Pointer to samples to process.
+ * @param[in]		input_size		Size of the input in bytes.
+ * @param[in]		sample_rate_input	Sample rate of the input bytes.
+ * @param[out]		output			Array that output will be written.
+ * @param[in]		output_size		Size of the output array in bytes.
+ * @param[out]		output_written		Number of bytes written to output.
+ * @param[in]		sample_rate_output	Sample rate of output.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	Invalid parameters for sample rate conversion, or the output buffer is too
+ *			small.
+ */
+int sample_rate_converter_poly_process(struct sample_rate_converter_poly_ctx *ctx,
+				       void const *const input, size_t input_size,
+				       uint32_t sample_rate_input, void *const output,
+				       size_t output_size, size_t *output_written,
+				       uint32_t sample_rate_output);
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE */
+
 /**
  * @}
  */
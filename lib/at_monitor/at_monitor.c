@@ -8,6 +8,8 @@
 #include <zephyr/kernel.h>
 #include <zephyr/init.h>
 #include <zephyr/device.h>
+#include <zephyr/spinlock.h>
+#include <zephyr/sys/util.h>
 #include <nrf_modem_at.h>
 #include <modem/at_monitor.h>
 #include <zephyr/toolchain.h>
@@ -15,17 +17,55 @@
 
 LOG_MODULE_REGISTER(at_monitor, CONFIG_AT_MONITOR_LOG_LEVEL);
 
-struct at_notif_fifo {
-	void *fifo_reserved;
-	char data[]; /* Null-terminated AT notification string */
+/* Notification record in the notification buffer.
+ * Records are stored back to back and never wrap around the end of the buffer.
+ * The record is shared by all monitors dispatched in the workqueue.
+ */
+struct at_notif {
+	uint16_t size;	    /* Record size, including this header, multiple of 4 bytes */
+	uint8_t committed;  /* Data has been copied and the record can be dispatched */
+	uint8_t padding;    /* Record only fills the end of the buffer */
+#if defined(CONFIG_AT_MONITOR_STATS)
+	uint32_t timestamp; /* Cycle count when the notification was received */
+#endif
+	char data[];	    /* Null-terminated AT notification string */
 };
 
+#define NOTIF_BUF_SIZE ROUND_DOWN(CONFIG_AT_MONITOR_HEAP_SIZE, sizeof(uint32_t))
+
 static void at_monitor_task(struct k_work *work);
 
-static K_FIFO_DEFINE(at_monitor_fifo);
-static K_HEAP_DEFINE(at_monitor_heap, CONFIG_AT_MONITOR_HEAP_SIZE);
+static uint8_t notif_buf[NOTIF_BUF_SIZE] __aligned(sizeof(uint32_t));
+static struct {
+	size_t head;
+	size_t tail;
+	size_t used;
+} ring;
+static struct k_spinlock ring_lock;
 static K_WORK_DEFINE(at_monitor_work, at_monitor_task);
 
+/* Number of characters of the notification used to select the bucket */
+#define MATCH_PREFIX_LEN 4
+
+/* Monitors with a filter starting with '+' or '%' are placed in a bucket, selected by the hash
+ * of the first characters of the filter. Other monitors, including those with the ANY filter,
+ * are matched against every notification.
+ *
+ * Filters match anywhere in the notification, but a filter starting with '+' or '%' can only
+ * match after the start of the notification if one of these characters follows there. The
+ * buckets are therefore only used for notifications without one, and all monitors are checked
+ * for the others.
+ */
+static struct at_monitor_entry *buckets[CONFIG_AT_MONITOR_MATCH_BUCKETS];
+static struct at_monitor_entry *generic;
+
+STRUCT_SECTION_START_EXTERN(at_monitor_entry);
+STRUCT_SECTION_END_EXTERN(at_monitor_entry);
+
+#if defined(CONFIG_AT_MONITOR_STATS)
+static struct at_monitor_stats stats;
+#endif
+
 static bool is_paused(const struct at_monitor_entry *mon)
 {
 	return mon->flags.paused;
@@ -36,9 +76,173 @@ static bool is_direct(const struct at_monitor_entry *mon)
 	return mon->flags.direct;
 }
 
-static bool has_match(const struct at_monitor_entry *mon, const char *notif)
+static bool is_prefix_filter(const char *filter)
+{
+	return filter != ANY && (filter[0] == '+' || filter[0] == '%') &&
+	       strnlen(filter, MATCH_PREFIX_LEN) == MATCH_PREFIX_LEN;
+}
+
+/* FNV-1a hash of the first characters of the string, stops early on shorter strings */
+static uint32_t prefix_hash(const char *str)
+{
+	uint32_t hash = 2166136261U;
+
+	for (size_t i = 0; i < MATCH_PREFIX_LEN && str[i] != '\0'; i++) {
+		hash = (hash ^ (uint8_t)str[i]) * 16777619U;
+	}
+
+	return hash % CONFIG_AT_MONITOR_MATCH_BUCKETS;
+}
+
+/* Monitors that may match a notification, iterated in section order */
+struct candidates {
+	struct at_monitor_entry *bucket;
+	struct at_monitor_entry *wildcard;
+	/* Next monitor in the section, when all monitors are checked */
+	struct at_monitor_entry *all;
+};
+
+static void candidates_init(struct candidates *c, const char *notif)
+{
+	if (notif[0] != '\0' && strpbrk(notif + 1, "+%")) {
+		c->bucket = NULL;
+		c->wildcard = NULL;
+		c->all = STRUCT_SECTION_START(at_monitor_entry);
+	} else {
+		c->bucket = buckets[prefix_hash(notif)];
+		c->wildcard = generic;
+		c->all = NULL;
+	}
+}
+
+/* Return the next candidate monitor, or NULL when there are no more */
+static struct at_monitor_entry *candidate_next(struct candidates *c)
+{
+	struct at_monitor_entry *e;
+
+	if (c->all) {
+		e = c->all;
+		if (e == STRUCT_SECTION_END(at_monitor_entry)) {
+			return NULL;
+		}
+		c->all = e + 1;
+	} else if (c->bucket && (!c->wildcard || c->bucket < c->wildcard)) {
+		e = c->bucket;
+		c->bucket = e->next;
+	} else {
+		e = c->wildcard;
+		if (e) {
+			c->wildcard = e->next;
+		}
+	}
+
+	return e;
+}
+
+static bool has_match(const struct candidates *c, const struct at_monitor_entry *mon,
+		      const char *notif)
+{
+	if (mon->filter == ANY) {
+		return true;
+	}
+
+	if (!c->all && is_prefix_filter(mon->filter)) {
+		/* The filter can only be at the start of the notification */
+		return strncmp(notif, mon->filter, mon->filter_len) == 0;
+	}
+
+	return strstr(notif, mon->filter);
+}
+
+/* Iterate the monitors that may match the notification, in section order */
+#define CANDIDATE_FOREACH(_c, _notif, _e)                                                          \
+	for (struct at_monitor_entry *_e = (candidates_init(_c, _notif), candidate_next(_c)); _e;  \
+	     _e = candidate_next(_c))
+
+static struct at_notif *notif_alloc(size_t len)
+{
+	struct at_notif *rec;
+	size_t need = ROUND_UP(sizeof(struct at_notif) + len + sizeof(char), sizeof(uint32_t));
+	size_t to_end;
+	size_t pad = 0;
+
+	if (ring.used == 0) {
+		/* Start from the beginning to get the largest contiguous space */
+		ring.head = 0;
+		ring.tail = 0;
+	}
+
+	to_end = NOTIF_BUF_SIZE - ring.head;
+	if (need > to_end) {
+		pad = to_end;
+	}
+
+	if (need > UINT16_MAX || need + pad > NOTIF_BUF_SIZE - ring.used) {
+		return NULL;
+	}
+
+	if (pad) {
+		if (pad >= sizeof(struct at_notif)) {
+			rec = (struct at_notif *)&notif_buf[ring.head];
+			rec->size = pad;
+			rec->padding = true;
+			rec->committed = true;
+		}
+		ring.used += pad;
+		ring.head = 0;
+	}
+
+	rec = (struct at_notif *)&notif_buf[ring.head];
+	rec->size = need;
+	rec->padding = false;
+	rec->committed = false;
+
+	ring.head = (ring.head + need) % NOTIF_BUF_SIZE;
+	ring.used += need;
+
+#if defined(CONFIG_AT_MONITOR_STATS)
+	stats.buf_used_peak = MAX(stats.buf_used_peak, ring.used);
+#endif
+
+	return rec;
+}
+
+/* Return the oldest record, skipping padding, or NULL if there is nothing to dispatch */
+static struct at_notif *notif_peek(void)
+{
+	struct at_notif *rec;
+
+	while (ring.used) {
+		size_t to_end = NOTIF_BUF_SIZE - ring.tail;
+
+		if (to_end < sizeof(struct at_notif)) {
+			/* Too small for a padding record */
+			ring.used -= to_end;
+			ring.tail = 0;
+			continue;
+		}
+
+		rec = (struct at_notif *)&notif_buf[ring.tail];
+		if (!rec->committed) {
+			return NULL;
+		}
+
+		if (rec->padding) {
+			ring.used -= rec->size;
+			ring.tail = 0;
+			continue;
+		}
+
+		return rec;
+	}
+
+	return NULL;
+}
+
+static void notif_free(struct at_notif *rec)
 {
-	return (mon->filter == ANY || strstr(notif, mon->filter));
+	ring.tail = (ring.tail + rec->size) % NOTIF_BUF_SIZE;
+	ring.used -= rec->size;
 }
 
 /* Dispatch AT notifications immediately, or schedules a workqueue task to do that.
@@ -48,14 +252,16 @@ static bool has_match(const struct at_monitor_entry *mon, const char *notif)
 void at_monitor_dispatch(const char *notif)
 {
 	bool monitored;
-	struct at_notif_fifo *at_notif;
-	size_t sz_needed;
+	struct candidates c;
+	struct at_notif *at_notif;
+	k_spinlock_key_t key;
+	size_t len;
 
 	__ASSERT_NO_MSG(notif != NULL);
 
 	monitored = false;
-	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-		if (!is_paused(e) && has_match(e, notif)) {
+	CANDIDATE_FOREACH(&c, notif, e) {
+		if (!is_paused(e) && has_match(&c, e, notif)) {
 			if (is_direct(e)) {
 				LOG_DBG("Dispatching to %p (ISR)", e->handler);
 				e->handler(notif);
@@ -67,39 +273,138 @@ void at_monitor_dispatch(const char *notif)
 	}
 
 	if (!monitored) {
-		/* Only copy monitored notifications to save heap */
+		/* Only copy monitored notifications to save space */
 		return;
 	}
 
-	sz_needed = sizeof(struct at_notif_fifo) + strlen(notif) + sizeof(char);
+	len = strlen(notif);
+
+	key = k_spin_lock(&ring_lock);
+	at_notif = notif_alloc(len);
+#if defined(CONFIG_AT_MONITOR_STATS)
+	if (!at_notif) {
+		stats.dropped++;
+	}
+#endif
+	k_spin_unlock(&ring_lock, key);
 
-	at_notif = k_heap_alloc(&at_monitor_heap, sz_needed, K_NO_WAIT);
 	if (!at_notif) {
-		LOG_WRN("No heap space for incoming notification: %s", notif);
-		__ASSERT(at_notif, "No heap space for incoming notification: %s", notif);
+		LOG_WRN("No buffer space for incoming notification: %s", notif);
+		__ASSERT(at_notif, "No buffer space for incoming notification: %s", notif);
 		return;
 	}
 
-	strcpy(at_notif->data, notif);
+	memcpy(at_notif->data, notif, len + sizeof(char));
+#if defined(CONFIG_AT_MONITOR_STATS)
+	at_notif->timestamp = k_cycle_get_32();
+#endif
+
+	/* Publish the record only once the data is in place */
+	compiler_barrier();
+	at_notif->committed = true;
 
-	k_fifo_put(&at_monitor_fifo, at_notif);
 	k_work_submit(&at_monitor_work);
 }
 
+#if defined(CONFIG_AT_MONITOR_STATS)
+static void entry_stats_update(struct at_monitor_entry *e, uint32_t timestamp)
+{
+	uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - timestamp);
+
+	e->stats.dispatched++;
+	e->stats.latency_max_us = MAX(e->stats.latency_max_us, latency_us);
+	/* Exponential moving average with a weight of 1/8 for the newest sample */
+	e->stats.latency_avg_us = e->stats.latency_avg_us -
+				  (e->stats.latency_avg_us >> 3) + (latency_us >> 3);
+}
+#endif
+
 static void at_monitor_task(struct k_work *work)
 {
-	struct at_notif_fifo *at_notif;
+	struct candidates c;
+	struct at_notif *at_notif;
+	k_spinlock_key_t key;
+
+	while (true) {
+		key = k_spin_lock(&ring_lock);
+		at_notif = notif_peek();
+		k_spin_unlock(&ring_lock, key);
 
-	while ((at_notif = k_fifo_get(&at_monitor_fifo, K_NO_WAIT))) {
-		/* Match notification with all monitors */
+		if (!at_notif) {
+			break;
+		}
+
+		/* Match notification with all monitors.
+		 * The record stays in the buffer and is read in place by every handler.
+		 */
 		LOG_DBG("AT notif: %.*s", strlen(at_notif->data) - strlen("\r\n"), at_notif->data);
-		STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
-			if (!is_paused(e) && !is_direct(e) && has_match(e, at_notif->data)) {
+		CANDIDATE_FOREACH(&c, at_notif->data, e) {
+			if (!is_paused(e) && !is_direct(e) && has_match(&c, e, at_notif->data)) {
 				LOG_DBG("Dispatching to %p", e->handler);
+#if defined(CONFIG_AT_MONITOR_STATS)
+				entry_stats_update(e, at_notif->timestamp);
+#endif
 				e->handler(at_notif->data);
 			}
 		}
-		k_heap_free(&at_monitor_heap, at_notif);
+
+		key = k_spin_lock(&ring_lock);
+		notif_free(at_notif);
+#if defined(CONFIG_AT_MONITOR_STATS)
+		stats.dispatched++;
+#endif
+		k_spin_unlock(&ring_lock, key);
+	}
+}
+
+#if defined(CONFIG_AT_MONITOR_STATS)
+void at_monitor_stats_get(struct at_monitor_stats *out)
+{
+	k_spinlock_key_t key;
+
+	__ASSERT_NO_MSG(out != NULL);
+
+	key = k_spin_lock(&ring_lock);
+	*out = stats;
+	k_spin_unlock(&ring_lock, key);
+}
+
+void at_monitor_stats_reset(void)
+{
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&ring_lock);
+	memset(&stats, 0, sizeof(stats));
+	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
+		memset(&e->stats, 0, sizeof(e->stats));
+	}
+	k_spin_unlock(&ring_lock, key);
+}
+#endif /* CONFIG_AT_MONITOR_STATS */
+
+/* Sort the monitors into the match lists, keeping the section order within each list */
+static void match_lists_build(void)
+{
+	struct at_monitor_entry **tails[CONFIG_AT_MONITOR_MATCH_BUCKETS];
+	struct at_monitor_entry **generic_tail = &generic;
+
+	for (size_t i = 0; i < ARRAY_SIZE(buckets); i++) {
+		tails[i] = &buckets[i];
+	}
+
+	STRUCT_SECTION_FOREACH(at_monitor_entry, e) {
+		e->next = NULL;
+
+		if (is_prefix_filter(e->filter)) {
+			uint32_t i = prefix_hash(e->filter);
+
+			e->filter_len = strlen(e->filter);
+			*tails[i] = e;
+			tails[i] = &e->next;
+		} else {
+			*generic_tail = e;
+			generic_tail = &e->next;
+		}
 	}
 }
 
@@ -107,6 +412,8 @@ static int at_monitor_sys_init(void)
 {
 	int err;
 
+	match_lists_build();
+
 	err = nrf_modem_at_notif_handler_set(at_monitor_dispatch);
 	if (err) {
 		LOG_ERR("Failed to hook the dispatch function, err %d", err);
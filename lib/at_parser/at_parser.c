@@ -350,27 +350,10 @@ int at_parser_cmd_count_get(struct at_parser *parser, size_t *count)
 	return (err == -EIO || err == -EAGAIN) ? 0 : err;
 }
 
-static int at_parser_num_get_impl(struct at_parser *parser, size_t index, void *value,
-				  enum at_num_type type)
+/* Convert an integer token to a number of the given type. */
+static int at_token_num_get(const struct at_token *token, void *value, enum at_num_type type)
 {
-	int err;
-	struct at_token token = {0};
-
-	if (!value) {
-		return -EINVAL;
-	}
-
-	err = at_parser_check(parser);
-	if (err) {
-		return err;
-	}
-
-	err = at_parser_seek(parser, index, &token);
-	if (err) {
-		return err;
-	}
-
-	switch (token.type) {
+	switch (token->type) {
 	/* Acceptable types. */
 	case AT_TOKEN_TYPE_INT:
 		break;
@@ -385,11 +368,11 @@ static int at_parser_num_get_impl(struct at_parser *parser, size_t index, void *
 
 	/* Check unsigned 64-bit integer first, using its own parsing function. */
 	if (type == AT_NUM_TYPE_UINT64) {
-		if (token.start[0] == MINUS_SIGN) {
+		if (token->start[0] == MINUS_SIGN) {
 			return -ERANGE;
 		}
 
-		uint64_t val = strtoull(token.start, NULL, 10);
+		uint64_t val = strtoull(token->start, NULL, 10);
 
 		if (errno == ERANGE) {
 			return -ERANGE;
@@ -400,7 +383,7 @@ static int at_parser_num_get_impl(struct at_parser *parser, size_t index, void *
 		return 0;
 	}
 
-	int64_t val = strtoll(token.start, NULL, 10);
+	int64_t val = strtoll(token->start, NULL, 10);
 
 	switch (type) {
 	case AT_NUM_TYPE_INT16:
@@ -439,6 +422,29 @@ static int at_parser_num_get_impl(struct at_parser *parser, size_t index, void *
 	return 0;
 }
 
+static int at_parser_num_get_impl(struct at_parser *parser, size_t index, void *value,
+				  enum at_num_type type)
+{
+	int err;
+	struct at_token token = {0};
+
+	if (!value) {
+		return -EINVAL;
+	}
+
+	err = at_parser_check(parser);
+	if (err) {
+		return err;
+	}
+
+	err = at_parser_seek(parser, index, &token);
+	if (err) {
+		return err;
+	}
+
+	return at_token_num_get(&token, value, type);
+}
+
 int at_parser_int16_get(struct at_parser *parser, size_t index, int16_t *value)
 {
 	return at_parser_num_get_impl(parser, index, value, AT_NUM_TYPE_INT16);
@@ -469,6 +475,47 @@ int at_parser_uint64_get(struct at_parser *parser, size_t index, uint64_t *value
 	return at_parser_num_get_impl(parser, index, value, AT_NUM_TYPE_UINT64);
 }
 
+/* Copy a string token to a buffer, or return a pointer to it. */
+static int at_token_string_get(const struct at_token *token, void *ptr, size_t *len,
+			       bool is_ptr_get)
+{
+	switch (token->type) {
+	/* Acceptable types. */
+	case AT_TOKEN_TYPE_CMD_TEST:
+	case AT_TOKEN_TYPE_CMD_SET:
+	case AT_TOKEN_TYPE_CMD_READ:
+	case AT_TOKEN_TYPE_NOTIF:
+	case AT_TOKEN_TYPE_QUOTED_STRING:
+	case AT_TOKEN_TYPE_STRING:
+	case AT_TOKEN_TYPE_ARRAY:
+		break;
+	case AT_TOKEN_TYPE_EMPTY:
+		return -ENODATA;
+	default:
+		return -EOPNOTSUPP;
+	}
+
+	if (is_ptr_get) {
+		*((const char **)ptr) = token->start;
+		*len = token->len;
+	} else {
+		/* Check if there is enough memory. */
+		if (*len < token->len + 1) {
+			return -ENOMEM;
+		}
+
+		memcpy((char *)ptr, token->start, token->len);
+
+		/* Null-terminate the string. */
+		((char *)ptr)[token->len] = '\0';
+
+		/* Update the length to reflect the copied string length. */
+		*len = token->len;
+	}
+
+	return 0;
+}
+
 static int at_parser_string_common_get_impl(struct at_parser *parser, size_t index, void *ptr,
 					    size_t *len, bool is_ptr_get)
 {
@@ -489,15 +536,62 @@ static int at_parser_string_common_get_impl(struct at_parser *parser, size_t ind
 		return err;
 	}
 
-	switch (token.type) {
+	return at_token_string_get(&token, ptr, len, is_ptr_get);
+}
+
+int at_parser_string_get(struct at_parser *parser, size_t index, char *str, size_t *len)
+{
+	return at_parser_string_common_get_impl(parser, index, (void *)str, len, false);
+}
+
+int at_parser_string_ptr_get(struct at_parser *parser, size_t index, const char **str_ptr,
+			     size_t *len)
+{
+	return at_parser_string_common_get_impl(parser, index, (void *)str_ptr, len, true);
+}
+
+/* Store an unsigned value in a destination of the given size. */
+static int uint_store(void *dst, size_t size, uint64_t val)
+{
+	switch (size) {
+	case sizeof(uint8_t):
+		if (val > UINT8_MAX) {
+			return -ERANGE;
+		}
+		*(uint8_t *)dst = (uint8_t)val;
+		break;
+	case sizeof(uint16_t):
+		if (val > UINT16_MAX) {
+			return -ERANGE;
+		}
+		*(uint16_t *)dst = (uint16_t)val;
+		break;
+	case sizeof(uint32_t):
+		if (val > UINT32_MAX) {
+			return -ERANGE;
+		}
+		*(uint32_t *)dst = (uint32_t)val;
+		break;
+	case sizeof(uint64_t):
+		*(uint64_t *)dst = val;
+		break;
+	default:
+		return -EINVAL;
+	}
+
+	return 0;
+}
+
+/* Convert a hexadecimal string token to an unsigned integer. */
+static int at_token_hex_get(const struct at_token *token, void *dst, size_t size)
+{
+	char *end;
+	uint64_t val;
+
+	switch (token->type) {
 	/* Acceptable types. */
-	case AT_TOKEN_TYPE_CMD_TEST:
-	case AT_TOKEN_TYPE_CMD_SET:
-	case AT_TOKEN_TYPE_CMD_READ:
-	case AT_TOKEN_TYPE_NOTIF:
 	case AT_TOKEN_TYPE_QUOTED_STRING:
 	case AT_TOKEN_TYPE_STRING:
-	case AT_TOKEN_TYPE_ARRAY:
 		break;
 	case AT_TOKEN_TYPE_EMPTY:
 		return -ENODATA;
@@ -505,34 +599,211 @@ static int at_parser_string_common_get_impl(struct at_parser *parser, size_t ind
 		return -EOPNOTSUPP;
 	}
 
-	if (is_ptr_get) {
-		*((const char **)ptr) = token.start;
-		*len = token.len;
-	} else {
-		/* Check if there is enough memory. */
-		if (*len < token.len + 1) {
-			return -ENOMEM;
+	if (token->len == 0) {
+		return -ENODATA;
+	}
+
+	/* Must be set to 0 before calling `strtoull`. */
+	errno = 0;
+
+	/* The token is not null-terminated, but is always followed by a character that is not a
+	 * hexadecimal digit.
+	 */
+	val = strtoull(token->start, &end, 16);
+	if (errno == ERANGE) {
+		return -ERANGE;
+	}
+
+	if (end != token->start + token->len || token->start[0] == MINUS_SIGN) {
+		return -EOPNOTSUPP;
+	}
+
+	return uint_store(dst, size, val);
+}
+
+/* Decode one token into the destination of a field. */
+static int at_token_field_get(const struct at_token *token, const struct at_parser_field *field,
+			      uint8_t *out)
+{
+	void *dst = out + field->offset;
+	size_t len = field->size;
+
+	switch (field->type) {
+	case AT_PARSER_FIELD_TYPE_INT16:
+		return at_token_num_get(token, dst, AT_NUM_TYPE_INT16);
+	case AT_PARSER_FIELD_TYPE_UINT16:
+		return at_token_num_get(token, dst, AT_NUM_TYPE_UINT16);
+	case AT_PARSER_FIELD_TYPE_INT32:
+		return at_token_num_get(token, dst, AT_NUM_TYPE_INT32);
+	case AT_PARSER_FIELD_TYPE_UINT32:
+		return at_token_num_get(token, dst, AT_NUM_TYPE_UINT32);
+	case AT_PARSER_FIELD_TYPE_INT64:
+		return at_token_num_get(token, dst, AT_NUM_TYPE_INT64);
+	case AT_PARSER_FIELD_TYPE_UINT64:
+		return at_token_num_get(token, dst, AT_NUM_TYPE_UINT64);
+	case AT_PARSER_FIELD_TYPE_STRING:
+		return at_token_string_get(token, dst, &len, false);
+	case AT_PARSER_FIELD_TYPE_STRING_PTR: {
+		struct at_parser_str *str = dst;
+
+		return at_token_string_get(token, &str->ptr, &str->len, true);
+	}
+	case AT_PARSER_FIELD_TYPE_HEX:
+		return at_token_hex_get(token, dst, field->size);
+	case AT_PARSER_FIELD_TYPE_SKIP:
+		return 0;
+	default:
+		return -EINVAL;
+	}
+}
+
+/* Check if the fields starting from the given one can all be absent. */
+static bool fields_optional(const struct at_parser_field *fields, size_t count)
+{
+	for (size_t i = 0; i < count; i++) {
+		if (!(fields[i].flags & AT_PARSER_FIELD_FLAG_OPTIONAL)) {
+			return false;
 		}
+	}
 
-		memcpy((char *)ptr, token.start, token.len);
+	return true;
+}
 
-		/* Null-terminate the string. */
-		((char *)ptr)[token.len] = '\0';
+static bool is_line_end(int err)
+{
+	return err == -EIO || err == -EAGAIN;
+}
 
-		/* Update the length to reflect the copied string length. */
-		*len = token.len;
+/* Decode the next tokens into the given fields.
+ * Returns the number of fields decoded before the end of the line, or a negative error code.
+ * The output is not written if it is NULL.
+ */
+static int fields_decode(struct at_parser *parser, const struct at_parser_field *fields,
+			 size_t count, uint8_t *out)
+{
+	int err;
+	struct at_token token = {0};
+
+	for (size_t i = 0; i < count; i++) {
+		err = at_parser_tok(parser, &token);
+		if (is_line_end(err)) {
+			return i;
+		} else if (err) {
+			return err;
+		}
+
+		if (out) {
+			err = at_token_field_get(&token, &fields[i], out);
+			if (err == -ENODATA && (fields[i].flags & AT_PARSER_FIELD_FLAG_OPTIONAL)) {
+				err = 0;
+			} else if (err && (fields[i].flags & AT_PARSER_FIELD_FLAG_LENIENT)) {
+				err = 0;
+			}
+			if (err) {
+				return err;
+			}
+		}
 	}
 
-	return 0;
+	return count;
 }
 
-int at_parser_string_get(struct at_parser *parser, size_t index, char *str, size_t *len)
+/* Decode group elements until the end of the line.
+ * Returns the number of elements found, or a negative error code.
+ */
+static int group_decode(struct at_parser *parser, const struct at_parser_field *group,
+			uint8_t *out)
 {
-	return at_parser_string_common_get_impl(parser, index, (void *)str, len, false);
+	int ret;
+	size_t found = 0;
+	size_t stored;
+
+	while (true) {
+		uint8_t *elem = (found < group->max) ? out + group->offset + found * group->size
+						     : NULL;
+
+		ret = fields_decode(parser, group->fields, group->fields_count, elem);
+		if (ret < 0) {
+			return ret;
+		} else if (ret == 0) {
+			/* Nothing left on the line. */
+			break;
+		}
+
+		if (ret < group->fields_count &&
+		    !fields_optional(&group->fields[ret], group->fields_count - ret)) {
+			return -ENODATA;
+		}
+
+		found++;
+
+		if (ret < group->fields_count) {
+			/* The line ended within the optional fields of the last element. */
+			break;
+		}
+	}
+
+	stored = MIN(found, group->max);
+
+	ret = uint_store(out + group->count_offset, group->count_size, stored);
+	if (ret) {
+		return ret;
+	}
+
+	return found;
 }
 
-int at_parser_string_ptr_get(struct at_parser *parser, size_t index, const char **str_ptr,
-			     size_t *len)
+int at_parser_decode(struct at_parser *parser, const struct at_parser_schema *schema, void *out)
 {
-	return at_parser_string_common_get_impl(parser, index, (void *)str_ptr, len, true);
+	int ret;
+	size_t count;
+	const struct at_parser_field *group = NULL;
+	struct at_token token = {0};
+
+	if (!schema || !out) {
+		return -EINVAL;
+	}
+
+	ret = at_parser_check(parser);
+	if (ret) {
+		return ret;
+	}
+
+	count = schema->fields_count;
+	if (count > 0 && schema->fields[count - 1].type == AT_PARSER_FIELD_TYPE_GROUP) {
+		/* A group is the last field and consumes the rest of the line. */
+		group = &schema->fields[--count];
+	}
+
+	/* Rewind to the command prefix of the current line. */
+	parser->cursor = parser->at;
+	parser->count = 0;
+	parser->is_next_empty = false;
+
+	ret = at_parser_tok(parser, &token);
+	if (ret) {
+		return ret;
+	}
+
+	ret = fields_decode(parser, schema->fields, count, out);
+	if (ret < 0) {
+		return ret;
+	} else if (ret < count) {
+		/* The line ended, the remaining fields must be optional. */
+		return fields_optional(&schema->fields[ret], schema->fields_count - ret) ? ret
+											 : -ENODATA;
+	}
+
+	if (group) {
+		ret = group_decode(parser, group, out);
+		if (ret < 0) {
+			return ret;
+		} else if (ret > group->max) {
+			return -E2BIG;
+		}
+
+		return count + (ret > 0 ? 1 : 0);
+	}
+
+	return count;
 }
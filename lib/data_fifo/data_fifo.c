@@ -41,6 +41,243 @@ static int msgq_slab_legal_used_elements(struct data_fifo *data_fifo, uint32_t *
 	return 0;
 }
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+/** @brief Number of steps from one SPSC index to another. */
+static uint32_t spsc_count(struct data_fifo const *const data_fifo, atomic_val_t from,
+			   atomic_val_t to)
+{
+	uint32_t range = 2 * data_fifo->elements_max;
+
+	return (range + to - from) % range;
+}
+
+static atomic_val_t spsc_index_add(struct data_fifo const *const data_fifo, atomic_val_t index,
+				   uint32_t num)
+{
+	return (index + num) % (2 * data_fifo->elements_max);
+}
+
+static void *spsc_block(struct data_fifo const *const data_fifo, atomic_val_t index)
+{
+	return data_fifo->slab_buffer + (index % data_fifo->elements_max) * data_fifo->block_size_max;
+}
+
+/* The message queue buffer is not used in SPSC mode, it holds the size of each block instead */
+static struct data_fifo_msgq *spsc_msg(struct data_fifo const *const data_fifo, atomic_val_t index)
+{
+	return (struct data_fifo_msgq *)data_fifo->msgq_buffer + (index % data_fifo->elements_max);
+}
+
+/** @brief Wait until woken by the other side of the FIFO, or the timeout expires.
+ *
+ * The waiting flag must be set and the FIFO checked again before calling this, so that a
+ * wake-up is not lost. Spurious wake-ups are possible, and the caller must check again.
+ */
+static int spsc_wait(struct k_sem *sem, k_timepoint_t end)
+{
+	int ret;
+
+	ret = k_sem_take(sem, sys_timepoint_timeout(end));
+	if (ret) {
+		return -EAGAIN;
+	}
+
+	return 0;
+}
+
+static void spsc_wake(struct k_sem *sem, atomic_t *waiting)
+{
+	if (atomic_cas(waiting, 1, 0)) {
+		k_sem_give(sem);
+	}
+}
+
+static void spsc_reset(struct data_fifo *data_fifo)
+{
+	atomic_set(&data_fifo->spsc.alloc, 0);
+	atomic_set(&data_fifo->spsc.head, 0);
+	atomic_set(&data_fifo->spsc.read, 0);
+	atomic_set(&data_fifo->spsc.tail, 0);
+	atomic_set(&data_fifo->spsc.vacant_wait, 0);
+	atomic_set(&data_fifo->spsc.filled_wait, 0);
+	k_sem_reset(&data_fifo->spsc.vacant_sem);
+	k_sem_reset(&data_fifo->spsc.filled_sem);
+}
+
+static int spsc_vacant_get(struct data_fifo *data_fifo, void **data, uint32_t *num,
+			   k_timeout_t timeout)
+{
+	int ret;
+	uint32_t vacant;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	atomic_val_t alloc = atomic_get(&data_fifo->spsc.alloc);
+
+	while (true) {
+		vacant = data_fifo->elements_max -
+			 spsc_count(data_fifo, atomic_get(&data_fifo->spsc.tail), alloc);
+		if (vacant) {
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMEM;
+		}
+
+		if (!atomic_get(&data_fifo->spsc.vacant_wait)) {
+			atomic_set(&data_fifo->spsc.vacant_wait, 1);
+			continue;
+		}
+
+		ret = spsc_wait(&data_fifo->spsc.vacant_sem, end);
+		if (ret) {
+			atomic_clear(&data_fifo->spsc.vacant_wait);
+			return ret;
+		}
+	}
+
+	atomic_clear(&data_fifo->spsc.vacant_wait);
+
+	*num = MIN(*num, vacant);
+
+	for (uint32_t i = 0; i < *num; i++) {
+		data[i] = spsc_block(data_fifo, spsc_index_add(data_fifo, alloc, i));
+	}
+
+	atomic_set(&data_fifo->spsc.alloc, spsc_index_add(data_fifo, alloc, *num));
+
+	return 0;
+}
+
+static int spsc_blocks_lock(struct data_fifo *data_fifo, void **data, size_t const *size,
+			    uint32_t num)
+{
+	atomic_val_t head = atomic_get(&data_fifo->spsc.head);
+	uint32_t alloced = spsc_count(data_fifo, head, atomic_get(&data_fifo->spsc.alloc));
+
+	if (num > alloced) {
+		LOG_ERR("Locking %u blocks, only %u taken", num, alloced);
+		return -ESPIPE;
+	}
+
+	for (uint32_t i = 0; i < num; i++) {
+		if (size[i] > data_fifo->block_size_max) {
+			LOG_ERR("Size %zu too big, max: %zu", size[i], data_fifo->block_size_max);
+			return -ENOMEM;
+		} else if (size[i] == 0) {
+			LOG_ERR("Size is zero");
+			return -EINVAL;
+		}
+
+		if (data[i] != spsc_block(data_fifo, spsc_index_add(data_fifo, head, i))) {
+			LOG_ERR("Block %p not locked in the order it was taken", data[i]);
+			return -ESPIPE;
+		}
+	}
+
+	for (uint32_t i = 0; i < num; i++) {
+		spsc_msg(data_fifo, spsc_index_add(data_fifo, head, i))->size = size[i];
+	}
+
+	atomic_set(&data_fifo->spsc.head, spsc_index_add(data_fifo, head, num));
+	spsc_wake(&data_fifo->spsc.filled_sem, &data_fifo->spsc.filled_wait);
+
+	return 0;
+}
+
+static int spsc_filled_get(struct data_fifo *data_fifo, void **data, size_t *size, uint32_t *num,
+			   k_timeout_t timeout)
+{
+	int ret;
+	uint32_t filled;
+	k_timepoint_t end = sys_timepoint_calc(timeout);
+	atomic_val_t read = atomic_get(&data_fifo->spsc.read);
+
+	while (true) {
+		filled = spsc_count(data_fifo, read, atomic_get(&data_fifo->spsc.head));
+		if (filled) {
+			break;
+		}
+
+		if (K_TIMEOUT_EQ(timeout, K_NO_WAIT)) {
+			return -ENOMSG;
+		}
+
+		if (!atomic_get(&data_fifo->spsc.filled_wait)) {
+			atomic_set(&data_fifo->spsc.filled_wait, 1);
+			continue;
+		}
+
+		ret = spsc_wait(&data_fifo->spsc.filled_sem, end);
+		if (ret) {
+			atomic_clear(&data_fifo->spsc.filled_wait);
+			return ret;
+		}
+	}
+
+	atomic_clear(&data_fifo->spsc.filled_wait);
+
+	*num = MIN(*num, filled);
+
+	for (uint32_t i = 0; i < *num; i++) {
+		atomic_val_t index = spsc_index_add(data_fifo, read, i);
+
+		data[i] = spsc_block(data_fifo, index);
+		size[i] = spsc_msg(data_fifo, index)->size;
+	}
+
+	atomic_set(&data_fifo->spsc.read, spsc_index_add(data_fifo, read, *num));
+
+	return 0;
+}
+
+static void spsc_blocks_free(struct data_fifo *data_fifo, void **data, uint32_t num)
+{
+	atomic_val_t tail_start = atomic_get(&data_fifo->spsc.tail);
+	atomic_val_t tail = tail_start;
+	uint32_t received = spsc_count(data_fifo, tail, atomic_get(&data_fifo->spsc.read));
+	atomic_val_t alloc;
+
+	for (uint32_t i = 0; i < num; i++) {
+		if (received && data[i] == spsc_block(data_fifo, tail)) {
+			/* Consumer is done with the oldest block */
+			tail = spsc_index_add(data_fifo, tail, 1);
+			received--;
+			continue;
+		}
+
+		alloc = atomic_get(&data_fifo->spsc.alloc);
+
+		if (alloc != atomic_get(&data_fifo->spsc.head) &&
+		    data[i] == spsc_block(data_fifo,
+					  spsc_index_add(data_fifo, alloc,
+							 2 * data_fifo->elements_max - 1))) {
+			/* Producer returns the block it took last, without locking it */
+			atomic_set(&data_fifo->spsc.alloc,
+				   spsc_index_add(data_fifo, alloc, 2 * data_fifo->elements_max - 1));
+			continue;
+		}
+
+		LOG_ERR("Block %p not freed in the order it was received", data[i]);
+		__ASSERT(false, "Block %p not freed in the order it was received", data[i]);
+	}
+
+	/* Only the consumer moves the tail. A producer returning its last block must not write
+	 * back the tail it read, as the consumer may have moved it since.
+	 */
+	if (tail == tail_start) {
+		return;
+	}
+
+	if (!atomic_cas(&data_fifo->spsc.tail, tail_start, tail)) {
+		LOG_ERR("Tail moved while freeing blocks, more than one consumer");
+		__ASSERT(false, "Tail moved while freeing blocks, more than one consumer");
+		return;
+	}
+
+	spsc_wake(&data_fifo->spsc.vacant_sem, &data_fifo->spsc.vacant_wait);
+}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 				       k_timeout_t timeout)
 {
@@ -48,16 +285,63 @@ int data_fifo_pointer_first_vacant_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc_mode) {
+		uint32_t num = 1;
+
+		return spsc_vacant_get(data_fifo, data, &num, timeout);
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	ret = k_mem_slab_alloc(&data_fifo->mem_slab, data, timeout);
 	return ret;
 }
 
+int data_fifo_pointers_first_vacant_get(struct data_fifo *data_fifo, void **data, uint32_t *num,
+					k_timeout_t timeout)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+	__ASSERT_NO_MSG(data_fifo->initialized);
+	int ret;
+
+	if (*num == 0) {
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc_mode) {
+		return spsc_vacant_get(data_fifo, data, num, timeout);
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
+	ret = k_mem_slab_alloc(&data_fifo->mem_slab, &data[0], timeout);
+	if (ret) {
+		return ret;
+	}
+
+	for (uint32_t i = 1; i < *num; i++) {
+		ret = k_mem_slab_alloc(&data_fifo->mem_slab, &data[i], K_NO_WAIT);
+		if (ret) {
+			*num = i;
+			break;
+		}
+	}
+
+	return 0;
+}
+
 int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 {
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc_mode) {
+		return spsc_blocks_lock(data_fifo, data, &size, 1);
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	if (size > data_fifo->block_size_max) {
 		LOG_ERR("Size %zu too big, max: %zu", size, data_fifo->block_size_max);
 		return -ENOMEM;
@@ -84,6 +368,29 @@ int data_fifo_block_lock(struct data_fifo *data_fifo, void **data, size_t size)
 	return 0;
 }
 
+int data_fifo_blocks_lock(struct data_fifo *data_fifo, void **data, size_t const *size,
+			  uint32_t num)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+	__ASSERT_NO_MSG(data_fifo->initialized);
+	int ret;
+
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc_mode) {
+		return spsc_blocks_lock(data_fifo, data, size, num);
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
+	for (uint32_t i = 0; i < num; i++) {
+		ret = data_fifo_block_lock(data_fifo, &data[i], size[i]);
+		if (ret) {
+			return ret;
+		}
+	}
+
+	return 0;
+}
+
 int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
 				      k_timeout_t timeout)
 {
@@ -91,6 +398,14 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 	__ASSERT_NO_MSG(data_fifo->initialized);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc_mode) {
+		uint32_t num = 1;
+
+		return spsc_filled_get(data_fifo, data, size, &num, timeout);
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	struct data_fifo_msgq msgq_tmp;
 
 	ret = k_msgq_get(&data_fifo->msgq, &msgq_tmp, timeout);
@@ -103,14 +418,71 @@ int data_fifo_pointer_last_filled_get(struct data_fifo *data_fifo, void **data,
 	return 0;
 }
 
+int data_fifo_pointers_last_filled_get(struct data_fifo *data_fifo, void **data, size_t *size,
+				       uint32_t *num, k_timeout_t timeout)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+	__ASSERT_NO_MSG(data_fifo->initialized);
+	int ret;
+
+	if (*num == 0) {
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc_mode) {
+		return spsc_filled_get(data_fifo, data, size, num, timeout);
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
+	ret = data_fifo_pointer_last_filled_get(data_fifo, &data[0], &size[0], timeout);
+	if (ret) {
+		return ret;
+	}
+
+	for (uint32_t i = 1; i < *num; i++) {
+		ret = data_fifo_pointer_last_filled_get(data_fifo, &data[i], &size[i], K_NO_WAIT);
+		if (ret) {
+			*num = i;
+			break;
+		}
+	}
+
+	return 0;
+}
+
 void data_fifo_block_free(struct data_fifo *data_fifo, void *data)
 {
 	__ASSERT_NO_MSG(data_fifo != NULL);
 	__ASSERT_NO_MSG(data_fifo->initialized);
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc_mode) {
+		spsc_blocks_free(data_fifo, &data, 1);
+		return;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	k_mem_slab_free(&data_fifo->mem_slab, data);
 }
 
+void data_fifo_blocks_free(struct data_fifo *data_fifo, void **data, uint32_t num)
+{
+	__ASSERT_NO_MSG(data_fifo != NULL);
+	__ASSERT_NO_MSG(data_fifo->initialized);
+
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc_mode) {
+		spsc_blocks_free(data_fifo, data, num);
+		return;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
+	for (uint32_t i = 0; i < num; i++) {
+		k_mem_slab_free(&data_fifo->mem_slab, data[i]);
+	}
+}
+
 int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, uint32_t *locked_num)
 {
 	__ASSERT_NO_MSG(data_fifo != NULL);
@@ -120,6 +492,16 @@ int data_fifo_num_used_get(struct data_fifo *data_fifo, uint32_t *alloced_num, u
 	uint32_t msgq_num_used = UINT32_MAX;
 	uint32_t slab_blocks_num_used = UINT32_MAX;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc_mode) {
+		*locked_num = spsc_count(data_fifo, atomic_get(&data_fifo->spsc.read),
+					 atomic_get(&data_fifo->spsc.head));
+		*alloced_num = spsc_count(data_fifo, atomic_get(&data_fifo->spsc.tail),
+					  atomic_get(&data_fifo->spsc.alloc));
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	ret = msgq_slab_legal_used_elements(data_fifo, &msgq_num_used, &slab_blocks_num_used);
 	if (ret) {
 		return ret;
@@ -138,6 +520,13 @@ int data_fifo_empty(struct data_fifo *data_fifo)
 	void *old_data;
 	size_t size;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc_mode) {
+		spsc_reset(data_fifo);
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	ret = data_fifo_num_used_get(data_fifo, &fifo_alloced_num, &fifo_locked_num);
 	if (ret) {
 		LOG_ERR("Failed to get num used in FIFO");
@@ -192,6 +581,16 @@ int data_fifo_init(struct data_fifo *data_fifo)
 	__ASSERT_NO_MSG((data_fifo->block_size_max % WB_UP(1)) == 0);
 	int ret;
 
+#if defined(CONFIG_DATA_FIFO_SPSC)
+	if (data_fifo->spsc_mode) {
+		k_sem_init(&data_fifo->spsc.vacant_sem, 0, 1);
+		k_sem_init(&data_fifo->spsc.filled_sem, 0, 1);
+		spsc_reset(data_fifo);
+		data_fifo->initialized = true;
+		return 0;
+	}
+#endif /* CONFIG_DATA_FIFO_SPSC */
+
 	k_msgq_init(&data_fifo->msgq, data_fifo->msgq_buffer, sizeof(struct data_fifo_msgq),
 		    data_fifo->elements_max);
 
@@ -6,6 +6,8 @@
 
 #include <assert.h>
 #include <math.h>
+#include <limits>
+#include <type_traits>
 #include <ei_run_classifier.h>
 
 #if !CONFIG_ZTEST
@@ -40,8 +42,19 @@ enum state {
 	STATE_READY,
 };
 
+#if defined(CONFIG_EI_WRAPPER_DATA_TYPE_INT8)
+typedef int8_t sample_t;
+#elif defined(CONFIG_EI_WRAPPER_DATA_TYPE_INT16)
+typedef int16_t sample_t;
+#else
+typedef float sample_t;
+#endif
+
+/* The first INPUT_WINDOW_SIZE samples of the ring are mirrored after its end, so that any window
+ * can be read from the buffer as a contiguous block.
+ */
 struct data_buffer {
-	float buf[DATA_BUFFER_SIZE];
+	sample_t buf[DATA_BUFFER_SIZE + INPUT_WINDOW_SIZE];
 	size_t process_idx;
 	size_t append_idx;
 	size_t wait_data_size;
@@ -60,6 +73,41 @@ static ei_impulse_result_t ei_result;
 static int cur_res_idx;
 static ei_wrapper_result_ready_cb user_cb;
 
+#if CONFIG_EI_WRAPPER_PIPELINE
+#define PIPELINE_DEPTH			CONFIG_EI_WRAPPER_PIPELINE_DEPTH
+#define CAPTURE_THREAD_STACK_SIZE	CONFIG_EI_WRAPPER_PIPELINE_CAPTURE_THREAD_STACK_SIZE
+#define CAPTURE_THREAD_PRIORITY		CONFIG_EI_WRAPPER_PIPELINE_CAPTURE_THREAD_PRIORITY
+
+/* The capture thread must take the window out of the input buffer while the classifier runs. */
+BUILD_ASSERT(CAPTURE_THREAD_PRIORITY < THREAD_PRIORITY);
+
+/* Input window taken out of the input buffer, waiting for the classifier. */
+struct window_slot {
+	float data[INPUT_WINDOW_SIZE];
+	uint32_t copy_cycles;
+	atomic_val_t generation;
+};
+
+static K_THREAD_STACK_DEFINE(capture_thread_stack, CAPTURE_THREAD_STACK_SIZE);
+static struct k_thread capture_thread;
+
+static struct window_slot window_slots[PIPELINE_DEPTH];
+static struct window_slot *classified_slot;
+
+/* Indexes of the free slots, and of the captured slots in the order of the predictions. */
+K_MSGQ_DEFINE(free_slots, sizeof(uint8_t), PIPELINE_DEPTH, 1);
+K_MSGQ_DEFINE(captured_slots, sizeof(uint8_t), PIPELINE_DEPTH, 1);
+
+/* Incremented when the data is cleared, to drop the windows that are already captured. */
+static atomic_t generation;
+static ei_wrapper_window_captured_cb captured_cb;
+#endif /* CONFIG_EI_WRAPPER_PIPELINE */
+
+/* Value of one quantization step of the stored samples. */
+static float data_scale = 1.0f;
+static uint32_t copy_cycles;
+static int copy_time_us;
+
 
 BUILD_ASSERT(DATA_BUFFER_SIZE > INPUT_WINDOW_SIZE);
 BUILD_ASSERT(INPUT_WINDOW_SIZE % INPUT_FRAME_SIZE == 0);
@@ -71,17 +119,80 @@ static size_t buf_get_collected_data_count(const struct data_buffer *b)
 		return b->append_idx - b->process_idx;
 	}
 
-	return (ARRAY_SIZE(b->buf) - b->process_idx) + b->append_idx;
+	return (DATA_BUFFER_SIZE - b->process_idx) + b->append_idx;
 }
 
 static size_t buf_calc_free_space(const struct data_buffer *b)
 {
 	if (b->wait_data_size > 0) {
-		return b->wait_data_size + ARRAY_SIZE(b->buf) -
+		return b->wait_data_size + DATA_BUFFER_SIZE -
 		       INPUT_WINDOW_SIZE - 1;
 	}
 
-	return ARRAY_SIZE(b->buf) - buf_get_collected_data_count(b) - 1;
+	return DATA_BUFFER_SIZE - buf_get_collected_data_count(b) - 1;
+}
+
+static inline sample_t sample_store(float value)
+{
+	if (std::is_same<sample_t, float>::value) {
+		return value;
+	}
+
+	float quantized = roundf(value / data_scale);
+
+	quantized = MAX(quantized, (float)std::numeric_limits<sample_t>::min());
+	quantized = MIN(quantized, (float)std::numeric_limits<sample_t>::max());
+
+	return (sample_t)quantized;
+}
+
+static inline sample_t sample_store(int32_t value)
+{
+	if (std::is_same<sample_t, float>::value) {
+		return (sample_t)(value * data_scale);
+	}
+
+	/* Only types not wider than the stored samples are accepted. */
+	return (sample_t)value;
+}
+
+template <typename T>
+static void samples_store(sample_t *dst, const T *src, size_t len)
+{
+	if (std::is_same<T, sample_t>::value) {
+		memcpy(dst, src, len * sizeof(sample_t));
+		return;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		dst[i] = sample_store(src[i]);
+	}
+}
+
+static void samples_load(float *dst, const sample_t *src, size_t len)
+{
+	if (std::is_same<sample_t, float>::value) {
+		memcpy(dst, src, len * sizeof(float));
+		return;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		dst[i] = src[i] * data_scale;
+	}
+}
+
+template <typename T>
+static void buf_write(struct data_buffer *b, size_t idx, const T *data, size_t len)
+{
+	samples_store(&b->buf[idx], data, len);
+
+	/* Keep the mirror of the beginning of the ring up to date. */
+	if (idx < INPUT_WINDOW_SIZE) {
+		size_t mirror_cnt = MIN(len, INPUT_WINDOW_SIZE - idx);
+
+		memcpy(&b->buf[DATA_BUFFER_SIZE + idx], &b->buf[idx],
+		       mirror_cnt * sizeof(b->buf[0]));
+	}
 }
 
 static void buf_processing_end(struct data_buffer *b)
@@ -119,7 +230,8 @@ static int buf_cleanup(struct data_buffer *b, bool *cancelled)
 	return err;
 }
 
-static int buf_append(struct data_buffer *b, const float *data, size_t len,
+template <typename T>
+static int buf_append(struct data_buffer *b, const T *data, size_t len,
 		      bool *process_buf)
 {
 	*process_buf = false;
@@ -145,8 +257,8 @@ static int buf_append(struct data_buffer *b, const float *data, size_t len,
 		}
 	}
 
-	if (new_idx >= ARRAY_SIZE(b->buf)) {
-		new_idx -= ARRAY_SIZE(b->buf);
+	if (new_idx >= DATA_BUFFER_SIZE) {
+		new_idx -= DATA_BUFFER_SIZE;
 		looped = true;
 	}
 
@@ -155,42 +267,24 @@ static int buf_append(struct data_buffer *b, const float *data, size_t len,
 	k_spin_unlock(&b->lock, key);
 
 	if (looped) {
-		size_t copy_cnt = ARRAY_SIZE(b->buf) - cur_idx;
+		size_t copy_cnt = DATA_BUFFER_SIZE - cur_idx;
 
-		memcpy(&b->buf[cur_idx], data, copy_cnt * sizeof(b->buf[0]));
-		memcpy(&b->buf[0], data + copy_cnt,
-		      (len - copy_cnt) * sizeof(b->buf[0]));
+		buf_write(b, cur_idx, data, copy_cnt);
+		buf_write(b, 0, data + copy_cnt, len - copy_cnt);
 	} else {
-		memcpy(&b->buf[cur_idx], data, len * sizeof(b->buf[0]));
+		buf_write(b, cur_idx, data, len);
 	}
 
 	return 0;
 }
 
-static void buf_get(const struct data_buffer *b, float *b_res, size_t offset,
-		    size_t len)
+static const sample_t *buf_window_get(const struct data_buffer *b)
 {
-	__ASSERT_NO_MSG((offset + len) <= INPUT_WINDOW_SIZE);
-
 	/* Processing index cannot change while processing is done. */
 	__ASSERT_NO_MSG(b->state == STATE_PROCESSING);
 
-	size_t read_start = b->process_idx + offset;
-	size_t read_end = read_start + len;
-
-	if ((read_end > ARRAY_SIZE(b->buf)) && (read_start < ARRAY_SIZE(b->buf))) {
-		size_t copy_cnt = ARRAY_SIZE(b->buf) - read_start;
-
-		memcpy(b_res, &b->buf[read_start],
-		       copy_cnt * sizeof(b->buf[0]));
-		memcpy(b_res + copy_cnt, &b->buf[0],
-		       (len - copy_cnt) * sizeof(b->buf[0]));
-	} else {
-		if (read_start >= ARRAY_SIZE(b->buf)) {
-			read_start -= ARRAY_SIZE(b->buf);
-		}
-		memcpy(b_res, &b->buf[read_start], len * sizeof(b->buf[0]));
-	}
+	/* Thanks to the mirror, the window never wraps. */
+	return &b->buf[b->process_idx];
 }
 
 static int buf_processing_move(struct data_buffer *b, size_t move,
@@ -211,8 +305,8 @@ static int buf_processing_move(struct data_buffer *b, size_t move,
 	size_t max_move = buf_get_collected_data_count(b);
 
 	b->process_idx += move;
-	if (b->process_idx >= ARRAY_SIZE(b->buf)) {
-		b->process_idx -= ARRAY_SIZE(b->buf);
+	if (b->process_idx >= DATA_BUFFER_SIZE) {
+		b->process_idx -= DATA_BUFFER_SIZE;
 	}
 
 	size_t processing_end_move = move + INPUT_WINDOW_SIZE;
@@ -265,7 +359,8 @@ const char *ei_wrapper_get_classifier_label(size_t idx)
 	return ei_classifier_inferencing_categories[idx];
 }
 
-int ei_wrapper_add_data(const float *data, size_t data_size)
+template <typename T>
+static int add_data(const T *data, size_t data_size)
 {
 	if (data_size % INPUT_FRAME_SIZE) {
 		return -EINVAL;
@@ -281,9 +376,47 @@ int ei_wrapper_add_data(const float *data, size_t data_size)
 	return err;
 }
 
+int ei_wrapper_add_data(const float *data, size_t data_size)
+{
+	return add_data(data, data_size);
+}
+
+int ei_wrapper_add_data_int16(const int16_t *data, size_t data_size)
+{
+	if (sizeof(sample_t) < sizeof(int16_t)) {
+		return -ENOTSUP;
+	}
+
+	return add_data(data, data_size);
+}
+
+int ei_wrapper_add_data_int8(const int8_t *data, size_t data_size)
+{
+	return add_data(data, data_size);
+}
+
+int ei_wrapper_set_data_scale(float scale)
+{
+	if (!isfinite(scale) || (scale <= 0.0f)) {
+		return -EINVAL;
+	}
+
+	data_scale = scale;
+
+	return 0;
+}
+
 int ei_wrapper_clear_data(bool *cancelled)
 {
-	return buf_cleanup(&ei_input, cancelled);
+	int err = buf_cleanup(&ei_input, cancelled);
+
+#if CONFIG_EI_WRAPPER_PIPELINE
+	if (!err) {
+		atomic_inc(&generation);
+	}
+#endif /* CONFIG_EI_WRAPPER_PIPELINE */
+
+	return err;
 }
 
 int ei_wrapper_start_prediction(size_t window_shift, size_t frame_shift)
@@ -303,56 +436,157 @@ int ei_wrapper_start_prediction(size_t window_shift, size_t frame_shift)
 
 static int raw_feature_get_data(size_t offset, size_t length, float *out_ptr)
 {
-	buf_get(&ei_input, out_ptr, offset, length);
+	__ASSERT_NO_MSG((offset + length) <= INPUT_WINDOW_SIZE);
+
+	uint32_t start = k_cycle_get_32();
+
+	samples_load(out_ptr, buf_window_get(&ei_input) + offset, length);
+
+	copy_cycles += k_cycle_get_32() - start;
 
 	return 0;
 }
 
-static void processing_finished(int err)
+static EI_IMPULSE_ERROR classify(int (*get_data)(size_t, size_t, float *),
+				 uint32_t capture_cycles)
+{
+	signal_t features_signal;
+	int64_t start_time;
+
+	features_signal.get_data = get_data;
+	features_signal.total_length = INPUT_WINDOW_SIZE;
+	copy_cycles = capture_cycles;
+
+	if (IS_ENABLED(CONFIG_EI_WRAPPER_PROFILING)) {
+		start_time = k_uptime_get();
+	}
+
+	/* Invoke the impulse. */
+	EI_IMPULSE_ERROR err = run_classifier(&features_signal,
+					      &ei_result, DEBUG_MODE);
+	copy_time_us = k_cyc_to_us_floor32(copy_cycles);
+
+	if (IS_ENABLED(CONFIG_EI_WRAPPER_PROFILING)) {
+		int64_t delta = k_uptime_delta(&start_time);
+
+		LOG_INF("run_classifier execution time: %dms", (int32_t)delta);
+		LOG_INF("sampling: %dms dsp: %dms classification: %dms anomaly: %dms",
+			ei_result.timing.sampling,
+			ei_result.timing.dsp,
+			ei_result.timing.classification,
+			ei_result.timing.anomaly);
+		LOG_INF("input data copy: %dus", copy_time_us);
+	}
+
+	if (err) {
+		LOG_ERR("run_classifier err=%d", (int)err);
+	}
+
+	return err;
+}
+
+static void result_report(int err)
 {
 	__ASSERT_NO_MSG(user_cb);
 
-	buf_processing_end(&ei_input);
 	cur_res_idx = -1;
 	user_cb(err);
 }
 
-static void edge_impulse_thread_fn(void)
+#if CONFIG_EI_WRAPPER_PIPELINE
+static int slot_feature_get_data(size_t offset, size_t length, float *out_ptr)
 {
-	signal_t features_signal;
-	int64_t start_time;
+	__ASSERT_NO_MSG((offset + length) <= INPUT_WINDOW_SIZE);
+
+	uint32_t start = k_cycle_get_32();
+
+	memcpy(out_ptr, &classified_slot->data[offset], length * sizeof(float));
+
+	copy_cycles += k_cycle_get_32() - start;
+
+	return 0;
+}
+
+static void capture_thread_fn(void)
+{
+	uint8_t idx;
+	struct window_slot *slot;
 
 	while (true) {
 		k_sem_take(&ei_sem, K_FOREVER);
 
-		features_signal.get_data = &raw_feature_get_data;
-		features_signal.total_length = INPUT_WINDOW_SIZE;
+		/* Wait for the classifier if all the slots are in use. */
+		int err = k_msgq_get(&free_slots, &idx, K_FOREVER);
+
+		__ASSERT_NO_MSG(!err);
+		ARG_UNUSED(err);
+
+		slot = &window_slots[idx];
+
+		uint32_t start = k_cycle_get_32();
+
+		samples_load(slot->data, buf_window_get(&ei_input), INPUT_WINDOW_SIZE);
+		slot->copy_cycles = k_cycle_get_32() - start;
 
-		if (IS_ENABLED(CONFIG_EI_WRAPPER_PROFILING)) {
-			start_time = k_uptime_get();
+		/* Data cannot be cleared while the window is processed. */
+		slot->generation = atomic_get(&generation);
+
+		buf_processing_end(&ei_input);
+
+		err = k_msgq_put(&captured_slots, &idx, K_NO_WAIT);
+		__ASSERT_NO_MSG(!err);
+
+		if (captured_cb) {
+			captured_cb();
 		}
+	}
+}
+
+static void edge_impulse_thread_fn(void)
+{
+	uint8_t idx;
+
+	while (true) {
+		int err = k_msgq_get(&captured_slots, &idx, K_FOREVER);
+
+		__ASSERT_NO_MSG(!err);
+		ARG_UNUSED(err);
+
+		classified_slot = &window_slots[idx];
 
-		/* Invoke the impulse. */
-		EI_IMPULSE_ERROR err = run_classifier(&features_signal,
-						      &ei_result, DEBUG_MODE);
-		if (IS_ENABLED(CONFIG_EI_WRAPPER_PROFILING)) {
-			int64_t delta = k_uptime_delta(&start_time);
-
-			LOG_INF("run_classifier execution time: %dms", (int32_t)delta);
-			LOG_INF("sampling: %dms dsp: %dms classification: %dms anomaly: %dms",
-				ei_result.timing.sampling,
-				ei_result.timing.dsp,
-				ei_result.timing.classification,
-				ei_result.timing.anomaly);
+		if (classified_slot->generation != atomic_get(&generation)) {
+			LOG_DBG("Dropping window captured before the data was cleared");
+			err = k_msgq_put(&free_slots, &idx, K_NO_WAIT);
+			__ASSERT_NO_MSG(!err);
+			continue;
 		}
 
-		if (err) {
-			LOG_ERR("run_classifier err=%d", (int)err);
+		EI_IMPULSE_ERROR ei_err = classify(&slot_feature_get_data,
+						   classified_slot->copy_cycles);
+		bool dropped = (classified_slot->generation != atomic_get(&generation));
+
+		/* The slot is not used by the result, it can take the next window. */
+		err = k_msgq_put(&free_slots, &idx, K_NO_WAIT);
+		__ASSERT_NO_MSG(!err);
+
+		if (!dropped) {
+			result_report(ei_err);
 		}
+	}
+}
+#else
+static void edge_impulse_thread_fn(void)
+{
+	while (true) {
+		k_sem_take(&ei_sem, K_FOREVER);
+
+		EI_IMPULSE_ERROR err = classify(&raw_feature_get_data, 0);
 
-		processing_finished(err);
+		buf_processing_end(&ei_input);
+		result_report(err);
 	}
 }
+#endif /* CONFIG_EI_WRAPPER_PIPELINE */
 
 static bool can_read_result(void)
 {
@@ -464,6 +698,50 @@ int ei_wrapper_get_timing(int *dsp_time, int *classification_time, int *anomaly_
 	return 0;
 }
 
+int ei_wrapper_get_data_copy_time(int *copy_time)
+{
+	if (!can_read_result()) {
+		LOG_WRN("Result can be read only from callback context");
+		return -EACCES;
+	}
+
+	if (copy_time) {
+		*copy_time = copy_time_us;
+	}
+
+	return 0;
+}
+
+#if CONFIG_EI_WRAPPER_PIPELINE
+int ei_wrapper_set_window_captured_cb(ei_wrapper_window_captured_cb cb)
+{
+	if (user_cb) {
+		/* The callback must be set before the capture thread is started. */
+		return -EALREADY;
+	}
+
+	captured_cb = cb;
+
+	return 0;
+}
+
+static void pipeline_init(void)
+{
+	for (uint8_t idx = 0; idx < PIPELINE_DEPTH; idx++) {
+		int err = k_msgq_put(&free_slots, &idx, K_NO_WAIT);
+
+		__ASSERT_NO_MSG(!err);
+		ARG_UNUSED(err);
+	}
+
+	k_thread_create(&capture_thread, capture_thread_stack, CAPTURE_THREAD_STACK_SIZE,
+			(k_thread_entry_t)capture_thread_fn,
+			NULL, NULL, NULL,
+			CAPTURE_THREAD_PRIORITY, 0, K_NO_WAIT);
+	k_thread_name_set(&capture_thread, "edge_impulse_capture_thread");
+}
+#endif /* CONFIG_EI_WRAPPER_PIPELINE */
+
 int ei_wrapper_init(ei_wrapper_result_ready_cb cb)
 {
 	if (!cb) {
@@ -489,5 +767,9 @@ int ei_wrapper_init(ei_wrapper_result_ready_cb cb)
 				       THREAD_PRIORITY, 0, K_NO_WAIT);
 	k_thread_name_set(&thread, "edge_impulse_thread");
 
+#if CONFIG_EI_WRAPPER_PIPELINE
+	pipeline_init();
+#endif /* CONFIG_EI_WRAPPER_PIPELINE */
+
 	return 0;
 }
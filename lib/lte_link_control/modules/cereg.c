@@ -26,14 +26,31 @@ LOG_MODULE_DECLARE(lte_lc, CONFIG_LTE_LINK_CONTROL_LOG_LEVEL);
 #define AT_CEREG_READ "AT+CEREG?"
 #define AT_CEREG_5    "AT+CEREG=5"
 
-#define AT_CEREG_REG_STATUS_INDEX   1
-#define AT_CEREG_TAC_INDEX	    2
-#define AT_CEREG_CELL_ID_INDEX	    3
-#define AT_CEREG_ACT_INDEX	    4
-#define AT_CEREG_CAUSE_TYPE_INDEX   5
-#define AT_CEREG_REJECT_CAUSE_INDEX 6
-#define AT_CEREG_ACTIVE_TIME_INDEX  7
-#define AT_CEREG_TAU_INDEX	    8
+/* Number of fields up to and including the cell ID */
+#define AT_CEREG_CELL_ID_FIELDS 3
+
+/* Decoded +CEREG notification or response */
+struct cereg_params {
+	int32_t reg_status;
+	uint32_t tac;
+	uint32_t cell_id;
+	int32_t act;
+	int32_t cause_type;
+	int32_t reject_cause;
+	char active_time[9];
+	char tau_ext[9];
+};
+
+/* Only the registration status is mandatory, invalid optional parameters are ignored */
+AT_PARSER_SCHEMA_DEFINE(cereg_schema,
+	AT_PARSER_FIELD(struct cereg_params, reg_status),
+	AT_PARSER_FIELD_HEX_LENIENT(struct cereg_params, tac),
+	AT_PARSER_FIELD_HEX_LENIENT(struct cereg_params, cell_id),
+	AT_PARSER_FIELD_LENIENT(struct cereg_params, act),
+	AT_PARSER_FIELD_LENIENT(struct cereg_params, cause_type),
+	AT_PARSER_FIELD_LENIENT(struct cereg_params, reject_cause),
+	AT_PARSER_FIELD_LENIENT(struct cereg_params, active_time),
+	AT_PARSER_FIELD_LENIENT(struct cereg_params, tau_ext));
 
 /* Previously received LTE mode as indicated by the modem */
 static enum lte_lc_lte_mode prev_lte_mode = LTE_LC_LTE_MODE_NONE;
@@ -56,11 +73,15 @@ static int parse_cereg(const char *at_response, enum lte_lc_nw_reg_status *reg_s
 		       struct lte_lc_cell *cell, enum lte_lc_lte_mode *lte_mode,
 		       struct lte_lc_psm_cfg *psm_cfg)
 {
-	int err, temp;
+	int err, count;
 	struct at_parser parser;
-	char str_buf[10];
-	size_t len = sizeof(str_buf);
-	size_t count = 0;
+	struct cereg_params params = {
+		.tac = LTE_LC_CELL_TAC_INVALID,
+		.cell_id = LTE_LC_CELL_EUTRAN_ID_INVALID,
+		.act = -1,
+		.cause_type = -1,
+		.reject_cause = -1,
+	};
 
 	__ASSERT_NO_MSG(at_response != NULL);
 	__ASSERT_NO_MSG(reg_status != NULL);
@@ -80,114 +101,52 @@ static int parse_cereg(const char *at_response, enum lte_lc_nw_reg_status *reg_s
 	err = at_parser_init(&parser, at_response);
 	__ASSERT_NO_MSG(err == 0);
 
-	/* Get network registration status */
-	err = at_parser_num_get(&parser, AT_CEREG_REG_STATUS_INDEX, &temp);
-	if (err) {
-		LOG_ERR("Could not get registration status, error: %d", err);
-		goto clean_exit;
+	/* Decode all parameters in a single pass */
+	count = at_parser_decode(&parser, &cereg_schema, &params);
+	if (count < 0) {
+		LOG_ERR("Could not parse CEREG, potentially malformed notification, error: %d",
+			count);
+		return count;
 	}
 
-	*reg_status = temp;
+	*reg_status = params.reg_status;
 	LOG_DBG("Network registration status: %d", *reg_status);
 
-	err = at_parser_cmd_count_get(&parser, &count);
-	if (err) {
-		LOG_ERR("Could not get CEREG param count, potentially malformed notification, "
-			"error: %d",
-			err);
-		goto clean_exit;
-	}
-
-	if ((*reg_status != LTE_LC_NW_REG_UICC_FAIL) && (count > AT_CEREG_CELL_ID_INDEX)) {
-		/* Parse tracking area code */
-		err = at_parser_string_get(&parser, AT_CEREG_TAC_INDEX, str_buf, &len);
-		if (err) {
-			LOG_DBG("Could not get tracking area code, error: %d", err);
-		} else {
-			cell->tac = strtoul(str_buf, NULL, 16);
-		}
-
-		/* Parse cell ID */
-		len = sizeof(str_buf);
-
-		err = at_parser_string_get(&parser, AT_CEREG_CELL_ID_INDEX, str_buf, &len);
-		if (err) {
-			LOG_DBG("Could not get cell ID, error: %d", err);
-		} else {
-			cell->id = strtoul(str_buf, NULL, 16);
-		}
+	if ((*reg_status != LTE_LC_NW_REG_UICC_FAIL) && (count >= AT_CEREG_CELL_ID_FIELDS)) {
+		cell->tac = params.tac;
+		cell->id = params.cell_id;
 	}
 
-	/* Get currently active LTE mode. */
-	err = at_parser_num_get(&parser, AT_CEREG_ACT_INDEX, &temp);
-	if (err) {
-		LOG_DBG("LTE mode not found, error code: %d", err);
-
-		/* This is not an error that should be returned, as it's
-		 * expected in some situations that LTE mode is not available.
-		 */
-		err = 0;
-	} else {
-		*lte_mode = temp;
+	/* Currently active LTE mode is not always available. */
+	if (params.act != -1) {
+		*lte_mode = params.act;
 		LOG_DBG("LTE mode: %d", *lte_mode);
+	} else {
+		LOG_DBG("LTE mode not found");
 	}
 
-#if defined(CONFIG_LOG)
-	int cause_type;
-	int reject_cause;
-
 	/* Log reject cause if present. */
-	err = at_parser_num_get(&parser, AT_CEREG_CAUSE_TYPE_INDEX, &cause_type);
-	err |= at_parser_num_get(&parser, AT_CEREG_REJECT_CAUSE_INDEX, &reject_cause);
-	if (!err && cause_type == 0 /* EMM cause */) {
+	if (params.cause_type == 0 /* EMM cause */ && params.reject_cause != -1) {
 		LOG_WRN("Registration rejected, EMM cause: %d, Cell ID: %d, Tracking area: %d, "
 			"LTE mode: %d",
-			reject_cause, cell->id, cell->tac, *lte_mode);
+			params.reject_cause, cell->id, cell->tac, *lte_mode);
 	}
-	/* Absence of reject cause is not considered an error. */
-	err = 0;
-#endif /* CONFIG_LOG */
 
 #if defined(CONFIG_LTE_LC_PSM_MODULE)
 	/* Check PSM parameters only if we are connected */
 	if ((*reg_status != LTE_LC_NW_REG_REGISTERED_HOME) &&
 	    (*reg_status != LTE_LC_NW_REG_REGISTERED_ROAMING)) {
-		goto clean_exit;
-	}
-
-	char active_time_str[9] = {0};
-	char tau_ext_str[9] = {0};
-	int str_len;
-	int err_active_time;
-	int err_tau;
-
-	str_len = sizeof(active_time_str);
-
-	/* Get active time */
-	err_active_time = at_parser_string_get(&parser, AT_CEREG_ACTIVE_TIME_INDEX, active_time_str,
-					       &str_len);
-	if (err_active_time) {
-		LOG_DBG("Active time not found, error: %d", err_active_time);
-	} else {
-		LOG_DBG("Active time: %s", active_time_str);
+		return 0;
 	}
 
-	str_len = sizeof(tau_ext_str);
+	LOG_DBG("Active time: %s, TAU: %s", params.active_time, params.tau_ext);
 
-	/* Get Periodic-TAU-ext */
-	err_tau = at_parser_string_get(&parser, AT_CEREG_TAU_INDEX, tau_ext_str, &str_len);
-	if (err_tau) {
-		LOG_DBG("TAU not found, error: %d", err_tau);
-	} else {
-		LOG_DBG("TAU: %s", tau_ext_str);
-	}
-
-	if (err_active_time == 0 && err_tau == 0) {
+	if (params.active_time[0] != '\0' && params.tau_ext[0] != '\0') {
 		/* Legacy TAU is not requested because we do not get it from CEREG.
 		 * If extended TAU is not set, TAU will be set to inactive so
 		 * caller can then make its conclusions.
 		 */
-		err = psm_parse(active_time_str, tau_ext_str, NULL, psm_cfg);
+		err = psm_parse(params.active_time, params.tau_ext, NULL, psm_cfg);
 		if (err) {
 			LOG_ERR("Failed to parse PSM configuration, error: %d", err);
 		}
@@ -195,11 +154,9 @@ static int parse_cereg(const char *at_response, enum lte_lc_nw_reg_status *reg_s
 	/* The notification does not always contain PSM parameters,
 	 * so this is not considered an error
 	 */
-	err = 0;
 #endif
 
-clean_exit:
-	return err;
+	return 0;
 }
 
 static void at_handler_cereg(const char *response)
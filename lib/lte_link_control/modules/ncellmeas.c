@@ -29,31 +29,8 @@ LOG_MODULE_DECLARE(lte_lc, CONFIG_LTE_LINK_CONTROL_LOG_LEVEL);
 #define AT_NCELLMEAS_STATUS_VALUE_FAIL	     1
 #define AT_NCELLMEAS_STATUS_VALUE_INCOMPLETE 2
 #define AT_NCELLMEAS_CELL_ID_INDEX	     2
-#define AT_NCELLMEAS_PLMN_INDEX		     3
-#define AT_NCELLMEAS_TAC_INDEX		     4
-#define AT_NCELLMEAS_TIMING_ADV_INDEX	     5
-#define AT_NCELLMEAS_EARFCN_INDEX	     6
-#define AT_NCELLMEAS_PHYS_CELL_ID_INDEX	     7
-#define AT_NCELLMEAS_RSRP_INDEX		     8
-#define AT_NCELLMEAS_RSRQ_INDEX		     9
-#define AT_NCELLMEAS_MEASUREMENT_TIME_INDEX  10
 #define AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT 11
-/* The rest of the parameters are in repeating arrays per neighboring cell.
- * The indices below refer to their index within such a repeating array.
- */
-#define AT_NCELLMEAS_N_EARFCN_INDEX	     0
-#define AT_NCELLMEAS_N_PHYS_CELL_ID_INDEX    1
-#define AT_NCELLMEAS_N_RSRP_INDEX	     2
-#define AT_NCELLMEAS_N_RSRQ_INDEX	     3
-#define AT_NCELLMEAS_N_TIME_DIFF_INDEX	     4
 #define AT_NCELLMEAS_N_PARAMS_COUNT	     5
-#define AT_NCELLMEAS_N_MAX_ARRAY_SIZE	     CONFIG_LTE_NEIGHBOR_CELLS_MAX
-
-#define AT_NCELLMEAS_PARAMS_COUNT_MAX                                                              \
-	(AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT +                                                    \
-	 AT_NCELLMEAS_N_PARAMS_COUNT * CONFIG_LTE_NEIGHBOR_CELLS_MAX)
-
-#define AT_NCELLMEAS_GCI_CELL_PARAMS_COUNT 12
 
 /* Requested NCELLMEAS params */
 static struct lte_lc_ncellmeas_params ncellmeas_params;
@@ -62,59 +39,233 @@ K_SEM_DEFINE(ncellmeas_idle_sem, 1, 1);
 
 AT_MONITOR(ltelc_atmon_ncellmeas, "%NCELLMEAS", at_handler_ncellmeas);
 
-/* Counts the frequency of a character in a null-terminated string. */
-static uint32_t get_char_frequency(const char *str, char c)
+/* Neighbor cell measurement results are read from the notification in a single forward pass.
+ * Subparameters are always requested at increasing indices, so that the AT parser never rewinds
+ * and each subparameter is tokenized only once, regardless of the number of cells.
+ */
+struct ncellmeas_reader {
+	struct at_parser parser;
+	/* Index of the next subparameter. */
+	size_t index;
+};
+
+#define NCELLMEAS_NUM_GET(_reader, _value)                                                         \
+	at_parser_num_get(&(_reader)->parser, (_reader)->index++, _value)
+
+/* Check if the error is returned because there are no more subparameters. */
+static bool is_line_end(int err)
+{
+	return err == -EIO || err == -EAGAIN;
+}
+
+static int ncellmeas_reader_init(struct ncellmeas_reader *reader, const char *at_response,
+				 int *status)
 {
-	uint32_t count = 0;
+	int err;
+
+	err = at_parser_init(&reader->parser, at_response);
+	__ASSERT_NO_MSG(err == 0);
 
-	__ASSERT_NO_MSG(str != NULL);
+	reader->index = AT_NCELLMEAS_STATUS_INDEX;
 
-	do {
-		if (*str == c) {
-			count++;
+	err = NCELLMEAS_NUM_GET(reader, status);
+	if (err) {
+		LOG_DBG("Cannot parse NCELLMEAS status");
+		return err;
+	}
+
+	if (*status == AT_NCELLMEAS_STATUS_VALUE_FAIL) {
+		LOG_WRN("NCELLMEAS failed");
+		return 1;
+	} else if (*status == AT_NCELLMEAS_STATUS_VALUE_INCOMPLETE) {
+		LOG_WRN("NCELLMEAS interrupted; results incomplete");
+	}
+
+	return 0;
+}
+
+/* Parse <cell_id>,<plmn>,<tac>,<ta>[,<ta_meas_time>],<earfcn>,<phys_cell_id>,<rsrp>,<rsrq>,
+ * <meas_time>. The <ta_meas_time> is only present in the results of the GCI search types.
+ */
+static int cell_parse(struct ncellmeas_reader *reader, struct lte_lc_cell *cell, bool gci)
+{
+	int err, tmp;
+
+	/* <cell_id> */
+	err = string_param_to_int(&reader->parser, reader->index++, &tmp, 16);
+	if (err) {
+		return err;
+	}
+
+	if (tmp > LTE_LC_CELL_EUTRAN_ID_MAX) {
+		LOG_WRN("cell_id = %d which is > LTE_LC_CELL_EUTRAN_ID_MAX; marking invalid", tmp);
+		tmp = LTE_LC_CELL_EUTRAN_ID_INVALID;
+	}
+	cell->id = tmp;
+
+	/* <plmn>, that is, MCC and MNC */
+	err = plmn_param_string_to_mcc_mnc(&reader->parser, reader->index++, &cell->mcc,
+					   &cell->mnc);
+	if (err) {
+		return err;
+	}
+
+	/* <tac> */
+	err = string_param_to_int(&reader->parser, reader->index++, &tmp, 16);
+	if (err) {
+		LOG_ERR("Could not parse tracking_area_code, error: %d", err);
+		return err;
+	}
+	cell->tac = tmp;
+
+	/* <ta> */
+	err = NCELLMEAS_NUM_GET(reader, &tmp);
+	if (err) {
+		LOG_ERR("Could not parse timing_advance, error: %d", err);
+		return err;
+	}
+	cell->timing_advance = tmp;
+
+	/* <ta_meas_time> */
+	if (gci) {
+		err = NCELLMEAS_NUM_GET(reader, &cell->timing_advance_meas_time);
+		if (err) {
+			LOG_ERR("Could not parse timing_advance_meas_time, error: %d", err);
+			return err;
 		}
-	} while (*(str++) != '\0');
+	}
+
+	/* <earfcn> */
+	err = NCELLMEAS_NUM_GET(reader, &cell->earfcn);
+	if (err) {
+		LOG_ERR("Could not parse earfcn, error: %d", err);
+		return err;
+	}
+
+	/* <phys_cell_id> */
+	err = NCELLMEAS_NUM_GET(reader, &cell->phys_cell_id);
+	if (err) {
+		LOG_ERR("Could not parse phys_cell_id, error: %d", err);
+		return err;
+	}
+
+	/* <rsrp> */
+	err = NCELLMEAS_NUM_GET(reader, &cell->rsrp);
+	if (err) {
+		LOG_ERR("Could not parse rsrp, error: %d", err);
+		return err;
+	}
 
-	return count;
+	/* <rsrq> */
+	err = NCELLMEAS_NUM_GET(reader, &cell->rsrq);
+	if (err) {
+		LOG_ERR("Could not parse rsrq, error: %d", err);
+		return err;
+	}
+
+	/* <meas_time> */
+	err = NCELLMEAS_NUM_GET(reader, &cell->measurement_time);
+	if (err) {
+		LOG_ERR("Could not parse meas_time, error: %d", err);
+		return err;
+	}
+
+	return 0;
 }
 
+/* Parse <n_phys_cell_id>,<n_rsrp>,<n_rsrq>,<time_diff> of a neighbor cell.
+ * The <n_earfcn> is read by the caller.
+ */
+static int ncell_parse(struct ncellmeas_reader *reader, struct lte_lc_ncell *ncell)
+{
+	int err, tmp;
+
+	/* <n_phys_cell_id> */
+	err = NCELLMEAS_NUM_GET(reader, &ncell->phys_cell_id);
+	if (err) {
+		LOG_ERR("Could not parse n_phys_cell_id, error: %d", err);
+		return err;
+	}
+
+	/* <n_rsrp> */
+	err = NCELLMEAS_NUM_GET(reader, &tmp);
+	if (err) {
+		LOG_ERR("Could not parse n_rsrp, error: %d", err);
+		return err;
+	}
+	ncell->rsrp = tmp;
+
+	/* <n_rsrq> */
+	err = NCELLMEAS_NUM_GET(reader, &tmp);
+	if (err) {
+		LOG_ERR("Could not parse n_rsrq, error: %d", err);
+		return err;
+	}
+	ncell->rsrq = tmp;
+
+	/* <time_diff> */
+	err = NCELLMEAS_NUM_GET(reader, &ncell->time_diff);
+	if (err) {
+		LOG_ERR("Could not parse time_diff, error: %d", err);
+		return err;
+	}
+
+	return 0;
+}
+
+/* Count the neighbor cells in a response of the normal search types from the number of
+ * commas, so that only the needed memory is allocated. The trailing <ta_meas_time> does not
+ * add a cell.
+ */
 static uint32_t neighborcell_count_get(const char *at_response)
 {
-	uint32_t comma_count, ncell_elements, ncell_count;
+	uint32_t comma_count = 0;
 
-	__ASSERT_NO_MSG(at_response != NULL);
+	for (const char *c = at_response; *c != '\0'; c++) {
+		if (*c == ',') {
+			comma_count++;
+		}
+	}
 
-	comma_count = get_char_frequency(at_response, ',');
 	if (comma_count < AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT) {
 		return 0;
 	}
 
 	/* Add one, as there's no comma after the last element. */
-	ncell_elements = comma_count - (AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT - 1) + 1;
-	ncell_count = ncell_elements / AT_NCELLMEAS_N_PARAMS_COUNT;
+	return (comma_count - (AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT - 1) + 1) /
+	       AT_NCELLMEAS_N_PARAMS_COUNT;
+}
 
-	return ncell_count;
+/* Get storage for the next neighbor cell. Cells beyond the allocated number, which is at most
+ * CONFIG_LTE_NEIGHBOR_CELLS_MAX, are parsed into the given scratch cell and dropped.
+ */
+static struct lte_lc_ncell *ncell_slot_get(struct lte_lc_cells_info *cells, size_t ncells_max,
+					   struct lte_lc_ncell *scratch, bool *incomplete)
+{
+	if (cells->ncells_count >= ncells_max) {
+		if (!*incomplete) {
+			LOG_WRN("Cutting response, because received neigbor cell"
+				" count is bigger than configured max: %d",
+				CONFIG_LTE_NEIGHBOR_CELLS_MAX);
+			*incomplete = true;
+		}
+
+		return scratch;
+	}
+
+	return &cells->neighbor_cells[cells->ncells_count++];
 }
 
 static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const char *at_response,
 			       struct lte_lc_cells_info *cells)
 {
-	struct at_parser parser;
-	struct lte_lc_ncell *ncells = NULL;
-	int err, status, tmp_int, len;
+	struct ncellmeas_reader reader;
+	struct lte_lc_ncell scratch;
+	int err, status;
 	int16_t tmp_short;
-	char tmp_str[7];
 	bool incomplete = false;
-	int curr_index;
-	size_t i = 0, j = 0, k = 0;
-
-	/* Count the actual number of parameters in the AT response before
-	 * allocating heap for it. This may save quite a bit of heap as the
-	 * worst case scenario is 96 elements.
-	 * 3 is added to account for the parameters that do not have a trailing
-	 * comma.
-	 */
-	size_t param_count = get_char_frequency(at_response, ',') + 3;
+	size_t ncells_max = 0;
+	size_t i;
 
 	__ASSERT_NO_MSG(at_response != NULL);
 	__ASSERT_NO_MSG(params != NULL);
@@ -150,257 +301,96 @@ static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const cha
 	 *	[,<n_earfcn2>,<n_phys_cell_id2>,<n_rsrp2>,<n_rsrq2>,<time_diff2>]...]...
 	 */
 
-	err = at_parser_init(&parser, at_response);
-	__ASSERT_NO_MSG(err == 0);
-
-	/* Status code */
-	curr_index = AT_NCELLMEAS_STATUS_INDEX;
-	err = at_parser_num_get(&parser, curr_index, &status);
+	err = ncellmeas_reader_init(&reader, at_response, &status);
 	if (err) {
-		LOG_DBG("Cannot parse NCELLMEAS status");
-		goto clean_exit;
-	}
-
-	if (status == AT_NCELLMEAS_STATUS_VALUE_FAIL) {
-		err = 1;
-		LOG_WRN("NCELLMEAS failed");
-		goto clean_exit;
-	} else if (status == AT_NCELLMEAS_STATUS_VALUE_INCOMPLETE) {
-		LOG_WRN("NCELLMEAS interrupted; results incomplete");
-		if (param_count == 3) {
-			/* No results, skip parsing. */
-			goto clean_exit;
-		}
+		return err;
 	}
 
 	/* Go through the cells */
-	for (i = 0; curr_index < (param_count - (AT_NCELLMEAS_GCI_CELL_PARAMS_COUNT + 1)) &&
-		    i < params->gci_count;
-	     i++) {
+	for (i = 0; i < params->gci_count; i++) {
 		struct lte_lc_cell parsed_cell;
 		bool is_serving_cell;
+		bool store_ncells = false;
 		uint8_t parsed_ncells_count;
+		size_t start = reader.index;
 
-		/* <cell_id>  */
-		curr_index++;
-		err = string_param_to_int(&parser, curr_index, &tmp_int, 16);
-		if (err) {
-			LOG_ERR("Could not parse cell_id, index %d, i %d error: %d", curr_index, i,
-				err);
-			goto clean_exit;
-		}
-
-		if (tmp_int > LTE_LC_CELL_EUTRAN_ID_MAX) {
-			LOG_WRN("cell_id = %d which is > LTE_LC_CELL_EUTRAN_ID_MAX; "
-				"marking invalid",
-				tmp_int);
-			tmp_int = LTE_LC_CELL_EUTRAN_ID_INVALID;
-		}
-		parsed_cell.id = tmp_int;
-
-		/* <plmn> */
-		len = sizeof(tmp_str);
-
-		curr_index++;
-		err = at_parser_string_get(&parser, curr_index, tmp_str, &len);
-		if (err) {
-			LOG_ERR("Could not parse plmn, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* Read MNC and store as integer. The MNC starts as the fourth character
-		 * in the string, following three characters long MCC.
+		err = cell_parse(&reader, &parsed_cell, true);
+		/* A successful measurement always has at least one cell, so running out of them
+		 * before the first one is an error unless the measurement was interrupted.
 		 */
-		err = string_to_int(&tmp_str[3], 10, &parsed_cell.mnc);
-		if (err) {
-			LOG_ERR("string_to_int, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* Null-terminated MCC, read and store it. */
-		tmp_str[3] = '\0';
-
-		err = string_to_int(tmp_str, 10, &parsed_cell.mcc);
-		if (err) {
-			LOG_ERR("string_to_int, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <tac> */
-		curr_index++;
-		err = string_param_to_int(&parser, curr_index, &tmp_int, 16);
-		if (err) {
-			LOG_ERR("Could not parse tracking_area_code in i %d, error: %d", i, err);
-			goto clean_exit;
-		}
-		parsed_cell.tac = tmp_int;
-
-		/* <ta> */
-		curr_index++;
-		err = at_parser_num_get(&parser, curr_index, &tmp_int);
-		if (err) {
-			LOG_ERR("Could not parse timing_advance, error: %d", err);
-			goto clean_exit;
-		}
-		parsed_cell.timing_advance = tmp_int;
-
-		/* <ta_meas_time> */
-		curr_index++;
-		err = at_parser_num_get(&parser, curr_index, &parsed_cell.timing_advance_meas_time);
-		if (err) {
-			LOG_ERR("Could not parse timing_advance_meas_time, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <earfcn> */
-		curr_index++;
-		err = at_parser_num_get(&parser, curr_index, &parsed_cell.earfcn);
-		if (err) {
-			LOG_ERR("Could not parse earfcn, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <phys_cell_id> */
-		curr_index++;
-		err = at_parser_num_get(&parser, curr_index, &parsed_cell.phys_cell_id);
-		if (err) {
-			LOG_ERR("Could not parse phys_cell_id, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <rsrp> */
-		curr_index++;
-		err = at_parser_num_get(&parser, curr_index, &parsed_cell.rsrp);
-		if (err) {
-			LOG_ERR("Could not parse rsrp, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <rsrq> */
-		curr_index++;
-		err = at_parser_num_get(&parser, curr_index, &parsed_cell.rsrq);
-		if (err) {
-			LOG_ERR("Could not parse rsrq, error: %d", err);
-			goto clean_exit;
-		}
-
-		/* <meas_time> */
-		curr_index++;
-		err = at_parser_num_get(&parser, curr_index, &parsed_cell.measurement_time);
-		if (err) {
-			LOG_ERR("Could not parse meas_time, error: %d", err);
-			goto clean_exit;
+		if (is_line_end(err) && reader.index == start + 1 &&
+		    (i > 0 || status == AT_NCELLMEAS_STATUS_VALUE_INCOMPLETE)) {
+			/* No more cells. */
+			err = 0;
+			break;
+		} else if (err) {
+			LOG_ERR("Could not parse cell %d, error: %d", i, err);
+			return err;
 		}
 
 		/* <serving> */
-		curr_index++;
-		err = at_parser_num_get(&parser, curr_index, &tmp_short);
+		err = NCELLMEAS_NUM_GET(&reader, &tmp_short);
 		if (err) {
 			LOG_ERR("Could not parse serving, error: %d", err);
-			goto clean_exit;
+			return err;
 		}
 		is_serving_cell = tmp_short;
 
 		/* <neighbor_count> */
-		curr_index++;
-		err = at_parser_num_get(&parser, curr_index, &tmp_short);
+		err = NCELLMEAS_NUM_GET(&reader, &tmp_short);
 		if (err) {
 			LOG_ERR("Could not parse neighbor_count, error: %d", err);
-			goto clean_exit;
+			return err;
 		}
 		parsed_ncells_count = tmp_short;
 
-		if (is_serving_cell) {
-			int to_be_parsed_ncell_count = 0;
-
+		if (!is_serving_cell) {
+			cells->gci_cells[cells->gci_cells_count++] = parsed_cell;
+		} else {
 			/* This the current/serving cell.
 			 * In practice the <neighbor_count> is always 0 for other than
 			 * the serving cell, i.e. no neigbour cell list is available.
 			 * Thus, handle neighbor cells only for the serving cell.
 			 */
 			cells->current_cell = parsed_cell;
-			if (parsed_ncells_count != 0) {
+
+			if (parsed_ncells_count != 0 && cells->neighbor_cells == NULL) {
 				/* Allocate room for the parsed neighbor info. */
-				if (parsed_ncells_count > CONFIG_LTE_NEIGHBOR_CELLS_MAX) {
-					to_be_parsed_ncell_count = CONFIG_LTE_NEIGHBOR_CELLS_MAX;
-					incomplete = true;
-					LOG_WRN("Cutting response, because received neigbor cell"
-						" count is bigger than configured max: %d",
-						CONFIG_LTE_NEIGHBOR_CELLS_MAX);
-
-				} else {
-					to_be_parsed_ncell_count = parsed_ncells_count;
-				}
-				ncells = k_calloc(to_be_parsed_ncell_count,
-						  sizeof(struct lte_lc_ncell));
-				if (ncells == NULL) {
+				ncells_max = MIN(parsed_ncells_count,
+						 CONFIG_LTE_NEIGHBOR_CELLS_MAX);
+				cells->neighbor_cells =
+					k_calloc(ncells_max, sizeof(struct lte_lc_ncell));
+				if (cells->neighbor_cells == NULL) {
 					LOG_WRN("Failed to allocate memory for the ncells"
 						" (continue)");
-					continue;
 				}
-				cells->neighbor_cells = ncells;
-				cells->ncells_count = to_be_parsed_ncell_count;
+
+				store_ncells = cells->neighbor_cells != NULL;
 			}
+		}
 
-			/* Parse neighbors */
-			for (j = 0; j < parsed_ncells_count; j++) {
-				/* If maximum number of cells has been stored, skip the data for
-				 * the remaining ncells to be able to continue from next GCI cell
-				 */
-				if (j >= to_be_parsed_ncell_count) {
-					LOG_WRN("Ignoring ncell");
-					curr_index += 5;
-					continue;
-				}
-				/* <n_earfcn[j]> */
-				curr_index++;
-				err = at_parser_num_get(&parser, curr_index,
-							&cells->neighbor_cells[j].earfcn);
-				if (err) {
-					LOG_ERR("Could not parse n_earfcn, error: %d", err);
-					goto clean_exit;
-				}
+		/* Parse neighbors */
+		for (size_t j = 0; j < parsed_ncells_count; j++) {
+			struct lte_lc_ncell *ncell = &scratch;
 
-				/* <n_phys_cell_id[j]> */
-				curr_index++;
-				err = at_parser_num_get(&parser, curr_index,
-							&cells->neighbor_cells[j].phys_cell_id);
-				if (err) {
-					LOG_ERR("Could not parse n_phys_cell_id, error: %d", err);
-					goto clean_exit;
-				}
+			/* Neighbors that are not stored are skipped to be able to continue from
+			 * the next GCI cell.
+			 */
+			if (store_ncells) {
+				ncell = ncell_slot_get(cells, ncells_max, &scratch, &incomplete);
+			}
 
-				/* <n_rsrp[j]> */
-				curr_index++;
-				err = at_parser_num_get(&parser, curr_index, &tmp_int);
-				if (err) {
-					LOG_ERR("Could not parse n_rsrp, error: %d", err);
-					goto clean_exit;
-				}
-				cells->neighbor_cells[j].rsrp = tmp_int;
-
-				/* <n_rsrq[j]> */
-				curr_index++;
-				err = at_parser_num_get(&parser, curr_index, &tmp_int);
-				if (err) {
-					LOG_ERR("Could not parse n_rsrq, error: %d", err);
-					goto clean_exit;
-				}
-				cells->neighbor_cells[j].rsrq = tmp_int;
-
-				/* <time_diff[j]> */
-				curr_index++;
-				err = at_parser_num_get(&parser, curr_index,
-							&cells->neighbor_cells[j].time_diff);
-				if (err) {
-					LOG_ERR("Could not parse time_diff, error: %d", err);
-					goto clean_exit;
-				}
+			/* <n_earfcn> */
+			err = NCELLMEAS_NUM_GET(&reader, &ncell->earfcn);
+			if (err) {
+				LOG_ERR("Could not parse n_earfcn, error: %d", err);
+				return err;
+			}
+
+			err = ncell_parse(&reader, ncell);
+			if (err) {
+				return err;
 			}
-		} else {
-			cells->gci_cells[k] = parsed_cell;
-			cells->gci_cells_count++; /* Increase count for non-serving GCI cell */
-			k++;
 		}
 	}
 
@@ -409,196 +399,92 @@ static int parse_ncellmeas_gci(struct lte_lc_ncellmeas_params *params, const cha
 		LOG_WRN("Buffer is too small; results incomplete: %d", err);
 	}
 
-clean_exit:
 	return err;
 }
 
 static int parse_ncellmeas(const char *at_response, struct lte_lc_cells_info *cells)
 {
-	int err, status, tmp;
-	struct at_parser parser;
-	size_t count = 0;
+	struct ncellmeas_reader reader;
+	struct lte_lc_ncell scratch;
+	int err, status;
 	bool incomplete = false;
+	size_t ncells_max = 0;
 
 	__ASSERT_NO_MSG(at_response != NULL);
 	__ASSERT_NO_MSG(cells != NULL);
 
+	/*
+	 * Response format:
+	 * %NCELLMEAS: status
+	 * [,<cell_id>,<plmn>,<tac>,<ta>,<earfcn>,<phys_cell_id>,<rsrp>,<rsrq>,<meas_time>
+	 *	[,<n_earfcn1>,<n_phys_cell_id1>,<n_rsrp1>,<n_rsrq1>,<time_diff1>]
+	 *	[,<n_earfcn2>,<n_phys_cell_id2>,<n_rsrp2>,<n_rsrq2>,<time_diff2>]...
+	 *	[,<ta_meas_time>]]
+	 */
+
 	cells->ncells_count = 0;
 	cells->current_cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID;
+	cells->current_cell.timing_advance_meas_time = 0;
 
-	err = at_parser_init(&parser, at_response);
-	__ASSERT_NO_MSG(err == 0);
-
-	err = at_parser_cmd_count_get(&parser, &count);
-	if (err) {
-		LOG_ERR("Could not get NCELLMEAS param count, "
-			"potentially malformed notification, error: %d",
-			err);
-		goto clean_exit;
-	}
-
-	/* Status code */
-	err = at_parser_num_get(&parser, AT_NCELLMEAS_STATUS_INDEX, &status);
-	if (err) {
-		goto clean_exit;
-	}
-
-	if (status == AT_NCELLMEAS_STATUS_VALUE_FAIL) {
-		err = 1;
-		LOG_WRN("NCELLMEAS failed");
-		goto clean_exit;
-	} else if (status == AT_NCELLMEAS_STATUS_VALUE_INCOMPLETE) {
-		LOG_WRN("NCELLMEAS interrupted; results incomplete");
-		if (count == 2) {
-			/* No results, skip parsing. */
-			goto clean_exit;
-		}
-	}
-
-	/* Current cell ID */
-	err = string_param_to_int(&parser, AT_NCELLMEAS_CELL_ID_INDEX, &tmp, 16);
-	if (err) {
-		goto clean_exit;
-	}
-
-	if (tmp > LTE_LC_CELL_EUTRAN_ID_MAX) {
-		tmp = LTE_LC_CELL_EUTRAN_ID_INVALID;
-	}
-	cells->current_cell.id = tmp;
-
-	/* PLMN, that is, MCC and MNC */
-	err = plmn_param_string_to_mcc_mnc(&parser, AT_NCELLMEAS_PLMN_INDEX,
-					   &cells->current_cell.mcc, &cells->current_cell.mnc);
+	err = ncellmeas_reader_init(&reader, at_response, &status);
 	if (err) {
-		goto clean_exit;
+		return err;
 	}
 
-	/* Tracking area code */
-	err = string_param_to_int(&parser, AT_NCELLMEAS_TAC_INDEX, &tmp, 16);
-	if (err) {
-		goto clean_exit;
-	}
-
-	cells->current_cell.tac = tmp;
-
-	/* Timing advance */
-	err = at_parser_num_get(&parser, AT_NCELLMEAS_TIMING_ADV_INDEX, &tmp);
-	if (err) {
-		goto clean_exit;
-	}
-
-	cells->current_cell.timing_advance = tmp;
-
-	/* EARFCN */
-	err = at_parser_num_get(&parser, AT_NCELLMEAS_EARFCN_INDEX, &cells->current_cell.earfcn);
-	if (err) {
-		goto clean_exit;
-	}
-
-	/* Physical cell ID */
-	err = at_parser_num_get(&parser, AT_NCELLMEAS_PHYS_CELL_ID_INDEX,
-				&cells->current_cell.phys_cell_id);
-	if (err) {
-		goto clean_exit;
-	}
-
-	/* RSRP */
-	err = at_parser_num_get(&parser, AT_NCELLMEAS_RSRP_INDEX, &tmp);
-	if (err) {
-		goto clean_exit;
-	}
-
-	cells->current_cell.rsrp = tmp;
-
-	/* RSRQ */
-	err = at_parser_num_get(&parser, AT_NCELLMEAS_RSRQ_INDEX, &tmp);
-	if (err) {
-		goto clean_exit;
-	}
-
-	cells->current_cell.rsrq = tmp;
-
-	/* Measurement time */
-	err = at_parser_num_get(&parser, AT_NCELLMEAS_MEASUREMENT_TIME_INDEX,
-				&cells->current_cell.measurement_time);
-	if (err) {
-		goto clean_exit;
-	}
-
-	/* Neighbor cell count */
-	cells->ncells_count = neighborcell_count_get(at_response);
-
-	/* Starting from modem firmware v1.3.1, timing advance measurement time
-	 * information is added as the last parameter in the response.
-	 */
-	size_t ta_meas_time_index = AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT +
-				    cells->ncells_count * AT_NCELLMEAS_N_PARAMS_COUNT;
-
-	if (count > ta_meas_time_index) {
-		err = at_parser_num_get(&parser, ta_meas_time_index,
-					&cells->current_cell.timing_advance_meas_time);
-		if (err) {
-			goto clean_exit;
-		}
-	} else {
-		cells->current_cell.timing_advance_meas_time = 0;
-	}
-
-	if (cells->ncells_count == 0) {
-		goto clean_exit;
-	}
-
-	__ASSERT_NO_MSG(cells->neighbor_cells != NULL);
-
-	if (cells->ncells_count > CONFIG_LTE_NEIGHBOR_CELLS_MAX) {
-		cells->ncells_count = CONFIG_LTE_NEIGHBOR_CELLS_MAX;
-		incomplete = true;
-		LOG_WRN("Cutting response, because received neigbor cell"
-			" count is bigger than configured max: %d",
-			CONFIG_LTE_NEIGHBOR_CELLS_MAX);
+	err = cell_parse(&reader, &cells->current_cell, false);
+	if (is_line_end(err) && reader.index == AT_NCELLMEAS_CELL_ID_INDEX + 1 &&
+	    status == AT_NCELLMEAS_STATUS_VALUE_INCOMPLETE) {
+		/* No results. */
+		return 0;
+	} else if (err) {
+		return err;
 	}
 
 	/* Neighboring cells */
-	for (size_t i = 0; i < cells->ncells_count; i++) {
-		size_t start_idx =
-			AT_NCELLMEAS_PRE_NCELLS_PARAMS_COUNT + i * AT_NCELLMEAS_N_PARAMS_COUNT;
-
-		/* EARFCN */
-		err = at_parser_num_get(&parser, start_idx + AT_NCELLMEAS_N_EARFCN_INDEX,
-					&cells->neighbor_cells[i].earfcn);
-		if (err) {
-			goto clean_exit;
+	while (true) {
+		struct lte_lc_ncell ncell;
+		uint64_t value;
+		size_t start;
+
+		/* The neighbor cells are followed by the timing advance measurement time, which
+		 * is present starting from modem firmware v1.3.1. Whether the value is
+		 * <n_earfcn> or <ta_meas_time> is known only after reading the next subparameter.
+		 */
+		err = NCELLMEAS_NUM_GET(&reader, &value);
+		if (is_line_end(err)) {
+			err = 0;
+			break;
+		} else if (err) {
+			return err;
 		}
 
-		/* Physical cell ID */
-		err = at_parser_num_get(&parser, start_idx + AT_NCELLMEAS_N_PHYS_CELL_ID_INDEX,
-					&cells->neighbor_cells[i].phys_cell_id);
-		if (err) {
-			goto clean_exit;
-		}
+		start = reader.index;
 
-		/* RSRP */
-		err = at_parser_num_get(&parser, start_idx + AT_NCELLMEAS_N_RSRP_INDEX, &tmp);
-		if (err) {
-			goto clean_exit;
+		err = ncell_parse(&reader, &ncell);
+		if (is_line_end(err) && reader.index == start + 1) {
+			cells->current_cell.timing_advance_meas_time = value;
+			err = 0;
+			break;
+		} else if (err) {
+			return err;
 		}
 
-		cells->neighbor_cells[i].rsrp = tmp;
-
-		/* RSRQ */
-		err = at_parser_num_get(&parser, start_idx + AT_NCELLMEAS_N_RSRQ_INDEX, &tmp);
-		if (err) {
-			goto clean_exit;
+		if (value > UINT32_MAX) {
+			return -ERANGE;
 		}
-
-		cells->neighbor_cells[i].rsrq = tmp;
-
-		/* Time difference */
-		err = at_parser_num_get(&parser, start_idx + AT_NCELLMEAS_N_TIME_DIFF_INDEX,
-					&cells->neighbor_cells[i].time_diff);
-		if (err) {
-			goto clean_exit;
+		ncell.earfcn = value;
+
+		if (cells->neighbor_cells == NULL) {
+			ncells_max = CLAMP(neighborcell_count_get(at_response), 1,
+					   CONFIG_LTE_NEIGHBOR_CELLS_MAX);
+			cells->neighbor_cells = k_calloc(ncells_max, sizeof(struct lte_lc_ncell));
+			if (cells->neighbor_cells == NULL) {
+				LOG_ERR("Failed to allocate memory for neighbor cells");
+				return -ENOMEM;
+			}
 		}
+
+		*ncell_slot_get(cells, ncells_max, &scratch, &incomplete) = ncell;
 	}
 
 	if (incomplete) {
@@ -606,7 +492,6 @@ static int parse_ncellmeas(const char *at_response, struct lte_lc_cells_info *ce
 		LOG_WRN("Buffer is too small; results incomplete: %d", err);
 	}
 
-clean_exit:
 	return err;
 }
 
@@ -708,24 +593,10 @@ static void at_handler_ncellmeas(const char *response)
 		goto exit;
 	}
 
-	int ncell_count = neighborcell_count_get(response);
-	struct lte_lc_ncell *neighbor_cells = NULL;
-
-	LOG_DBG("%%NCELLMEAS notification: neighbor cell count: %d", ncell_count);
-
-	if (ncell_count != 0) {
-		neighbor_cells = k_calloc(ncell_count, sizeof(struct lte_lc_ncell));
-		if (neighbor_cells == NULL) {
-			LOG_ERR("Failed to allocate memory for neighbor cells");
-			ncellmeas_empty_event_dispatch();
-			goto exit;
-		}
-	}
-
-	evt.cells_info.neighbor_cells = neighbor_cells;
-
 	err = parse_ncellmeas(response, &evt.cells_info);
 
+	LOG_DBG("%%NCELLMEAS notification: neighbor cell count: %d", evt.cells_info.ncells_count);
+
 	switch (err) {
 	case -E2BIG:
 		LOG_WRN("Not all neighbor cells could be parsed");
@@ -743,9 +614,7 @@ static void at_handler_ncellmeas(const char *response)
 		break;
 	}
 
-	if (neighbor_cells) {
-		k_free(neighbor_cells);
-	}
+	k_free(evt.cells_info.neighbor_cells);
 exit:
 	k_sem_give(&ncellmeas_idle_sem);
 }
@@ -26,6 +26,16 @@ K_SEM_DEFINE(modem_trace_level_sem, 1, 1);
 extern struct nrf_modem_lib_trace_backend trace_backend;
 static bool has_space = true;
 
+/* Trace data queued in backends with asynchronous writes, until it is processed. */
+static atomic_t async_queued;
+static atomic_t async_release_len;
+static atomic_t async_dropped;
+static uint32_t async_queued_max;
+static uint32_t backpressure_count;
+static uint32_t backpressure_ms;
+K_SEM_DEFINE(trace_write_done_sem, 0, 1);
+#define TRACE_DRAIN_TIMEOUT K_MSEC(CONFIG_NRF_MODEM_LIB_TRACE_DRAIN_TIMEOUT_MS)
+
 #define TRACE_THREAD_PRIORITY                                                                      \
 	COND_CODE_1(CONFIG_NRF_MODEM_LIB_TRACE_THREAD_PRIO_OVERRIDE,                               \
 		    (CONFIG_NRF_MODEM_LIB_TRACE_THREAD_PRIO), (K_LOWEST_APPLICATION_THREAD_PRIO))
@@ -73,6 +83,12 @@ static void backend_resume(void)
 
 static void backend_suspend_handle(struct k_work *item)
 {
+	if (atomic_get(&async_queued) > 0) {
+		/* The backend is still writing trace data */
+		k_work_schedule(&backend_suspend_work, BACKEND_SUSPEND_DELAY);
+		return;
+	}
+
 	backend_suspend();
 }
 
@@ -159,8 +175,21 @@ K_WORK_DELAYABLE_DEFINE(backend_bps_log_work, backend_bps_log);
 
 static void backend_bps_log(struct k_work *item)
 {
+	struct nrf_modem_lib_trace_backend_stats stats;
+
 	LOG_INF("Trace backend bitrate (bps): %u", backend_bps_avg);
 
+	if (trace_backend.stats_get && !trace_backend.stats_get(&stats) && stats.bytes_in) {
+		LOG_INF("Trace backend bytes in: %u kB, out: %u kB (%u%%)",
+			(uint32_t)(stats.bytes_in / 1024), (uint32_t)(stats.bytes_out / 1024),
+			(uint32_t)(stats.bytes_out * 100 / stats.bytes_in));
+	}
+
+	if (trace_backend.write_async) {
+		LOG_INF("Trace backend backpressure: %u (%u ms), dropped: %u bytes",
+			backpressure_count, backpressure_ms, (uint32_t)atomic_get(&async_dropped));
+	}
+
 	k_work_schedule(&backend_bps_log_work, BACKEND_BPS_LOG_PERIOD);
 }
 #endif
@@ -279,6 +308,116 @@ static int trace_fragment_write(struct nrf_modem_trace_data *frag)
 	return 0;
 }
 
+static void trace_release_handle(struct k_work *item)
+{
+	int err;
+	size_t len;
+
+	len = atomic_set(&async_release_len, 0);
+	if (!len) {
+		return;
+	}
+
+	PERF_END(len);
+	if (atomic_get(&async_queued) > 0) {
+		PERF_START();
+	}
+
+	/* Free the trace data in the modem shared memory */
+	err = nrf_modem_trace_processed(len);
+	if (err) {
+		LOG_WRN("nrf_modem_trace_processed failed, err %d", err);
+	}
+}
+
+K_WORK_DEFINE(trace_release_work, trace_release_handle);
+
+/* Called by the backend when queued trace data is processed, possibly from an interrupt. */
+static void trace_write_done(size_t len, int err)
+{
+	if (err) {
+		atomic_add(&async_dropped, len);
+	}
+
+	atomic_sub(&async_queued, len);
+	atomic_add(&async_release_len, len);
+	k_work_submit(&trace_release_work);
+	k_sem_give(&trace_write_done_sem);
+}
+
+/* Returns the number of fragments queued, or a negative error. */
+static int trace_frags_write_async(struct nrf_modem_trace_data *frags, size_t n_frags)
+{
+	int ret;
+	int64_t start;
+	size_t len = 0;
+	atomic_val_t queued;
+
+	for (int i = 0; i < n_frags; i++) {
+		len += frags[i].len;
+	}
+
+	while (true) {
+		k_sem_reset(&trace_write_done_sem);
+
+		/* Account for the trace data before the backend can report it as processed */
+		queued = atomic_add(&async_queued, len);
+		if (queued <= 0) {
+			PERF_START();
+		}
+
+		async_queued_max = MAX(async_queued_max, queued + len);
+
+		ret = trace_backend.write_async(frags, n_frags, trace_write_done);
+
+		__ASSERT(ret != 0, "Trace backend queued 0 fragments");
+
+		/* Remove the trace data that was not queued */
+		for (int i = MAX(ret, 0); i < n_frags; i++) {
+			atomic_sub(&async_queued, frags[i].len);
+		}
+
+		if (ret != -EAGAIN) {
+			break;
+		}
+
+		/* We don't allow waiting if the modem is shut down as that can block
+		 * a new modem init.
+		 */
+		if (!nrf_modem_is_initialized()) {
+			return -ESHUTDOWN;
+		}
+
+		/* The backend queue is full, wait for trace data to be processed */
+		backpressure_count++;
+		start = k_uptime_get();
+		k_sem_take(&trace_write_done_sem, K_FOREVER);
+		backpressure_ms += k_uptime_get() - start;
+	}
+
+	if (ret < 0) {
+		if ((ret == -ENOSPC) || (ret == -ENOSR)) {
+			LOG_DBG("trace_backend.write_async returned with %d", ret);
+		} else {
+			LOG_ERR("trace_backend.write_async failed with err: %d", ret);
+		}
+	}
+
+	return ret;
+}
+
+/* Wait for the trace data queued in the backend to be processed */
+static void trace_async_drain(void)
+{
+	while (atomic_get(&async_queued) > 0) {
+		if (k_sem_take(&trace_write_done_sem, TRACE_DRAIN_TIMEOUT)) {
+			LOG_WRN("Timed out waiting for the trace backend, %ld bytes queued",
+				atomic_get(&async_queued));
+			break;
+		}
+	}
+}
+
 void trace_thread_handler(void)
 {
 	int err;
@@ -325,7 +464,17 @@ trace_reset:
 
 		for (int i = 0; i < n_frags; i++) {
 retry:
-			err = trace_fragment_write(&frags[i]);
+			if (trace_backend.write_async) {
+				err = trace_frags_write_async(&frags[i], n_frags - i);
+				if (err > 0) {
+					/* Skip the other fragments queued in the same operation */
+					i += err - 1;
+					err = 0;
+				}
+			} else {
+				err = trace_fragment_write(&frags[i]);
+			}
+
 			switch (err) {
 			case 0:
 				break;
@@ -367,6 +516,10 @@ retry:
 	}
 
 deinit:
+	if (trace_backend.write_async) {
+		trace_async_drain();
+	}
+
 	err = trace_deinit();
 	if (err) {
 		LOG_ERR("trace_deinit failed with err: %d", err);
@@ -379,13 +532,16 @@ static int trace_init(void)
 {
 	int err;
 
-	if (!trace_backend.init || !trace_backend.deinit || !trace_backend.write) {
-		LOG_ERR("trace backend must implement init, deinit and write");
+	if (!trace_backend.init || !trace_backend.deinit ||
+	    (!trace_backend.write && !trace_backend.write_async)) {
+		LOG_ERR("trace backend must implement init, deinit and write or write_async");
 		return -ENOTSUP;
 	}
 
 	k_sem_take(&trace_done_sem, K_FOREVER);
 
+	atomic_clear(&async_queued);
+
 	err = trace_backend.init(nrf_modem_trace_processed);
 	if (err) {
 		LOG_ERR("trace_backend: init failed with err: %d", err);
@@ -516,6 +672,38 @@ int nrf_modem_lib_trace_read(uint8_t *buf, size_t len)
 	return read;
 }
 
+int nrf_modem_lib_trace_backend_stats_get(struct nrf_modem_lib_trace_backend_stats *stats)
+{
+	if (!stats) {
+		return -EINVAL;
+	}
+
+	if (!trace_backend.stats_get) {
+		return -ENOTSUP;
+	}
+
+	return trace_backend.stats_get(stats);
+}
+
+int nrf_modem_lib_trace_pipeline_stats_get(struct nrf_modem_lib_trace_pipeline_stats *stats)
+{
+	if (!stats) {
+		return -EINVAL;
+	}
+
+	if (!trace_backend.write_async) {
+		return -ENOTSUP;
+	}
+
+	stats->backpressure_count = backpressure_count;
+	stats->backpressure_ms = backpressure_ms;
+	stats->dropped_bytes = atomic_get(&async_dropped);
+	stats->queued_bytes = MAX(atomic_get(&async_queued), 0);
+	stats->queued_bytes_max = async_queued_max;
+
+	return 0;
+}
+
 int nrf_modem_lib_trace_clear(void)
 {
 	int err;
@@ -12,9 +12,16 @@
 #include <zephyr/fs/fcb.h>
 #include <zephyr/storage/flash_map.h>
 #include <zephyr/sys/util.h>
+#include <zephyr/sys/byteorder.h>
 #include <zephyr/logging/log.h>
 
 #include <modem/trace_backend.h>
+#include <modem/nrf_modem_lib_trace.h>
+
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+#define LZ4_STATIC_LINKING_ONLY
+#include <lz4.h>
+#endif
 
 LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 
@@ -26,6 +33,31 @@ LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
 
 #define TRACE_MAGIC_INITIALIZED 0x152ac523
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+/* Each FCB entry holds the length of the uncompressed trace data, followed by an LZ4 frame
+ * block: the block size, with the most significant bit set if the data does not compress,
+ * and the block data. The entries are independent of each other.
+ */
+#define ENTRY_RAW_LEN_SIZE sizeof(uint16_t)
+#define BLOCK_HDR_SIZE sizeof(uint32_t)
+#define BLOCK_UNCOMPRESSED BIT(31)
+#define BLOCK_SIZE_MAX (BLOCK_HDR_SIZE + BUF_SIZE)
+#define ENTRY_SIZE_MAX (ENTRY_RAW_LEN_SIZE + BLOCK_SIZE_MAX)
+
+#define READ_COMPRESSED IS_ENABLED(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_READ_COMPRESSED)
+
+/* Largest entry supported by FCB */
+BUILD_ASSERT(ENTRY_SIZE_MAX <= 0x7fff);
+
+/* LZ4 frame with independent blocks of up to 64 kB, without checksums */
+static const uint8_t lz4_frame_header[] = {0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82};
+static const uint8_t lz4_frame_end[BLOCK_HDR_SIZE];
+
+static LZ4_stream_t lz4_state;
+/* Entry being written or read, used with the FCB semaphore taken. */
+static uint8_t entry_buf[ENTRY_SIZE_MAX];
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS */
+
 static trace_backend_processed_cb trace_processed_callback;
 
 static const struct flash_area *modem_trace_area;
@@ -51,8 +83,22 @@ static __noinit size_t trace_bytes_unread;
 static __noinit size_t flash_buf_written;
 static __noinit uint8_t flash_buf[BUF_SIZE];
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+/* Decompressed entry being read, or LZ4 frame data when reading compressed traces. */
+static __noinit uint8_t read_buf[BLOCK_SIZE_MAX];
+static __noinit size_t read_len;
+/* The read buffer holds the LZ4 frame header or end mark, not trace data. */
+static __noinit bool read_frame;
+static __noinit bool frame_open;
+#endif
+
 static bool is_initialized;
 
+/* 64-bit counters are not updated atomically, guard them with a spinlock */
+static struct k_spinlock stats_lock;
+static uint64_t stats_bytes_in;
+static uint64_t stats_bytes_out;
+
 static struct k_sem fcb_sem;
 
 static size_t buffer_append(const void *data, size_t len)
@@ -69,13 +115,58 @@ static size_t buffer_append(const void *data, size_t len)
 	return append_len;
 }
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+/* Number of bytes returned by trace_backend_read() for an entry. */
+static size_t entry_read_len(size_t raw_len, size_t entry_len)
+{
+	return READ_COMPRESSED ? entry_len - ENTRY_RAW_LEN_SIZE : raw_len;
+}
+
+/* Compress the flash buffer into an LZ4 block, or copy it if it does not compress. */
+static size_t block_build(uint8_t *block)
+{
+	int len;
+
+	len = LZ4_compress_fast_extState_fastReset(
+		&lz4_state, (const char *)flash_buf, (char *)&block[BLOCK_HDR_SIZE],
+		flash_buf_written, flash_buf_written - 1,
+		CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS_ACCELERATION);
+	if (len > 0) {
+		sys_put_le32(len, block);
+	} else {
+		memcpy(&block[BLOCK_HDR_SIZE], flash_buf, flash_buf_written);
+		len = flash_buf_written;
+		sys_put_le32(len | BLOCK_UNCOMPRESSED, block);
+	}
+
+	return BLOCK_HDR_SIZE + len;
+}
+
+/* Number of bytes returned by trace_backend_read() for an entry in flash. */
+static size_t entry_stored_read_len(struct fcb_entry_ctx *loc_ctx)
+{
+	uint8_t raw_len[ENTRY_RAW_LEN_SIZE] = {0};
+
+	if (!READ_COMPRESSED) {
+		(void)flash_area_read(loc_ctx->fap, FCB_ENTRY_FA_DATA_OFF(loc_ctx->loc), raw_len,
+				      sizeof(raw_len));
+	}
+
+	return entry_read_len(sys_get_le16(raw_len), loc_ctx->loc.fe_data_len);
+}
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS */
+
 static int fcb_walk_callback(struct fcb_entry_ctx *loc_ctx, void *arg)
 {
 	if ((loc_ctx->loc.fe_sector == sector) && (loc_ctx->loc.fe_elem_off < loc.fe_elem_off)) {
 		return 0;
 	}
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+	trace_bytes_unread -= entry_stored_read_len(loc_ctx);
+#else
 	trace_bytes_unread -= loc_ctx->loc.fe_data_len;
+#endif
 	return 0;
 }
 
@@ -83,6 +174,9 @@ static int buffer_flush_to_flash(void)
 {
 	int err;
 	struct fcb_entry loc_flush;
+	const uint8_t *data = flash_buf;
+	size_t data_len = flash_buf_written;
+	k_spinlock_key_t key;
 
 	if (!is_initialized) {
 		return -EPERM;
@@ -94,7 +188,13 @@ static int buffer_flush_to_flash(void)
 
 	k_sem_take(&fcb_sem, K_FOREVER);
 
-	err = fcb_append(&trace_fcb, flash_buf_written, &loc_flush);
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+	sys_put_le16(flash_buf_written, entry_buf);
+	data_len = ENTRY_RAW_LEN_SIZE + block_build(&entry_buf[ENTRY_RAW_LEN_SIZE]);
+	data = entry_buf;
+#endif
+
+	err = fcb_append(&trace_fcb, data_len, &loc_flush);
 	if (err) {
 		if (IS_ENABLED(CONFIG_NRF_MODEM_TRACE_FLASH_NOSPACE_ERASE_OLDEST)) {
 			/* Find the number of trace bytes in oldest sector (that is not read). */
@@ -117,7 +217,7 @@ static int buffer_flush_to_flash(void)
 				LOG_ERR("fcb_rotate failed, err %d", err);
 				goto out;
 			}
-			err = fcb_append(&trace_fcb, flash_buf_written, &loc_flush);
+			err = fcb_append(&trace_fcb, data_len, &loc_flush);
 		}
 
 		if (err) {
@@ -130,7 +230,7 @@ static int buffer_flush_to_flash(void)
 	}
 
 	err = flash_area_write(
-		trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc_flush), flash_buf, flash_buf_written);
+		trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc_flush), data, data_len);
 	if (err) {
 		LOG_ERR("flash_area_write failed, err %d", err);
 		goto out;
@@ -142,6 +242,16 @@ static int buffer_flush_to_flash(void)
 		goto out;
 	}
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+	/* The data is now counted as it is read from flash */
+	trace_bytes_unread += entry_read_len(flash_buf_written, data_len) - flash_buf_written;
+#endif
+
+	key = k_spin_lock(&stats_lock);
+	stats_bytes_in += flash_buf_written;
+	stats_bytes_out += data_len;
+	k_spin_unlock(&stats_lock, key);
+
 	flash_buf_written = 0;
 
 out:
@@ -202,6 +312,11 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 		flash_buf_written = 0;
 		memset(&loc, 0, sizeof(loc));
 		sector = NULL;
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+		read_len = 0;
+		read_frame = false;
+		frame_open = false;
+#endif
 		magic = TRACE_MAGIC_INITIALIZED;
 		trace_flash_erase();
 	} else {
@@ -233,6 +348,10 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 		return err;
 	}
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+	LZ4_initStream(&lz4_state, sizeof(lz4_state));
+#endif
+
 	is_initialized = true;
 
 	LOG_DBG("Modem trace flash storage initialized\n");
@@ -243,8 +362,196 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 
 size_t trace_backend_data_size(void)
 {
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+	size_t frame_len = 0;
+
+	if (read_frame) {
+		frame_len += read_len - read_offset;
+	}
+
+	if (frame_open) {
+		frame_len += sizeof(lz4_frame_end);
+	} else if (READ_COMPRESSED && trace_bytes_unread) {
+		frame_len += sizeof(lz4_frame_header) + sizeof(lz4_frame_end);
+	}
+
+	return trace_bytes_unread + frame_len;
+#else
 	return trace_bytes_unread;
+#endif
+}
+
+/* Read the trace data that is not written to flash yet
+ * FCB sem has to be taken before calling this function!
+ */
+static int buffer_read(void *buf, size_t len)
+{
+	size_t to_read;
+
+	to_read = MIN(flash_buf_written, len);
+	memcpy(buf, flash_buf, to_read);
+	if (to_read != flash_buf_written) {
+		/* We haven't read all, move the rest to start of buffer */
+		memmove(flash_buf, &flash_buf[to_read],
+			flash_buf_written - to_read);
+	}
+
+	flash_buf_written -= to_read;
+	trace_bytes_unread -= to_read;
+
+	return to_read;
+}
+
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+/* Read from the read buffer
+ * FCB sem has to be taken before calling this function!
+ */
+static int read_buf_read(void *buf, size_t len)
+{
+	size_t to_read;
+
+	to_read = MIN(len, read_len - read_offset);
+	memcpy(buf, &read_buf[read_offset], to_read);
+
+	if (!read_frame) {
+		trace_bytes_unread -= to_read;
+	}
+
+	read_offset += to_read;
+	if (read_offset >= read_len) {
+		read_offset = 0;
+		read_len = 0;
+		read_frame = false;
+	}
+
+	return to_read;
+}
+
+static void read_buf_frame_set(const uint8_t *data, size_t len)
+{
+	memcpy(read_buf, data, len);
+	read_len = len;
+	read_frame = true;
+}
+
+/* Load the entry at the read location, and decompress it unless compressed traces are read
+ * FCB sem has to be taken before calling this function!
+ */
+static int entry_load(void)
+{
+	int err;
+	int raw_len;
+	uint32_t block;
+	size_t block_len;
+
+	if (loc.fe_data_len < ENTRY_RAW_LEN_SIZE + BLOCK_HDR_SIZE ||
+	    loc.fe_data_len > ENTRY_SIZE_MAX) {
+		LOG_ERR("Invalid trace entry length %d", loc.fe_data_len);
+		return -EBADMSG;
+	}
+
+	if (READ_COMPRESSED) {
+		/* Stream the LZ4 block as is */
+		read_len = loc.fe_data_len - ENTRY_RAW_LEN_SIZE;
+		err = flash_area_read(trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc) + ENTRY_RAW_LEN_SIZE,
+				      read_buf, read_len);
+		if (err) {
+			LOG_ERR("Flash_area_read failed, err %d", err);
+			read_len = 0;
+		}
+
+		return err;
+	}
+
+	err = flash_area_read(trace_fcb.fap, FCB_ENTRY_FA_DATA_OFF(loc), entry_buf,
+			      loc.fe_data_len);
+	if (err) {
+		LOG_ERR("Flash_area_read failed, err %d", err);
+		return err;
+	}
+
+	raw_len = sys_get_le16(entry_buf);
+	block = sys_get_le32(&entry_buf[ENTRY_RAW_LEN_SIZE]);
+	block_len = block & ~BLOCK_UNCOMPRESSED;
+
+	if (block_len != loc.fe_data_len - ENTRY_RAW_LEN_SIZE - BLOCK_HDR_SIZE) {
+		LOG_ERR("Invalid trace block length %zu", block_len);
+		return -EBADMSG;
+	}
+
+	if (block & BLOCK_UNCOMPRESSED) {
+		memcpy(read_buf, &entry_buf[ENTRY_RAW_LEN_SIZE + BLOCK_HDR_SIZE], block_len);
+		err = block_len;
+	} else {
+		err = LZ4_decompress_safe(
+			(const char *)&entry_buf[ENTRY_RAW_LEN_SIZE + BLOCK_HDR_SIZE],
+			(char *)read_buf, block_len, BUF_SIZE);
+	}
+
+	if (err != raw_len) {
+		LOG_ERR("Failed to decompress trace block, err %d", err);
+		return -EBADMSG;
+	}
+
+	read_len = raw_len;
+	return 0;
+}
+
+/* Read the next chunk of compressed traces
+ * FCB sem has to be taken before calling this function!
+ */
+static int compressed_read(void *buf, size_t len)
+{
+	int err;
+
+	if (read_offset < read_len) {
+		return read_buf_read(buf, len);
+	}
+
+	if (READ_COMPRESSED && !frame_open && trace_bytes_unread) {
+		read_buf_frame_set(lz4_frame_header, sizeof(lz4_frame_header));
+		frame_open = true;
+		return read_buf_read(buf, len);
+	}
+
+	err = fcb_getnext(&trace_fcb, &loc);
+	if (!err) {
+		err = entry_load();
+		if (err) {
+			return err;
+		}
+
+		return read_buf_read(buf, len);
+	} else if (err != -ENOTSUP) {
+		return err;
+	}
+
+	if (flash_buf_written) {
+		if (!READ_COMPRESSED) {
+			return buffer_read(buf, len);
+		}
+
+		read_len = block_build(read_buf);
+		trace_bytes_unread += read_len - flash_buf_written;
+		flash_buf_written = 0;
+		return read_buf_read(buf, len);
+	}
+
+	if (frame_open) {
+		read_buf_frame_set(lz4_frame_end, sizeof(lz4_frame_end));
+		frame_open = false;
+		return read_buf_read(buf, len);
+	}
+
+	/* Nothing to read */
+	loc.fe_sector = 0;
+	loc.fe_elem_off = 0;
+	read_offset = 0;
+	sector = NULL;
+
+	return -ENODATA;
 }
+#else
 
 /* Read from offset
  * FCB sem has to be taken before calling this function!
@@ -272,25 +579,12 @@ static int read_from_offset(void *buf, size_t len)
 	return to_read;
 }
 
-int trace_backend_read(void *buf, size_t len)
+static int raw_read(void *buf, size_t len)
 {
 	int err;
-	size_t ret;
-	size_t to_read = 0;
-
-	if (!is_initialized) {
-		return -EPERM;
-	}
-
-	if (!buf) {
-		return -EINVAL;
-	}
-
-	k_sem_take(&fcb_sem, K_FOREVER);
 
 	if (read_offset != 0 && loc.fe_sector) {
-		err = read_from_offset(buf, len);
-		goto out;
+		return read_from_offset(buf, len);
 	}
 
 	err = fcb_getnext(&trace_fcb, &loc);
@@ -300,30 +594,39 @@ int trace_backend_read(void *buf, size_t len)
 		loc.fe_elem_off = 0;
 		read_offset = 0;
 		sector = NULL;
-		err = -ENODATA;
-		goto out;
+		return -ENODATA;
 	} else if (err == -ENOTSUP && flash_buf_written) {
-		to_read = MIN(flash_buf_written, len);
-		memcpy(buf, flash_buf, to_read);
-		if (to_read != flash_buf_written) {
-			/* We haven't read all, move the rest to start of buffer */
-			memmove(flash_buf, &flash_buf[to_read],
-				flash_buf_written - to_read);
-		}
+		return buffer_read(buf, len);
+	} else if (err) {
+		return err;
+	}
 
-		flash_buf_written -= to_read;
-		trace_bytes_unread -= to_read;
+	return read_from_offset(buf, len);
+}
 
-		err = to_read;
-		goto out;
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS */
 
-	} else if (err) {
-		goto out;
+int trace_backend_read(void *buf, size_t len)
+{
+	int err;
+	size_t ret;
+
+	if (!is_initialized) {
+		return -EPERM;
+	}
+
+	if (!buf) {
+		return -EINVAL;
 	}
 
-	err = read_from_offset(buf, len);
+	k_sem_take(&fcb_sem, K_FOREVER);
+
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+	err = compressed_read(buf, len);
+#else
+	err = raw_read(buf, len);
+#endif
 
-out:
 	ret = err;
 
 	/* Erase if done with previous sector. */
@@ -420,12 +723,28 @@ int trace_backend_clear(void)
 	trace_bytes_unread = 0;
 	read_offset = 0;
 	sector = NULL;
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_COMPRESS)
+	read_len = 0;
+	read_frame = false;
+	frame_open = false;
+#endif
 
 	k_sem_give(&fcb_sem);
 
 	return err;
 }
 
+int trace_backend_stats_get(struct nrf_modem_lib_trace_backend_stats *stats)
+{
+	k_spinlock_key_t key = k_spin_lock(&stats_lock);
+
+	stats->bytes_in = stats_bytes_in;
+	stats->bytes_out = stats_bytes_out;
+	k_spin_unlock(&stats_lock, key);
+
+	return 0;
+}
+
 int trace_backend_deinit(void)
 {
 	buffer_flush_to_flash();
@@ -439,4 +758,5 @@ struct nrf_modem_lib_trace_backend trace_backend = {
 	.data_size = trace_backend_data_size,
 	.read = trace_backend_read,
 	.clear = trace_backend_clear,
+	.stats_get = trace_backend_stats_get,
 };
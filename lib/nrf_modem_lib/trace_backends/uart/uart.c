@@ -8,6 +8,7 @@
 #include <zephyr/kernel.h>
 #include <zephyr/logging/log.h>
 #include <modem/trace_backend.h>
+#include <nrf_modem_trace.h>
 #include <zephyr/pm/device.h>
 
 LOG_MODULE_REGISTER(modem_trace_backend, CONFIG_MODEM_TRACE_BACKEND_LOG_LEVEL);
@@ -23,17 +24,129 @@ static const struct device *const uart_dev = DEVICE_DT_GET(UART_DEVICE_NODE);
 /* Maximum UART transfer attempts. */
 #define UART_TX_RETRIES 5
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_ASYNC)
+#define QUEUE_SIZE CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_QUEUE_SIZE
+
+/* Trace fragments queued for transfer, sent in order directly from the shared memory. */
+static struct {
+	const uint8_t *data;
+	size_t len;
+} tx_queue[QUEUE_SIZE];
+/* Index of the fragment being sent, and number of queued fragments. */
+static size_t tx_head;
+static size_t tx_count;
+/* Number of bytes of the fragment being sent that are already sent. */
+static size_t tx_offset;
+/* Length of the transfer in progress, zero when the UART is idle. */
+static size_t tx_len;
+/* Number of consecutive transfers that sent nothing. */
+static int tx_retries;
+static struct k_spinlock tx_lock;
+
+/* Callback to notify the trace library when queued trace data is processed. */
+static trace_backend_write_done_cb write_done_callback;
+#else
 /* Semaphores used to synchronize UART transfers. */
 static K_SEM_DEFINE(tx_sem, 0, 1);
 static K_SEM_DEFINE(tx_done_sem, 0, 1);
 /* Number of bytes that were transferred successfully in last transmission. */
 static int tx_bytes;
+#endif
 
 /* Callback to notify the trace library when trace data is processed. */
 static trace_backend_processed_cb trace_processed_callback;
 
 static bool suspended;
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_ASYNC)
+/* Move past len bytes of the fragment being sent. Called with tx_lock held. */
+static void tx_advance(size_t len)
+{
+	tx_offset += len;
+	if (tx_offset == tx_queue[tx_head].len) {
+		tx_offset = 0;
+		tx_head = (tx_head + 1) % QUEUE_SIZE;
+		tx_count--;
+	}
+}
+
+/* Start sending the next chunk, if the UART is idle. Called with tx_lock held.
+ * Returns the number of bytes dropped because the transfer could not be started.
+ */
+static size_t tx_start(int *err)
+{
+	int ret;
+	size_t len;
+	size_t remaining;
+	size_t dropped = 0;
+
+	while (tx_count && !tx_len) {
+		/* Split fragments into smaller DMA-able chunks */
+		remaining = tx_queue[tx_head].len - tx_offset;
+		len = MIN(remaining, CHUNK_SZ);
+
+		ret = uart_tx(uart_dev, &tx_queue[tx_head].data[tx_offset], len,
+			      UART_TX_WAIT_TIME_MS * USEC_PER_MSEC);
+		if (ret) {
+			LOG_ERR("UART TX failed, err %d", ret);
+			*err = ret;
+			dropped += remaining;
+			tx_advance(remaining);
+			continue;
+		}
+
+		tx_len = len;
+	}
+
+	return dropped;
+}
+
+static void tx_complete(size_t sent)
+{
+	int err = 0;
+	int start_err = 0;
+	size_t dropped = 0;
+	size_t start_dropped;
+	k_spinlock_key_t key;
+
+	key = k_spin_lock(&tx_lock);
+
+	if (!tx_len) {
+		/* The transfer was started before the queue was reset */
+		k_spin_unlock(&tx_lock, key);
+		return;
+	}
+
+	tx_len = 0;
+
+	if (sent) {
+		tx_retries = 0;
+		tx_advance(sent);
+	} else if (++tx_retries >= UART_TX_RETRIES) {
+		/* Give up on the rest of the fragment */
+		tx_retries = 0;
+		dropped = tx_queue[tx_head].len - tx_offset;
+		tx_advance(dropped);
+		err = -EIO;
+	}
+
+	start_dropped = tx_start(&start_err);
+
+	k_spin_unlock(&tx_lock, key);
+
+	/* Report in order, so that the trace data is released in order. */
+	if (sent) {
+		write_done_callback(sent, 0);
+	}
+	if (dropped) {
+		write_done_callback(dropped, err);
+	}
+	if (start_dropped) {
+		write_done_callback(start_dropped, start_err);
+	}
+}
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_ASYNC */
+
 static void uart_callback(const struct device *dev, struct uart_event *evt, void *user_data)
 {
 	ARG_UNUSED(dev);
@@ -42,8 +155,12 @@ static void uart_callback(const struct device *dev, struct uart_event *evt, void
 	switch (evt->type) {
 	case UART_TX_DONE:
 	case UART_TX_ABORTED:
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_ASYNC)
+		tx_complete(evt->data.tx.len);
+#else
 		tx_bytes = evt->data.tx.len;
 		k_sem_give(&tx_done_sem);
+#endif
 		break;
 	case UART_RX_DISABLED:
 		LOG_DBG("UART RX disabled");
@@ -94,7 +211,21 @@ int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 		return -EFAULT;
 	}
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_ASYNC)
+	K_SPINLOCK(&tx_lock) {
+		/* Forget about trace data left from a previous session */
+		tx_head = 0;
+		tx_count = 0;
+		tx_offset = 0;
+		tx_len = 0;
+		tx_retries = 0;
+	}
+
+	/* The completion of a transfer left from a previous session is ignored */
+	(void)uart_tx_abort(uart_dev);
+#else
 	k_sem_give(&tx_sem);
+#endif
 
 	return 0;
 }
@@ -104,6 +235,49 @@ int trace_backend_deinit(void)
 	return 0;
 }
 
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_ASYNC)
+int trace_backend_write_async(const struct nrf_modem_trace_data *frags, size_t n_frags,
+			      trace_backend_write_done_cb done_cb)
+{
+	int err = 0;
+	size_t n = 0;
+	size_t dropped;
+	k_spinlock_key_t key;
+
+	if (suspended) {
+		return -EPERM;
+	}
+
+	key = k_spin_lock(&tx_lock);
+
+	write_done_callback = done_cb;
+
+	while (n < n_frags && tx_count < QUEUE_SIZE) {
+		/* Nothing to send for empty fragments */
+		if (frags[n].len) {
+			tx_queue[(tx_head + tx_count) % QUEUE_SIZE].data = frags[n].data;
+			tx_queue[(tx_head + tx_count) % QUEUE_SIZE].len = frags[n].len;
+			tx_count++;
+		}
+		n++;
+	}
+
+	dropped = tx_start(&err);
+
+	k_spin_unlock(&tx_lock, key);
+
+	if (dropped) {
+		done_cb(dropped, err);
+	}
+
+	if (n == 0) {
+		return -EAGAIN;
+	}
+
+	return n;
+}
+#else
+
 /* Returns the number of bytes written, or negative error. */
 static int uart_send(const uint8_t *data, size_t len)
 {
@@ -175,6 +349,7 @@ out:
 
 	return ret;
 }
+#endif /* CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_ASYNC */
 
 int trace_backend_suspend(void)
 {
@@ -212,7 +387,11 @@ int trace_backend_resume(void)
 struct nrf_modem_lib_trace_backend trace_backend = {
 	.init = trace_backend_init,
 	.deinit = trace_backend_deinit,
+#if defined(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_UART_ASYNC)
+	.write_async = trace_backend_write_async,
+#else
 	.write = trace_backend_write,
+#endif
 	.suspend = trace_backend_suspend,
 	.resume = trace_backend_resume
 };
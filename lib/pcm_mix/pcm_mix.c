@@ -6,7 +6,14 @@
 
 #include <pcm_mix.h>
 
+#include <string.h>
 #include <zephyr/kernel.h>
+#include <zephyr/sys/util.h>
+#include <zephyr/toolchain.h>
+
+#if defined(__ARM_FEATURE_DSP)
+#include <cmsis_core.h>
+#endif
 
 #include <zephyr/logging/log.h>
 LOG_MODULE_REGISTER(pcm_mix, CONFIG_PCM_MIX_LOG_LEVEL);
@@ -23,21 +30,104 @@ static void hard_limiter(int32_t *const pcm)
 	}
 }
 
-/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
-static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
-			      size_t size_b)
+#define PCM_MIX_24_BIT_MIN (-(1L << 23))
+#define PCM_MIX_24_BIT_MAX ((1L << 23) - 1)
+
+static inline int32_t saturate(int64_t val, int32_t min, int32_t max)
 {
-	int32_t res;
+	return (int32_t)CLAMP(val, min, max);
+}
 
-	for (uint32_t i = 0; i < size_b / 2; i++) {
-		res = ((int16_t *)pcm_a)[i] + ((int16_t *)pcm_b)[i];
+/* Apply a Q16.16 gain to a sample. The result is not saturated */
+static inline int64_t gain_apply(int32_t sample, uint32_t gain)
+{
+	if (gain == PCM_MIX_GAIN_UNITY) {
+		return sample;
+	}
 
-		hard_limiter(&res);
+	return ((int64_t)sample * (int32_t)gain) >> 16;
+}
 
-		((int16_t *)pcm_a)[i] = (int16_t)res;
+/* Mix num_inputs 16-bit buffers into out, reading every input exactly once */
+static void mix_multi_16(int16_t *const out, size_t num_samples, int16_t const *const *const in,
+			 uint32_t const *const gain, uint8_t num_inputs)
+{
+	size_t i = 0;
+
+#if defined(__ARM_FEATURE_DSP)
+	/* Two samples are packed in each word and processed by one saturating instruction */
+	for (; i + 1 < num_samples; i += 2) {
+		uint32_t acc = 0;
+
+		for (uint8_t n = 0; n < num_inputs; n++) {
+			uint32_t val = UNALIGNED_GET((uint32_t const *)&in[n][i]);
+
+			if (gain[n] != PCM_MIX_GAIN_UNITY) {
+				int32_t lo = __SSAT(__SMULWB((int32_t)gain[n], val), 16);
+				int32_t hi = __SSAT(__SMULWT((int32_t)gain[n], val), 16);
+
+				val = __PKHBT(lo, hi, 16);
+			}
+
+			acc = __QADD16(acc, val);
+		}
+
+		UNALIGNED_PUT(acc, (uint32_t *)&out[i]);
+	}
+#endif /* defined(__ARM_FEATURE_DSP) */
+
+	for (; i < num_samples; i++) {
+		int32_t acc = 0;
+
+		for (uint8_t n = 0; n < num_inputs; n++) {
+			int32_t val = saturate(gain_apply(in[n][i], gain[n]), INT16_MIN, INT16_MAX);
+
+			acc = saturate(acc + val, INT16_MIN, INT16_MAX);
+		}
+
+		out[i] = (int16_t)acc;
 	}
 }
 
+/* Mix num_inputs 24-bit or 32-bit buffers (in 32-bit carriers) into out */
+static void mix_multi_32(int32_t *const out, size_t num_samples, int32_t const *const *const in,
+			 uint32_t const *const gain, uint8_t num_inputs, uint8_t pcm_bit_depth)
+{
+	int32_t min = (pcm_bit_depth == 24) ? PCM_MIX_24_BIT_MIN : INT32_MIN;
+	int32_t max = (pcm_bit_depth == 24) ? PCM_MIX_24_BIT_MAX : INT32_MAX;
+
+	for (size_t i = 0; i < num_samples; i++) {
+		int32_t acc = 0;
+
+		for (uint8_t n = 0; n < num_inputs; n++) {
+			int32_t val = saturate(gain_apply(in[n][i], gain[n]), min, max);
+
+#if defined(__ARM_FEATURE_DSP)
+			if (pcm_bit_depth == 24) {
+				/* Sum of two 24-bit values cannot overflow the carrier */
+				acc = __SSAT(acc + val, 24);
+			} else {
+				acc = __QADD(acc, val);
+			}
+#else
+			acc = saturate((int64_t)acc + val, min, max);
+#endif /* defined(__ARM_FEATURE_DSP) */
+		}
+
+		out[i] = acc;
+	}
+}
+
+/* Mix stereo-stereo or mono-mono. I.e. buffers are of equal size */
+static void pcm_mix_identical(void *const pcm_a, size_t size_a, void const *const pcm_b,
+			      size_t size_b)
+{
+	int16_t const *const in[] = {pcm_a, pcm_b};
+	uint32_t const gain[] = {PCM_MIX_GAIN_UNITY, PCM_MIX_GAIN_UNITY};
+
+	mix_multi_16(pcm_a, size_b / sizeof(int16_t), in, gain, ARRAY_SIZE(in));
+}
+
 /* Mix mono into both channels of a stereo buffer */
 static void pcm_mix_b_mono_into_a_stereo_lr(void *const pcm_a, size_t size_a,
 					    void const *const pcm_b, size_t size_b)
@@ -133,3 +223,70 @@ int pcm_mix(void *const pcm_a, size_t size_a, void const *const pcm_b, size_t si
 
 	return 0;
 }
+
+int pcm_mix_multi(void *const pcm_out, size_t size, struct pcm_mix_input const *const inputs,
+		  uint8_t num_inputs, uint8_t pcm_bit_depth)
+{
+	void const *in[CONFIG_PCM_MIX_MULTI_INPUTS_MAX];
+	uint32_t gain[CONFIG_PCM_MIX_MULTI_INPUTS_MAX];
+	uint8_t num_active = 0;
+	size_t carrier_size;
+
+	if (pcm_out == NULL || size == 0 || (inputs == NULL && num_inputs != 0)) {
+		return -EINVAL;
+	}
+
+	switch (pcm_bit_depth) {
+	case 16:
+		carrier_size = sizeof(int16_t);
+		break;
+	case 24:
+		/* Fall through */
+	case 32:
+		carrier_size = sizeof(int32_t);
+		break;
+	default:
+		LOG_ERR("Invalid bit depth: %d", pcm_bit_depth);
+		return -EINVAL;
+	}
+
+	if (size % carrier_size != 0) {
+		LOG_ERR("Size %zu is not a multiple of the carrier size", size);
+		return -EINVAL;
+	}
+
+	if (num_inputs > CONFIG_PCM_MIX_MULTI_INPUTS_MAX) {
+		LOG_ERR("Too many inputs: %d", num_inputs);
+		return -EINVAL;
+	}
+
+	/* Drop empty inputs up front to keep the sample loop free of checks */
+	for (uint8_t n = 0; n < num_inputs; n++) {
+		if (inputs[n].gain > PCM_MIX_GAIN_MAX) {
+			return -EINVAL;
+		}
+
+		if (inputs[n].pcm == NULL || inputs[n].gain == 0) {
+			continue;
+		}
+
+		in[num_active] = inputs[n].pcm;
+		gain[num_active] = inputs[n].gain;
+		num_active++;
+	}
+
+	if (num_active == 0) {
+		memset(pcm_out, 0, size);
+		return 0;
+	}
+
+	if (pcm_bit_depth == 16) {
+		mix_multi_16(pcm_out, size / carrier_size, (int16_t const *const *)in, gain,
+			     num_active);
+	} else {
+		mix_multi_32(pcm_out, size / carrier_size, (int32_t const *const *)in, gain,
+			     num_active, pcm_bit_depth);
+	}
+
+	return 0;
+}
@@ -24,4 +24,35 @@ int sample_rate_converter_filter_get(enum sample_rate_converter_filter filter_ty
 				     int conversion_ratio, void const **filter_ptr,
 				     size_t *filter_size);
 
+/** Coefficient bank for the polyphase sample rate converter */
+struct sample_rate_converter_poly_bank {
+	/* Cut-off frequency in per mille of the input Nyquist frequency. */
+	uint16_t cutoff_permille;
+
+	/* Lowest output/input sample rate ratio, in per mille, the bank can be used for. */
+	uint16_t min_ratio_permille;
+
+	/* Number of taps in each phase. */
+	uint8_t taps;
+
+	/* (SAMPLE_RATE_CONVERTER_POLY_PHASES + 1) phases of taps coefficients each. */
+	q15_t const *coeffs;
+};
+
+/**
+ * @brief Get the polyphase coefficient bank for a conversion.
+ *
+ * @details Selects the bank with the widest pass band that still suppresses aliasing for the
+ *	    given ratio between the sample rates.
+ *
+ * @param[in]	sample_rate_input	Sample rate of the input samples.
+ * @param[in]	sample_rate_output	Sample rate of the output samples.
+ * @param[out]	bank			Pointer to the selected bank.
+ *
+ * @retval	0	On success.
+ * @retval	-EINVAL	No bank can be used for the given sample rates.
+ */
+int sample_rate_converter_poly_bank_get(uint32_t sample_rate_input, uint32_t sample_rate_output,
+					struct sample_rate_converter_poly_bank const **bank);
+
 #endif /* _SAMPLE_RATE_CONVERTER_FILTER_H_ */
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sample_rate_converter.h"
+#include "sample_rate_converter_filter.h"
+
+#include <errno.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include <dsp/basic_math_functions.h>
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
+
+BUILD_ASSERT(IS_POWER_OF_TWO(SAMPLE_RATE_CONVERTER_POLY_PHASES),
+	     "Number of polyphase phases must be a power of two");
+
+/* Number of bits of the position fraction used to select the phase */
+#define PHASE_BITS LOG2(SAMPLE_RATE_CONVERTER_POLY_PHASES)
+
+/* Remaining fraction bits are used to interpolate between two phases, with 16 bits resolution */
+#define PHASE_SHIFT (32 - PHASE_BITS)
+#define ALPHA_SHIFT (PHASE_SHIFT - 16)
+
+#define DRIFT_PPB_SCALE 1000000000LL
+
+static void step_update(struct sample_rate_converter_poly_ctx *ctx)
+{
+	int64_t drift = ((int64_t)ctx->step_nominal * ctx->drift_ppb) / DRIFT_PPB_SCALE;
+
+	ctx->step = ctx->step_nominal + drift;
+}
+
+/**
+ * @brief Reconfigures the polyphase sample rate converter context.
+ *
+ * @details Selects the coefficient bank for the conversion ratio, calculates the step between
+ *	    output samples and fills the filter history with silence. This gives a constant delay
+ *	    of half the filter length and lets the first call produce output immediately.
+ *
+ * @param[in,out]	ctx			Pointer to the polyphase conversion context.
+ * @param[in]		sample_rate_input	Sample rate of the input samples.
+ * @param[in]		sample_rate_output	Sample rate of the output samples.
+ *
+ * @retval 0 On success.
+ * @retval -EINVAL Invalid parameters used to initialize the conversion.
+ */
+static int poly_reconfigure(struct sample_rate_converter_poly_ctx *ctx, uint32_t sample_rate_input,
+			    uint32_t sample_rate_output)
+{
+	int ret;
+	uint64_t step_scaled;
+
+	ret = sample_rate_converter_poly_bank_get(sample_rate_input, sample_rate_output,
+						  &ctx->bank);
+	if (ret) {
+		return ret;
+	}
+
+	ctx->sample_rate_input = sample_rate_input;
+	ctx->sample_rate_output = sample_rate_output;
+
+	step_scaled = (uint64_t)sample_rate_input << 32;
+	ctx->step_nominal = step_scaled / sample_rate_output;
+	ctx->step_remainder = step_scaled % sample_rate_output;
+	ctx->remainder_acc = 0;
+	step_update(ctx);
+
+	ctx->pos = 0;
+	ctx->samples_in_history = ctx->bank->taps - 1;
+	memset(ctx->history, 0, ctx->samples_in_history * sizeof(ctx->history[0]));
+
+	LOG_DBG("Polyphase converter initialized. Input sample rate: %d, output sample rate: %d, "
+		"cut-off: %d, taps: %d",
+		sample_rate_input, sample_rate_output, ctx->bank->cutoff_permille,
+		ctx->bank->taps);
+
+	return 0;
+}
+
+/* Returns the filter output in Q(15 + sample bits) format, before rounding */
+static inline int64_t poly_filter(sample_rate_converter_poly_sample_t const *const window,
+				  q15_t const *const coeffs, uint8_t taps, uint32_t frac)
+{
+	q15_t const *row0 = coeffs + (frac >> PHASE_SHIFT) * taps;
+	q15_t const *row1 = row0 + taps;
+	int32_t alpha = (frac >> ALPHA_SHIFT) & 0xFFFF;
+	int64_t d0;
+	int64_t d1;
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+	arm_dot_prod_q15(window, row0, taps, &d0);
+	arm_dot_prod_q15(window, row1, taps, &d1);
+
+	return d0 + (((d1 - d0) * alpha) >> 16);
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+	d0 = 0;
+	d1 = 0;
+
+	for (uint8_t k = 0; k < taps; k++) {
+		d0 += (int64_t)window[k] * row0[k];
+		d1 += (int64_t)window[k] * row1[k];
+	}
+
+	/* Scale down first to keep the product within 64 bits */
+	return d0 + ((((d1 - d0) >> 8) * alpha) >> 8);
+#endif
+}
+
+int sample_rate_converter_poly_open(struct sample_rate_converter_poly_ctx *ctx)
+{
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	memset(ctx, 0, sizeof(struct sample_rate_converter_poly_ctx));
+
+	return 0;
+}
+
+int sample_rate_converter_poly_drift_set(struct sample_rate_converter_poly_ctx *ctx,
+					 int32_t drift_ppb)
+{
+	if (ctx == NULL) {
+		LOG_ERR("Context cannot be NULL");
+		return -EINVAL;
+	}
+
+	if ((drift_ppb > SAMPLE_RATE_CONVERTER_POLY_DRIFT_PPB_MAX) ||
+	    (drift_ppb < -SAMPLE_RATE_CONVERTER_POLY_DRIFT_PPB_MAX)) {
+		LOG_ERR("Drift correction out of range: %d", drift_ppb);
+		return -EINVAL;
+	}
+
+	ctx->drift_ppb = drift_ppb;
+	step_update(ctx);
+
+	return 0;
+}
+
+int sample_rate_converter_poly_process(struct sample_rate_converter_poly_ctx *ctx,
+				       void const *const input, size_t input_size,
+				       uint32_t sample_rate_input, void *const output,
+				       size_t output_size, size_t *output_written,
+				       uint32_t sample_rate_output)
+{
+	int ret;
+	size_t samples_in;
+	size_t samples_avail;
+	size_t samples_out = 0;
+	size_t samples_out_max;
+	size_t consumed;
+	int64_t last_window;
+	uint8_t taps;
+	sample_rate_converter_poly_sample_t *out = output;
+
+	if ((ctx == NULL) || (input == NULL) || (output == NULL) || (output_written == NULL)) {
+		LOG_ERR("Null pointer received");
+		return -EINVAL;
+	}
+
+	if (input_size % sizeof(sample_rate_converter_poly_sample_t) != 0) {
+		LOG_ERR("Size of input is not a byte multiple");
+		return -EINVAL;
+	}
+
+	samples_in = input_size / sizeof(sample_rate_converter_poly_sample_t);
+
+	if (samples_in > CONFIG_SAMPLE_RATE_CONVERTER_BLOCK_SIZE_MAX) {
+		LOG_ERR("Too many samples given as input");
+		return -EINVAL;
+	}
+
+	if ((ctx->sample_rate_input != sample_rate_input) ||
+	    (ctx->sample_rate_output != sample_rate_output)) {
+		LOG_DBG("State has changed, re-initializing polyphase filter");
+		ret = poly_reconfigure(ctx, sample_rate_input, sample_rate_output);
+		if (ret) {
+			LOG_ERR("Failed to initialize converter (%d)", ret);
+			return ret;
+		}
+	}
+
+	taps = ctx->bank->taps;
+	samples_avail = ctx->samples_in_history + samples_in;
+
+	/* Upper bound of output samples, as the remainder only ever lengthens the step */
+	last_window = ((int64_t)samples_avail - taps + 1) << 32;
+	if (last_window > (int64_t)ctx->pos) {
+		samples_out_max = (last_window - ctx->pos + ctx->step - 1) / ctx->step;
+	} else {
+		samples_out_max = 0;
+	}
+
+	if (samples_out_max * sizeof(sample_rate_converter_poly_sample_t) > output_size) {
+		LOG_ERR("Conversion process may produce more bytes than the output buffer can "
+			"hold");
+		return -EINVAL;
+	}
+
+	memcpy(&ctx->history[ctx->samples_in_history], input, input_size);
+
+	while (((ctx->pos >> 32) + taps) <= samples_avail) {
+		int64_t acc = poly_filter(&ctx->history[ctx->pos >> 32], ctx->bank->coeffs, taps,
+					  (uint32_t)ctx->pos);
+
+		acc = (acc + (1 << 14)) >> 15;
+#if CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_16
+		out[samples_out++] = (q15_t)CLAMP(acc, INT16_MIN, INT16_MAX);
+#elif CONFIG_SAMPLE_RATE_CONVERTER_BIT_DEPTH_32
+		out[samples_out++] = (q31_t)CLAMP(acc, INT32_MIN, INT32_MAX);
+#endif
+
+		ctx->pos += ctx->step;
+		ctx->remainder_acc += ctx->step_remainder;
+		if (ctx->remainder_acc >= ctx->sample_rate_output) {
+			ctx->remainder_acc -= ctx->sample_rate_output;
+			ctx->pos++;
+		}
+	}
+
+	/* Keep the samples the next output still needs, the position may point past them */
+	consumed = MIN(ctx->pos >> 32, samples_avail);
+	ctx->pos -= (uint64_t)consumed << 32;
+	ctx->samples_in_history = samples_avail - consumed;
+	memmove(ctx->history, &ctx->history[consumed],
+		ctx->samples_in_history * sizeof(ctx->history[0]));
+
+	*output_written = samples_out * sizeof(sample_rate_converter_poly_sample_t);
+
+	return 0;
+}
@@ -0,0 +1,660 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "sample_rate_converter.h"
+#include "sample_rate_converter_filter.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(sample_rate_converter, CONFIG_SAMPLE_RATE_CONVERTER_LOG_LEVEL);
+
+/**
+ * The polyphase coefficient banks are Kaiser windowed sinc filters (beta = 7.5) with the
+ * following properties:
+ * - Cut-off given in per mille of the input Nyquist frequency.
+ * - SAMPLE_RATE_CONVERTER_POLY_PHASES + 1 phases, where phase p holds the filter delayed by
+ *   p / SAMPLE_RATE_CONVERTER_POLY_PHASES input samples. The extra phase allows linear
+ *   interpolation between neighbouring phases without wrapping.
+ * - Each phase is normalized to unity DC gain before quantization.
+ * - A bank can be used for any conversion where the output Nyquist frequency is above the
+ *   cut-off, with some margin for the transition band.
+ */
+
+static const q15_t poly_bank_cutoff_875[SAMPLE_RATE_CONVERTER_POLY_PHASES + 1][24] = {
+	{0xFFF0, 0x0023, 0xFFD4, 0x0000, 0x009B, 0xFE1B, 0x0400, 0xF929, 0x0A0F, 0xF2EE, 0x0F39,
+	 0x7006, 0x0F39, 0xF2EE, 0x0A0F, 0xF929, 0x0400, 0xFE1B, 0x009B, 0x0000, 0xFFD4, 0x0023,
+	 0xFFF0, 0x0000},
+	{0xFFF1, 0x001F, 0xFFDE, 0xFFED, 0x00B8, 0xFDFB, 0x0411, 0xF948, 0x0985, 0xF452, 0x0BA1,
+	 0x6FDF, 0x12EF, 0xF197, 0x0A89, 0xF916, 0x03E6, 0xFE3F, 0x007D, 0x0014, 0xFFCA, 0x0027,
+	 0xFFEF, 0x0003},
+	{0xFFF3, 0x001B, 0xFFE8, 0xFFDB, 0x00D2, 0xFDE0, 0x041B, 0xF973, 0x08ED, 0xF5BF, 0x082D,
+	 0x6F73, 0x16C3, 0xF04F, 0x0AF3, 0xF911, 0x03C4, 0xFE68, 0x005C, 0x0028, 0xFFC0, 0x002B,
+	 0xFFEE, 0x0004},
+	{0xFFF4, 0x0017, 0xFFF2, 0xFFCA, 0x00EA, 0xFDCA, 0x041B, 0xF9A9, 0x0848, 0xF732, 0x04DF,
+	 0x6EC0, 0x1AB0, 0xEF19, 0x0B4A, 0xF919, 0x0399, 0xFE96, 0x003A, 0x003D, 0xFFB6, 0x002F,
+	 0xFFED, 0x0004},
+	{0xFFF5, 0x0013, 0xFFFB, 0xFFBA, 0x00FE, 0xFDB9, 0x0414, 0xF9EA, 0x0799, 0xF8A8, 0x01B9,
+	 0x6DC7, 0x1EB3, 0xEDF8, 0x0B8E, 0xF92F, 0x0366, 0xFEC8, 0x0015, 0x0052, 0xFFAC, 0x0032,
+	 0xFFEC, 0x0004},
+	{0xFFF6, 0x000F, 0x0004, 0xFFAB, 0x0111, 0xFDAD, 0x0406, 0xFA35, 0x06E0, 0xFA1F, 0xFEBF,
+	 0x6C88, 0x22C7, 0xECEF, 0x0BBD, 0xF953, 0x032B, 0xFEFE, 0xFFF0, 0x0067, 0xFFA3, 0x0036,
+	 0xFFEB, 0x0004},
+	{0xFFF8, 0x000B, 0x000C, 0xFF9E, 0x0120, 0xFDA6, 0x03F0, 0xFA89, 0x061F, 0xFB94, 0xFBF1,
+	 0x6B06, 0x26E8, 0xEC00, 0x0BD7, 0xF985, 0x02E8, 0xFF37, 0xFFC9, 0x007D, 0xFF99, 0x0039,
+	 0xFFEB, 0x0004},
+	{0xFFF9, 0x0007, 0x0014, 0xFF91, 0x012D, 0xFDA4, 0x03D3, 0xFAE5, 0x0559, 0xFD05, 0xF952,
+	 0x6941, 0x2B13, 0xEB2F, 0x0BDB, 0xF9C5, 0x029D, 0xFF74, 0xFFA1, 0x0092, 0xFF90, 0x003C,
+	 0xFFEA, 0x0004},
+	{0xFFFA, 0x0004, 0x001B, 0xFF86, 0x0137, 0xFDA6, 0x03B0, 0xFB48, 0x048E, 0xFE6E, 0xF6E4,
+	 0x673D, 0x2F43, 0xEA7F, 0x0BC7, 0xFA13, 0x024A, 0xFFB4, 0xFF79, 0x00A7, 0xFF88, 0x003E,
+	 0xFFEA, 0x0004},
+	{0xFFFB, 0x0000, 0x0022, 0xFF7D, 0x013F, 0xFDAD, 0x0386, 0xFBB1, 0x03C0, 0xFFCF, 0xF4A7,
+	 0x64FB, 0x3374, 0xE9F1, 0x0B9C, 0xFA6F, 0x01F1, 0xFFF6, 0xFF50, 0x00BB, 0xFF80, 0x0040,
+	 0xFFEA, 0x0004},
+	{0xFFFC, 0xFFFD, 0x0028, 0xFF75, 0x0143, 0xFDB8, 0x0357, 0xFC20, 0x02F1, 0x0123, 0xF29D,
+	 0x627F, 0x37A2, 0xE989, 0x0B58, 0xFAD9, 0x0192, 0x003B, 0xFF28, 0x00CF, 0xFF79, 0x0042,
+	 0xFFEA, 0x0004},
+	{0xFFFD, 0xFFFA, 0x002E, 0xFF6E, 0x0146, 0xFDC7, 0x0323, 0xFC93, 0x0223, 0x026A, 0xF0C7,
+	 0x5FCA, 0x3BC8, 0xE948, 0x0AFC, 0xFB50, 0x012C, 0x0081, 0xFEFF, 0x00E2, 0xFF72, 0x0043,
+	 0xFFEA, 0x0004},
+	{0xFFFE, 0xFFF8, 0x0033, 0xFF69, 0x0145, 0xFDDA, 0x02EB, 0xFD09, 0x0156, 0x03A2, 0xEF24,
+	 0x5CE1, 0x3FE1, 0xE931, 0x0A88, 0xFBD4, 0x00C1, 0x00C8, 0xFED8, 0x00F3, 0xFF6D, 0x0043,
+	 0xFFEB, 0x0004},
+	{0xFFFF, 0xFFF5, 0x0037, 0xFF65, 0x0142, 0xFDF0, 0x02AE, 0xFD81, 0x008D, 0x04C8, 0xEDB5,
+	 0x59C6, 0x43E9, 0xE946, 0x09FB, 0xFC63, 0x0052, 0x0110, 0xFEB1, 0x0104, 0xFF68, 0x0043,
+	 0xFFEB, 0x0003},
+	{0x0000, 0xFFF3, 0x003B, 0xFF62, 0x013D, 0xFE0A, 0x026E, 0xFDFB, 0xFFC8, 0x05DB, 0xEC7A,
+	 0x567D, 0x47DC, 0xE989, 0x0956, 0xFCFE, 0xFFDF, 0x0158, 0xFE8B, 0x0113, 0xFF65, 0x0043,
+	 0xFFEC, 0x0003},
+	{0x0001, 0xFFF1, 0x003E, 0xFF61, 0x0135, 0xFE27, 0x022B, 0xFE76, 0xFF0A, 0x06DB, 0xEB73,
+	 0x530A, 0x4BB5, 0xE9FB, 0x0899, 0xFDA4, 0xFF68, 0x01A0, 0xFE68, 0x0120, 0xFF62, 0x0042,
+	 0xFFEE, 0x0002},
+	{0x0002, 0xFFEF, 0x0040, 0xFF61, 0x012C, 0xFE46, 0x01E7, 0xFEF0, 0xFE53, 0x07C5, 0xEA9E,
+	 0x4F71, 0x4F71, 0xEA9E, 0x07C5, 0xFE53, 0xFEF0, 0x01E7, 0xFE46, 0x012C, 0xFF61, 0x0040,
+	 0xFFEF, 0x0002},
+	{0x0002, 0xFFEE, 0x0042, 0xFF62, 0x0120, 0xFE68, 0x01A0, 0xFF68, 0xFDA4, 0x0899, 0xE9FB,
+	 0x4BB5, 0x530A, 0xEB73, 0x06DB, 0xFF0A, 0xFE76, 0x022B, 0xFE27, 0x0135, 0xFF61, 0x003E,
+	 0xFFF1, 0x0001},
+	{0x0003, 0xFFEC, 0x0043, 0xFF65, 0x0113, 0xFE8B, 0x0158, 0xFFDF, 0xFCFE, 0x0956, 0xE989,
+	 0x47DC, 0x567D, 0xEC7A, 0x05DB, 0xFFC8, 0xFDFB, 0x026E, 0xFE0A, 0x013D, 0xFF62, 0x003B,
+	 0xFFF3, 0x0000},
+	{0x0003, 0xFFEB, 0x0043, 0xFF68, 0x0104, 0xFEB1, 0x0110, 0x0052, 0xFC63, 0x09FB, 0xE946,
+	 0x43E9, 0x59C6, 0xEDB5, 0x04C8, 0x008D, 0xFD81, 0x02AE, 0xFDF0, 0x0142, 0xFF65, 0x0037,
+	 0xFFF5, 0xFFFF},
+	{0x0004, 0xFFEB, 0x0043, 0xFF6D, 0x00F3, 0xFED8, 0x00C8, 0x00C1, 0xFBD4, 0x0A88, 0xE931,
+	 0x3FE1, 0x5CE1, 0xEF24, 0x03A2, 0x0156, 0xFD09, 0x02EB, 0xFDDA, 0x0145, 0xFF69, 0x0033,
+	 0xFFF8, 0xFFFE},
+	{0x0004, 0xFFEA, 0x0043, 0xFF72, 0x00E2, 0xFEFF, 0x0081, 0x012C, 0xFB50, 0x0AFC, 0xE948,
+	 0x3BC8, 0x5FCA, 0xF0C7, 0x026A, 0x0223, 0xFC93, 0x0323, 0xFDC7, 0x0146, 0xFF6E, 0x002E,
+	 0xFFFA, 0xFFFD},
+	{0x0004, 0xFFEA, 0x0042, 0xFF79, 0x00CF, 0xFF28, 0x003B, 0x0192, 0xFAD9, 0x0B58, 0xE989,
+	 0x37A2, 0x627F, 0xF29D, 0x0123, 0x02F1, 0xFC20, 0x0357, 0xFDB8, 0x0143, 0xFF75, 0x0028,
+	 0xFFFD, 0xFFFC},
+	{0x0004, 0xFFEA, 0x0040, 0xFF80, 0x00BB, 0xFF50, 0xFFF6, 0x01F1, 0xFA6F, 0x0B9C, 0xE9F1,
+	 0x3374, 0x64FB, 0xF4A7, 0xFFCF, 0x03C0, 0xFBB1, 0x0386, 0xFDAD, 0x013F, 0xFF7D, 0x0022,
+	 0x0000, 0xFFFB},
+	{0x0004, 0xFFEA, 0x003E, 0xFF88, 0x00A7, 0xFF79, 0xFFB4, 0x024A, 0xFA13, 0x0BC7, 0xEA7F,
+	 0x2F43, 0x673D, 0xF6E4, 0xFE6E, 0x048E, 0xFB48, 0x03B0, 0xFDA6, 0x0137, 0xFF86, 0x001B,
+	 0x0004, 0xFFFA},
+	{0x0004, 0xFFEA, 0x003C, 0xFF90, 0x0092, 0xFFA1, 0xFF74, 0x029D, 0xF9C5, 0x0BDB, 0xEB2F,
+	 0x2B13, 0x6941, 0xF952, 0xFD05, 0x0559, 0xFAE5, 0x03D3, 0xFDA4, 0x012D, 0xFF91, 0x0014,
+	 0x0007, 0xFFF9},
+	{0x0004, 0xFFEB, 0x0039, 0xFF99, 0x007D, 0xFFC9, 0xFF37, 0x02E8, 0xF985, 0x0BD7, 0xEC00,
+	 0x26E8, 0x6B06, 0xFBF1, 0xFB94, 0x061F, 0xFA89, 0x03F0, 0xFDA6, 0x0120, 0xFF9E, 0x000C,
+	 0x000B, 0xFFF8},
+	{0x0004, 0xFFEB, 0x0036, 0xFFA3, 0x0067, 0xFFF0, 0xFEFE, 0x032B, 0xF953, 0x0BBD, 0xECEF,
+	 0x22C7, 0x6C88, 0xFEBF, 0xFA1F, 0x06E0, 0xFA35, 0x0406, 0xFDAD, 0x0111, 0xFFAB, 0x0004,
+	 0x000F, 0xFFF6},
+	{0x0004, 0xFFEC, 0x0032, 0xFFAC, 0x0052, 0x0015, 0xFEC8, 0x0366, 0xF92F, 0x0B8E, 0xEDF8,
+	 0x1EB3, 0x6DC7, 0x01B9, 0xF8A8, 0x0799, 0xF9EA, 0x0414, 0xFDB9, 0x00FE, 0xFFBA, 0xFFFB,
+	 0x0013, 0xFFF5},
+	{0x0004, 0xFFED, 0x002F, 0xFFB6, 0x003D, 0x003A, 0xFE96, 0x0399, 0xF919, 0x0B4A, 0xEF19,
+	 0x1AB0, 0x6EC0, 0x04DF, 0xF732, 0x0848, 0xF9A9, 0x041B, 0xFDCA, 0x00EA, 0xFFCA, 0xFFF2,
+	 0x0017, 0xFFF4},
+	{0x0004, 0xFFEE, 0x002B, 0xFFC0, 0x0028, 0x005C, 0xFE68, 0x03C4, 0xF911, 0x0AF3, 0xF04F,
+	 0x16C3, 0x6F73, 0x082D, 0xF5BF, 0x08ED, 0xF973, 0x041B, 0xFDE0, 0x00D2, 0xFFDB, 0xFFE8,
+	 0x001B, 0xFFF3},
+	{0x0003, 0xFFEF, 0x0027, 0xFFCA, 0x0014, 0x007D, 0xFE3F, 0x03E6, 0xF916, 0x0A89, 0xF197,
+	 0x12EF, 0x6FDF, 0x0BA1, 0xF452, 0x0985, 0xF948, 0x0411, 0xFDFB, 0x00B8, 0xFFED, 0xFFDE,
+	 0x001F, 0xFFF1},
+	{0x0000, 0xFFF0, 0x0023, 0xFFD4, 0x0000, 0x009B, 0xFE1B, 0x0400, 0xF929, 0x0A0F, 0xF2EE,
+	 0x0F39, 0x7006, 0x0F39, 0xF2EE, 0x0A0F, 0xF929, 0x0400, 0xFE1B, 0x009B, 0x0000, 0xFFD4,
+	 0x0023, 0xFFF0},
+};
+
+
+#if CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_DOWNSAMPLING
+static const q15_t poly_bank_cutoff_600[SAMPLE_RATE_CONVERTER_POLY_PHASES + 1][32] = {
+	{0x0000, 0x0016, 0xFFE5, 0xFFCE, 0x0089, 0x0000, 0xFEB4, 0x012E, 0x01B3, 0xFC1D, 0x0000,
+	 0x07C3, 0xF8F2, 0xF4AA, 0x2638, 0x4CCA, 0x2638, 0xF4AA, 0xF8F2, 0x07C3, 0x0000, 0xFC1D,
+	 0x01B3, 0x012E, 0xFEB4, 0x0000, 0x0089, 0xFFCE, 0xFFE5, 0x0016, 0x0000, 0x0000},
+	{0xFFFF, 0x0016, 0xFFE7, 0xFFCB, 0x0084, 0x000D, 0xFEB2, 0x0112, 0x01D0, 0xFC3C, 0xFFAA,
+	 0x07CF, 0xF99D, 0xF3F9, 0x2442, 0x4CC0, 0x282D, 0xF56B, 0xF84A, 0x07B0, 0x0058, 0xFC01,
+	 0x0193, 0x014A, 0xFEB7, 0xFFF2, 0x008D, 0xFFD1, 0xFFE2, 0x0016, 0x0001, 0xFFFE},
+	{0xFFFF, 0x0015, 0xFFEA, 0xFFC8, 0x007F, 0x001A, 0xFEB2, 0x00F6, 0x01EB, 0xFC5E, 0xFF57,
+	 0x07D4, 0xFA49, 0xF35A, 0x224A, 0x4C9D, 0x2A1D, 0xF63D, 0xF7A3, 0x0795, 0x00B1, 0xFBE8,
+	 0x0171, 0x0165, 0xFEBB, 0xFFE4, 0x0091, 0xFFD5, 0xFFDF, 0x0016, 0x0001, 0xFFFD},
+	{0xFFFF, 0x0015, 0xFFED, 0xFFC6, 0x0079, 0x0027, 0xFEB3, 0x00D9, 0x0204, 0xFC83, 0xFF05,
+	 0x07D1, 0xFAF6, 0xF2CA, 0x2052, 0x4C63, 0x2C09, 0xF720, 0xF700, 0x0773, 0x010B, 0xFBD2,
+	 0x014E, 0x0180, 0xFEC0, 0xFFD6, 0x0095, 0xFFD9, 0xFFDC, 0x0016, 0x0002, 0xFFFD},
+	{0xFFFE, 0x0015, 0xFFF0, 0xFFC4, 0x0073, 0x0033, 0xFEB5, 0x00BC, 0x021A, 0xFCA9, 0xFEB7,
+	 0x07C7, 0xFBA3, 0xF24C, 0x1E59, 0x4C12, 0x2DEF, 0xF813, 0xF662, 0x0749, 0x0167, 0xFBC0,
+	 0x0128, 0x019A, 0xFEC7, 0xFFC8, 0x0098, 0xFFDD, 0xFFD9, 0x0016, 0x0002, 0xFFFD},
+	{0xFFFE, 0x0014, 0xFFF2, 0xFFC2, 0x006D, 0x003E, 0xFEB8, 0x009F, 0x022E, 0xFCD3, 0xFE6B,
+	 0x07B7, 0xFC50, 0xF1DD, 0x1C62, 0x4BAA, 0x2FCF, 0xF917, 0xF5C7, 0x0717, 0x01C3, 0xFBB1,
+	 0x0100, 0x01B3, 0xFECF, 0xFFB9, 0x009B, 0xFFE2, 0xFFD7, 0x0015, 0x0003, 0xFFFD},
+	{0xFFFD, 0x0014, 0xFFF5, 0xFFC0, 0x0067, 0x0049, 0xFEBD, 0x0082, 0x023F, 0xFCFE, 0xFE22,
+	 0x07A0, 0xFCFC, 0xF17F, 0x1A6E, 0x4B2C, 0x31A8, 0xFA2B, 0xF532, 0x06DD, 0x021F, 0xFBA6,
+	 0x00D6, 0x01CB, 0xFED8, 0xFFAA, 0x009D, 0xFFE6, 0xFFD4, 0x0015, 0x0004, 0xFFFD},
+	{0xFFFD, 0x0013, 0xFFF7, 0xFFBF, 0x0060, 0x0053, 0xFEC2, 0x0066, 0x024E, 0xFD2B, 0xFDDD,
+	 0x0783, 0xFDA6, 0xF131, 0x187D, 0x4A97, 0x3378, 0xFB4E, 0xF4A3, 0x069C, 0x027C, 0xFB9E,
+	 0x00AB, 0x01E1, 0xFEE3, 0xFF9B, 0x009F, 0xFFEB, 0xFFD2, 0x0014, 0x0005, 0xFFFD},
+	{0xFFFD, 0x0012, 0xFFFA, 0xFFBE, 0x005A, 0x005D, 0xFEC9, 0x0049, 0x025B, 0xFD59, 0xFD9B,
+	 0x075F, 0xFE4E, 0xF0F2, 0x1690, 0x49EC, 0x353E, 0xFC82, 0xF41A, 0x0654, 0x02D8, 0xFB9B,
+	 0x007E, 0x01F7, 0xFEEF, 0xFF8C, 0x00A0, 0xFFF1, 0xFFCF, 0x0014, 0x0005, 0xFFFC},
+	{0xFFFD, 0x0012, 0xFFFC, 0xFFBD, 0x0053, 0x0066, 0xFED0, 0x002D, 0x0265, 0xFD89, 0xFD5C,
+	 0x0736, 0xFEF3, 0xF0C3, 0x14A7, 0x492C, 0x36FB, 0xFDC5, 0xF398, 0x0603, 0x0334, 0xFB9B,
+	 0x0050, 0x020B, 0xFEFD, 0xFF7D, 0x00A1, 0xFFF6, 0xFFCD, 0x0013, 0x0006, 0xFFFC},
+	{0xFFFC, 0x0011, 0xFFFF, 0xFFBD, 0x004C, 0x006F, 0xFED8, 0x0012, 0x026D, 0xFDBA, 0xFD21,
+	 0x0706, 0xFF96, 0xF0A3, 0x12C5, 0x4856, 0x38AB, 0xFF17, 0xF31F, 0x05AB, 0x038F, 0xFBA0,
+	 0x0020, 0x021E, 0xFF0B, 0xFF6E, 0x00A1, 0xFFFC, 0xFFCB, 0x0012, 0x0007, 0xFFFC},
+	{0xFFFC, 0x0010, 0x0001, 0xFFBD, 0x0045, 0x0076, 0xFEE1, 0xFFF7, 0x0272, 0xFDEC, 0xFCEA,
+	 0x06D2, 0x0035, 0xF092, 0x10EA, 0x476B, 0x3A50, 0x0077, 0xF2AD, 0x054C, 0x03E8, 0xFBA9,
+	 0xFFF0, 0x022F, 0xFF1B, 0xFF5F, 0x00A0, 0x0002, 0xFFC8, 0x0011, 0x0008, 0xFFFC},
+	{0xFFFC, 0x0010, 0x0003, 0xFFBD, 0x003E, 0x007E, 0xFEEB, 0xFFDD, 0x0275, 0xFE1F, 0xFCB7,
+	 0x0699, 0x00CF, 0xF08F, 0x0F16, 0x466D, 0x3BE8, 0x01E6, 0xF245, 0x04E6, 0x0440, 0xFBB6,
+	 0xFFBE, 0x023F, 0xFF2C, 0xFF51, 0x009F, 0x0008, 0xFFC6, 0x0010, 0x0009, 0xFFFC},
+	{0xFFFC, 0x000F, 0x0005, 0xFFBE, 0x0037, 0x0084, 0xFEF6, 0xFFC4, 0x0276, 0xFE53, 0xFC88,
+	 0x065B, 0x0166, 0xF09A, 0x0D4B, 0x455A, 0x3D72, 0x0362, 0xF1E6, 0x0479, 0x0496, 0xFBC7,
+	 0xFF8B, 0x024C, 0xFF3F, 0xFF43, 0x009D, 0x000F, 0xFFC5, 0x000F, 0x000A, 0xFFFC},
+	{0xFFFC, 0x000E, 0x0007, 0xFFBE, 0x0030, 0x008A, 0xFF01, 0xFFAB, 0x0274, 0xFE87, 0xFC5D,
+	 0x0618, 0x01F7, 0xF0B3, 0x0B89, 0x4435, 0x3EEC, 0x04EC, 0xF192, 0x0405, 0x04E9, 0xFBDC,
+	 0xFF58, 0x0258, 0xFF52, 0xFF35, 0x009B, 0x0015, 0xFFC3, 0x000D, 0x000A, 0xFFFC},
+	{0xFFFC, 0x000D, 0x0009, 0xFFBF, 0x0029, 0x008F, 0xFF0E, 0xFF93, 0x0270, 0xFEBB, 0xFC37,
+	 0x05D2, 0x0283, 0xF0D9, 0x09D1, 0x42FD, 0x4058, 0x0682, 0xF149, 0x038A, 0x053A, 0xFBF6,
+	 0xFF24, 0x0262, 0xFF67, 0xFF27, 0x0098, 0x001C, 0xFFC1, 0x000C, 0x000B, 0xFFFC},
+	{0xFFFC, 0x000C, 0x000A, 0xFFC0, 0x0023, 0x0094, 0xFF1A, 0xFF7D, 0x026A, 0xFEF0, 0xFC14,
+	 0x0587, 0x030A, 0xF10B, 0x0824, 0x41B3, 0x41B3, 0x0824, 0xF10B, 0x030A, 0x0587, 0xFC14,
+	 0xFEF0, 0x026A, 0xFF7D, 0xFF1A, 0x0094, 0x0023, 0xFFC0, 0x000A, 0x000C, 0xFFFC},
+	{0xFFFC, 0x000B, 0x000C, 0xFFC1, 0x001C, 0x0098, 0xFF27, 0xFF67, 0x0262, 0xFF24, 0xFBF6,
+	 0x053A, 0x038A, 0xF149, 0x0682, 0x4058, 0x42FD, 0x09D1, 0xF0D9, 0x0283, 0x05D2, 0xFC37,
+	 0xFEBB, 0x0270, 0xFF93, 0xFF0E, 0x008F, 0x0029, 0xFFBF, 0x0009, 0x000D, 0xFFFC},
+	{0xFFFC, 0x000A, 0x000D, 0xFFC3, 0x0015, 0x009B, 0xFF35, 0xFF52, 0x0258, 0xFF58, 0xFBDC,
+	 0x04E9, 0x0405, 0xF192, 0x04EC, 0x3EEC, 0x4435, 0x0B89, 0xF0B3, 0x01F7, 0x0618, 0xFC5D,
+	 0xFE87, 0x0274, 0xFFAB, 0xFF01, 0x008A, 0x0030, 0xFFBE, 0x0007, 0x000E, 0xFFFC},
+	{0xFFFC, 0x000A, 0x000F, 0xFFC5, 0x000F, 0x009D, 0xFF43, 0xFF3F, 0x024C, 0xFF8B, 0xFBC7,
+	 0x0496, 0x0479, 0xF1E6, 0x0362, 0x3D72, 0x455A, 0x0D4B, 0xF09A, 0x0166, 0x065B, 0xFC88,
+	 0xFE53, 0x0276, 0xFFC4, 0xFEF6, 0x0084, 0x0037, 0xFFBE, 0x0005, 0x000F, 0xFFFC},
+	{0xFFFC, 0x0009, 0x0010, 0xFFC6, 0x0008, 0x009F, 0xFF51, 0xFF2C, 0x023F, 0xFFBE, 0xFBB6,
+	 0x0440, 0x04E6, 0xF245, 0x01E6, 0x3BE8, 0x466D, 0x0F16, 0xF08F, 0x00CF, 0x0699, 0xFCB7,
+	 0xFE1F, 0x0275, 0xFFDD, 0xFEEB, 0x007E, 0x003E, 0xFFBD, 0x0003, 0x0010, 0xFFFC},
+	{0xFFFC, 0x0008, 0x0011, 0xFFC8, 0x0002, 0x00A0, 0xFF5F, 0xFF1B, 0x022F, 0xFFF0, 0xFBA9,
+	 0x03E8, 0x054C, 0xF2AD, 0x0077, 0x3A50, 0x476B, 0x10EA, 0xF092, 0x0035, 0x06D2, 0xFCEA,
+	 0xFDEC, 0x0272, 0xFFF7, 0xFEE1, 0x0076, 0x0045, 0xFFBD, 0x0001, 0x0010, 0xFFFC},
+	{0xFFFC, 0x0007, 0x0012, 0xFFCB, 0xFFFC, 0x00A1, 0xFF6E, 0xFF0B, 0x021E, 0x0020, 0xFBA0,
+	 0x038F, 0x05AB, 0xF31F, 0xFF17, 0x38AB, 0x4856, 0x12C5, 0xF0A3, 0xFF96, 0x0706, 0xFD21,
+	 0xFDBA, 0x026D, 0x0012, 0xFED8, 0x006F, 0x004C, 0xFFBD, 0xFFFF, 0x0011, 0xFFFC},
+	{0xFFFC, 0x0006, 0x0013, 0xFFCD, 0xFFF6, 0x00A1, 0xFF7D, 0xFEFD, 0x020B, 0x0050, 0xFB9B,
+	 0x0334, 0x0603, 0xF398, 0xFDC5, 0x36FB, 0x492C, 0x14A7, 0xF0C3, 0xFEF3, 0x0736, 0xFD5C,
+	 0xFD89, 0x0265, 0x002D, 0xFED0, 0x0066, 0x0053, 0xFFBD, 0xFFFC, 0x0012, 0xFFFD},
+	{0xFFFC, 0x0005, 0x0014, 0xFFCF, 0xFFF1, 0x00A0, 0xFF8C, 0xFEEF, 0x01F7, 0x007E, 0xFB9B,
+	 0x02D8, 0x0654, 0xF41A, 0xFC82, 0x353E, 0x49EC, 0x1690, 0xF0F2, 0xFE4E, 0x075F, 0xFD9B,
+	 0xFD59, 0x025B, 0x0049, 0xFEC9, 0x005D, 0x005A, 0xFFBE, 0xFFFA, 0x0012, 0xFFFD},
+	{0xFFFD, 0x0005, 0x0014, 0xFFD2, 0xFFEB, 0x009F, 0xFF9B, 0xFEE3, 0x01E1, 0x00AB, 0xFB9E,
+	 0x027C, 0x069C, 0xF4A3, 0xFB4E, 0x3378, 0x4A97, 0x187D, 0xF131, 0xFDA6, 0x0783, 0xFDDD,
+	 0xFD2B, 0x024E, 0x0066, 0xFEC2, 0x0053, 0x0060, 0xFFBF, 0xFFF7, 0x0013, 0xFFFD},
+	{0xFFFD, 0x0004, 0x0015, 0xFFD4, 0xFFE6, 0x009D, 0xFFAA, 0xFED8, 0x01CB, 0x00D6, 0xFBA6,
+	 0x021F, 0x06DD, 0xF532, 0xFA2B, 0x31A8, 0x4B2C, 0x1A6E, 0xF17F, 0xFCFC, 0x07A0, 0xFE22,
+	 0xFCFE, 0x023F, 0x0082, 0xFEBD, 0x0049, 0x0067, 0xFFC0, 0xFFF5, 0x0014, 0xFFFD},
+	{0xFFFD, 0x0003, 0x0015, 0xFFD7, 0xFFE2, 0x009B, 0xFFB9, 0xFECF, 0x01B3, 0x0100, 0xFBB1,
+	 0x01C3, 0x0717, 0xF5C7, 0xF917, 0x2FCF, 0x4BAA, 0x1C62, 0xF1DD, 0xFC50, 0x07B7, 0xFE6B,
+	 0xFCD3, 0x022E, 0x009F, 0xFEB8, 0x003E, 0x006D, 0xFFC2, 0xFFF2, 0x0014, 0xFFFE},
+	{0xFFFD, 0x0002, 0x0016, 0xFFD9, 0xFFDD, 0x0098, 0xFFC8, 0xFEC7, 0x019A, 0x0128, 0xFBC0,
+	 0x0167, 0x0749, 0xF662, 0xF813, 0x2DEF, 0x4C12, 0x1E59, 0xF24C, 0xFBA3, 0x07C7, 0xFEB7,
+	 0xFCA9, 0x021A, 0x00BC, 0xFEB5, 0x0033, 0x0073, 0xFFC4, 0xFFF0, 0x0015, 0xFFFE},
+	{0xFFFD, 0x0002, 0x0016, 0xFFDC, 0xFFD9, 0x0095, 0xFFD6, 0xFEC0, 0x0180, 0x014E, 0xFBD2,
+	 0x010B, 0x0773, 0xF700, 0xF720, 0x2C09, 0x4C63, 0x2052, 0xF2CA, 0xFAF6, 0x07D1, 0xFF05,
+	 0xFC83, 0x0204, 0x00D9, 0xFEB3, 0x0027, 0x0079, 0xFFC6, 0xFFED, 0x0015, 0xFFFF},
+	{0xFFFD, 0x0001, 0x0016, 0xFFDF, 0xFFD5, 0x0091, 0xFFE4, 0xFEBB, 0x0165, 0x0171, 0xFBE8,
+	 0x00B1, 0x0795, 0xF7A3, 0xF63D, 0x2A1D, 0x4C9D, 0x224A, 0xF35A, 0xFA49, 0x07D4, 0xFF57,
+	 0xFC5E, 0x01EB, 0x00F6, 0xFEB2, 0x001A, 0x007F, 0xFFC8, 0xFFEA, 0x0015, 0xFFFF},
+	{0xFFFE, 0x0001, 0x0016, 0xFFE2, 0xFFD1, 0x008D, 0xFFF2, 0xFEB7, 0x014A, 0x0193, 0xFC01,
+	 0x0058, 0x07B0, 0xF84A, 0xF56B, 0x282D, 0x4CC0, 0x2442, 0xF3F9, 0xF99D, 0x07CF, 0xFFAA,
+	 0xFC3C, 0x01D0, 0x0112, 0xFEB2, 0x000D, 0x0084, 0xFFCB, 0xFFE7, 0x0016, 0xFFFF},
+	{0x0000, 0x0000, 0x0016, 0xFFE5, 0xFFCE, 0x0089, 0x0000, 0xFEB4, 0x012E, 0x01B3, 0xFC1D,
+	 0x0000, 0x07C3, 0xF8F2, 0xF4AA, 0x2638, 0x4CCA, 0x2638, 0xF4AA, 0xF8F2, 0x07C3, 0x0000,
+	 0xFC1D, 0x01B3, 0x012E, 0xFEB4, 0x0000, 0x0089, 0xFFCE, 0xFFE5, 0x0016, 0x0000},
+};
+
+static const q15_t poly_bank_cutoff_450[SAMPLE_RATE_CONVERTER_POLY_PHASES + 1][48] = {
+	{0x0004, 0xFFFD, 0xFFF1, 0x0000, 0x0026, 0x0012, 0xFFB8, 0xFFBE, 0x006C, 0x00A4, 0xFF87,
+	 0xFEBA, 0x0044, 0x022A, 0x006D, 0xFCBF, 0xFE0C, 0x0467, 0x04F2, 0xFA92, 0xF48B, 0x0625,
+	 0x2800, 0x399A, 0x2800, 0x0625, 0xF48B, 0xFA92, 0x04F2, 0x0467, 0xFE0C, 0xFCBF, 0x006D,
+	 0x022A, 0x0044, 0xFEBA, 0xFF87, 0x00A4, 0x006C, 0xFFBE, 0xFFB8, 0x0012, 0x0026, 0x0000,
+	 0xFFF1, 0xFFFD, 0x0004, 0x0000},
+	{0x0004, 0xFFFE, 0xFFF1, 0xFFFF, 0x0025, 0x0014, 0xFFBA, 0xFFBB, 0x0066, 0x00A8, 0xFF93,
+	 0xFEB8, 0x0031, 0x0226, 0x008A, 0xFCD2, 0xFDE5, 0x043A, 0x051E, 0xFAF4, 0xF46E, 0x0538,
+	 0x2701, 0x3995, 0x28FA, 0x0717, 0xF4AF, 0xFA31, 0x04C3, 0x0493, 0xFE35, 0xFCAE, 0x004F,
+	 0x022E, 0x0058, 0xFEBC, 0xFF7C, 0x00A0, 0x0072, 0xFFC1, 0xFFB5, 0x000F, 0x0027, 0x0001,
+	 0xFFF1, 0xFFFD, 0x0004, 0x0001},
+	{0x0004, 0xFFFE, 0xFFF1, 0xFFFE, 0x0024, 0x0016, 0xFFBD, 0xFFB7, 0x0060, 0x00AB, 0xFF9E,
+	 0xFEB7, 0x001E, 0x0220, 0x00A7, 0xFCE6, 0xFDC0, 0x040B, 0x0546, 0xFB56, 0xF458, 0x044F,
+	 0x25FF, 0x3986, 0x29EF, 0x080D, 0xF4D9, 0xF9D1, 0x0490, 0x04BD, 0xFE5F, 0xFC9F, 0x0031,
+	 0x0230, 0x006C, 0xFEBF, 0xFF71, 0x009C, 0x0077, 0xFFC5, 0xFFB3, 0x000D, 0x0027, 0x0002,
+	 0xFFF1, 0xFFFC, 0x0004, 0x0001},
+	{0x0004, 0xFFFF, 0xFFF1, 0xFFFD, 0x0023, 0x0018, 0xFFBF, 0xFFB5, 0x005A, 0x00AE, 0xFFAA,
+	 0xFEB6, 0x000B, 0x0219, 0x00C3, 0xFCFB, 0xFD9D, 0x03DA, 0x056C, 0xFBBA, 0xF448, 0x036C,
+	 0x24F9, 0x396E, 0x2ADF, 0x0908, 0xF509, 0xF972, 0x045B, 0x04E6, 0xFE8A, 0xFC90, 0x0011,
+	 0x0231, 0x0080, 0xFEC3, 0xFF65, 0x0097, 0x007D, 0xFFC9, 0xFFB1, 0x000B, 0x0028, 0x0003,
+	 0xFFF1, 0xFFFC, 0x0004, 0x0001},
+	{0x0004, 0xFFFF, 0xFFF2, 0xFFFC, 0x0023, 0x001A, 0xFFC2, 0xFFB2, 0x0054, 0x00B1, 0xFFB5,
+	 0xFEB7, 0xFFF8, 0x0212, 0x00DE, 0xFD12, 0xFD7B, 0x03A9, 0x058E, 0xFC1D, 0xF43E, 0x028E,
+	 0x23EF, 0x394C, 0x2BCA, 0x0A07, 0xF541, 0xF915, 0x0422, 0x050C, 0xFEB7, 0xFC84, 0xFFF2,
+	 0x0232, 0x0094, 0xFEC8, 0xFF5A, 0x0092, 0x0082, 0xFFCD, 0xFFAF, 0x0008, 0x0028, 0x0005,
+	 0xFFF1, 0xFFFC, 0x0004, 0x0001},
+	{0x0004, 0xFFFF, 0xFFF2, 0xFFFB, 0x0022, 0x001B, 0xFFC5, 0xFFB0, 0x004E, 0x00B3, 0xFFC1,
+	 0xFEB8, 0xFFE5, 0x0209, 0x00F8, 0xFD29, 0xFD5B, 0x0376, 0x05AC, 0xFC81, 0xF43B, 0x01B6,
+	 0x22E2, 0x3920, 0x2CB0, 0x0B0A, 0xF580, 0xF8BA, 0x03E6, 0x0531, 0xFEE5, 0xFC79, 0xFFD2,
+	 0x0231, 0x00A8, 0xFECD, 0xFF4F, 0x008C, 0x0087, 0xFFD1, 0xFFAD, 0x0006, 0x0029, 0x0006,
+	 0xFFF1, 0xFFFB, 0x0004, 0x0001},
+	{0x0004, 0x0000, 0xFFF2, 0xFFFA, 0x0020, 0x001D, 0xFFC8, 0xFFAD, 0x0048, 0x00B4, 0xFFCC,
+	 0xFEB9, 0xFFD3, 0x0200, 0x0112, 0xFD42, 0xFD3C, 0x0343, 0x05C7, 0xFCE5, 0xF43D, 0x00E3,
+	 0x21D2, 0x38EA, 0x2D90, 0x0C10, 0xF5C5, 0xF861, 0x03A7, 0x0553, 0xFF15, 0xFC6F, 0xFFB2,
+	 0x022F, 0x00BC, 0xFED3, 0xFF45, 0x0086, 0x008C, 0xFFD6, 0xFFAB, 0x0003, 0x0029, 0x0007,
+	 0xFFF1, 0xFFFB, 0x0004, 0x0002},
+	{0x0004, 0x0000, 0xFFF3, 0xFFF9, 0x001F, 0x001F, 0xFFCB, 0xFFAB, 0x0042, 0x00B5, 0xFFD8,
+	 0xFEBB, 0xFFC1, 0x01F6, 0x012A, 0xFD5C, 0xFD20, 0x030E, 0x05DF, 0xFD48, 0xF445, 0x0016,
+	 0x20BF, 0x38AB, 0x2E69, 0x0D19, 0xF612, 0xF80A, 0x0365, 0x0573, 0xFF45, 0xFC68, 0xFF91,
+	 0x022B, 0x00CF, 0xFEDA, 0xFF3A, 0x0080, 0x0091, 0xFFDA, 0xFFAA, 0x0000, 0x002A, 0x0008,
+	 0xFFF1, 0xFFFA, 0x0004, 0x0002},
+	{0x0003, 0x0000, 0xFFF3, 0xFFF8, 0x001E, 0x0020, 0xFFCD, 0xFFAA, 0x003B, 0x00B6, 0xFFE3,
+	 0xFEBE, 0xFFB0, 0x01EA, 0x0142, 0xFD76, 0xFD05, 0x02D9, 0x05F4, 0xFDAB, 0xF453, 0xFF50,
+	 0x1FAB, 0x3863, 0x2F3D, 0x0E26, 0xF665, 0xF7B5, 0x0321, 0x0591, 0xFF77, 0xFC62, 0xFF70,
+	 0x0227, 0x00E3, 0xFEE1, 0xFF30, 0x0079, 0x0095, 0xFFDF, 0xFFA8, 0xFFFE, 0x002A, 0x000A,
+	 0xFFF1, 0xFFFA, 0x0004, 0x0002},
+	{0x0003, 0x0001, 0xFFF3, 0xFFF8, 0x001D, 0x0021, 0xFFD0, 0xFFA8, 0x0035, 0x00B7, 0xFFEE,
+	 0xFEC1, 0xFF9F, 0x01DF, 0x0158, 0xFD92, 0xFCEC, 0x02A3, 0x0605, 0xFE0E, 0xF467, 0xFE8F,
+	 0x1E94, 0x3811, 0x3009, 0x0F35, 0xF6C0, 0xF763, 0x02D9, 0x05AC, 0xFFAA, 0xFC5E, 0xFF4F,
+	 0x0221, 0x00F7, 0xFEEA, 0xFF26, 0x0072, 0x0099, 0xFFE4, 0xFFA7, 0xFFFB, 0x002A, 0x000B,
+	 0xFFF1, 0xFFF9, 0x0003, 0x0002},
+	{0x0003, 0x0001, 0xFFF4, 0xFFF7, 0x001C, 0x0023, 0xFFD3, 0xFFA7, 0x002F, 0x00B7, 0xFFF9,
+	 0xFEC5, 0xFF8E, 0x01D2, 0x016E, 0xFDAF, 0xFCD6, 0x026D, 0x0613, 0xFE70, 0xF480, 0xFDD4,
+	 0x1D7C, 0x37B6, 0x30CF, 0x1047, 0xF721, 0xF714, 0x028F, 0x05C5, 0xFFDD, 0xFC5C, 0xFF2E,
+	 0x021B, 0x010A, 0xFEF2, 0xFF1C, 0x006A, 0x009D, 0xFFE9, 0xFFA6, 0xFFF8, 0x002A, 0x000C,
+	 0xFFF1, 0xFFF9, 0x0003, 0x0002},
+	{0x0003, 0x0001, 0xFFF4, 0xFFF6, 0x001B, 0x0024, 0xFFD7, 0xFFA5, 0x0029, 0x00B7, 0x0004,
+	 0xFECA, 0xFF7E, 0x01C4, 0x0183, 0xFDCC, 0xFCC1, 0x0236, 0x061E, 0xFED0, 0xF49E, 0xFD20,
+	 0x1C62, 0x3752, 0x318E, 0x115C, 0xF78A, 0xF6C8, 0x0243, 0x05DC, 0x0012, 0xFC5B, 0xFF0C,
+	 0x0213, 0x011D, 0xFEFC, 0xFF12, 0x0062, 0x00A1, 0xFFEE, 0xFFA5, 0xFFF5, 0x002A, 0x000E,
+	 0xFFF1, 0xFFF8, 0x0003, 0x0002},
+	{0x0003, 0x0001, 0xFFF4, 0xFFF5, 0x0019, 0x0025, 0xFFDA, 0xFFA4, 0x0022, 0x00B6, 0x000E,
+	 0xFECF, 0xFF6E, 0x01B6, 0x0196, 0xFDEA, 0xFCAE, 0x01FE, 0x0625, 0xFF30, 0xF4C2, 0xFC73,
+	 0x1B47, 0x36E4, 0x3246, 0x1272, 0xF7FA, 0xF67F, 0x01F4, 0x05F0, 0x0047, 0xFC5D, 0xFEEB,
+	 0x0209, 0x0130, 0xFF06, 0xFF09, 0x005A, 0x00A5, 0xFFF4, 0xFFA4, 0xFFF2, 0x002A, 0x000F,
+	 0xFFF2, 0xFFF8, 0x0003, 0x0002},
+	{0x0003, 0x0002, 0xFFF5, 0xFFF5, 0x0018, 0x0026, 0xFFDD, 0xFFA4, 0x001C, 0x00B5, 0x0019,
+	 0xFED5, 0xFF5F, 0x01A7, 0x01A8, 0xFE09, 0xFC9D, 0x01C7, 0x0629, 0xFF8F, 0xF4EA, 0xFBCB,
+	 0x1A2C, 0x366E, 0x32F6, 0x138A, 0xF870, 0xF639, 0x01A2, 0x0601, 0x007C, 0xFC60, 0xFECA,
+	 0x01FF, 0x0142, 0xFF11, 0xFF01, 0x0052, 0x00A8, 0xFFF9, 0xFFA4, 0xFFEF, 0x0029, 0x0010,
+	 0xFFF2, 0xFFF7, 0x0003, 0x0002},
+	{0x0003, 0x0002, 0xFFF5, 0xFFF4, 0x0017, 0x0027, 0xFFE0, 0xFFA3, 0x0016, 0x00B4, 0x0023,
+	 0xFEDB, 0xFF51, 0x0198, 0x01BA, 0xFE28, 0xFC8E, 0x0190, 0x062A, 0xFFEC, 0xF517, 0xFB2B,
+	 0x1910, 0x35EF, 0x339E, 0x14A3, 0xF8EE, 0xF5F7, 0x014E, 0x060F, 0x00B3, 0xFC65, 0xFEA9,
+	 0x01F4, 0x0154, 0xFF1C, 0xFEF8, 0x0049, 0x00AB, 0xFFFF, 0xFFA3, 0xFFEC, 0x0029, 0x0012,
+	 0xFFF2, 0xFFF7, 0x0003, 0x0002},
+	{0x0003, 0x0002, 0xFFF6, 0xFFF4, 0x0016, 0x0027, 0xFFE3, 0xFFA3, 0x0010, 0x00B2, 0x002D,
+	 0xFEE2, 0xFF43, 0x0188, 0x01CA, 0xFE48, 0xFC81, 0x0158, 0x0628, 0x0047, 0xF549, 0xFA92,
+	 0x17F4, 0x3567, 0x343F, 0x15BD, 0xF973, 0xF5B9, 0x00F9, 0x061A, 0x00EA, 0xFC6C, 0xFE88,
+	 0x01E7, 0x0166, 0xFF29, 0xFEF0, 0x0040, 0x00AE, 0x0004, 0xFFA3, 0xFFE9, 0x0029, 0x0013,
+	 0xFFF3, 0xFFF7, 0x0003, 0x0003},
+	{0x0003, 0x0002, 0xFFF6, 0xFFF3, 0x0014, 0x0028, 0xFFE6, 0xFFA3, 0x000A, 0x00B0, 0x0036,
+	 0xFEE9, 0xFF35, 0x0177, 0x01D9, 0xFE68, 0xFC76, 0x0121, 0x0622, 0x00A1, 0xF57F, 0xF9FF,
+	 0x16D8, 0x34D7, 0x34D7, 0x16D8, 0xF9FF, 0xF57F, 0x00A1, 0x0622, 0x0121, 0xFC76, 0xFE68,
+	 0x01D9, 0x0177, 0xFF35, 0xFEE9, 0x0036, 0x00B0, 0x000A, 0xFFA3, 0xFFE6, 0x0028, 0x0014,
+	 0xFFF3, 0xFFF6, 0x0002, 0x0003},
+	{0x0003, 0x0003, 0xFFF7, 0xFFF3, 0x0013, 0x0029, 0xFFE9, 0xFFA3, 0x0004, 0x00AE, 0x0040,
+	 0xFEF0, 0xFF29, 0x0166, 0x01E7, 0xFE88, 0xFC6C, 0x00EA, 0x061A, 0x00F9, 0xF5B9, 0xF973,
+	 0x15BD, 0x343F, 0x3567, 0x17F4, 0xFA92, 0xF549, 0x0047, 0x0628, 0x0158, 0xFC81, 0xFE48,
+	 0x01CA, 0x0188, 0xFF43, 0xFEE2, 0x002D, 0x00B2, 0x0010, 0xFFA3, 0xFFE3, 0x0027, 0x0016,
+	 0xFFF4, 0xFFF6, 0x0002, 0x0003},
+	{0x0002, 0x0003, 0xFFF7, 0xFFF2, 0x0012, 0x0029, 0xFFEC, 0xFFA3, 0xFFFF, 0x00AB, 0x0049,
+	 0xFEF8, 0xFF1C, 0x0154, 0x01F4, 0xFEA9, 0xFC65, 0x00B3, 0x060F, 0x014E, 0xF5F7, 0xF8EE,
+	 0x14A3, 0x339E, 0x35EF, 0x1910, 0xFB2B, 0xF517, 0xFFEC, 0x062A, 0x0190, 0xFC8E, 0xFE28,
+	 0x01BA, 0x0198, 0xFF51, 0xFEDB, 0x0023, 0x00B4, 0x0016, 0xFFA3, 0xFFE0, 0x0027, 0x0017,
+	 0xFFF4, 0xFFF5, 0x0002, 0x0003},
+	{0x0002, 0x0003, 0xFFF7, 0xFFF2, 0x0010, 0x0029, 0xFFEF, 0xFFA4, 0xFFF9, 0x00A8, 0x0052,
+	 0xFF01, 0xFF11, 0x0142, 0x01FF, 0xFECA, 0xFC60, 0x007C, 0x0601, 0x01A2, 0xF639, 0xF870,
+	 0x138A, 0x32F6, 0x366E, 0x1A2C, 0xFBCB, 0xF4EA, 0xFF8F, 0x0629, 0x01C7, 0xFC9D, 0xFE09,
+	 0x01A8, 0x01A7, 0xFF5F, 0xFED5, 0x0019, 0x00B5, 0x001C, 0xFFA4, 0xFFDD, 0x0026, 0x0018,
+	 0xFFF5, 0xFFF5, 0x0002, 0x0003},
+	{0x0002, 0x0003, 0xFFF8, 0xFFF2, 0x000F, 0x002A, 0xFFF2, 0xFFA4, 0xFFF4, 0x00A5, 0x005A,
+	 0xFF09, 0xFF06, 0x0130, 0x0209, 0xFEEB, 0xFC5D, 0x0047, 0x05F0, 0x01F4, 0xF67F, 0xF7FA,
+	 0x1272, 0x3246, 0x36E4, 0x1B47, 0xFC73, 0xF4C2, 0xFF30, 0x0625, 0x01FE, 0xFCAE, 0xFDEA,
+	 0x0196, 0x01B6, 0xFF6E, 0xFECF, 0x000E, 0x00B6, 0x0022, 0xFFA4, 0xFFDA, 0x0025, 0x0019,
+	 0xFFF5, 0xFFF4, 0x0001, 0x0003},
+	{0x0002, 0x0003, 0xFFF8, 0xFFF1, 0x000E, 0x002A, 0xFFF5, 0xFFA5, 0xFFEE, 0x00A1, 0x0062,
+	 0xFF12, 0xFEFC, 0x011D, 0x0213, 0xFF0C, 0xFC5B, 0x0012, 0x05DC, 0x0243, 0xF6C8, 0xF78A,
+	 0x115C, 0x318E, 0x3752, 0x1C62, 0xFD20, 0xF49E, 0xFED0, 0x061E, 0x0236, 0xFCC1, 0xFDCC,
+	 0x0183, 0x01C4, 0xFF7E, 0xFECA, 0x0004, 0x00B7, 0x0029, 0xFFA5, 0xFFD7, 0x0024, 0x001B,
+	 0xFFF6, 0xFFF4, 0x0001, 0x0003},
+	{0x0002, 0x0003, 0xFFF9, 0xFFF1, 0x000C, 0x002A, 0xFFF8, 0xFFA6, 0xFFE9, 0x009D, 0x006A,
+	 0xFF1C, 0xFEF2, 0x010A, 0x021B, 0xFF2E, 0xFC5C, 0xFFDD, 0x05C5, 0x028F, 0xF714, 0xF721,
+	 0x1047, 0x30CF, 0x37B6, 0x1D7C, 0xFDD4, 0xF480, 0xFE70, 0x0613, 0x026D, 0xFCD6, 0xFDAF,
+	 0x016E, 0x01D2, 0xFF8E, 0xFEC5, 0xFFF9, 0x00B7, 0x002F, 0xFFA7, 0xFFD3, 0x0023, 0x001C,
+	 0xFFF7, 0xFFF4, 0x0001, 0x0003},
+	{0x0002, 0x0003, 0xFFF9, 0xFFF1, 0x000B, 0x002A, 0xFFFB, 0xFFA7, 0xFFE4, 0x0099, 0x0072,
+	 0xFF26, 0xFEEA, 0x00F7, 0x0221, 0xFF4F, 0xFC5E, 0xFFAA, 0x05AC, 0x02D9, 0xF763, 0xF6C0,
+	 0x0F35, 0x3009, 0x3811, 0x1E94, 0xFE8F, 0xF467, 0xFE0E, 0x0605, 0x02A3, 0xFCEC, 0xFD92,
+	 0x0158, 0x01DF, 0xFF9F, 0xFEC1, 0xFFEE, 0x00B7, 0x0035, 0xFFA8, 0xFFD0, 0x0021, 0x001D,
+	 0xFFF8, 0xFFF3, 0x0001, 0x0003},
+	{0x0002, 0x0004, 0xFFFA, 0xFFF1, 0x000A, 0x002A, 0xFFFE, 0xFFA8, 0xFFDF, 0x0095, 0x0079,
+	 0xFF30, 0xFEE1, 0x00E3, 0x0227, 0xFF70, 0xFC62, 0xFF77, 0x0591, 0x0321, 0xF7B5, 0xF665,
+	 0x0E26, 0x2F3D, 0x3863, 0x1FAB, 0xFF50, 0xF453, 0xFDAB, 0x05F4, 0x02D9, 0xFD05, 0xFD76,
+	 0x0142, 0x01EA, 0xFFB0, 0xFEBE, 0xFFE3, 0x00B6, 0x003B, 0xFFAA, 0xFFCD, 0x0020, 0x001E,
+	 0xFFF8, 0xFFF3, 0x0000, 0x0003},
+	{0x0002, 0x0004, 0xFFFA, 0xFFF1, 0x0008, 0x002A, 0x0000, 0xFFAA, 0xFFDA, 0x0091, 0x0080,
+	 0xFF3A, 0xFEDA, 0x00CF, 0x022B, 0xFF91, 0xFC68, 0xFF45, 0x0573, 0x0365, 0xF80A, 0xF612,
+	 0x0D19, 0x2E69, 0x38AB, 0x20BF, 0x0016, 0xF445, 0xFD48, 0x05DF, 0x030E, 0xFD20, 0xFD5C,
+	 0x012A, 0x01F6, 0xFFC1, 0xFEBB, 0xFFD8, 0x00B5, 0x0042, 0xFFAB, 0xFFCB, 0x001F, 0x001F,
+	 0xFFF9, 0xFFF3, 0x0000, 0x0004},
+	{0x0002, 0x0004, 0xFFFB, 0xFFF1, 0x0007, 0x0029, 0x0003, 0xFFAB, 0xFFD6, 0x008C, 0x0086,
+	 0xFF45, 0xFED3, 0x00BC, 0x022F, 0xFFB2, 0xFC6F, 0xFF15, 0x0553, 0x03A7, 0xF861, 0xF5C5,
+	 0x0C10, 0x2D90, 0x38EA, 0x21D2, 0x00E3, 0xF43D, 0xFCE5, 0x05C7, 0x0343, 0xFD3C, 0xFD42,
+	 0x0112, 0x0200, 0xFFD3, 0xFEB9, 0xFFCC, 0x00B4, 0x0048, 0xFFAD, 0xFFC8, 0x001D, 0x0020,
+	 0xFFFA, 0xFFF2, 0x0000, 0x0004},
+	{0x0001, 0x0004, 0xFFFB, 0xFFF1, 0x0006, 0x0029, 0x0006, 0xFFAD, 0xFFD1, 0x0087, 0x008C,
+	 0xFF4F, 0xFECD, 0x00A8, 0x0231, 0xFFD2, 0xFC79, 0xFEE5, 0x0531, 0x03E6, 0xF8BA, 0xF580,
+	 0x0B0A, 0x2CB0, 0x3920, 0x22E2, 0x01B6, 0xF43B, 0xFC81, 0x05AC, 0x0376, 0xFD5B, 0xFD29,
+	 0x00F8, 0x0209, 0xFFE5, 0xFEB8, 0xFFC1, 0x00B3, 0x004E, 0xFFB0, 0xFFC5, 0x001B, 0x0022,
+	 0xFFFB, 0xFFF2, 0xFFFF, 0x0004},
+	{0x0001, 0x0004, 0xFFFC, 0xFFF1, 0x0005, 0x0028, 0x0008, 0xFFAF, 0xFFCD, 0x0082, 0x0092,
+	 0xFF5A, 0xFEC8, 0x0094, 0x0232, 0xFFF2, 0xFC84, 0xFEB7, 0x050C, 0x0422, 0xF915, 0xF541,
+	 0x0A07, 0x2BCA, 0x394C, 0x23EF, 0x028E, 0xF43E, 0xFC1D, 0x058E, 0x03A9, 0xFD7B, 0xFD12,
+	 0x00DE, 0x0212, 0xFFF8, 0xFEB7, 0xFFB5, 0x00B1, 0x0054, 0xFFB2, 0xFFC2, 0x001A, 0x0023,
+	 0xFFFC, 0xFFF2, 0xFFFF, 0x0004},
+	{0x0001, 0x0004, 0xFFFC, 0xFFF1, 0x0003, 0x0028, 0x000B, 0xFFB1, 0xFFC9, 0x007D, 0x0097,
+	 0xFF65, 0xFEC3, 0x0080, 0x0231, 0x0011, 0xFC90, 0xFE8A, 0x04E6, 0x045B, 0xF972, 0xF509,
+	 0x0908, 0x2ADF, 0x396E, 0x24F9, 0x036C, 0xF448, 0xFBBA, 0x056C, 0x03DA, 0xFD9D, 0xFCFB,
+	 0x00C3, 0x0219, 0x000B, 0xFEB6, 0xFFAA, 0x00AE, 0x005A, 0xFFB5, 0xFFBF, 0x0018, 0x0023,
+	 0xFFFD, 0xFFF1, 0xFFFF, 0x0004},
+	{0x0001, 0x0004, 0xFFFC, 0xFFF1, 0x0002, 0x0027, 0x000D, 0xFFB3, 0xFFC5, 0x0077, 0x009C,
+	 0xFF71, 0xFEBF, 0x006C, 0x0230, 0x0031, 0xFC9F, 0xFE5F, 0x04BD, 0x0490, 0xF9D1, 0xF4D9,
+	 0x080D, 0x29EF, 0x3986, 0x25FF, 0x044F, 0xF458, 0xFB56, 0x0546, 0x040B, 0xFDC0, 0xFCE6,
+	 0x00A7, 0x0220, 0x001E, 0xFEB7, 0xFF9E, 0x00AB, 0x0060, 0xFFB7, 0xFFBD, 0x0016, 0x0024,
+	 0xFFFE, 0xFFF1, 0xFFFE, 0x0004},
+	{0x0001, 0x0004, 0xFFFD, 0xFFF1, 0x0001, 0x0027, 0x000F, 0xFFB5, 0xFFC1, 0x0072, 0x00A0,
+	 0xFF7C, 0xFEBC, 0x0058, 0x022E, 0x004F, 0xFCAE, 0xFE35, 0x0493, 0x04C3, 0xFA31, 0xF4AF,
+	 0x0717, 0x28FA, 0x3995, 0x2701, 0x0538, 0xF46E, 0xFAF4, 0x051E, 0x043A, 0xFDE5, 0xFCD2,
+	 0x008A, 0x0226, 0x0031, 0xFEB8, 0xFF93, 0x00A8, 0x0066, 0xFFBB, 0xFFBA, 0x0014, 0x0025,
+	 0xFFFF, 0xFFF1, 0xFFFE, 0x0004},
+	{0x0000, 0x0004, 0xFFFD, 0xFFF1, 0x0000, 0x0026, 0x0012, 0xFFB8, 0xFFBE, 0x006C, 0x00A4,
+	 0xFF87, 0xFEBA, 0x0044, 0x022A, 0x006D, 0xFCBF, 0xFE0C, 0x0467, 0x04F2, 0xFA92, 0xF48B,
+	 0x0625, 0x2800, 0x399A, 0x2800, 0x0625, 0xF48B, 0xFA92, 0x04F2, 0x0467, 0xFE0C, 0xFCBF,
+	 0x006D, 0x022A, 0x0044, 0xFEBA, 0xFF87, 0x00A4, 0x006C, 0xFFBE, 0xFFB8, 0x0012, 0x0026,
+	 0x0000, 0xFFF1, 0xFFFD, 0x0004},
+};
+
+static const q15_t poly_bank_cutoff_300[SAMPLE_RATE_CONVERTER_POLY_PHASES + 1][64] = {
+	{0xFFFE, 0x0000, 0x0006, 0x000B, 0x0005, 0xFFF2, 0xFFE0, 0xFFE7, 0x0011, 0x0044, 0x004A,
+	 0x0000, 0xFF8D, 0xFF5A, 0xFFBE, 0x0097, 0x0135, 0x00D9, 0xFF78, 0xFE0F, 0xFE0A, 0x0000,
+	 0x02C4, 0x03E2, 0x0185, 0xFC79, 0xF885, 0xFA55, 0x0412, 0x131C, 0x20D9, 0x2666, 0x20D9,
+	 0x131C, 0x0412, 0xFA55, 0xF885, 0xFC79, 0x0185, 0x03E2, 0x02C4, 0x0000, 0xFE0A, 0xFE0F,
+	 0xFF78, 0x00D9, 0x0135, 0x0097, 0xFFBE, 0xFF5A, 0xFF8D, 0x0000, 0x004A, 0x0044, 0x0011,
+	 0xFFE7, 0xFFE0, 0xFFF2, 0x0005, 0x000B, 0x0006, 0x0000, 0xFFFE, 0x0000},
+	{0xFFFE, 0x0000, 0x0006, 0x000B, 0x0006, 0xFFF3, 0xFFE0, 0xFFE6, 0x0010, 0x0043, 0x004B,
+	 0x0003, 0xFF90, 0xFF5A, 0xFFB9, 0x0090, 0x0133, 0x00E1, 0xFF85, 0xFE16, 0xFE02, 0xFFEA,
+	 0x02B0, 0x03E5, 0x01A5, 0xFCA4, 0xF894, 0xFA28, 0x03A9, 0x129F, 0x2083, 0x2664, 0x212D,
+	 0x139A, 0x047C, 0xFA84, 0xF878, 0xFC4F, 0x0164, 0x03DD, 0x02D6, 0x0016, 0xFE13, 0xFE07,
+	 0xFF6B, 0x00D2, 0x0137, 0x009E, 0xFFC4, 0xFF5B, 0xFF8A, 0xFFFD, 0x0049, 0x0046, 0x0013,
+	 0xFFE8, 0xFFE0, 0xFFF2, 0x0005, 0x000B, 0x0006, 0x0000, 0xFFFE, 0xFFFF},
+	{0xFFFE, 0x0000, 0x0006, 0x000B, 0x0006, 0xFFF4, 0xFFE1, 0xFFE5, 0x000E, 0x0042, 0x004C,
+	 0x0007, 0xFF94, 0xFF59, 0xFFB3, 0x0089, 0x0131, 0x00E8, 0xFF92, 0xFE1E, 0xFDFB, 0xFFD5,
+	 0x029D, 0x03E8, 0x01C5, 0xFCCF, 0xF8A4, 0xF9FD, 0x0341, 0x1221, 0x202C, 0x2660, 0x217E,
+	 0x1416, 0x04E9, 0xFAB6, 0xF86C, 0xFC25, 0x0142, 0x03D8, 0x02E9, 0x002C, 0xFE1B, 0xFE00,
+	 0xFF5E, 0x00CA, 0x0138, 0x00A5, 0xFFCA, 0xFF5B, 0xFF87, 0xFFF9, 0x0048, 0x0047, 0x0015,
+	 0xFFE9, 0xFFE0, 0xFFF1, 0x0004, 0x000B, 0x0007, 0x0000, 0xFFFE, 0xFFFF},
+	{0xFFFE, 0x0000, 0x0005, 0x000B, 0x0006, 0xFFF4, 0xFFE1, 0xFFE5, 0x000C, 0x0041, 0x004D,
+	 0x000A, 0xFF97, 0xFF59, 0xFFAE, 0x0082, 0x012F, 0x00EF, 0xFF9F, 0xFE26, 0xFDF4, 0xFFC0,
+	 0x0289, 0x03E9, 0x01E4, 0xFCFA, 0xF8B6, 0xF9D4, 0x02DB, 0x11A3, 0x1FD2, 0x2659, 0x21CD,
+	 0x1493, 0x0556, 0xFAE9, 0xF862, 0xFBFB, 0x011F, 0x03D2, 0x02FB, 0x0042, 0xFE25, 0xFDFA,
+	 0xFF51, 0x00C1, 0x0139, 0x00AC, 0xFFD0, 0xFF5C, 0xFF84, 0xFFF6, 0x0046, 0x0048, 0x0016,
+	 0xFFEA, 0xFFDF, 0xFFF0, 0x0004, 0x000B, 0x0007, 0x0000, 0xFFFE, 0xFFFF},
+	{0xFFFE, 0xFFFF, 0x0005, 0x000B, 0x0007, 0xFFF5, 0xFFE1, 0xFFE4, 0x000B, 0x003F, 0x004D,
+	 0x000D, 0xFF9A, 0xFF59, 0xFFA9, 0x007B, 0x012C, 0x00F6, 0xFFAC, 0xFE2F, 0xFDEE, 0xFFAB,
+	 0x0274, 0x03EA, 0x0202, 0xFD25, 0xF8C9, 0xF9AD, 0x0276, 0x1125, 0x1F76, 0x264F, 0x221A,
+	 0x150F, 0x05C5, 0xFB1F, 0xF85A, 0xFBD2, 0x00FB, 0x03CB, 0x030C, 0x0058, 0xFE2F, 0xFDF4,
+	 0xFF44, 0x00B9, 0x013A, 0x00B3, 0xFFD5, 0xFF5D, 0xFF81, 0xFFF2, 0x0045, 0x0049, 0x0018,
+	 0xFFEA, 0xFFDF, 0xFFEF, 0x0003, 0x000B, 0x0007, 0x0001, 0xFFFE, 0xFFFF},
+	{0xFFFE, 0xFFFF, 0x0005, 0x000B, 0x0007, 0xFFF6, 0xFFE2, 0xFFE3, 0x0009, 0x003E, 0x004E,
+	 0x0010, 0xFF9E, 0xFF59, 0xFFA4, 0x0074, 0x0129, 0x00FC, 0xFFB9, 0xFE38, 0xFDE9, 0xFF97,
+	 0x0260, 0x03EA, 0x0220, 0xFD50, 0xF8DD, 0xF988, 0x0213, 0x10A7, 0x1F18, 0x2642, 0x2265,
+	 0x158A, 0x0634, 0xFB56, 0xF853, 0xFBA9, 0x00D7, 0x03C3, 0x031D, 0x006F, 0xFE39, 0xFDEE,
+	 0xFF37, 0x00B0, 0x013B, 0x00B9, 0xFFDC, 0xFF5F, 0xFF7E, 0xFFEF, 0x0044, 0x004A, 0x001A,
+	 0xFFEB, 0xFFDF, 0xFFEF, 0x0003, 0x000B, 0x0007, 0x0001, 0xFFFE, 0xFFFF},
+	{0xFFFE, 0xFFFF, 0x0005, 0x000B, 0x0007, 0xFFF6, 0xFFE2, 0xFFE3, 0x0007, 0x003D, 0x004F,
+	 0x0013, 0xFFA1, 0xFF5A, 0xFF9F, 0x006C, 0x0126, 0x0102, 0xFFC6, 0xFE41, 0xFDE3, 0xFF83,
+	 0x024B, 0x03E9, 0x023C, 0xFD7B, 0xF8F3, 0xF965, 0x01B1, 0x1029, 0x1EB9, 0x2632, 0x22AD,
+	 0x1605, 0x06A6, 0xFB90, 0xF84D, 0xFB80, 0x00B3, 0x03B9, 0x032D, 0x0086, 0xFE44, 0xFDE9,
+	 0xFF2A, 0x00A7, 0x013B, 0x00C0, 0xFFE2, 0xFF60, 0xFF7B, 0xFFEB, 0x0042, 0x004B, 0x001C,
+	 0xFFEC, 0xFFDF, 0xFFEE, 0x0002, 0x000B, 0x0007, 0x0001, 0xFFFE, 0xFFFF},
+	{0xFFFE, 0xFFFF, 0x0005, 0x000A, 0x0008, 0xFFF7, 0xFFE3, 0xFFE2, 0x0006, 0x003B, 0x004F,
+	 0x0016, 0xFFA5, 0xFF5A, 0xFF9B, 0x0065, 0x0123, 0x0108, 0xFFD2, 0xFE4B, 0xFDDF, 0xFF6F,
+	 0x0235, 0x03E7, 0x0258, 0xFDA6, 0xF90A, 0xF944, 0x0151, 0x0FAB, 0x1E57, 0x261F, 0x22F3,
+	 0x167F, 0x0718, 0xFBCC, 0xF84A, 0xFB58, 0x008D, 0x03AF, 0x033D, 0x009C, 0xFE50, 0xFDE4,
+	 0xFF1D, 0x009D, 0x013B, 0x00C7, 0xFFE8, 0xFF62, 0xFF78, 0xFFE7, 0x0041, 0x004B, 0x001D,
+	 0xFFED, 0xFFDF, 0xFFED, 0x0002, 0x000B, 0x0008, 0x0001, 0xFFFE, 0xFFFF},
+	{0xFFFE, 0xFFFF, 0x0004, 0x000A, 0x0008, 0xFFF8, 0xFFE3, 0xFFE2, 0x0004, 0x003A, 0x0050,
+	 0x0019, 0xFFA8, 0xFF5B, 0xFF96, 0x005E, 0x011F, 0x010D, 0xFFDF, 0xFE55, 0xFDDB, 0xFF5B,
+	 0x0220, 0x03E4, 0x0273, 0xFDD2, 0xF922, 0xF926, 0x00F3, 0x0F2D, 0x1DF4, 0x2609, 0x2336,
+	 0x16F8, 0x078B, 0xFC0A, 0xF848, 0xFB31, 0x0068, 0x03A4, 0x034C, 0x00B3, 0xFE5C, 0xFDE0,
+	 0xFF10, 0x0094, 0x013B, 0x00CD, 0xFFEE, 0xFF64, 0xFF76, 0xFFE4, 0x003F, 0x004C, 0x001F,
+	 0xFFEF, 0xFFDF, 0xFFED, 0x0001, 0x000B, 0x0008, 0x0001, 0xFFFE, 0xFFFE},
+	{0xFFFE, 0xFFFF, 0x0004, 0x000A, 0x0008, 0xFFF8, 0xFFE4, 0xFFE1, 0x0003, 0x0038, 0x0050,
+	 0x001C, 0xFFAC, 0xFF5B, 0xFF92, 0x0057, 0x011C, 0x0112, 0xFFEB, 0xFE5F, 0xFDD7, 0xFF48,
+	 0x020A, 0x03E0, 0x028D, 0xFDFD, 0xF93C, 0xF909, 0x0096, 0x0EAF, 0x1D8F, 0x25F1, 0x2377,
+	 0x1770, 0x0800, 0xFC49, 0xF848, 0xFB0A, 0x0041, 0x0398, 0x035B, 0x00CA, 0xFE68, 0xFDDC,
+	 0xFF03, 0x008A, 0x013A, 0x00D3, 0xFFF5, 0xFF65, 0xFF73, 0xFFE0, 0x003D, 0x004D, 0x0021,
+	 0xFFF0, 0xFFDF, 0xFFEC, 0x0001, 0x000B, 0x0008, 0x0001, 0xFFFE, 0xFFFE},
+	{0xFFFE, 0xFFFF, 0x0004, 0x000A, 0x0009, 0xFFF9, 0xFFE4, 0xFFE1, 0x0001, 0x0037, 0x0050,
+	 0x001F, 0xFFB0, 0xFF5C, 0xFF8E, 0x004F, 0x0118, 0x0117, 0xFFF8, 0xFE69, 0xFDD4, 0xFF36,
+	 0x01F4, 0x03DC, 0x02A6, 0xFE28, 0xF957, 0xF8EF, 0x003C, 0x0E31, 0x1D28, 0x25D5, 0x23B6,
+	 0x17E8, 0x0875, 0xFC8B, 0xF849, 0xFAE4, 0x001A, 0x038B, 0x0369, 0x00E1, 0xFE75, 0xFDD8,
+	 0xFEF6, 0x0080, 0x0139, 0x00D9, 0xFFFC, 0xFF68, 0xFF71, 0xFFDC, 0x003B, 0x004E, 0x0023,
+	 0xFFF1, 0xFFDE, 0xFFEB, 0x0000, 0x000B, 0x0008, 0x0002, 0xFFFE, 0xFFFE},
+	{0xFFFE, 0xFFFF, 0x0004, 0x000A, 0x0009, 0xFFFA, 0xFFE5, 0xFFE0, 0xFFFF, 0x0035, 0x0050,
+	 0x0022, 0xFFB3, 0xFF5D, 0xFF8A, 0x0048, 0x0113, 0x011B, 0x0004, 0xFE74, 0xFDD2, 0xFF23,
+	 0x01DE, 0x03D6, 0x02BE, 0xFE53, 0xF972, 0xF8D6, 0xFFE3, 0x0DB4, 0x1CC0, 0x25B7, 0x23F2,
+	 0x185E, 0x08EB, 0xFCCF, 0xF84D, 0xFABE, 0xFFF3, 0x037E, 0x0376, 0x00F8, 0xFE83, 0xFDD5,
+	 0xFEEA, 0x0076, 0x0138, 0x00DF, 0x0002, 0xFF6A, 0xFF6E, 0xFFD9, 0x0039, 0x004E, 0x0024,
+	 0xFFF2, 0xFFDE, 0xFFEB, 0x0000, 0x000B, 0x0008, 0x0002, 0xFFFE, 0xFFFE},
+	{0xFFFE, 0xFFFF, 0x0004, 0x000A, 0x0009, 0xFFFA, 0xFFE5, 0xFFE0, 0xFFFE, 0x0033, 0x0050,
+	 0x0024, 0xFFB7, 0xFF5E, 0xFF86, 0x0041, 0x010F, 0x0120, 0x0010, 0xFE7F, 0xFDD0, 0xFF11,
+	 0x01C7, 0x03D0, 0x02D6, 0xFE7E, 0xF98F, 0xF8C0, 0xFF8B, 0x0D37, 0x1C56, 0x2596, 0x242B,
+	 0x18D4, 0x0963, 0xFD15, 0xF852, 0xFA99, 0xFFCB, 0x036F, 0x0383, 0x0110, 0xFE91, 0xFDD3,
+	 0xFEDD, 0x006B, 0x0136, 0x00E5, 0x0009, 0xFF6C, 0xFF6C, 0xFFD5, 0x0037, 0x004F, 0x0026,
+	 0xFFF3, 0xFFDF, 0xFFEA, 0xFFFF, 0x000A, 0x0009, 0x0002, 0xFFFE, 0xFFFE},
+	{0xFFFE, 0xFFFF, 0x0003, 0x000A, 0x0009, 0xFFFB, 0xFFE6, 0xFFE0, 0xFFFD, 0x0032, 0x0051,
+	 0x0027, 0xFFBB, 0xFF60, 0xFF82, 0x003A, 0x010A, 0x0124, 0x001C, 0xFE8A, 0xFDCF, 0xFF00,
+	 0x01B1, 0x03C9, 0x02EC, 0xFEA9, 0xF9AD, 0xF8AB, 0xFF36, 0x0CBA, 0x1BEA, 0x2572, 0x2462,
+	 0x1948, 0x09DB, 0xFD5D, 0xF859, 0xFA75, 0xFFA2, 0x035F, 0x038F, 0x0127, 0xFE9F, 0xFDD1,
+	 0xFED1, 0x0060, 0x0135, 0x00EB, 0x0010, 0xFF6F, 0xFF6A, 0xFFD1, 0x0035, 0x004F, 0x0028,
+	 0xFFF4, 0xFFDF, 0xFFE9, 0xFFFF, 0x000A, 0x0009, 0x0002, 0xFFFE, 0xFFFE},
+	{0xFFFE, 0xFFFF, 0x0003, 0x000A, 0x0009, 0xFFFC, 0xFFE6, 0xFFE0, 0xFFFB, 0x0030, 0x0050,
+	 0x002A, 0xFFBF, 0xFF61, 0xFF7E, 0x0033, 0x0106, 0x0127, 0x0028, 0xFE95, 0xFDCE, 0xFEEE,
+	 0x019A, 0x03C1, 0x0302, 0xFED3, 0xF9CC, 0xF898, 0xFEE2, 0x0C3E, 0x1B7D, 0x254C, 0x2496,
+	 0x19BC, 0x0A54, 0xFDA7, 0xF862, 0xFA51, 0xFF7A, 0x034E, 0x039B, 0x013E, 0xFEAE, 0xFDCF,
+	 0xFEC5, 0x0056, 0x0133, 0x00F1, 0x0017, 0xFF72, 0xFF68, 0xFFCD, 0x0033, 0x0050, 0x002A,
+	 0xFFF6, 0xFFDF, 0xFFE9, 0xFFFE, 0x000A, 0x0009, 0x0002, 0xFFFE, 0xFFFE},
+	{0xFFFE, 0xFFFE, 0x0003, 0x0009, 0x000A, 0xFFFC, 0xFFE7, 0xFFDF, 0xFFFA, 0x002F, 0x0050,
+	 0x002C, 0xFFC2, 0xFF63, 0xFF7B, 0x002C, 0x0101, 0x012A, 0x0034, 0xFEA1, 0xFDCD, 0xFEDE,
+	 0x0183, 0x03B9, 0x0316, 0xFEFD, 0xF9EC, 0xF888, 0xFE91, 0x0BC3, 0x1B0F, 0x2522, 0x24C7,
+	 0x1A2E, 0x0ACD, 0xFDF3, 0xF86C, 0xFA2F, 0xFF50, 0x033C, 0x03A5, 0x0155, 0xFEBD, 0xFDCE,
+	 0xFEB8, 0x004A, 0x0130, 0x00F6, 0x001E, 0xFF75, 0xFF66, 0xFFCA, 0x0031, 0x0050, 0x002B,
+	 0xFFF7, 0xFFDF, 0xFFE8, 0xFFFE, 0x000A, 0x0009, 0x0003, 0xFFFE, 0xFFFE},
+	{0xFFFE, 0xFFFE, 0x0003, 0x0009, 0x000A, 0xFFFD, 0xFFE8, 0xFFDF, 0xFFF8, 0x002D, 0x0050,
+	 0x002E, 0xFFC6, 0xFF64, 0xFF78, 0x0025, 0x00FB, 0x012D, 0x003F, 0xFEAD, 0xFDCD, 0xFECD,
+	 0x016C, 0x03AF, 0x032A, 0xFF27, 0xFA0D, 0xF879, 0xFE41, 0x0B48, 0x1A9F, 0x24F6, 0x24F6,
+	 0x1A9F, 0x0B48, 0xFE41, 0xF879, 0xFA0D, 0xFF27, 0x032A, 0x03AF, 0x016C, 0xFECD, 0xFDCD,
+	 0xFEAD, 0x003F, 0x012D, 0x00FB, 0x0025, 0xFF78, 0xFF64, 0xFFC6, 0x002E, 0x0050, 0x002D,
+	 0xFFF8, 0xFFDF, 0xFFE8, 0xFFFD, 0x000A, 0x0009, 0x0003, 0xFFFE, 0xFFFE},
+	{0xFFFE, 0xFFFE, 0x0003, 0x0009, 0x000A, 0xFFFE, 0xFFE8, 0xFFDF, 0xFFF7, 0x002B, 0x0050,
+	 0x0031, 0xFFCA, 0xFF66, 0xFF75, 0x001E, 0x00F6, 0x0130, 0x004A, 0xFEB8, 0xFDCE, 0xFEBD,
+	 0x0155, 0x03A5, 0x033C, 0xFF50, 0xFA2F, 0xF86C, 0xFDF3, 0x0ACD, 0x1A2E, 0x24C7, 0x2522,
+	 0x1B0F, 0x0BC3, 0xFE91, 0xF888, 0xF9EC, 0xFEFD, 0x0316, 0x03B9, 0x0183, 0xFEDE, 0xFDCD,
+	 0xFEA1, 0x0034, 0x012A, 0x0101, 0x002C, 0xFF7B, 0xFF63, 0xFFC2, 0x002C, 0x0050, 0x002F,
+	 0xFFFA, 0xFFDF, 0xFFE7, 0xFFFC, 0x000A, 0x0009, 0x0003, 0xFFFE, 0xFFFE},
+	{0xFFFE, 0xFFFE, 0x0002, 0x0009, 0x000A, 0xFFFE, 0xFFE9, 0xFFDF, 0xFFF6, 0x002A, 0x0050,
+	 0x0033, 0xFFCD, 0xFF68, 0xFF72, 0x0017, 0x00F1, 0x0133, 0x0056, 0xFEC5, 0xFDCF, 0xFEAE,
+	 0x013E, 0x039B, 0x034E, 0xFF7A, 0xFA51, 0xF862, 0xFDA7, 0x0A54, 0x19BC, 0x2496, 0x254C,
+	 0x1B7D, 0x0C3E, 0xFEE2, 0xF898, 0xF9CC, 0xFED3, 0x0302, 0x03C1, 0x019A, 0xFEEE, 0xFDCE,
+	 0xFE95, 0x0028, 0x0127, 0x0106, 0x0033, 0xFF7E, 0xFF61, 0xFFBF, 0x002A, 0x0050, 0x0030,
+	 0xFFFB, 0xFFE0, 0xFFE6, 0xFFFC, 0x0009, 0x000A, 0x0003, 0xFFFF, 0xFFFE},
+	{0xFFFE, 0xFFFE, 0x0002, 0x0009, 0x000A, 0xFFFF, 0xFFE9, 0xFFDF, 0xFFF4, 0x0028, 0x004F,
+	 0x0035, 0xFFD1, 0xFF6A, 0xFF6F, 0x0010, 0x00EB, 0x0135, 0x0060, 0xFED1, 0xFDD1, 0xFE9F,
+	 0x0127, 0x038F, 0x035F, 0xFFA2, 0xFA75, 0xF859, 0xFD5D, 0x09DB, 0x1948, 0x2462, 0x2572,
+	 0x1BEA, 0x0CBA, 0xFF36, 0xF8AB, 0xF9AD, 0xFEA9, 0x02EC, 0x03C9, 0x01B1, 0xFF00, 0xFDCF,
+	 0xFE8A, 0x001C, 0x0124, 0x010A, 0x003A, 0xFF82, 0xFF60, 0xFFBB, 0x0027, 0x0051, 0x0032,
+	 0xFFFD, 0xFFE0, 0xFFE6, 0xFFFB, 0x0009, 0x000A, 0x0003, 0xFFFF, 0xFFFE},
+	{0xFFFE, 0xFFFE, 0x0002, 0x0009, 0x000A, 0xFFFF, 0xFFEA, 0xFFDF, 0xFFF3, 0x0026, 0x004F,
+	 0x0037, 0xFFD5, 0xFF6C, 0xFF6C, 0x0009, 0x00E5, 0x0136, 0x006B, 0xFEDD, 0xFDD3, 0xFE91,
+	 0x0110, 0x0383, 0x036F, 0xFFCB, 0xFA99, 0xF852, 0xFD15, 0x0963, 0x18D4, 0x242B, 0x2596,
+	 0x1C56, 0x0D37, 0xFF8B, 0xF8C0, 0xF98F, 0xFE7E, 0x02D6, 0x03D0, 0x01C7, 0xFF11, 0xFDD0,
+	 0xFE7F, 0x0010, 0x0120, 0x010F, 0x0041, 0xFF86, 0xFF5E, 0xFFB7, 0x0024, 0x0050, 0x0033,
+	 0xFFFE, 0xFFE0, 0xFFE5, 0xFFFA, 0x0009, 0x000A, 0x0004, 0xFFFF, 0xFFFE},
+	{0xFFFE, 0xFFFE, 0x0002, 0x0008, 0x000B, 0x0000, 0xFFEB, 0xFFDE, 0xFFF2, 0x0024, 0x004E,
+	 0x0039, 0xFFD9, 0xFF6E, 0xFF6A, 0x0002, 0x00DF, 0x0138, 0x0076, 0xFEEA, 0xFDD5, 0xFE83,
+	 0x00F8, 0x0376, 0x037E, 0xFFF3, 0xFABE, 0xF84D, 0xFCCF, 0x08EB, 0x185E, 0x23F2, 0x25B7,
+	 0x1CC0, 0x0DB4, 0xFFE3, 0xF8D6, 0xF972, 0xFE53, 0x02BE, 0x03D6, 0x01DE, 0xFF23, 0xFDD2,
+	 0xFE74, 0x0004, 0x011B, 0x0113, 0x0048, 0xFF8A, 0xFF5D, 0xFFB3, 0x0022, 0x0050, 0x0035,
+	 0xFFFF, 0xFFE0, 0xFFE5, 0xFFFA, 0x0009, 0x000A, 0x0004, 0xFFFF, 0xFFFE},
+	{0xFFFE, 0xFFFE, 0x0002, 0x0008, 0x000B, 0x0000, 0xFFEB, 0xFFDE, 0xFFF1, 0x0023, 0x004E,
+	 0x003B, 0xFFDC, 0xFF71, 0xFF68, 0xFFFC, 0x00D9, 0x0139, 0x0080, 0xFEF6, 0xFDD8, 0xFE75,
+	 0x00E1, 0x0369, 0x038B, 0x001A, 0xFAE4, 0xF849, 0xFC8B, 0x0875, 0x17E8, 0x23B6, 0x25D5,
+	 0x1D28, 0x0E31, 0x003C, 0xF8EF, 0xF957, 0xFE28, 0x02A6, 0x03DC, 0x01F4, 0xFF36, 0xFDD4,
+	 0xFE69, 0xFFF8, 0x0117, 0x0118, 0x004F, 0xFF8E, 0xFF5C, 0xFFB0, 0x001F, 0x0050, 0x0037,
+	 0x0001, 0xFFE1, 0xFFE4, 0xFFF9, 0x0009, 0x000A, 0x0004, 0xFFFF, 0xFFFE},
+	{0xFFFE, 0xFFFE, 0x0001, 0x0008, 0x000B, 0x0001, 0xFFEC, 0xFFDF, 0xFFF0, 0x0021, 0x004D,
+	 0x003D, 0xFFE0, 0xFF73, 0xFF65, 0xFFF5, 0x00D3, 0x013A, 0x008A, 0xFF03, 0xFDDC, 0xFE68,
+	 0x00CA, 0x035B, 0x0398, 0x0041, 0xFB0A, 0xF848, 0xFC49, 0x0800, 0x1770, 0x2377, 0x25F1,
+	 0x1D8F, 0x0EAF, 0x0096, 0xF909, 0xF93C, 0xFDFD, 0x028D, 0x03E0, 0x020A, 0xFF48, 0xFDD7,
+	 0xFE5F, 0xFFEB, 0x0112, 0x011C, 0x0057, 0xFF92, 0xFF5B, 0xFFAC, 0x001C, 0x0050, 0x0038,
+	 0x0003, 0xFFE1, 0xFFE4, 0xFFF8, 0x0008, 0x000A, 0x0004, 0xFFFF, 0xFFFE},
+	{0xFFFE, 0xFFFE, 0x0001, 0x0008, 0x000B, 0x0001, 0xFFED, 0xFFDF, 0xFFEF, 0x001F, 0x004C,
+	 0x003F, 0xFFE4, 0xFF76, 0xFF64, 0xFFEE, 0x00CD, 0x013B, 0x0094, 0xFF10, 0xFDE0, 0xFE5C,
+	 0x00B3, 0x034C, 0x03A4, 0x0068, 0xFB31, 0xF848, 0xFC0A, 0x078B, 0x16F8, 0x2336, 0x2609,
+	 0x1DF4, 0x0F2D, 0x00F3, 0xF926, 0xF922, 0xFDD2, 0x0273, 0x03E4, 0x0220, 0xFF5B, 0xFDDB,
+	 0xFE55, 0xFFDF, 0x010D, 0x011F, 0x005E, 0xFF96, 0xFF5B, 0xFFA8, 0x0019, 0x0050, 0x003A,
+	 0x0004, 0xFFE2, 0xFFE3, 0xFFF8, 0x0008, 0x000A, 0x0004, 0xFFFF, 0xFFFE},
+	{0xFFFF, 0xFFFE, 0x0001, 0x0008, 0x000B, 0x0002, 0xFFED, 0xFFDF, 0xFFED, 0x001D, 0x004B,
+	 0x0041, 0xFFE7, 0xFF78, 0xFF62, 0xFFE8, 0x00C7, 0x013B, 0x009D, 0xFF1D, 0xFDE4, 0xFE50,
+	 0x009C, 0x033D, 0x03AF, 0x008D, 0xFB58, 0xF84A, 0xFBCC, 0x0718, 0x167F, 0x22F3, 0x261F,
+	 0x1E57, 0x0FAB, 0x0151, 0xF944, 0xF90A, 0xFDA6, 0x0258, 0x03E7, 0x0235, 0xFF6F, 0xFDDF,
+	 0xFE4B, 0xFFD2, 0x0108, 0x0123, 0x0065, 0xFF9B, 0xFF5A, 0xFFA5, 0x0016, 0x004F, 0x003B,
+	 0x0006, 0xFFE2, 0xFFE3, 0xFFF7, 0x0008, 0x000A, 0x0005, 0xFFFF, 0xFFFE},
+	{0xFFFF, 0xFFFE, 0x0001, 0x0007, 0x000B, 0x0002, 0xFFEE, 0xFFDF, 0xFFEC, 0x001C, 0x004B,
+	 0x0042, 0xFFEB, 0xFF7B, 0xFF60, 0xFFE2, 0x00C0, 0x013B, 0x00A7, 0xFF2A, 0xFDE9, 0xFE44,
+	 0x0086, 0x032D, 0x03B9, 0x00B3, 0xFB80, 0xF84D, 0xFB90, 0x06A6, 0x1605, 0x22AD, 0x2632,
+	 0x1EB9, 0x1029, 0x01B1, 0xF965, 0xF8F3, 0xFD7B, 0x023C, 0x03E9, 0x024B, 0xFF83, 0xFDE3,
+	 0xFE41, 0xFFC6, 0x0102, 0x0126, 0x006C, 0xFF9F, 0xFF5A, 0xFFA1, 0x0013, 0x004F, 0x003D,
+	 0x0007, 0xFFE3, 0xFFE2, 0xFFF6, 0x0007, 0x000B, 0x0005, 0xFFFF, 0xFFFE},
+	{0xFFFF, 0xFFFE, 0x0001, 0x0007, 0x000B, 0x0003, 0xFFEF, 0xFFDF, 0xFFEB, 0x001A, 0x004A,
+	 0x0044, 0xFFEF, 0xFF7E, 0xFF5F, 0xFFDC, 0x00B9, 0x013B, 0x00B0, 0xFF37, 0xFDEE, 0xFE39,
+	 0x006F, 0x031D, 0x03C3, 0x00D7, 0xFBA9, 0xF853, 0xFB56, 0x0634, 0x158A, 0x2265, 0x2642,
+	 0x1F18, 0x10A7, 0x0213, 0xF988, 0xF8DD, 0xFD50, 0x0220, 0x03EA, 0x0260, 0xFF97, 0xFDE9,
+	 0xFE38, 0xFFB9, 0x00FC, 0x0129, 0x0074, 0xFFA4, 0xFF59, 0xFF9E, 0x0010, 0x004E, 0x003E,
+	 0x0009, 0xFFE3, 0xFFE2, 0xFFF6, 0x0007, 0x000B, 0x0005, 0xFFFF, 0xFFFE},
+	{0xFFFF, 0xFFFE, 0x0001, 0x0007, 0x000B, 0x0003, 0xFFEF, 0xFFDF, 0xFFEA, 0x0018, 0x0049,
+	 0x0045, 0xFFF2, 0xFF81, 0xFF5D, 0xFFD5, 0x00B3, 0x013A, 0x00B9, 0xFF44, 0xFDF4, 0xFE2F,
+	 0x0058, 0x030C, 0x03CB, 0x00FB, 0xFBD2, 0xF85A, 0xFB1F, 0x05C5, 0x150F, 0x221A, 0x264F,
+	 0x1F76, 0x1125, 0x0276, 0xF9AD, 0xF8C9, 0xFD25, 0x0202, 0x03EA, 0x0274, 0xFFAB, 0xFDEE,
+	 0xFE2F, 0xFFAC, 0x00F6, 0x012C, 0x007B, 0xFFA9, 0xFF59, 0xFF9A, 0x000D, 0x004D, 0x003F,
+	 0x000B, 0xFFE4, 0xFFE1, 0xFFF5, 0x0007, 0x000B, 0x0005, 0xFFFF, 0xFFFE},
+	{0xFFFF, 0xFFFE, 0x0000, 0x0007, 0x000B, 0x0004, 0xFFF0, 0xFFDF, 0xFFEA, 0x0016, 0x0048,
+	 0x0046, 0xFFF6, 0xFF84, 0xFF5C, 0xFFD0, 0x00AC, 0x0139, 0x00C1, 0xFF51, 0xFDFA, 0xFE25,
+	 0x0042, 0x02FB, 0x03D2, 0x011F, 0xFBFB, 0xF862, 0xFAE9, 0x0556, 0x1493, 0x21CD, 0x2659,
+	 0x1FD2, 0x11A3, 0x02DB, 0xF9D4, 0xF8B6, 0xFCFA, 0x01E4, 0x03E9, 0x0289, 0xFFC0, 0xFDF4,
+	 0xFE26, 0xFF9F, 0x00EF, 0x012F, 0x0082, 0xFFAE, 0xFF59, 0xFF97, 0x000A, 0x004D, 0x0041,
+	 0x000C, 0xFFE5, 0xFFE1, 0xFFF4, 0x0006, 0x000B, 0x0005, 0x0000, 0xFFFE},
+	{0xFFFF, 0xFFFE, 0x0000, 0x0007, 0x000B, 0x0004, 0xFFF1, 0xFFE0, 0xFFE9, 0x0015, 0x0047,
+	 0x0048, 0xFFF9, 0xFF87, 0xFF5B, 0xFFCA, 0x00A5, 0x0138, 0x00CA, 0xFF5E, 0xFE00, 0xFE1B,
+	 0x002C, 0x02E9, 0x03D8, 0x0142, 0xFC25, 0xF86C, 0xFAB6, 0x04E9, 0x1416, 0x217E, 0x2660,
+	 0x202C, 0x1221, 0x0341, 0xF9FD, 0xF8A4, 0xFCCF, 0x01C5, 0x03E8, 0x029D, 0xFFD5, 0xFDFB,
+	 0xFE1E, 0xFF92, 0x00E8, 0x0131, 0x0089, 0xFFB3, 0xFF59, 0xFF94, 0x0007, 0x004C, 0x0042,
+	 0x000E, 0xFFE5, 0xFFE1, 0xFFF4, 0x0006, 0x000B, 0x0006, 0x0000, 0xFFFE},
+	{0xFFFF, 0xFFFE, 0x0000, 0x0006, 0x000B, 0x0005, 0xFFF2, 0xFFE0, 0xFFE8, 0x0013, 0x0046,
+	 0x0049, 0xFFFD, 0xFF8A, 0xFF5B, 0xFFC4, 0x009E, 0x0137, 0x00D2, 0xFF6B, 0xFE07, 0xFE13,
+	 0x0016, 0x02D6, 0x03DD, 0x0164, 0xFC4F, 0xF878, 0xFA84, 0x047C, 0x139A, 0x212D, 0x2664,
+	 0x2083, 0x129F, 0x03A9, 0xFA28, 0xF894, 0xFCA4, 0x01A5, 0x03E5, 0x02B0, 0xFFEA, 0xFE02,
+	 0xFE16, 0xFF85, 0x00E1, 0x0133, 0x0090, 0xFFB9, 0xFF5A, 0xFF90, 0x0003, 0x004B, 0x0043,
+	 0x0010, 0xFFE6, 0xFFE0, 0xFFF3, 0x0006, 0x000B, 0x0006, 0x0000, 0xFFFE},
+	{0x0000, 0xFFFE, 0x0000, 0x0006, 0x000B, 0x0005, 0xFFF2, 0xFFE0, 0xFFE7, 0x0011, 0x0044,
+	 0x004A, 0x0000, 0xFF8D, 0xFF5A, 0xFFBE, 0x0097, 0x0135, 0x00D9, 0xFF78, 0xFE0F, 0xFE0A,
+	 0x0000, 0x02C4, 0x03E2, 0x0185, 0xFC79, 0xF885, 0xFA55, 0x0412, 0x131C, 0x20D9, 0x2666,
+	 0x20D9, 0x131C, 0x0412, 0xFA55, 0xF885, 0xFC79, 0x0185, 0x03E2, 0x02C4, 0x0000, 0xFE0A,
+	 0xFE0F, 0xFF78, 0x00D9, 0x0135, 0x0097, 0xFFBE, 0xFF5A, 0xFF8D, 0x0000, 0x004A, 0x0044,
+	 0x0011, 0xFFE7, 0xFFE0, 0xFFF2, 0x0005, 0x000B, 0x0006, 0x0000, 0xFFFE},
+};
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_DOWNSAMPLING */
+
+/* Banks sorted by decreasing cut-off, so the first usable bank keeps most of the band */
+static const struct sample_rate_converter_poly_bank poly_banks[] = {
+	{
+		.cutoff_permille = 875,
+		.min_ratio_permille = 900,
+		.taps = ARRAY_SIZE(poly_bank_cutoff_875[0]),
+		.coeffs = &poly_bank_cutoff_875[0][0],
+	},
+#if CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_DOWNSAMPLING
+	{
+		.cutoff_permille = 600,
+		.min_ratio_permille = 620,
+		.taps = ARRAY_SIZE(poly_bank_cutoff_600[0]),
+		.coeffs = &poly_bank_cutoff_600[0][0],
+	},
+	{
+		.cutoff_permille = 450,
+		.min_ratio_permille = 460,
+		.taps = ARRAY_SIZE(poly_bank_cutoff_450[0]),
+		.coeffs = &poly_bank_cutoff_450[0][0],
+	},
+	{
+		.cutoff_permille = 300,
+		.min_ratio_permille = 310,
+		.taps = ARRAY_SIZE(poly_bank_cutoff_300[0]),
+		.coeffs = &poly_bank_cutoff_300[0][0],
+	},
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_DOWNSAMPLING */
+};
+
+BUILD_ASSERT(ARRAY_SIZE(poly_bank_cutoff_875[0]) <= SAMPLE_RATE_CONVERTER_POLY_TAPS_MAX);
+#if CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_DOWNSAMPLING
+BUILD_ASSERT(ARRAY_SIZE(poly_bank_cutoff_300[0]) <= SAMPLE_RATE_CONVERTER_POLY_TAPS_MAX);
+#endif /* CONFIG_SAMPLE_RATE_CONVERTER_POLYPHASE_DOWNSAMPLING */
+
+int sample_rate_converter_poly_bank_get(uint32_t sample_rate_input, uint32_t sample_rate_output,
+					struct sample_rate_converter_poly_bank const **bank)
+{
+	uint64_t ratio_permille;
+
+	__ASSERT(bank != NULL, "Bank pointer cannot be NULL");
+
+	if ((sample_rate_input == 0) || (sample_rate_output == 0)) {
+		LOG_ERR("Sample rates must be non-zero");
+		return -EINVAL;
+	}
+
+	ratio_permille = ((uint64_t)sample_rate_output * 1000) / sample_rate_input;
+
+	for (size_t i = 0; i < ARRAY_SIZE(poly_banks); i++) {
+		if (ratio_permille >= poly_banks[i].min_ratio_permille) {
+			*bank = &poly_banks[i];
+			return 0;
+		}
+	}
+
+	LOG_ERR("No polyphase bank for conversion from %d to %d", sample_rate_input,
+		sample_rate_output);
+	return -EINVAL;
+}
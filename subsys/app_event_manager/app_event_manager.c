@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <errno.h>
 #include <stdio.h>
 #include <zephyr/kernel.h>
 #include <zephyr/spinlock.h>
@@ -19,15 +20,66 @@ static void event_processor_fn(struct k_work *work);
 
 struct app_event_manager_event_display_bm _app_event_manager_event_display_bm;
 
-static K_WORK_DEFINE(event_processor, event_processor_fn);
-static sys_slist_t eventq = SYS_SLIST_STATIC_INIT(&eventq);
+/* Event queue processed in a workqueue. */
+struct event_lane {
+	sys_slist_t eventq;
+	struct k_work work;
+	struct k_work_q *workq;
+};
+
+/* Zero-initialized event queues are empty, so events can be queued before initialization. */
+static struct event_lane lanes[CONFIG_APP_EVENT_MANAGER_LANES];
 static struct k_spinlock lock;
+static bool lanes_ready;
 
-static bool log_is_event_displayed(const struct event_type *et)
+#if CONFIG_APP_EVENT_MANAGER_LANES > 1
+static struct k_work_q lane_workq[CONFIG_APP_EVENT_MANAGER_LANES - 1];
+static K_THREAD_STACK_ARRAY_DEFINE(lane_stacks, CONFIG_APP_EVENT_MANAGER_LANES - 1,
+				   CONFIG_APP_EVENT_MANAGER_LANE_STACK_SIZE);
+
+/* Lane of every event type, indexed by the event type index. */
+static uint8_t type_lane[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS)
+/* Event types with at least one batch listener subscribed. */
+static ATOMIC_DEFINE(batch_types, CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT);
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+struct event_type_stats {
+	atomic_t queued;
+	uint16_t queued_max;
+	uint32_t dispatched;
+	uint32_t latency_avg_us;
+	uint32_t latency_max_us;
+};
+
+static struct event_type_stats type_stats[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+#endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+/* Number of events allocated from the heap after the pool was exhausted, per event type. */
+static atomic_t pool_fallbacks[CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT];
+#endif
+
+static size_t type_idx(const struct event_type *et)
 {
-	size_t idx = et - _event_type_list_start;
+	return et - _event_type_list_start;
+}
 
-	return atomic_test_bit(_app_event_manager_event_display_bm.flags, idx);
+static uint8_t lane_id_get(const struct event_type *et)
+{
+#if CONFIG_APP_EVENT_MANAGER_LANES > 1
+	return type_lane[type_idx(et)];
+#else
+	return 0;
+#endif
+}
+
+static bool log_is_event_displayed(const struct event_type *et)
+{
+	return atomic_test_bit(_app_event_manager_event_display_bm.flags, type_idx(et));
 }
 
 #if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_USE_DEPRECATED_LOG_FUN)
@@ -137,78 +189,338 @@ void __weak app_event_manager_free(void *addr)
 	k_free(addr);
 }
 
-static void event_processor_fn(struct k_work *work)
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+static bool is_pool_block(const struct k_mem_slab *slab, const void *addr)
 {
-	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+	const char *start = slab->buffer;
+	const char *end = start + slab->info.num_blocks * slab->info.block_size;
 
-	/* Make current event list local. */
-	k_spinlock_key_t key = k_spin_lock(&lock);
+	return ((const char *)addr >= start) && ((const char *)addr < end);
+}
 
-	if (sys_slist_is_empty(&eventq)) {
-		k_spin_unlock(&lock, key);
+void *app_event_manager_pool_alloc(const struct event_type *et, size_t size)
+{
+	void *event;
+
+	APP_EVENT_ASSERT_ID(et);
+
+	if (et->pool) {
+		if (!k_mem_slab_alloc(&et->pool->slab, &event, K_NO_WAIT)) {
+			return event;
+		}
+
+		atomic_inc(&pool_fallbacks[type_idx(et)]);
+	}
+
+	return app_event_manager_alloc(size);
+}
+
+bool app_event_manager_pool_free(void *addr)
+{
+	const struct app_event_header *aeh = addr;
+	struct app_event_pool *pool;
+
+	__ASSERT_NO_MSG(aeh != NULL);
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	pool = aeh->type_id->pool;
+	if (!pool || !is_pool_block(&pool->slab, addr)) {
+		return false;
+	}
+
+	k_mem_slab_free(&pool->slab, addr);
+
+	return true;
+}
+
+int app_event_manager_pool_stats_get(const struct event_type *et,
+				     struct app_event_manager_pool_stats *stats)
+{
+	APP_EVENT_ASSERT_ID(et);
+	__ASSERT_NO_MSG(stats != NULL);
+
+	if (!et->pool) {
+		return -ENOENT;
+	}
+
+	stats->block_size = et->pool->slab.info.block_size;
+	stats->total = et->pool->slab.info.num_blocks;
+	stats->used = k_mem_slab_num_used_get(&et->pool->slab);
+	stats->used_max = k_mem_slab_max_used_get(&et->pool->slab);
+	stats->heap_fallbacks = atomic_get(&pool_fallbacks[type_idx(et)]);
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_POOLS */
+
+static void stats_submit_update(struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+	struct event_type_stats *ts = &type_stats[type_idx(aeh->type_id)];
+	atomic_val_t queued = atomic_inc(&ts->queued) + 1;
+
+	aeh->timestamp = k_cycle_get_32();
+	ts->queued_max = MAX(ts->queued_max, MIN(queued, UINT16_MAX));
+#endif
+}
+
+static void stats_dispatch_update(const struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+	struct event_type_stats *ts = &type_stats[type_idx(aeh->type_id)];
+	uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - aeh->timestamp);
+
+	/* Statistics of an event type are only updated from the lane processing it. */
+	atomic_dec(&ts->queued);
+	ts->dispatched++;
+	ts->latency_max_us = MAX(ts->latency_max_us, latency_us);
+	/* Exponential moving average with a weight of 1/8 for the newest sample */
+	ts->latency_avg_us = ts->latency_avg_us - (ts->latency_avg_us >> 3) + (latency_us >> 3);
+#endif
+}
+
+static void event_preprocess(const struct app_event_header *aeh)
+{
+	APP_EVENT_ASSERT_ID(aeh->type_id);
+
+	stats_dispatch_update(aeh);
+
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
+			h->hook(aeh);
+		}
+	}
+
+	log_event(aeh);
+}
+
+static void event_postprocess(struct app_event_header *aeh)
+{
+	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
+		STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
+			h->hook(aeh);
+		}
+	}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+	if (app_event_manager_pool_free(aeh)) {
 		return;
 	}
+#endif
 
-	sys_slist_merge_slist(&events, &eventq);
+	app_event_manager_free(aeh);
+}
 
-	k_spin_unlock(&lock, key);
+static bool listener_notify(const struct event_listener *el, struct app_event_header *aeh)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS)
+	if (el->batch_notification) {
+		/* Before the initialization, the event types with batch listeners are not known
+		 * yet, so the events are passed one by one.
+		 */
+		sys_slist_t batch = SYS_SLIST_STATIC_INIT(&batch);
+
+		sys_slist_append(&batch, &aeh->node);
+		return el->batch_notification(&batch, 1);
+	}
+#endif
 
-	/* Traverse the list of events. */
-	sys_snode_t *node;
-	while (NULL != (node = sys_slist_get(&events))) {
-		struct app_event_header *aeh = CONTAINER_OF(node,
-						       struct app_event_header,
-						       node);
+	return el->notification(aeh);
+}
 
-		APP_EVENT_ASSERT_ID(aeh->type_id);
+static void event_process(struct app_event_header *aeh)
+{
+	const struct event_type *et = aeh->type_id;
 
-		const struct event_type *et = aeh->type_id;
+	event_preprocess(aeh);
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_PREPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_preprocess_hook, h) {
-				h->hook(aeh);
-			}
+	bool consumed = false;
+
+	for (const struct event_subscriber *es = et->subs_start;
+	     (es != et->subs_stop) && !consumed;
+	     es++) {
+
+		__ASSERT_NO_MSG(es != NULL);
+
+		const struct event_listener *el = es->listener;
+
+		__ASSERT_NO_MSG(el != NULL);
+
+		log_event_progress(et, el);
+
+		consumed = listener_notify(el, aeh);
+
+		if (consumed) {
+			log_event_consumed(et);
 		}
+	}
 
-		log_event(aeh);
+	event_postprocess(aeh);
+}
 
-		bool consumed = false;
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS)
+/* Move the events of the same type as the first event from the events list to the batch. */
+static size_t batch_collect(sys_slist_t *batch, struct app_event_header *first,
+			    sys_slist_t *events)
+{
+	sys_snode_t *prev = NULL;
+	sys_snode_t *node = sys_slist_peek_head(events);
+	size_t count = 1;
 
-		for (const struct event_subscriber *es = et->subs_start;
-		     (es != et->subs_stop) && !consumed;
-		     es++) {
+	sys_slist_append(batch, &first->node);
 
-			__ASSERT_NO_MSG(es != NULL);
+	while (node) {
+		sys_snode_t *next = sys_slist_peek_next(node);
+		struct app_event_header *aeh = CONTAINER_OF(node, struct app_event_header, node);
 
-			const struct event_listener *el = es->listener;
+		if (aeh->type_id == first->type_id) {
+			sys_slist_remove(events, prev, node);
+			sys_slist_append(batch, node);
+			count++;
+		} else {
+			prev = node;
+		}
 
-			__ASSERT_NO_MSG(el != NULL);
-			__ASSERT_NO_MSG(el->notification != NULL);
+		node = next;
+	}
+
+	return count;
+}
+
+/* Notify a regular listener about every event of the batch, moving the consumed ones. */
+static size_t batch_notify(const struct event_listener *el, sys_slist_t *batch,
+			   sys_slist_t *consumed)
+{
+	sys_snode_t *prev = NULL;
+	sys_snode_t *node = sys_slist_peek_head(batch);
+	size_t count = 0;
+
+	while (node) {
+		sys_snode_t *next = sys_slist_peek_next(node);
+		struct app_event_header *aeh = CONTAINER_OF(node, struct app_event_header, node);
+
+		if (el->notification(aeh)) {
+			log_event_consumed(aeh->type_id);
+			sys_slist_remove(batch, prev, node);
+			sys_slist_append(consumed, node);
+			count++;
+		} else {
+			prev = node;
+		}
 
-			log_event_progress(et, el);
+		node = next;
+	}
+
+	return count;
+}
+
+static void batch_process(struct app_event_header *first, sys_slist_t *events)
+{
+	const struct event_type *et = first->type_id;
+	sys_slist_t batch = SYS_SLIST_STATIC_INIT(&batch);
+	sys_slist_t consumed = SYS_SLIST_STATIC_INIT(&consumed);
+	struct app_event_header *aeh;
+	struct app_event_header *tmp;
+	size_t count;
+
+	count = batch_collect(&batch, first, events);
+
+	APP_EVENT_BATCH_FOREACH(&batch, aeh) {
+		event_preprocess(aeh);
+	}
 
-			consumed = el->notification(aeh);
+	for (const struct event_subscriber *es = et->subs_start;
+	     (es != et->subs_stop) && (count > 0);
+	     es++) {
 
-			if (consumed) {
+		__ASSERT_NO_MSG(es != NULL);
+
+		const struct event_listener *el = es->listener;
+
+		__ASSERT_NO_MSG(el != NULL);
+
+		log_event_progress(et, el);
+
+		if (el->batch_notification) {
+			if (el->batch_notification(&batch, count)) {
 				log_event_consumed(et);
+				sys_slist_merge_slist(&consumed, &batch);
+				count = 0;
 			}
+		} else {
+			__ASSERT_NO_MSG(el->notification != NULL);
+			count -= batch_notify(el, &batch, &consumed);
 		}
+	}
 
-		if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTPROCESS_HOOKS)) {
-			STRUCT_SECTION_FOREACH(event_postprocess_hook, h) {
-				h->hook(aeh);
-			}
+	sys_slist_merge_slist(&consumed, &batch);
+
+	SYS_SLIST_FOR_EACH_CONTAINER_SAFE(&consumed, aeh, tmp, node) {
+		event_postprocess(aeh);
+	}
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS */
+
+static void lane_process(struct event_lane *lane)
+{
+	sys_slist_t events = SYS_SLIST_STATIC_INIT(&events);
+
+	/* Make current event list local. */
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	if (sys_slist_is_empty(&lane->eventq)) {
+		k_spin_unlock(&lock, key);
+		return;
+	}
+
+	sys_slist_merge_slist(&events, &lane->eventq);
+
+	k_spin_unlock(&lock, key);
+
+	/* Traverse the list of events. */
+	sys_snode_t *node;
+	while (NULL != (node = sys_slist_get(&events))) {
+		struct app_event_header *aeh = CONTAINER_OF(node,
+						       struct app_event_header,
+						       node);
+
+		APP_EVENT_ASSERT_ID(aeh->type_id);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS)
+		if (atomic_test_bit(batch_types, type_idx(aeh->type_id))) {
+			batch_process(aeh, &events);
+			continue;
 		}
+#endif
 
-		app_event_manager_free(aeh);
+		event_process(aeh);
 	}
 }
 
+static void event_processor_fn(struct k_work *work)
+{
+	lane_process(CONTAINER_OF(work, struct event_lane, work));
+}
+
+/* Process the events submitted before the initialization. The event types are assigned to
+ * their lanes by the initialization, so until then all events are in the first lane.
+ */
+static void early_processor_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	lane_process(&lanes[0]);
+}
+
+static K_WORK_DEFINE(early_processor, early_processor_fn);
+
 void _event_submit(struct app_event_header *aeh)
 {
 	__ASSERT_NO_MSG(aeh);
 	APP_EVENT_ASSERT_ID(aeh->type_id);
 
+	struct event_lane *lane = &lanes[lane_id_get(aeh->type_id)];
+	bool ready;
 	k_spinlock_key_t key = k_spin_lock(&lock);
 
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_SUBMIT_HOOKS)) {
@@ -216,10 +528,131 @@ void _event_submit(struct app_event_header *aeh)
 			h->hook(aeh);
 		}
 	}
-	sys_slist_append(&eventq, &aeh->node);
+	stats_submit_update(aeh);
+	sys_slist_append(&lane->eventq, &aeh->node);
+	ready = lanes_ready;
 	k_spin_unlock(&lock, key);
 
-	k_work_submit(&event_processor);
+	if (ready) {
+		k_work_submit_to_queue(lane->workq, &lane->work);
+	} else {
+		k_work_submit(&early_processor);
+	}
+}
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+void app_event_manager_stats_get(const struct event_type *et,
+				 struct app_event_manager_stats *stats)
+{
+	APP_EVENT_ASSERT_ID(et);
+	__ASSERT_NO_MSG(stats != NULL);
+
+	const struct event_type_stats *ts = &type_stats[type_idx(et)];
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	stats->lane = lane_id_get(et);
+	stats->queued = MIN(atomic_get(&ts->queued), UINT16_MAX);
+	stats->queued_max = ts->queued_max;
+	stats->dispatched = ts->dispatched;
+	stats->latency_avg_us = ts->latency_avg_us;
+	stats->latency_max_us = ts->latency_max_us;
+
+	k_spin_unlock(&lock, key);
+}
+
+void app_event_manager_stats_reset(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	for (size_t i = 0; i < ARRAY_SIZE(type_stats); i++) {
+		struct event_type_stats *ts = &type_stats[i];
+
+		ts->queued_max = atomic_get(&ts->queued);
+		ts->dispatched = 0;
+		ts->latency_avg_us = 0;
+		ts->latency_max_us = 0;
+	}
+
+	k_spin_unlock(&lock, key);
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_STATS */
+
+static void lanes_init(void)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(lanes); i++) {
+		k_work_init(&lanes[i].work, event_processor_fn);
+		lanes[i].workq = &k_sys_work_q;
+	}
+
+#if CONFIG_APP_EVENT_MANAGER_LANES > 1
+	for (size_t i = 1; i < ARRAY_SIZE(lanes); i++) {
+		struct k_work_queue_config cfg = {
+			.name = "app_event_lane",
+		};
+		struct k_work_q *workq = &lane_workq[i - 1];
+
+		k_work_queue_start(workq, lane_stacks[i - 1],
+				   K_THREAD_STACK_SIZEOF(lane_stacks[i - 1]),
+				   CONFIG_APP_EVENT_MANAGER_LANE_THREAD_PRIO - (int)(i - 1), &cfg);
+		lanes[i].workq = workq;
+	}
+
+	STRUCT_SECTION_FOREACH(event_type_lane, tl) {
+		APP_EVENT_ASSERT_ID(tl->type);
+		type_lane[type_idx(tl->type)] = tl->lane;
+	}
+#endif
+}
+
+/* Start processing the lanes. The first lane runs in the system workqueue, like the work
+ * item that processes the events submitted before the initialization.
+ */
+static void lanes_start(void)
+{
+	k_spinlock_key_t key = k_spin_lock(&lock);
+
+	lanes_ready = true;
+	k_spin_unlock(&lock, key);
+
+	for (size_t i = 0; i < ARRAY_SIZE(lanes); i++) {
+		k_work_submit_to_queue(lanes[i].workq, &lanes[i].work);
+	}
+}
+
+static int pools_init(void)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		struct app_event_pool *pool = et->pool;
+		int err;
+
+		if (!pool) {
+			continue;
+		}
+
+		err = k_mem_slab_init(&pool->slab, pool->buf, pool->block_size, pool->num_blocks);
+		if (err) {
+			return err;
+		}
+	}
+#endif
+	return 0;
+}
+
+static void batch_types_init(void)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS)
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		for (const struct event_subscriber *es = et->subs_start;
+		     es != et->subs_stop;
+		     es++) {
+			if (es->listener->batch_notification) {
+				atomic_set_bit(batch_types, type_idx(et));
+				break;
+			}
+		}
+	}
+#endif
 }
 
 int app_event_manager_init(void)
@@ -229,7 +662,15 @@ int app_event_manager_init(void)
 	__ASSERT_NO_MSG(_event_type_list_end - _event_type_list_start <=
 			CONFIG_APP_EVENT_MANAGER_MAX_EVENT_CNT);
 
+	ret = pools_init();
+	if (ret) {
+		return ret;
+	}
+
 	log_event_init();
+	lanes_init();
+	batch_types_init();
+	lanes_start();
 
 	if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_POSTINIT_HOOK)) {
 		STRUCT_SECTION_FOREACH(app_event_manager_postinit_hook, h) {
@@ -119,6 +119,45 @@ extern "C" {
 #define _EVENT_ID(ename) (&_CONCAT(__event_type_, ename))
 
 
+/* Macros related to event pools.
+ * If event pools are enabled, every event type without dynamic data gets a memory slab with
+ * the number of blocks declared together with the event type. The slab is initialized by
+ * app_event_manager_init. A pool with no blocks is not referenced by its event type, so it
+ * is left out of the build.
+ */
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+#define _APP_EVENT_POOL_SIZE_DECLARE(ename, cnt) \
+	enum {_CONCAT(ename, _POOL_SIZE) = (cnt)};
+
+#define _APP_EVENT_POOL_NAME(ename) _CONCAT(__event_pool_, ename)
+#define _APP_EVENT_POOL_BUF_NAME(ename) _CONCAT(__event_pool_buf_, ename)
+
+/* Additional level of expansion, so that the pool names are expanded before they are pasted. */
+#define _APP_EVENT_POOL_DEFINE_NAMED(pname, bname, ename)				\
+	static char __noinit __aligned(WB_UP(__alignof__(struct ename)))		\
+		bname[_CONCAT(ename, _POOL_SIZE) * WB_UP(sizeof(struct ename))];	\
+	static struct app_event_pool pname = {						\
+		.buf = bname,								\
+		.block_size = WB_UP(sizeof(struct ename)),				\
+		.num_blocks = _CONCAT(ename, _POOL_SIZE),				\
+	};
+
+#define _APP_EVENT_POOL_DEFINE(ename) \
+	_APP_EVENT_POOL_DEFINE_NAMED(_APP_EVENT_POOL_NAME(ename), _APP_EVENT_POOL_BUF_NAME(ename), \
+				     ename)
+
+#define _APP_EVENT_TYPE_DEFINE_POOL(ename)					\
+	.pool = ((_CONCAT(ename, _POOL_SIZE) > 0) ? &_APP_EVENT_POOL_NAME(ename) : NULL),
+
+#define _APP_EVENT_ALLOC(ename, size) app_event_manager_pool_alloc(_EVENT_ID(ename), size)
+#else
+#define _APP_EVENT_POOL_SIZE_DECLARE(ename, cnt)
+#define _APP_EVENT_POOL_DEFINE(ename)
+#define _APP_EVENT_TYPE_DEFINE_POOL(ename)
+#define _APP_EVENT_ALLOC(ename, size) app_event_manager_alloc(size)
+#endif
+
+
 /* Macro generates a function of name new_ename where ename is provided as
  * an argument. Allocator function is used to create an event of the given
  * ename type.
@@ -127,7 +166,7 @@ extern "C" {
 	static inline struct ename *_CONCAT(new_, ename)(void)			\
 	{									\
 		struct ename *event =						\
-			(struct ename *)app_event_manager_alloc(sizeof(*event));\
+			(struct ename *)_APP_EVENT_ALLOC(ename, sizeof(*event));\
 		BUILD_ASSERT(offsetof(struct ename, header) == 0,		\
 				 "");						\
 		if (event != NULL) {						\
@@ -194,6 +233,26 @@ extern "C" {
 		.notification = (notification_fn),					\
 	}
 
+#define _APP_EVENT_LISTENER_BATCH(lname, batch_fn)					\
+	BUILD_ASSERT(IS_ENABLED(CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS),		\
+		     "Enable APP_EVENT_MANAGER_BATCH_LISTENERS before usage");		\
+	STRUCT_SECTION_ITERABLE(event_listener, _CONCAT(__event_listener_, lname)) = {	\
+		.name = STRINGIFY(lname),						\
+		.notification = NULL,							\
+		IF_ENABLED(CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS,			\
+			   (.batch_notification = (batch_fn),))				\
+	}
+
+
+/* Assign an event type to a processing lane. */
+#define _APP_EVENT_TYPE_LANE_SET(ename, lane_id)					\
+	BUILD_ASSERT((lane_id) < CONFIG_APP_EVENT_MANAGER_LANES,			\
+		     "Lane ID must be lower than APP_EVENT_MANAGER_LANES");		\
+	STRUCT_SECTION_ITERABLE(event_type_lane, _CONCAT(__event_type_lane_, ename)) = {\
+		.type = _EVENT_ID(ename),						\
+		.lane = (lane_id),							\
+	}
+
 
 #define _APP_EVENT_TYPE_DECLARE_COMMON(ename)						\
 	extern Z_DECL_ALIGN(struct event_type) _CONCAT(__event_type_, ename);		\
@@ -201,14 +260,20 @@ extern "C" {
 	_APP_EVENT_TYPECHECK_FN(ename)
 
 
-#define _APP_EVENT_TYPE_DECLARE(ename)					\
+#define _APP_EVENT_TYPE_POOL_DECLARE(ename, max_cnt)			\
 	enum {_CONCAT(ename, _HAS_DYNDATA) = 0};			\
+	_APP_EVENT_POOL_SIZE_DECLARE(ename, max_cnt)			\
 	_APP_EVENT_TYPE_DECLARE_COMMON(ename);				\
 	_APP_EVENT_ALLOCATOR_FN(ename)
 
 
+#define _APP_EVENT_TYPE_DECLARE(ename)					\
+	_APP_EVENT_TYPE_POOL_DECLARE(ename, CONFIG_APP_EVENT_MANAGER_EVENT_POOL_SIZE)
+
+
 #define _APP_EVENT_TYPE_DYNDATA_DECLARE(ename)				\
 	enum {_CONCAT(ename, _HAS_DYNDATA) = 1};			\
+	_APP_EVENT_POOL_SIZE_DECLARE(ename, 0)				\
 	_APP_EVENT_TYPE_DECLARE_COMMON(ename);				\
 	_APP_EVENT_ALLOCATOR_DYNDATA_FN(ename)
 
@@ -230,6 +295,11 @@ struct app_event_header {
 
 	/** Pointer to the event type object. */
 	const struct event_type *type_id;
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+	/** Cycle count when the event was submitted. */
+	uint32_t timestamp;
+#endif
 };
 
 /** Function to log data from this event. */
@@ -262,6 +332,24 @@ typedef	int (*log_event_data_dep)(const struct app_event_header *aeh,
 #define _APP_EVENT_TYPE_DEFINE_LOG_FUN(log_fun) .log_event_func = log_fun,
 #endif
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+/** @brief Pool of events of a given type.
+ */
+struct app_event_pool {
+	/** Memory slab of the pool, initialized by app_event_manager_init. */
+	struct k_mem_slab slab;
+
+	/** Buffer of the slab. */
+	char *buf;
+
+	/** Size of a block in bytes. */
+	size_t block_size;
+
+	/** Number of blocks. */
+	uint32_t num_blocks;
+};
+#endif
+
 /** @brief Event type.
  */
 struct event_type {
@@ -292,6 +380,11 @@ struct event_type {
 	/** The size of the event structure */
 	uint16_t struct_size;
 #endif
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+	/** Pool of events of this type, NULL if the events are allocated from the heap. */
+	struct app_event_pool *pool;
+#endif
 };
 
 
@@ -304,6 +397,7 @@ extern struct event_type _event_type_list_end[];
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START))<<					\
 		APP_EVENT_TYPE_FLAGS_SYSTEM_START)) == 0);				\
 	_APP_EVENT_SUBSCRIBERS_ARRAY_TAGS(ename);					\
+	_APP_EVENT_POOL_DEFINE(ename)							\
 	STRUCT_SECTION_ITERABLE(event_type, _CONCAT(__event_type_, ename)) = {		\
 		.name            = STRINGIFY(ename),					\
 		.subs_start      = _APP_EVENT_SUBSCRIBERS_START_TAG(ename),		\
@@ -315,6 +409,7 @@ extern struct event_type _event_type_list_end[];
 				((et_flags) | BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)) :	\
 				((et_flags) & (~BIT(APP_EVENT_TYPE_FLAGS_HAS_DYNDATA)))),\
 		_APP_EVENT_TYPE_DEFINE_SIZES(ename) /* No comma here intentionally */	\
+		_APP_EVENT_TYPE_DEFINE_POOL(ename) /* No comma here intentionally */	\
 	}
 
 /**
@@ -387,6 +482,14 @@ struct event_listener {
 	 * not propagated to further listeners, or false, otherwise.
 	 */
 	bool (*notification)(const struct app_event_header *aeh);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS)
+	/** Pointer to the function that is called once with all queued events of a given type.
+	 * Set instead of the notification function for listeners defined with
+	 * @ref APP_EVENT_LISTENER_BATCH.
+	 */
+	bool (*batch_notification)(sys_slist_t *events, size_t count);
+#endif
 };
 
 
@@ -398,6 +501,19 @@ struct event_subscriber {
 };
 
 
+/** @brief Event type lane assignment.
+ *
+ * All lane assignments must be defined using @ref APP_EVENT_TYPE_LANE_SET.
+ */
+struct event_type_lane {
+	/** Pointer to the event type. */
+	const struct event_type *type;
+
+	/** Lane processing the events of this type. */
+	uint8_t lane;
+};
+
+
 /** @brief Structure used to register Application Event Manager initialization hook
  */
 struct app_event_manager_postinit_hook {
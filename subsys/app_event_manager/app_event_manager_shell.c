@@ -81,6 +81,59 @@ static int show_subscribers(const struct shell *shell, size_t argc,
 	return 0;
 }
 
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+static int show_stats(const struct shell *shell, size_t argc, char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL,
+		      "Event statistics (lane, queued, max queued, dispatched, "
+		      "avg/max latency in us):\n");
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		struct app_event_manager_stats stats;
+
+		app_event_manager_stats_get(et, &stats);
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t[E:%s] lane %u: %u/%u queued, %u dispatched, %u/%u us\n",
+			      et->name, stats.lane, stats.queued, stats.queued_max,
+			      stats.dispatched, stats.latency_avg_us, stats.latency_max_us);
+	}
+
+	return 0;
+}
+
+static int reset_stats(const struct shell *shell, size_t argc, char **argv)
+{
+	app_event_manager_stats_reset();
+	shell_fprintf(shell, SHELL_NORMAL, "Event statistics reset\n");
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_STATS */
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+static int show_pools(const struct shell *shell, size_t argc, char **argv)
+{
+	shell_fprintf(shell, SHELL_NORMAL,
+		      "Event pools (block size, used, max used, total, heap fallbacks):\n");
+
+	STRUCT_SECTION_FOREACH(event_type, et) {
+		struct app_event_manager_pool_stats stats;
+
+		if (app_event_manager_pool_stats_get(et, &stats)) {
+			shell_fprintf(shell, SHELL_NORMAL, "|\t[E:%s] heap only\n", et->name);
+			continue;
+		}
+
+		shell_fprintf(shell, SHELL_NORMAL,
+			      "|\t[E:%s] %zu B: %u/%u/%u used, %u from heap\n",
+			      et->name, stats.block_size, stats.used, stats.used_max, stats.total,
+			      stats.heap_fallbacks);
+	}
+
+	return 0;
+}
+#endif /* CONFIG_APP_EVENT_MANAGER_EVENT_POOLS */
+
 static void set_event_displaying(const struct shell *shell, size_t argc,
 				 char **argv, bool enable)
 {
@@ -155,6 +208,12 @@ SHELL_STATIC_SUBCMD_SET_CREATE(sub_app_event_manager,
 	SHELL_CMD_ARG(show_subscribers, NULL, "Show subscribers",
 		      show_subscribers, 0, 0),
 	SHELL_CMD_ARG(show_events, NULL, "Show events", show_events, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS, show_pools, NULL,
+			   "Show event pools", show_pools, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_STATS, show_stats, NULL,
+			   "Show event statistics", show_stats, 0, 0),
+	SHELL_COND_CMD_ARG(CONFIG_APP_EVENT_MANAGER_STATS, reset_stats, NULL,
+			   "Reset event statistics", reset_stats, 0, 0),
 	SHELL_CMD_ARG(disable, NULL, "Disable displaying event with given ID",
 		      disable_event_displaying, 0,
 		      sizeof(_app_event_manager_event_display_bm) * 8 - 1),
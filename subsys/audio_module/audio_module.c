@@ -133,6 +133,46 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 	return true;
 }
 
+/**
+ * @brief Helper function to allocate a buffer descriptor for the audio data sent by a module.
+ *
+ * @param handle  [in/out]  The handle of the sending modules instance.
+ *
+ * @return Pointer to the buffer descriptor, NULL if none is free.
+ */
+static struct audio_module_buffer *buffer_alloc(struct audio_module_handle *handle)
+{
+	for (int i = 0; i < CONFIG_AUDIO_MODULE_BUFFERS_NUM; i++) {
+		if (!atomic_test_and_set_bit(handle->buffers_used, i)) {
+			return &handle->buffers[i];
+		}
+	}
+
+	return NULL;
+}
+
+/**
+ * @brief Helper function to drop a reference to a data buffer, the data buffer is freed when
+ *        the last reference is dropped.
+ *
+ * @param handle  [in/out]  The handle of the sending modules instance.
+ * @param buffer  [in/out]  Pointer to the buffer descriptor.
+ * @param data    [in]      Pointer to the data buffer.
+ */
+static void buffer_release(struct audio_module_handle *handle, struct audio_module_buffer *buffer,
+			   void *data)
+{
+	if (atomic_dec(&buffer->ref_count) != 1) {
+		return;
+	}
+
+	LOG_DBG("Audio data has been consumed in module %s", handle->name);
+
+	/* Audio data has been consumed by all modules so now can free the data memory. */
+	k_mem_slab_free(handle->thread.data_slab, data);
+	atomic_clear_bit(handle->buffers_used, buffer - handle->buffers);
+}
+
 /**
  * @brief General callback for releasing the data when inter-module data
  *        passing.
@@ -143,21 +183,34 @@ static bool validate_parameters(struct audio_module_parameters const *const para
 static void audio_data_release_cb(struct audio_module_handle_private *handle,
 				  struct audio_data const *const audio_data)
 {
-	int ret;
 	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	struct audio_module_message *msg =
+		CONTAINER_OF(audio_data, struct audio_module_message, audio_data);
 
-	ret = k_sem_take(&hdl->sem, K_NO_WAIT);
-	if (ret) {
-		LOG_ERR("Failed to take semaphore for data release callback function");
+	if (msg->buffer == NULL) {
+		LOG_ERR("No buffer descriptor for data release in module %s", hdl->name);
 		return;
 	}
 
-	if (k_sem_count_get(&hdl->sem) == 0) {
-		LOG_DBG("Audio data has been consumed in module %s", hdl->name);
+	buffer_release(hdl, msg->buffer, audio_data->data);
+}
 
-		/* Audio data has been consumed by all modules so now can free the data memory. */
-		k_mem_slab_free(hdl->thread.data_slab, (void *)audio_data->data);
-	}
+/**
+ * @brief Update the statistics of a module when it takes a message from its RX FIFO.
+ *
+ * @param handle  [in/out]  The handle for the receiving module instance.
+ * @param msg     [in]      Pointer to the message taken.
+ */
+static void rx_stats_update(struct audio_module_handle *handle,
+			    struct audio_module_message const *const msg)
+{
+	uint32_t latency_us = k_cyc_to_us_floor32(k_cycle_get_32() - msg->sent_cycles);
+
+	atomic_dec(&handle->stats.queue_depth);
+
+	handle->stats.latency_sum_us += latency_us;
+	handle->stats.latency_count++;
+	handle->stats.latency_max_us = MAX(handle->stats.latency_max_us, latency_us);
 }
 
 /**
@@ -166,22 +219,26 @@ static void audio_data_release_cb(struct audio_module_handle_private *handle,
  * @param tx_handle            [in/out]  The handle for the sending module instance.
  * @param rx_handle            [in/out]  The handle for the receiving module instance.
  * @param audio_data           [in]      Pointer to the audio data to send to the module.
+ * @param buffer               [in]      Pointer to the descriptor of the shared data buffer,
+ *                                       NULL if not sent by a module.
  * @param data_in_response_cb  [in]      A pointer to a callback to run when the buffer is
  *                                       fully consumed.
  *
  * @return 0 if successful, error otherwise.
  */
 static int data_tx(struct audio_module_handle *tx_handle, struct audio_module_handle *rx_handle,
-		   struct audio_data const *const audio_data,
+		   struct audio_data const *const audio_data, struct audio_module_buffer *buffer,
 		   audio_module_response_cb data_in_response_cb)
 {
 	int ret;
+	atomic_val_t depth;
 	struct audio_module_message *data_msg_rx;
 
 	if (rx_handle->state == AUDIO_MODULE_STATE_RUNNING) {
 		ret = data_fifo_pointer_first_vacant_get(rx_handle->thread.msg_rx,
 							 (void **)&data_msg_rx, K_NO_WAIT);
 		if (ret) {
+			atomic_inc(&rx_handle->stats.dropped);
 			LOG_ERR("Module %s no free data buffer, ret %d", rx_handle->name, ret);
 			return ret;
 		}
@@ -190,10 +247,18 @@ static int data_tx(struct audio_module_handle *tx_handle, struct audio_module_ha
 		memcpy(&(data_msg_rx->audio_data), audio_data, sizeof(struct audio_data));
 		data_msg_rx->tx_handle = tx_handle;
 		data_msg_rx->response_cb = data_in_response_cb;
+		data_msg_rx->buffer = buffer;
+		data_msg_rx->sent_cycles = k_cycle_get_32();
+
+		/* Count the message before the receiving module can take it. */
+		depth = atomic_inc(&rx_handle->stats.queue_depth) + 1;
 
 		ret = data_fifo_block_lock(rx_handle->thread.msg_rx, (void **)&data_msg_rx,
 					   sizeof(struct audio_module_message));
 		if (ret) {
+			atomic_dec(&rx_handle->stats.queue_depth);
+			atomic_inc(&rx_handle->stats.dropped);
+
 			data_fifo_block_free(rx_handle->thread.msg_rx, (void *)data_msg_rx);
 
 			LOG_WRN("Module %s failed to queue audio data, ret %d", rx_handle->name,
@@ -201,6 +266,9 @@ static int data_tx(struct audio_module_handle *tx_handle, struct audio_module_ha
 			return ret;
 		}
 
+		atomic_inc(&rx_handle->stats.queued);
+		rx_handle->stats.queue_depth_max = MAX(rx_handle->stats.queue_depth_max, depth);
+
 		LOG_DBG("Audio data sent to module %s", rx_handle->name);
 
 	} else {
@@ -217,11 +285,13 @@ static int data_tx(struct audio_module_handle *tx_handle, struct audio_module_ha
  *
  * @param handle      [in/out]  The handle for this modules instance.
  * @param audio_data  [in]      A pointer to the audio data.
+ * @param buffer      [in]      Pointer to the descriptor of the shared data buffer.
  *
  * @return 0 if successful, error otherwise.
  */
 static int tx_fifo_put(struct audio_module_handle *handle,
-		       struct audio_data const *const audio_data)
+		       struct audio_data const *const audio_data,
+		       struct audio_module_buffer *buffer)
 {
 	int ret;
 	struct audio_module_message *data_msg_tx;
@@ -238,6 +308,8 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 	memcpy(&data_msg_tx->audio_data, audio_data, sizeof(struct audio_data));
 	data_msg_tx->tx_handle = handle;
 	data_msg_tx->response_cb = audio_data_release_cb;
+	data_msg_tx->buffer = buffer;
+	data_msg_tx->sent_cycles = k_cycle_get_32();
 
 	/* Send audio data to modules output message queue. */
 	ret = data_fifo_block_lock(handle->thread.msg_tx, (void **)&data_msg_tx,
@@ -248,11 +320,6 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 
 		data_fifo_block_free(handle->thread.msg_tx, (void *)data_msg_tx);
 
-		ret = k_sem_take(&handle->sem, K_NO_WAIT);
-		if (ret) {
-			LOG_ERR("Failed to take semaphore for TX FIFO put");
-		}
-
 		return ret;
 	}
 
@@ -264,6 +331,9 @@ static int tx_fifo_put(struct audio_module_handle *handle,
 /**
  * @brief Send the audio data item to all connected modules.
  *
+ * @note All the destinations share the same data buffer, which is freed when the last
+ *       destination has consumed it.
+ *
  * @param handle      [in/out]  The handle for this modules instance.
  * @param audio_data  [in]      A pointer to the audio data.
  *
@@ -273,9 +343,39 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 				     struct audio_data const *const audio_data)
 {
 	int ret;
+	int err = 0;
+	int dest_num = 0;
+	bool use_tx_queue;
+	struct audio_module_buffer *buffer;
 	struct audio_module_handle *handle_to;
+	struct audio_module_handle *dests[CONFIG_AUDIO_MODULE_DESTINATIONS_MAX];
+
+	/* Take a copy of the destinations, so that the lock is not held while sending. */
+	ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
+	if (ret) {
+		LOG_ERR("Failed to take MUTEX lock in time");
+		k_mem_slab_free(handle->thread.data_slab, (void *)audio_data->data);
+		return ret;
+	}
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
+		if (dest_num == ARRAY_SIZE(dests)) {
+			LOG_WRN("Module %s has too many destinations, not sending to all",
+				handle->name);
+			break;
+		}
+
+		dests[dest_num++] = handle_to;
+	}
+
+	use_tx_queue = handle->use_tx_queue && handle->thread.msg_tx;
+
+	ret = k_mutex_unlock(&handle->dest_mutex);
+	if (ret) {
+		LOG_ERR("Failed to release MUTEX");
+	}
 
-	if (handle->dest_count == 0) {
+	if (dest_num == 0 && !use_tx_queue) {
 		LOG_WRN("Nowhere to send the audio data from module %s so releasing it",
 			handle->name);
 
@@ -284,63 +384,52 @@ static int send_to_connected_modules(struct audio_module_handle *handle,
 		return 0;
 	}
 
-	/* We need to ensure that all receiving modules have got the audio data.
-	 * This is so the first receiver cannot free the audio data before all receivers
-	 * have all gotten the audio data.
-	 */
-	ret = k_mutex_lock(&handle->dest_mutex, LOCK_TIMEOUT_US);
-	if (ret) {
-		LOG_ERR("Failed to take MUTEX lock in time");
-		return ret;
+	buffer = buffer_alloc(handle);
+	if (buffer == NULL) {
+		LOG_ERR("No free buffer descriptor in module %s, dropping audio data",
+			handle->name);
+
+		k_mem_slab_free(handle->thread.data_slab, (void *)audio_data->data);
+
+		return -ENOMEM;
 	}
 
-	/* Here the semaphore is used as a count of the number of audio data items out in the
-	 * connected modules.
+	/* One reference for each destination, and one held while sending so that the first
+	 * destination cannot free the audio data before all destinations have gotten it.
 	 */
-	ret = k_sem_init(&handle->sem, handle->dest_count, handle->dest_count);
-	if (ret) {
-		LOG_ERR("Failed to initiate semaphore");
-		return ret;
-	}
+	atomic_set(&buffer->ref_count, dest_num + (use_tx_queue ? 1 : 0) + 1);
 
 	/* Send to all internally connected modules. */
-	SYS_SLIST_FOR_EACH_CONTAINER(&handle->handle_dest_list, handle_to, node) {
-		ret = data_tx(handle, handle_to, audio_data, &audio_data_release_cb);
+	for (int i = 0; i < dest_num; i++) {
+		ret = data_tx(handle, dests[i], audio_data, buffer, &audio_data_release_cb);
 		if (ret) {
 			LOG_ERR("Failed to send audio data to module %s from %s, ret %d",
-				handle_to->name, handle->name, ret);
+				dests[i]->name, handle->name, ret);
 
-			return ret;
+			buffer_release(handle, buffer, audio_data->data);
+			err = ret;
 		}
 	}
 
-	ret = k_mutex_unlock(&handle->dest_mutex);
-	if (ret) {
-		LOG_ERR("Failed to release MUTEX");
-		return ret;
-	}
-
 	/* Send to this module's TX FIFO for extraction by an external
 	 * process with audio_module_rx().
 	 */
-	if (handle->use_tx_queue && handle->thread.msg_tx) {
-		ret = tx_fifo_put(handle, audio_data);
+	if (use_tx_queue) {
+		ret = tx_fifo_put(handle, audio_data, buffer);
 		if (ret) {
 			LOG_ERR("Failed to send audio data on module %s TX message queue",
 				handle->name);
 
-			ret = k_sem_take(&handle->sem, K_NO_WAIT);
-			if (ret) {
-				LOG_ERR("Failed to take semaphore");
-			}
-
-			return ret;
+			buffer_release(handle, buffer, audio_data->data);
+			err = ret;
+		} else {
+			LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
 		}
-
-		LOG_DBG("Sent audio data to TX message queue for module %s", handle->name);
 	}
 
-	return 0;
+	buffer_release(handle, buffer, audio_data->data);
+
+	return err;
 }
 
 /**
@@ -434,6 +523,8 @@ static void module_thread_output(struct audio_module_handle *handle, void *p2, v
 							&size, K_FOREVER);
 		__ASSERT(ret == 0, "Module %s error in getting last filled", handle->name);
 
+		rx_stats_update(handle, msg_rx);
+
 		LOG_DBG("Module %s new audio data received", handle->name);
 
 		/* Process the input audio data and output from the audio system. */
@@ -495,6 +586,8 @@ static void module_thread_in_out(struct audio_module_handle *handle, void *p2, v
 							&size, K_FOREVER);
 		__ASSERT(ret == 0, "Module %s error in getting last filled %d", handle->name, ret);
 
+		rx_stats_update(handle, msg_rx);
+
 		/* Get a new output buffer. */
 		ret = k_mem_slab_alloc(handle->thread.data_slab, (void **)&data, K_NO_WAIT);
 		__ASSERT(ret == 0, "No free data buffer for module %s, dropping input, ret %d",
@@ -695,7 +788,7 @@ int audio_module_close(struct audio_module_handle *handle)
 
 	/*
 	 * TODO: How to return all the data to the slab items?
-	 *       Test the semaphore and wait for it to be zero.
+	 *       Wait for all the buffer descriptors to be released.
 	 */
 
 	k_thread_abort(handle->thread_id);
@@ -827,6 +920,12 @@ int audio_module_connect(struct audio_module_handle *handle_from,
 		return ret;
 	}
 
+	if (handle_from->dest_count >= CONFIG_AUDIO_MODULE_DESTINATIONS_MAX) {
+		LOG_ERR("Module %s has too many destinations", handle_from->name);
+		k_mutex_unlock(&handle_from->dest_mutex);
+		return -ENOMEM;
+	}
+
 	/* If the connect_external is true the handle_from module will queue it's output
 	 * data to it's own TX FIFO. Thus allowing an external system to receive the data
 	 * with a call to audio_module_data_rx() with the same handle.
@@ -840,6 +939,7 @@ int audio_module_connect(struct audio_module_handle *handle_from,
 			if (handle_to == handle) {
 				LOG_WRN("Already attached %s to %s", handle_to->name,
 					handle_from->name);
+				k_mutex_unlock(&handle_from->dest_mutex);
 				return -EALREADY;
 			}
 		}
@@ -1047,7 +1147,7 @@ int audio_module_data_tx(struct audio_module_handle *handle,
 		return -EINVAL;
 	}
 
-	return data_tx((void *)NULL, handle, audio_data, response_cb);
+	return data_tx((void *)NULL, handle, audio_data, NULL, response_cb);
 }
 
 int audio_module_data_rx(struct audio_module_handle *handle, struct audio_data *audio_data,
@@ -1158,7 +1258,7 @@ int audio_module_data_tx_rx(struct audio_module_handle *handle_tx,
 		return -EINVAL;
 	}
 
-	ret = data_tx(NULL, handle_rx, audio_data_tx, NULL);
+	ret = data_tx(NULL, handle_rx, audio_data_tx, NULL, NULL);
 	if (ret) {
 		LOG_ERR("Failed to send audio data to module %s, ret %d", handle_tx->name, ret);
 		return ret;
@@ -1237,6 +1337,35 @@ int audio_module_state_get(struct audio_module_handle const *const handle,
 	return 0;
 };
 
+int audio_module_stats_get(struct audio_module_handle const *const handle,
+			   struct audio_module_stats *stats)
+{
+	if (handle == NULL || stats == NULL) {
+		LOG_ERR("Input parameter is NULL");
+		return -EINVAL;
+	}
+
+	if (!state_not_undefined(handle->state)) {
+		LOG_WRN("Module state is invalid");
+		return -ECANCELED;
+	}
+
+	stats->queued = atomic_get(&handle->stats.queued);
+	stats->dropped = atomic_get(&handle->stats.dropped);
+	stats->queue_depth = MAX(atomic_get(&handle->stats.queue_depth), 0);
+	stats->queue_depth_max = handle->stats.queue_depth_max;
+	stats->latency_max_us = handle->stats.latency_max_us;
+
+	if (handle->stats.latency_count) {
+		stats->latency_avg_us =
+			handle->stats.latency_sum_us / handle->stats.latency_count;
+	} else {
+		stats->latency_avg_us = 0;
+	}
+
+	return 0;
+}
+
 int audio_module_number_channels_calculate(uint32_t locations, int8_t *number_channels)
 {
 	if (number_channels == NULL) {
@@ -37,3 +37,18 @@ APP_EVENT_TYPE_DEFINE(sensor_data_aggregator_release_buffer_event,
 		  NULL,
 		  NULL,
 		  APP_EVENT_FLAGS_CREATE(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE));
+
+static void log_sensor_data_aggregator_pressure_event(const struct app_event_header *aeh)
+{
+	const struct sensor_data_aggregator_pressure_event *event =
+		cast_sensor_data_aggregator_pressure_event(aeh);
+
+	APP_EVENT_MANAGER_LOG(aeh, "sensor:%s pressure:%s free buffers:%u",
+			      event->sensor_descr, event->high ? "high" : "low",
+			      event->free_buf_cnt);
+}
+
+APP_EVENT_TYPE_DEFINE(sensor_data_aggregator_pressure_event,
+		  log_sensor_data_aggregator_pressure_event,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE(APP_EVENT_TYPE_FLAGS_INIT_LOG_ENABLE));
@@ -4,6 +4,7 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <zephyr/kernel.h>
 #include <zephyr/drivers/sensor.h>
 #include <app_event_manager.h>
@@ -11,6 +12,7 @@
 #include <caf/events/sensor_event.h>
 #include <caf/events/sensor_data_aggregator_event.h>
 #include <caf/sensor_manager.h>
+#include <caf/sensor_data_aggregator.h>
 
 #define MODULE sensor_data_aggregator
 #include <caf/events/module_state_event.h>
@@ -32,19 +34,50 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_CAF_SENSOR_DATA_AGGREGATOR_LOG_LEVEL);
 		[DIV_ROUND_UP(size, sizeof(struct sensor_value))]
 /* End of BSS version only macros. */
 
-#define __INITIALIZE_BUFF(n, agg_node)                                                        \
+#define __SAMPLES_IN_BUF(agg_node)                              \
+	(DT_PROP(agg_node, buf_data_length) /                   \
+	 (DT_PROP(agg_node, sample_size) * sizeof(struct sensor_value)))
+#define __TS_BUFF_NAME(agg_node, n) DT_CAT5(agg_, agg_node,  _buff_,  n,  _ts)
+#define __DEFINE_TS(n, agg_node) \
+	static int64_t __TS_BUFF_NAME(agg_node, n)[__SAMPLES_IN_BUF(agg_node)]
+
+/* Per-sample timestamps are kept in local memory and are not provided for aggregators placed
+ * in a shared memory region.
+ */
+#define __XDEFINE_BUF_TS(agg_node)                                                      \
+	COND_CODE_0(DT_NODE_HAS_PROP(agg_node, memory_region),                          \
+		(LISTIFY(DT_PROP(agg_node, buf_count), __DEFINE_TS, (;), agg_node);),   \
+		()                                                                      \
+	)
+
+#define __INITIALIZE_BUFF_TS(n, agg_node)                                               \
+	COND_CODE_0(DT_NODE_HAS_PROP(agg_node, memory_region),                          \
+		(.timestamps = __TS_BUFF_NAME(agg_node, n),),                           \
+		()                                                                      \
+	)
+
+#define __INITIALIZE_BUFF_SAMPLES(n, agg_node)                                                \
 	COND_CODE_1(DT_NODE_HAS_PROP(agg_node, memory_region),                                \
-		({(struct sensor_value *) (DT_REG_ADDR(DT_PHANDLE(agg_node, memory_region)) + \
-			n * (DT_PROP(agg_node, buf_data_length)))}),                          \
-		({__DATA_BUFF_NAME(agg_node, n)})                                             \
+		((struct sensor_value *) (DT_REG_ADDR(DT_PHANDLE(agg_node, memory_region)) +  \
+			n * (DT_PROP(agg_node, buf_data_length)))),                           \
+		(__DATA_BUFF_NAME(agg_node, n))                                               \
 	)
 
+#define __INITIALIZE_BUFF(n, agg_node)                                                     \
+	{                                                                                  \
+		.samples = __INITIALIZE_BUFF_SAMPLES(n, agg_node),                         \
+		IF_ENABLED(CONFIG_CAF_SENSOR_DATA_AGGREGATOR_SAMPLE_TIMESTAMPS,            \
+			   (__INITIALIZE_BUFF_TS(n, agg_node)))                            \
+	}
+
 #define __XDEFINE_BUF_DATA(agg_node)                                                    \
 	COND_CODE_0(DT_NODE_HAS_PROP(agg_node, memory_region),                          \
 		(LISTIFY(DT_PROP(agg_node, buf_count), __DEFINE_DATA, (;),              \
 			agg_node, DT_PROP(agg_node, buf_data_length));),                \
 		()                                                                      \
 	)                                                                               \
+	IF_ENABLED(CONFIG_CAF_SENSOR_DATA_AGGREGATOR_SAMPLE_TIMESTAMPS,                 \
+		   (__XDEFINE_BUF_TS(agg_node)))                                        \
 	static struct aggregator_buffer __AGG_BUFFS_NAME(agg_node)[] = {                \
 		LISTIFY(DT_PROP(agg_node, buf_count), __INITIALIZE_BUFF, (,), agg_node) \
 	};                                                                              \
@@ -59,12 +92,18 @@ LOG_MODULE_REGISTER(MODULE, CONFIG_CAF_SENSOR_DATA_AGGREGATOR_LOG_LEVEL);
 	[i].values_in_sample = DT_INST_PROP(i, sample_size), \
 	[i].buf_count = DT_INST_PROP(i, buf_count),          \
 	[i].buf_len = DT_INST_PROP(i, buf_data_length),      \
+	[i].free_buf_cnt = DT_INST_PROP(i, buf_count),       \
 	[i].agg_buffers = __AGG_BUFFS_NAME(DT_DRV_INST(i)),  \
 	[i].active_buf  = __AGG_BUFFS_NAME(DT_DRV_INST(i)),
 
+#define PRESSURE_THRESHOLD CONFIG_CAF_SENSOR_DATA_AGGREGATOR_PRESSURE_THRESHOLD
+
 
 struct aggregator_buffer {
 	struct sensor_value *samples;	/* Dynamic data. */
+	int64_t *timestamps;		/* Per-sample timestamps or NULL. */
+	int64_t first_timestamp;	/* Timestamp of the first sample. */
+	int64_t last_timestamp;		/* Timestamp of the last sample. */
 	bool busy;			/* Buffer status. */
 	uint8_t sample_cnt;		/* Number of samples already saved in the buffer. */
 };
@@ -77,6 +116,10 @@ struct aggregator {
 	const uint8_t values_in_sample;		/* Number of sensor values in a sample. */
 	const uint8_t buf_count;		/* Number of buffers. */
 	const uint8_t buf_len;			/* Size of buffor data in bytes. */
+	uint8_t free_buf_cnt;			/* Number of buffers not passed to consumers. */
+	bool pressure;				/* Buffer pressure reported. */
+	bool writing;				/* Sample written by a direct producer. */
+	bool flush_pending;			/* Send active buffer once the sample is done. */
 };
 
 
@@ -85,6 +128,9 @@ static struct aggregator aggregators[] = {
 	DT_INST_FOREACH_STATUS_OKAY(__DEFINE_AGGREGATOR)
 };
 
+/* Protects the aggregator state shared between the direct producers and the event handler. */
+static struct k_spinlock agg_lock;
+
 
 static struct aggregator_buffer *get_free_buffer(struct aggregator *agg)
 {
@@ -98,66 +144,256 @@ static struct aggregator_buffer *get_free_buffer(struct aggregator *agg)
 
 static struct aggregator *get_aggregator(const char *sensor_descr)
 {
+	/* Consecutive events usually come from the same sensor. */
+	static struct aggregator *last_agg;
+
+	if (last_agg && (last_agg->sensor_descr == sensor_descr)) {
+		return last_agg;
+	}
+
 	for (size_t i = 0; i < ARRAY_SIZE(aggregators); i++) {
 		if (sensor_descr == aggregators[i].sensor_descr) {
-			return &aggregators[i];
+			last_agg = &aggregators[i];
+			return last_agg;
 		}
 	}
 	return NULL;
 }
 
+/* Must be called with agg_lock held. Returns true if the pressure state changed. */
+static bool update_pressure(struct aggregator *agg)
+{
+	if (PRESSURE_THRESHOLD == 0) {
+		return false;
+	}
+
+	bool pressure = (agg->free_buf_cnt <= PRESSURE_THRESHOLD);
+
+	if (pressure == agg->pressure) {
+		return false;
+	}
+
+	agg->pressure = pressure;
+	return true;
+}
+
+static void send_pressure_event(struct aggregator *agg, uint8_t free_buf_cnt, bool high)
+{
+	struct sensor_data_aggregator_pressure_event *event =
+		new_sensor_data_aggregator_pressure_event();
+
+	event->sensor_descr = agg->sensor_descr;
+	event->free_buf_cnt = free_buf_cnt;
+	event->high = high;
+	APP_EVENT_SUBMIT(event);
+}
+
 static void release_buffer(struct aggregator *agg, struct aggregator_buffer *ab)
 {
 	__ASSERT_NO_MSG(ab);
 
+	k_spinlock_key_t key = k_spin_lock(&agg_lock);
+
 	ab->sample_cnt = 0;
 	ab->busy = false;
+	agg->free_buf_cnt++;
 	if (agg->active_buf == NULL) {
 		agg->active_buf = ab;
 	}
+
+	bool pressure_changed = update_pressure(agg);
+	bool pressure = agg->pressure;
+	uint8_t free_buf_cnt = agg->free_buf_cnt;
+
+	k_spin_unlock(&agg_lock, key);
+
+	if (pressure_changed) {
+		send_pressure_event(agg, free_buf_cnt, pressure);
+	}
 }
 
-static void send_buffer(struct aggregator *agg, struct aggregator_buffer *ab)
+/* Must be called with agg_lock held. */
+static struct aggregator_buffer *detach_buffer(struct aggregator *agg)
 {
+	struct aggregator_buffer *ab = agg->active_buf;
+
+	if (!ab) {
+		return NULL;
+	}
+
 	ab->busy = true;
+	agg->free_buf_cnt--;
+	agg->active_buf = get_free_buffer(agg);
+	agg->flush_pending = false;
+
+	return ab;
+}
+
+static void send_buffer(struct aggregator *agg, struct aggregator_buffer *ab,
+			enum sensor_state sensor_state)
+{
 	struct sensor_data_aggregator_event *event = new_sensor_data_aggregator_event();
+
 	event->values_in_sample = agg->values_in_sample;
 	event->samples = ab->samples;
+	event->timestamps = ab->timestamps;
+	event->first_timestamp = ab->first_timestamp;
+	event->last_timestamp = ab->last_timestamp;
 	event->sample_cnt = ab->sample_cnt;
-	event->sensor_state = agg->sensor_state;
+	event->sensor_state = sensor_state;
 	event->sensor_descr = agg->sensor_descr;
 	APP_EVENT_SUBMIT(event);
 }
 
-static int enqueue_sample(struct aggregator *agg, struct sensor_event *event)
+/* Detaches the active buffer while holding the lock and sends it after the lock is released. */
+static void flush_buffer(struct aggregator *agg, k_spinlock_key_t key)
+{
+	struct aggregator_buffer *ab = detach_buffer(agg);
+	enum sensor_state sensor_state = agg->sensor_state;
+	bool pressure_changed = update_pressure(agg);
+	bool pressure = agg->pressure;
+	uint8_t free_buf_cnt = agg->free_buf_cnt;
+
+	k_spin_unlock(&agg_lock, key);
+
+	if (ab) {
+		send_buffer(agg, ab, sensor_state);
+	} else {
+		LOG_WRN("No active buffer to send: %s", agg->sensor_descr);
+	}
+
+	if (pressure_changed) {
+		send_pressure_event(agg, free_buf_cnt, pressure);
+	}
+}
+
+/* Must be called with agg_lock held. Returns true if the active buffer is full. */
+static bool commit_sample(struct aggregator *agg, int64_t timestamp)
 {
+	struct aggregator_buffer *ab = agg->active_buf;
 	size_t chunk_bytes = agg->values_in_sample * sizeof(struct sensor_value);
 
-	if ((event->dyndata.size) != chunk_bytes) {
+	if (ab->sample_cnt == 0) {
+		ab->first_timestamp = timestamp;
+	}
+	ab->last_timestamp = timestamp;
+	if (IS_ENABLED(CONFIG_CAF_SENSOR_DATA_AGGREGATOR_SAMPLE_TIMESTAMPS) && ab->timestamps) {
+		ab->timestamps[ab->sample_cnt] = timestamp;
+	}
+	ab->sample_cnt++;
+
+	size_t avail_bytes = agg->buf_len - ab->sample_cnt * chunk_bytes;
+
+	return (avail_bytes < chunk_bytes);
+}
+
+static int enqueue_samples(struct aggregator *agg, struct sensor_event *event)
+{
+	size_t chunk_bytes = agg->values_in_sample * sizeof(struct sensor_value);
+
+	/* The event may carry a batch of consecutive samples. */
+	if ((event->dyndata.size == 0) || ((event->dyndata.size % chunk_bytes) != 0)) {
 		return -EBADMSG;
 	}
-	if (!agg->active_buf) {
-		return -ENOMEM;
+
+	const uint8_t *data = event->dyndata.data;
+	size_t sample_cnt = event->dyndata.size / chunk_bytes;
+	int64_t timestamp = k_uptime_get();
+
+	for (size_t i = 0; i < sample_cnt; i++) {
+		k_spinlock_key_t key = k_spin_lock(&agg_lock);
+
+		if (agg->writing) {
+			k_spin_unlock(&agg_lock, key);
+			return -EBUSY;
+		}
+		if (!agg->active_buf) {
+			k_spin_unlock(&agg_lock, key);
+			return -ENOMEM;
+		}
+
+		struct aggregator_buffer *ab = agg->active_buf;
+		size_t pos_values = ab->sample_cnt * agg->values_in_sample;
+
+		memcpy(&ab->samples[pos_values], data, chunk_bytes);
+		data += chunk_bytes;
+
+		if (commit_sample(agg, timestamp)) {
+			flush_buffer(agg, key);
+		} else {
+			k_spin_unlock(&agg_lock, key);
+		}
+	}
+
+	return 0;
+}
+
+int sensor_data_aggregator_handle_get(const char *sensor_descr)
+{
+	for (size_t i = 0; i < ARRAY_SIZE(aggregators); i++) {
+		if ((sensor_descr == aggregators[i].sensor_descr) ||
+		    !strcmp(sensor_descr, aggregators[i].sensor_descr)) {
+			return i;
+		}
 	}
 
+	return -ENOENT;
+}
+
+struct sensor_value *sensor_data_aggregator_sample_get(int handle)
+{
+	__ASSERT_NO_MSG((handle >= 0) && (handle < ARRAY_SIZE(aggregators)));
+
+	struct aggregator *agg = &aggregators[handle];
+	struct sensor_value *sample = NULL;
+	k_spinlock_key_t key = k_spin_lock(&agg_lock);
+
+	__ASSERT(!agg->writing, "Previous sample not completed");
+
 	struct aggregator_buffer *ab = agg->active_buf;
-	size_t pos_values = ab->sample_cnt * agg->values_in_sample;
-	size_t avail_bytes = agg->buf_len - pos_values * sizeof(struct sensor_value);
 
-	if (avail_bytes < chunk_bytes) {
-		__ASSERT_NO_MSG(false);
-		return -ENOMEM;
+	if (ab) {
+		sample = &ab->samples[ab->sample_cnt * agg->values_in_sample];
+		agg->writing = true;
 	}
-	memcpy(&ab->samples[pos_values], (uint8_t *)event->dyndata.data, chunk_bytes);
-	ab->sample_cnt++;
-	avail_bytes -= chunk_bytes;
 
-	if (avail_bytes < chunk_bytes) {
-		send_buffer(agg, ab);
-		agg->active_buf = get_free_buffer(agg);
+	k_spin_unlock(&agg_lock, key);
+
+	return sample;
+}
+
+void sensor_data_aggregator_sample_commit(int handle, int64_t timestamp)
+{
+	__ASSERT_NO_MSG((handle >= 0) && (handle < ARRAY_SIZE(aggregators)));
+
+	struct aggregator *agg = &aggregators[handle];
+	k_spinlock_key_t key = k_spin_lock(&agg_lock);
+
+	__ASSERT_NO_MSG(agg->writing && agg->active_buf);
+	agg->writing = false;
+
+	if (commit_sample(agg, timestamp) || agg->flush_pending) {
+		flush_buffer(agg, key);
+	} else {
+		k_spin_unlock(&agg_lock, key);
 	}
+}
 
-	return 0;
+void sensor_data_aggregator_sample_abort(int handle)
+{
+	__ASSERT_NO_MSG((handle >= 0) && (handle < ARRAY_SIZE(aggregators)));
+
+	struct aggregator *agg = &aggregators[handle];
+	k_spinlock_key_t key = k_spin_lock(&agg_lock);
+
+	__ASSERT_NO_MSG(agg->writing);
+	agg->writing = false;
+
+	if (agg->flush_pending) {
+		flush_buffer(agg, key);
+	} else {
+		k_spin_unlock(&agg_lock, key);
+	}
 }
 
 static bool event_handler(const struct app_event_header *aeh)
@@ -167,7 +403,7 @@ static bool event_handler(const struct app_event_header *aeh)
 		struct aggregator *agg = get_aggregator(event->descr);
 
 		if (agg) {
-			int err = enqueue_sample(agg, event);
+			int err = enqueue_samples(agg, event);
 
 			if (err) {
 				LOG_ERR("Error code: %d", err);
@@ -201,11 +437,17 @@ static bool event_handler(const struct app_event_header *aeh)
 		struct aggregator *agg = get_aggregator(event->descr);
 
 		if (agg) {
-			struct aggregator_buffer *ab = agg->active_buf;
+			k_spinlock_key_t key = k_spin_lock(&agg_lock);
 
 			agg->sensor_state = event->state;
-			send_buffer(agg, ab);
-			agg->active_buf = get_free_buffer(agg);
+
+			if (agg->writing) {
+				/* The direct producer sends the buffer after completing the sample. */
+				agg->flush_pending = true;
+				k_spin_unlock(&agg_lock, key);
+			} else {
+				flush_buffer(agg, key);
+			}
 		}
 
 		return false;
@@ -10,6 +10,7 @@
 
 #include <caf/events/sensor_event.h>
 #include <caf/sensor_manager.h>
+#include <caf/sensor_data_aggregator.h>
 
 #include CONFIG_CAF_SENSOR_MANAGER_DEF_PATH
 
@@ -31,6 +32,16 @@ struct sensor_data {
 	atomic_t state;
 	unsigned int sleep_cntd;
 	atomic_t event_cnt;
+	int agg_handle;
+	struct sensor_event *batch_event;
+	uint8_t batch_cnt;
+};
+
+enum sample_dest {
+	SAMPLE_DEST_EVENT,
+	SAMPLE_DEST_BATCH,
+	SAMPLE_DEST_AGGREGATOR,
+	SAMPLE_DEST_NONE,
 };
 
 static struct sensor_data sensor_data[ARRAY_SIZE(sensor_configs)];
@@ -215,11 +226,120 @@ static void enter_sleep(const struct sm_sensor_config *sc,
 	k_sched_unlock();
 }
 
+static bool is_sensor_batched(const struct sm_sensor_config *sc)
+{
+	return (sc->batch_size > 1);
+}
+
+static void batch_submit(struct sensor_data *sd, size_t data_cnt)
+{
+	struct sensor_event *event = sd->batch_event;
+
+	__ASSERT_NO_MSG(event);
+	sd->batch_event = NULL;
+
+	if (sd->batch_cnt == 0) {
+		app_event_manager_free(event);
+		return;
+	}
+
+	event->dyndata.size = sizeof(struct sensor_value) * data_cnt * sd->batch_cnt;
+	sd->batch_cnt = 0;
+
+	atomic_inc(&sd->event_cnt);
+	APP_EVENT_SUBMIT(event);
+}
+
+static struct sensor_value *batch_slot_get(struct sensor_data *sd,
+					   const struct sm_sensor_config *sc, size_t data_cnt)
+{
+	if (!sd->batch_event) {
+		if (atomic_get(&sd->event_cnt) >= sc->active_events_limit) {
+			LOG_WRN("Did not send event due to too many active events on sensor: %s",
+				sc->dev->name);
+			return NULL;
+		}
+
+		sd->batch_event = new_sensor_event(sizeof(struct sensor_value) * data_cnt *
+						   sc->batch_size);
+		sd->batch_event->descr = sc->event_descr;
+		sd->batch_cnt = 0;
+	}
+
+	return sensor_event_get_data_ptr(sd->batch_event) + (sd->batch_cnt * data_cnt);
+}
+
+static struct sensor_value *sample_dest_get(struct sensor_data *sd,
+					    const struct sm_sensor_config *sc, size_t data_cnt,
+					    enum sample_dest *dest)
+{
+	struct sensor_value *data = NULL;
+
+	if (IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_AGGREGATOR_DIRECT) && (sd->agg_handle >= 0)) {
+		data = sensor_data_aggregator_sample_get(sd->agg_handle);
+		if (!data) {
+			LOG_WRN("No free aggregator buffer for sensor: %s", sc->dev->name);
+		}
+		*dest = data ? SAMPLE_DEST_AGGREGATOR : SAMPLE_DEST_NONE;
+	} else if (is_sensor_batched(sc)) {
+		data = batch_slot_get(sd, sc, data_cnt);
+		*dest = data ? SAMPLE_DEST_BATCH : SAMPLE_DEST_NONE;
+	} else {
+		*dest = SAMPLE_DEST_EVENT;
+	}
+
+	return data;
+}
+
+static void sample_report(struct sensor_data *sd, const struct sm_sensor_config *sc,
+			  const struct sensor_value *data, size_t data_cnt,
+			  enum sample_dest dest, int64_t timestamp)
+{
+	switch (dest) {
+	case SAMPLE_DEST_EVENT:
+		if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
+			send_sensor_event(sc->event_descr, data, data_cnt, &sd->event_cnt);
+		} else {
+			LOG_WRN("Did not send event due to too many active events on sensor: %s",
+				sc->dev->name);
+		}
+		break;
+
+	case SAMPLE_DEST_BATCH:
+		sd->batch_cnt++;
+		if (sd->batch_cnt == sc->batch_size) {
+			batch_submit(sd, data_cnt);
+		}
+		break;
+
+	case SAMPLE_DEST_AGGREGATOR:
+		if (IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_AGGREGATOR_DIRECT)) {
+			sensor_data_aggregator_sample_commit(sd->agg_handle, timestamp);
+		}
+		break;
+
+	case SAMPLE_DEST_NONE:
+		/* Sample dropped. */
+		break;
+
+	default:
+		__ASSERT_NO_MSG(false);
+		break;
+	}
+}
+
 static void sample_sensor(struct sensor_data *sd, const struct sm_sensor_config *sc)
 {
 	size_t data_idx = 0;
 	size_t data_cnt = get_sensor_data_cnt(sc);
-	struct sensor_value data[data_cnt];
+	struct sensor_value local_data[data_cnt];
+	enum sample_dest dest;
+	struct sensor_value *data = sample_dest_get(sd, sc, data_cnt, &dest);
+	int64_t timestamp = k_uptime_get();
+
+	if (!data) {
+		data = local_data;
+	}
 
 	int err = sensor_sample_fetch(sc->dev);
 
@@ -231,23 +351,27 @@ static void sample_sensor(struct sensor_data *sd, const struct sm_sensor_config
 	}
 
 	if (err) {
+		if (IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_AGGREGATOR_DIRECT) &&
+		    (dest == SAMPLE_DEST_AGGREGATOR)) {
+			sensor_data_aggregator_sample_abort(sd->agg_handle);
+		}
 		LOG_ERR("Sensor sampling error (err %d)", err);
 		update_sensor_state(sc, sd, SENSOR_STATE_ERROR);
 	} else {
-		if (atomic_get(&sd->event_cnt) < sc->active_events_limit) {
-			send_sensor_event(sc->event_descr, data, ARRAY_SIZE(data),
-					  &sd->event_cnt);
-		} else {
-			LOG_WRN("Did not send event due to too many active events on sensor: %s",
-				sc->dev->name);
-		}
+		bool sleep = false;
 
+		/* Activity is processed before reporting, as reported sample memory may be
+		 * released by the consumer right after it is passed.
+		 */
 		if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
 			process_sensor_activity(sc, sd, data);
-			if (!is_sensor_active(sd)) {
-				enter_sleep(sc, sd);
-			}
+			sleep = !is_sensor_active(sd);
+		}
 
+		sample_report(sd, sc, data, data_cnt, dest, timestamp);
+
+		if (sleep) {
+			enter_sleep(sc, sd);
 		}
 	}
 }
@@ -279,6 +403,11 @@ static size_t sample_sensors(int64_t *next_timeout)
 			}
 		}
 
+		/* Partially filled batch is submitted once the sensor stops sampling. */
+		if (sd->batch_event && (atomic_get(&sd->state) != SENSOR_STATE_ACTIVE)) {
+			batch_submit(sd, get_sensor_data_cnt(sc));
+		}
+
 		if (atomic_get(&sd->state) != SENSOR_STATE_ERROR) {
 			alive_sensors++;
 			if (atomic_get(&sd->state) == SENSOR_STATE_ACTIVE) {
@@ -389,6 +518,11 @@ static size_t sensor_init(void)
 		}
 		sd->sampling_period = sc->sampling_period_ms;
 		sd->sample_timeout = cur_uptime + sc->sampling_period_ms;
+		sd->agg_handle = -ENOENT;
+
+		if (IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_AGGREGATOR_DIRECT)) {
+			sd->agg_handle = sensor_data_aggregator_handle_get(sc->event_descr);
+		}
 
 		if (sc->trigger && IS_ENABLED(CONFIG_CAF_SENSOR_MANAGER_PM)) {
 			int err = sensor_trigger_init(sc, sd);
@@ -469,6 +603,8 @@ static bool handle_power_down_event(const struct app_event_header *aeh)
 		k_sched_unlock();
 	}
 	configure_max_power_state();
+	/* Let the sampling thread submit partially filled batches. */
+	k_sem_give(&can_sample);
 	return false;
 }
 
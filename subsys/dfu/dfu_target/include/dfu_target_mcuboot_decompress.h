@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Check if data in buf is the start of a compressed MCUboot image.
+ *
+ * The result is recorded for the next call to @ref dfu_target_mcuboot_decompress_init.
+ *
+ * @param buf Start of the image, at least the size of the compressed image header.
+ *
+ * @retval true if the image is compressed, false otherwise.
+ */
+bool dfu_target_mcuboot_decompress_identify(const void *const buf);
+
+/**
+ * @brief Prepare the decompression of a compressed MCUboot image.
+ *
+ * Must be called after the stream is initialized, so that the decompressed data that is
+ * already written to the stream is skipped.
+ *
+ * @param file_size Size of the compressed image.
+ * @param slot_size Size of the slot that receives the decompressed image.
+ *
+ * @retval true if the last identified image is compressed and is decompressed by the
+ *         following writes, false otherwise.
+ */
+bool dfu_target_mcuboot_decompress_init(size_t file_size, size_t slot_size);
+
+/**
+ * @brief Check if the decompression is used for the current image.
+ */
+bool dfu_target_mcuboot_decompress_active(void);
+
+/**
+ * @brief Get the amount of compressed data received since the initialization.
+ *
+ * @param[out] offset Offset in the compressed image to continue the download from.
+ *
+ * @return 0 on success, negative errno otherwise.
+ */
+int dfu_target_mcuboot_decompress_offset_get(size_t *offset);
+
+/**
+ * @brief Decompress a part of the compressed image and write it to the stream.
+ *
+ * @param buf Compressed data.
+ * @param len Length of the compressed data.
+ *
+ * @return 0 on success, -EINVAL if the image is not valid, negative errno otherwise.
+ */
+int dfu_target_mcuboot_decompress_write(const void *const buf, size_t len);
+
+/**
+ * @brief Finish or abort the decompression.
+ *
+ * After an abort, the download continues from the beginning of the compressed image and
+ * the decompressed data that is already written to the stream is skipped.
+ *
+ * @param successful Whether the whole compressed image was received.
+ *
+ * @return 0 on success, -EINVAL if the image is incomplete, negative errno otherwise.
+ */
+int dfu_target_mcuboot_decompress_done(bool successful);
+
+/**
+ * @brief Drop the decompression state.
+ */
+void dfu_target_mcuboot_decompress_reset(void);
@@ -28,6 +28,9 @@
 #include <dfu/dfu_target_stream.h>
 #include <zephyr/devicetree.h>
 #include <dfu_stream_flatten.h>
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+#include <dfu_target_mcuboot_decompress.h>
+#endif
 
 LOG_MODULE_REGISTER(dfu_target_mcuboot, CONFIG_DFU_TARGET_LOG_LEVEL);
 
@@ -123,6 +126,12 @@ static uint8_t curr_sec_img;
 
 bool dfu_target_mcuboot_identify(const void *const buf)
 {
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+	if (dfu_target_mcuboot_decompress_identify(buf)) {
+		return true;
+	}
+#endif
+
 	/* MCUBoot headers starts with 4 byte magic word */
 	return *((const uint32_t *)buf) == MCUBOOT_HEADER_MAGIC;
 }
@@ -156,6 +165,9 @@ int dfu_target_mcuboot_init(size_t file_size, int img_num, dfu_target_callback_t
 		return -ENODEV;
 	}
 
+	/* The size of a decompressed image is checked against the slot size once its header
+	 * is received.
+	 */
 	if (file_size > secondary_size[img_num]) {
 		LOG_ERR("Requested file too big to fit in flash %zu > 0x%x",
 			file_size, secondary_size[img_num]);
@@ -182,6 +194,10 @@ int dfu_target_mcuboot_init(size_t file_size, int img_num, dfu_target_callback_t
 		return err;
 	}
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+	(void)dfu_target_mcuboot_decompress_init(file_size, secondary_size[img_num]);
+#endif
+
 	curr_sec_img = img_num;
 	return 0;
 }
@@ -190,6 +206,12 @@ int dfu_target_mcuboot_offset_get(size_t *out)
 {
 	int err = 0;
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+	if (dfu_target_mcuboot_decompress_active()) {
+		return dfu_target_mcuboot_decompress_offset_get(out);
+	}
+#endif
+
 	err = dfu_target_stream_offset_get(out);
 #ifndef CONFIG_DFU_TARGET_STREAM_SYNCHRONOUS
 	if (err == 0) {
@@ -202,6 +224,12 @@ int dfu_target_mcuboot_offset_get(size_t *out)
 
 int dfu_target_mcuboot_write(const void *const buf, size_t len)
 {
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+	if (dfu_target_mcuboot_decompress_active()) {
+		return dfu_target_mcuboot_decompress_write(buf, len);
+	}
+#endif
+
 	/**
 	 * If saving progress the bytes written to flash are flushed
 	 * immediately, no need to add additional bytes to compensate
@@ -218,6 +246,16 @@ int dfu_target_mcuboot_done(bool successful)
 {
 	int err = 0;
 
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+	if (dfu_target_mcuboot_decompress_active()) {
+		err = dfu_target_mcuboot_decompress_done(successful);
+		if (err != 0) {
+			(void)dfu_target_stream_done(false);
+			return err;
+		}
+	}
+#endif
+
 	err = dfu_target_stream_done(successful);
 	if (err != 0) {
 		LOG_ERR("dfu_target_stream_done error %d", err);
@@ -269,5 +307,8 @@ int dfu_target_mcuboot_schedule_update(int img_num)
 int dfu_target_mcuboot_reset(void)
 {
 	stream_buf_bytes = 0;
+#ifdef CONFIG_DFU_TARGET_MCUBOOT_DECOMPRESS
+	dfu_target_mcuboot_decompress_reset();
+#endif
 	return dfu_target_stream_reset();
 }
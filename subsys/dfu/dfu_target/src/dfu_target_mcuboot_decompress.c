@@ -0,0 +1,359 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/byteorder.h>
+#include <dfu/dfu_target_mcuboot.h>
+#include <dfu/dfu_target_stream.h>
+#include <nrf_compress/implementation.h>
+#include <dfu_target_mcuboot_decompress.h>
+
+LOG_MODULE_REGISTER(dfu_target_mcuboot_decompress, CONFIG_DFU_TARGET_LOG_LEVEL);
+
+#if !defined(CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2)
+#error "Compressed MCUboot images require CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2"
+#endif
+
+#define HEADER_SIZE sizeof(struct dfu_target_mcuboot_compressed_header)
+
+static struct {
+	struct nrf_compress_implementation *lzma;
+	struct nrf_compress_implementation *arm_thumb;
+
+	/* Header collected from the start of the compressed image. */
+	uint8_t header[HEADER_SIZE];
+
+	/* Compressed data waiting for the amount requested by the decoder. */
+	uint8_t input[CONFIG_NRF_COMPRESS_CHUNK_SIZE];
+	size_t input_len;
+
+	/* Progress in the compressed image. */
+	size_t file_size;
+	size_t received;
+
+	/* Progress in the decompressed image. The data before the skip offset is already
+	 * written to the stream.
+	 */
+	size_t image_size;
+	size_t slot_size;
+	size_t decompressed;
+	size_t skip;
+
+	bool identified;
+	bool active;
+	bool started;
+} ctx;
+
+bool dfu_target_mcuboot_decompress_identify(const void *const buf)
+{
+	ctx.identified = sys_get_le32(buf) == DFU_TARGET_MCUBOOT_COMPRESSED_MAGIC;
+
+	return ctx.identified;
+}
+
+static void decoders_deinit(void)
+{
+	if (!ctx.started) {
+		return;
+	}
+
+	(void)ctx.lzma->deinit(NULL);
+
+	if (ctx.arm_thumb != NULL) {
+		(void)ctx.arm_thumb->deinit(NULL);
+	}
+
+	ctx.started = false;
+}
+
+/* Restart from the beginning of the compressed image, skipping the decompressed data that was
+ * already given to the stream.
+ */
+static void restart(size_t skip)
+{
+	decoders_deinit();
+
+	ctx.input_len = 0;
+	ctx.received = 0;
+	ctx.decompressed = 0;
+	ctx.skip = skip;
+}
+
+bool dfu_target_mcuboot_decompress_init(size_t file_size, size_t slot_size)
+{
+	size_t written = 0;
+
+	decoders_deinit();
+	ctx.active = ctx.identified;
+
+	if (!ctx.active) {
+		return false;
+	}
+
+	if (dfu_target_stream_offset_get(&written) == 0 && written > 0) {
+		LOG_INF("Skipping %zu already written bytes of the decompressed image", written);
+	}
+
+	ctx.file_size = file_size;
+	ctx.slot_size = slot_size;
+	restart(written);
+
+	return true;
+}
+
+bool dfu_target_mcuboot_decompress_active(void)
+{
+	return ctx.active;
+}
+
+int dfu_target_mcuboot_decompress_offset_get(size_t *offset)
+{
+	*offset = ctx.received;
+
+	return 0;
+}
+
+static int header_parse(void)
+{
+	const struct dfu_target_mcuboot_compressed_header *header = (const void *)ctx.header;
+	uint32_t flags = sys_le32_to_cpu(header->flags);
+	int err;
+
+	ctx.image_size = sys_le32_to_cpu(header->image_size);
+
+	if (sys_le32_to_cpu(header->magic) != DFU_TARGET_MCUBOOT_COMPRESSED_MAGIC ||
+	    (flags & ~DFU_TARGET_MCUBOOT_COMPRESSED_FLAG_ARM_THUMB) != 0) {
+		LOG_ERR("Invalid compressed image header");
+		return -EINVAL;
+	}
+
+	if (ctx.image_size > ctx.slot_size) {
+		LOG_ERR("Decompressed image too big to fit in flash %zu > %zu",
+			ctx.image_size, ctx.slot_size);
+		return -EINVAL;
+	}
+
+	if (ctx.skip > ctx.image_size) {
+		LOG_ERR("Written data does not belong to the compressed image");
+		return -EINVAL;
+	}
+
+	ctx.lzma = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+	ctx.arm_thumb = NULL;
+
+	if (flags & DFU_TARGET_MCUBOOT_COMPRESSED_FLAG_ARM_THUMB) {
+		ctx.arm_thumb = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_ARM_THUMB);
+
+		if (ctx.arm_thumb == NULL) {
+			LOG_ERR("ARM thumb filter not supported");
+			return -EINVAL;
+		}
+	}
+
+	if (ctx.lzma == NULL) {
+		LOG_ERR("LZMA decompression not supported");
+		return -EINVAL;
+	}
+
+	err = ctx.lzma->init(NULL, ctx.image_size);
+	if (err != 0) {
+		LOG_ERR("LZMA init error %d", err);
+		return err;
+	}
+
+	if (ctx.arm_thumb != NULL) {
+		err = ctx.arm_thumb->init(NULL, ctx.image_size);
+		if (err != 0) {
+			LOG_ERR("ARM thumb init error %d", err);
+			(void)ctx.lzma->deinit(NULL);
+			return err;
+		}
+	}
+
+	ctx.started = true;
+
+	return 0;
+}
+
+static int plain_write(const uint8_t *buf, size_t len)
+{
+	size_t skip_len = 0;
+	int err;
+
+	if (ctx.decompressed < ctx.skip) {
+		skip_len = MIN(len, ctx.skip - ctx.decompressed);
+	}
+
+	if (ctx.decompressed + len > ctx.image_size) {
+		LOG_ERR("Decompressed data exceeds the image size");
+		return -EINVAL;
+	}
+
+	if (skip_len < len) {
+		err = dfu_target_stream_write(&buf[skip_len], len - skip_len);
+		if (err != 0) {
+			return err;
+		}
+	}
+
+	/* Only count the data the stream accepted, so that a restart skips exactly that. */
+	ctx.decompressed += len;
+
+	return 0;
+}
+
+static int output_process(const uint8_t *buf, size_t len, bool last)
+{
+	while (len > 0) {
+		size_t chunk_len = MIN(len, CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+		uint32_t offset;
+		uint8_t *output;
+		size_t output_size;
+		int err;
+
+		if (ctx.arm_thumb == NULL) {
+			return plain_write(buf, len);
+		}
+
+		err = ctx.arm_thumb->decompress(NULL, buf, chunk_len, last && chunk_len == len,
+						&offset, &output, &output_size);
+		if (err != 0) {
+			LOG_ERR("ARM thumb filter error %d", err);
+			return -EINVAL;
+		}
+
+		err = plain_write(output, output_size);
+		if (err != 0) {
+			return err;
+		}
+
+		buf += offset;
+		len -= offset;
+	}
+
+	return 0;
+}
+
+static int input_process(bool last)
+{
+	do {
+		uint32_t offset;
+		uint8_t *output;
+		size_t output_size;
+		bool finished;
+		int err;
+
+		err = ctx.lzma->decompress(NULL, ctx.input, ctx.input_len, last, &offset, &output,
+					   &output_size);
+		if (err != 0 || offset == 0) {
+			LOG_ERR("LZMA decompression error %d", err);
+			return -EINVAL;
+		}
+
+		ctx.input_len -= offset;
+		memmove(ctx.input, &ctx.input[offset], ctx.input_len);
+		finished = last && ctx.input_len == 0;
+
+		if (output_size > 0) {
+			err = output_process(output, output_size, finished);
+			if (err != 0) {
+				return err;
+			}
+		}
+	} while (last && ctx.input_len > 0);
+
+	return 0;
+}
+
+int dfu_target_mcuboot_decompress_write(const void *const buf, size_t len)
+{
+	const uint8_t *data = buf;
+	int err;
+
+	if (ctx.received + len > ctx.file_size) {
+		LOG_ERR("Received data exceeds the file size");
+		return -EINVAL;
+	}
+
+	while (len > 0) {
+		size_t needed;
+		size_t copy_len;
+		bool last;
+
+		if (ctx.received < HEADER_SIZE) {
+			copy_len = MIN(len, HEADER_SIZE - ctx.received);
+			memcpy(&ctx.header[ctx.received], data, copy_len);
+			ctx.received += copy_len;
+			data += copy_len;
+			len -= copy_len;
+
+			if (ctx.received == HEADER_SIZE) {
+				err = header_parse();
+				if (err != 0) {
+					return err;
+				}
+			}
+
+			continue;
+		}
+
+		needed = ctx.lzma->decompress_bytes_needed(NULL);
+		if (needed == 0) {
+			return -ESRCH;
+		}
+
+		needed = MIN(needed, sizeof(ctx.input));
+		copy_len = MIN(len, needed - MIN(needed, ctx.input_len));
+		memcpy(&ctx.input[ctx.input_len], data, copy_len);
+		ctx.input_len += copy_len;
+		ctx.received += copy_len;
+		data += copy_len;
+		len -= copy_len;
+
+		last = ctx.received == ctx.file_size;
+
+		if (ctx.input_len < needed && !last) {
+			continue;
+		}
+
+		err = input_process(last);
+		if (err != 0) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+int dfu_target_mcuboot_decompress_done(bool successful)
+{
+	if (!successful) {
+		/* The decoder state is lost, so a resumed download starts over. */
+		restart(MAX(ctx.skip, ctx.decompressed));
+		return 0;
+	}
+
+	if (!ctx.started || ctx.decompressed != ctx.image_size) {
+		LOG_ERR("Incomplete compressed image, decompressed %zu of %zu bytes",
+			ctx.decompressed, ctx.image_size);
+		decoders_deinit();
+		return -EINVAL;
+	}
+
+	decoders_deinit();
+	ctx.active = false;
+
+	return 0;
+}
+
+void dfu_target_mcuboot_decompress_reset(void)
+{
+	decoders_deinit();
+	memset(&ctx, 0, sizeof(ctx));
+}
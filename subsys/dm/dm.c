@@ -329,7 +329,6 @@ static int timeslot_request(uint32_t distance_from_last)
 
 static void dm_start_ranging(void)
 {
-	struct timeslot_request *req;
 	int err;
 
 	k_mutex_lock(&ranging_mtx, K_FOREVER);
@@ -349,15 +348,12 @@ static void dm_start_ranging(void)
 		goto out;
 	}
 
-	req = timeslot_queue_peek();
-	if (!req) {
+	if (timeslot_queue_pop(&timeslot_ctx.curr_req)) {
 		goto out;
 	}
 
-	memcpy(&timeslot_ctx.curr_req, req, sizeof(timeslot_ctx.curr_req));
-	timeslot_queue_remove_first();
-
-	uint32_t distance = time_distance_get(timeslot_ctx.last_start, req->start_time);
+	uint32_t distance = time_distance_get(timeslot_ctx.last_start,
+					      timeslot_ctx.curr_req.start_time);
 
 	atomic_set(&timeslot_ctx.state, TIMESLOT_STATE_PENDING);
 	err = timeslot_request(TICKS_TO_US(distance));
@@ -4,62 +4,258 @@
  * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
  */
 
+#include <string.h>
 #include <zephyr/kernel.h>
 #include "timeslot_queue.h"
 #include "time.h"
 
 #define TIMESLOT_QUEUE_LENGTH            CONFIG_DM_TIMESLOT_QUEUE_LENGTH
 #define TIMESLOT_QUEUE_COUNT_SAME_PEER   CONFIG_DM_TIMESLOT_QUEUE_COUNT_SAME_PEER
+#define TIMESLOT_QUEUE_PEERS_MAX         CONFIG_DM_TIMESLOT_QUEUE_PEERS_MAX
 
 #define MIN_TIME_BETWEEN_TIMESLOTS_US    CONFIG_DM_MIN_TIME_BETWEEN_TIMESLOTS_US
 #define RANGING_OFFSET_US                CONFIG_DM_RANGING_OFFSET_US
 
-static K_MUTEX_DEFINE(list_mtx);
-static sys_slist_t timeslot_list = SYS_SLIST_STATIC_INIT(&timeslot_list);
+#define RTC_COUNTER_RANGE                ((uint64_t)RTC_COUNTER_MAX + 1)
 
-struct timeslot_entry {
-	struct timeslot_request timeslot_req;
-	sys_snode_t node;
+BUILD_ASSERT(TIMESLOT_QUEUE_LENGTH <= UINT8_MAX, "Timeslot queue too long");
+BUILD_ASSERT(TIMESLOT_QUEUE_PEERS_MAX <= UINT8_MAX, "Too many peers");
+
+struct peer_entry {
+	bt_addr_le_t bt_addr;
+	bool used;
+	uint8_t queued;
+	struct timeslot_queue_peer_stats stats;
 };
 
-static K_HEAP_DEFINE(heap, TIMESLOT_QUEUE_LENGTH * sizeof(struct timeslot_entry));
+static K_MUTEX_DEFINE(queue_mtx);
+
+/* Entries never move once allocated. The schedule is kept as a ring of entry indexes
+ * sorted by the timeslot start time.
+ */
+static struct timeslot_request entries[TIMESLOT_QUEUE_LENGTH];
+static uint8_t entry_peer[TIMESLOT_QUEUE_LENGTH];
+static uint8_t free_list[TIMESLOT_QUEUE_LENGTH];
+static uint8_t free_cnt;
+static uint8_t order[TIMESLOT_QUEUE_LENGTH];
+static uint8_t order_head;
+static uint8_t order_cnt;
+
+static struct peer_entry peers[TIMESLOT_QUEUE_PEERS_MAX];
+static uint8_t active_peers;
 
-static void list_lock(void)
+/* The last timeslot taken from the queue, new timeslots cannot start before its end. */
+static uint32_t busy_from;
+static uint32_t busy_until;
+static bool busy_valid;
+
+static struct timeslot_queue_stats stats;
+
+static void queue_lock(void)
 {
-	k_mutex_lock(&list_mtx, K_FOREVER);
+	k_mutex_lock(&queue_mtx, K_FOREVER);
 }
 
-static void list_unlock(void)
+static void queue_unlock(void)
 {
-	k_mutex_unlock(&list_mtx);
+	k_mutex_unlock(&queue_mtx);
 }
 
-static size_t get_list_size(void)
+static uint32_t time_add(uint32_t time, uint32_t ticks)
 {
-	size_t ret = 0;
-	sys_snode_t *node, *tmp;
+	return (uint32_t)(((uint64_t)time + ticks) % RTC_COUNTER_RANGE);
+}
+
+/* All scheduled timeslots are within a fraction of the counter range from each other,
+ * so the wrapping distance gives a total order.
+ */
+static bool time_before(uint32_t t1, uint32_t t2)
+{
+	uint32_t distance = time_distance_get(t1, t2);
+
+	return (distance != 0) && (distance < (RTC_COUNTER_MAX / 2));
+}
+
+static uint32_t timeslot_end(const struct timeslot_request *req)
+{
+	return time_add(req->start_time, US_TO_RTC_TICKS(req->timeslot_length_us +
+							 MIN_TIME_BETWEEN_TIMESLOTS_US));
+}
 
-	SYS_SLIST_FOR_EACH_NODE_SAFE(&timeslot_list, node, tmp) {
-		ret++;
+static struct timeslot_request *order_get(size_t pos)
+{
+	return &entries[order[(order_head + pos) % TIMESLOT_QUEUE_LENGTH]];
+}
+
+static void queue_init(void)
+{
+	static bool initialized;
+
+	if (initialized) {
+		return;
+	}
+
+	for (size_t i = 0; i < TIMESLOT_QUEUE_LENGTH; i++) {
+		free_list[i] = i;
 	}
+	free_cnt = TIMESLOT_QUEUE_LENGTH;
+	initialized = true;
+}
+
+static size_t peer_hash(const bt_addr_le_t *addr)
+{
+	uint32_t hash = addr->type;
 
-	return ret;
+	for (size_t i = 0; i < sizeof(addr->a.val); i++) {
+		hash = (hash * 31) + addr->a.val[i];
+	}
+
+	return hash % TIMESLOT_QUEUE_PEERS_MAX;
 }
 
-static bool is_request_exist(struct dm_request *req)
+static struct peer_entry *peer_find(const bt_addr_le_t *addr)
 {
-	uint8_t cnt = 0;
-	sys_snode_t *node, *tmp;
-	struct timeslot_entry *item;
+	size_t idx = peer_hash(addr);
+
+	for (size_t i = 0; i < TIMESLOT_QUEUE_PEERS_MAX; i++) {
+		struct peer_entry *peer = &peers[idx];
 
-	SYS_SLIST_FOR_EACH_NODE_SAFE(&timeslot_list, node, tmp) {
-		item = CONTAINER_OF(node, struct timeslot_entry, node);
-		if (bt_addr_le_cmp(&item->timeslot_req.dm_req.bt_addr, &req->bt_addr) == 0) {
-			cnt++;
+		if (!peer->used) {
+			return NULL;
 		}
+
+		if (bt_addr_le_cmp(&peer->bt_addr, addr) == 0) {
+			return peer;
+		}
+
+		idx = (idx + 1) % TIMESLOT_QUEUE_PEERS_MAX;
+	}
+
+	return NULL;
+}
+
+static struct peer_entry *peer_get(const bt_addr_le_t *addr)
+{
+	size_t idx = peer_hash(addr);
+	struct peer_entry *reusable = NULL;
+
+	for (size_t i = 0; i < TIMESLOT_QUEUE_PEERS_MAX; i++) {
+		struct peer_entry *peer = &peers[idx];
+
+		if (!peer->used) {
+			if (!reusable) {
+				reusable = peer;
+			}
+			break;
+		}
+
+		if (bt_addr_le_cmp(&peer->bt_addr, addr) == 0) {
+			return peer;
+		}
+
+		if (!reusable && (peer->queued == 0)) {
+			reusable = peer;
+		}
+
+		idx = (idx + 1) % TIMESLOT_QUEUE_PEERS_MAX;
 	}
 
-	return cnt >= TIMESLOT_QUEUE_COUNT_SAME_PEER;
+	if (!reusable) {
+		return NULL;
+	}
+
+	/* Peers without scheduled timeslots are replaced, so their statistics are lost. */
+	memset(reusable, 0, sizeof(*reusable));
+	bt_addr_le_copy(&reusable->bt_addr, addr);
+	reusable->used = true;
+
+	return reusable;
+}
+
+static size_t peer_limit(const struct peer_entry *peer)
+{
+	/* Share the queue fairly between the peers that have timeslots scheduled. */
+	size_t peer_cnt = active_peers + ((peer->queued == 0) ? 1 : 0);
+	size_t fair_share = DIV_ROUND_UP(TIMESLOT_QUEUE_LENGTH, peer_cnt);
+
+	return MIN(fair_share, TIMESLOT_QUEUE_COUNT_SAME_PEER);
+}
+
+/* Returns the position in the schedule the timeslot should be inserted at. */
+static size_t schedule_pos_find(uint32_t start_time)
+{
+	size_t low = 0;
+	size_t high = order_cnt;
+
+	while (low < high) {
+		size_t mid = low + (high - low) / 2;
+
+		if (time_before(start_time, order_get(mid)->start_time)) {
+			high = mid;
+		} else {
+			low = mid + 1;
+		}
+	}
+
+	return low;
+}
+
+static bool is_busy(uint32_t now, uint32_t start_time)
+{
+	if (!busy_valid) {
+		return false;
+	}
+
+	/* Forget the taken timeslot once it is over, as its end time would be compared
+	 * incorrectly after the counter wraps around.
+	 */
+	if (time_distance_get(busy_from, now) >= time_distance_get(busy_from, busy_until)) {
+		busy_valid = false;
+		return false;
+	}
+
+	return time_before(start_time, busy_until);
+}
+
+static bool schedule_fits(size_t pos, uint32_t now, uint32_t start_time,
+			  uint32_t timeslot_len_us)
+{
+	uint32_t end = time_add(start_time, US_TO_RTC_TICKS(timeslot_len_us +
+							    MIN_TIME_BETWEEN_TIMESLOTS_US));
+
+	if (is_busy(now, start_time)) {
+		return false;
+	}
+
+	if ((pos > 0) && time_before(start_time, timeslot_end(order_get(pos - 1)))) {
+		return false;
+	}
+
+	if ((pos < order_cnt) && time_before(order_get(pos)->start_time, end)) {
+		return false;
+	}
+
+	return true;
+}
+
+static void schedule_insert(size_t pos, uint8_t entry_idx)
+{
+	/* Shift the shorter side of the ring to make room for the new entry. */
+	if (pos < (order_cnt - pos)) {
+		order_head = (order_head + TIMESLOT_QUEUE_LENGTH - 1) % TIMESLOT_QUEUE_LENGTH;
+		for (size_t i = 0; i < pos; i++) {
+			order[(order_head + i) % TIMESLOT_QUEUE_LENGTH] =
+				order[(order_head + i + 1) % TIMESLOT_QUEUE_LENGTH];
+		}
+	} else {
+		for (size_t i = order_cnt; i > pos; i--) {
+			order[(order_head + i) % TIMESLOT_QUEUE_LENGTH] =
+				order[(order_head + i - 1) % TIMESLOT_QUEUE_LENGTH];
+		}
+	}
+
+	order[(order_head + pos) % TIMESLOT_QUEUE_LENGTH] = entry_idx;
+	order_cnt++;
 }
 
 int timeslot_queue_append(struct dm_request *req, uint32_t start_ref_tick,
@@ -67,86 +263,146 @@ int timeslot_queue_append(struct dm_request *req, uint32_t start_ref_tick,
 {
 	uint32_t start_time;
 	uint32_t delay;
-	size_t list_size;
-	struct timeslot_entry *last, *item;
+	struct peer_entry *peer;
+	struct timeslot_request *item;
+	uint8_t entry_idx;
+	size_t pos;
+	int err = 0;
 
 	delay = req->start_delay_us + RANGING_OFFSET_US;
-	start_time = (start_ref_tick + US_TO_RTC_TICKS(delay)) % RTC_COUNTER_MAX;
+	start_time = time_add(start_ref_tick, US_TO_RTC_TICKS(delay));
 
-	list_size = get_list_size();
-	if (list_size >= TIMESLOT_QUEUE_LENGTH) {
-		return -ENOMEM;
-	}
+	queue_lock();
+	queue_init();
 
-	if (list_size != 0) {
-		if (is_request_exist(req)) {
-			return -EAGAIN;
-		}
+	/* Do not take over a peer slot for a request that cannot be queued anyway. */
+	peer = (free_cnt > 0) ? peer_get(&req->bt_addr) : peer_find(&req->bt_addr);
 
-		/* Check that the new timeslot does not overlap with a previous one.
-		 * Timeslots are added with a fixed distance from "now" and are therefore
-		 * always appended to the end of the queue. This means that we only
-		 * need to check that the start of the new timeslot does not fall into
-		 * the last timeslot in the queue.
-		 */
-		list_lock();
-		last = SYS_SLIST_PEEK_TAIL_CONTAINER(&timeslot_list, last, node);
-		list_unlock();
-
-		if (start_time < last->timeslot_req.start_time +
-					 US_TO_RTC_TICKS(last->timeslot_req.timeslot_length_us +
-							 MIN_TIME_BETWEEN_TIMESLOTS_US)) {
-			return -EBUSY;
+	if ((free_cnt == 0) || !peer) {
+		stats.rejected_full++;
+		if (peer) {
+			peer->stats.rejected++;
 		}
+		err = -ENOMEM;
+		goto out;
+	}
+
+	if (peer->queued >= peer_limit(peer)) {
+		stats.rejected_peer_limit++;
+		peer->stats.rejected++;
+		err = -EAGAIN;
+		goto out;
 	}
 
-	item = k_heap_alloc(&heap, sizeof(struct timeslot_entry), K_NO_WAIT);
-	if (!item) {
-		return -ENOMEM;
+	/* Timeslots are placed in any gap of the schedule that is large enough. */
+	pos = schedule_pos_find(start_time);
+	if (!schedule_fits(pos, start_ref_tick, start_time, timeslot_len_us)) {
+		stats.rejected_busy++;
+		peer->stats.rejected++;
+		err = -EBUSY;
+		goto out;
 	}
 
-	item->timeslot_req.start_time = start_time;
-	item->timeslot_req.timeslot_length_us = timeslot_len_us;
-	item->timeslot_req.window_length_us = window_len_us;
+	entry_idx = free_list[--free_cnt];
+	item = &entries[entry_idx];
+	entry_peer[entry_idx] = peer - peers;
+
+	item->start_time = start_time;
+	item->timeslot_length_us = timeslot_len_us;
+	item->window_length_us = window_len_us;
 	req->rng_seed++;
 
-	memcpy(&item->timeslot_req.dm_req, req, sizeof(item->timeslot_req.dm_req));
+	memcpy(&item->dm_req, req, sizeof(item->dm_req));
 
-	list_lock();
-	sys_slist_append(&timeslot_list, &item->node);
-	list_unlock();
+	if (pos < order_cnt) {
+		stats.gap_inserts++;
+	}
+	schedule_insert(pos, entry_idx);
 
-	return 0;
+	if (peer->queued == 0) {
+		active_peers++;
+	}
+	peer->queued++;
+	peer->stats.scheduled++;
+	stats.scheduled++;
+	stats.max_depth = MAX(stats.max_depth, order_cnt);
+
+out:
+	queue_unlock();
+
+	return err;
 }
 
-struct timeslot_request *timeslot_queue_peek(void)
+int timeslot_queue_pop(struct timeslot_request *req)
 {
-	struct timeslot_entry *item;
+	uint8_t entry_idx;
+	struct peer_entry *peer;
 
-	list_lock();
-	item = SYS_SLIST_PEEK_HEAD_CONTAINER(&timeslot_list, item, node);
-	list_unlock();
+	queue_lock();
 
-	if (!item) {
-		return NULL;
+	if (order_cnt == 0) {
+		queue_unlock();
+		return -ENOENT;
+	}
+
+	entry_idx = order[order_head];
+	order_head = (order_head + 1) % TIMESLOT_QUEUE_LENGTH;
+	order_cnt--;
+
+	memcpy(req, &entries[entry_idx], sizeof(*req));
+	free_list[free_cnt++] = entry_idx;
+
+	peer = &peers[entry_peer[entry_idx]];
+	__ASSERT_NO_MSG(peer->queued > 0);
+	peer->queued--;
+	if (peer->queued == 0) {
+		active_peers--;
 	}
+	peer->stats.started++;
+
+	busy_from = time_now();
+	busy_until = timeslot_end(req);
+	busy_valid = true;
 
-	return &item->timeslot_req;
+	queue_unlock();
+
+	return 0;
 }
 
-void timeslot_queue_remove_first(void)
+size_t timeslot_queue_count(void)
 {
-	sys_snode_t *node;
-	struct timeslot_entry *item;
+	size_t cnt;
 
-	list_lock();
-	node = sys_slist_get(&timeslot_list);
-	list_unlock();
+	queue_lock();
+	cnt = order_cnt;
+	queue_unlock();
 
-	if (!node) {
-		return;
+	return cnt;
+}
+
+void timeslot_queue_stats_get(struct timeslot_queue_stats *out)
+{
+	queue_lock();
+	memcpy(out, &stats, sizeof(*out));
+	queue_unlock();
+}
+
+int timeslot_queue_peer_stats_get(const bt_addr_le_t *addr,
+				  struct timeslot_queue_peer_stats *out)
+{
+	struct peer_entry *peer;
+	int err = 0;
+
+	queue_lock();
+
+	peer = peer_find(addr);
+	if (peer) {
+		memcpy(out, &peer->stats, sizeof(*out));
+	} else {
+		err = -ENOENT;
 	}
 
-	item = CONTAINER_OF(node, struct timeslot_entry, node);
-	k_heap_free(&heap, item);
+	queue_unlock();
+
+	return err;
 }
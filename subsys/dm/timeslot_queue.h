@@ -29,33 +29,92 @@ struct timeslot_request {
 	uint32_t window_length_us;
 };
 
-/** @brief Append an element to the end of a queue.
+/** @brief Timeslot queue statistics */
+struct timeslot_queue_stats {
+	/* Number of scheduled timeslots */
+	uint32_t scheduled;
+
+	/* Number of timeslots placed in a gap between already scheduled ones */
+	uint32_t gap_inserts;
+
+	/* Number of requests rejected because the queue was full */
+	uint32_t rejected_full;
+
+	/* Number of requests rejected because of the per-peer limit */
+	uint32_t rejected_peer_limit;
+
+	/* Number of requests rejected because of time restrictions */
+	uint32_t rejected_busy;
+
+	/* Maximum number of timeslots in the queue */
+	uint32_t max_depth;
+};
+
+/** @brief Timeslot queue statistics of a single peer */
+struct timeslot_queue_peer_stats {
+	/* Number of scheduled timeslots */
+	uint32_t scheduled;
+
+	/* Number of timeslots taken from the queue */
+	uint32_t started;
+
+	/* Number of rejected requests */
+	uint32_t rejected;
+};
+
+/** @brief Add a timeslot to the queue.
+ *
+ *  The timeslot is placed in the schedule according to its start time. It can be placed
+ *  between already scheduled timeslots if the gap between them is large enough.
+ *  The number of timeslots of a single peer is limited to its fair share of the queue
+ *  among the peers with scheduled timeslots, but no more than
+ *  CONFIG_DM_TIMESLOT_QUEUE_COUNT_SAME_PEER.
  *
  *  @param req Address of the structure with request parameters.
  *  @param start_ref_tick Reference start time tick.
  *  @param window_len Ranging window length.
  *  @param timeslot_len Timeslot length.
  *
- *  @retval -ENOMEM when the tiemslot queue is full or a memory allocation error.
+ *  @retval -ENOMEM when the tiemslot queue is full or too many peers are tracked.
  *  @retval -EAGAIN when a single peer has a maximum number of timeslots scheduled.
  *  @retval -EBUSY when the timeslot cannot be scheduled due to time restrictions.
  */
 int timeslot_queue_append(struct dm_request *req, uint32_t start_ref_tick,
 			  uint32_t window_len, uint32_t timeslot_len);
 
-/** @brief Peek element at the head of queue.
+/** @brief Take the earliest timeslot from the queue.
+ *
+ *  Timeslots starting before the end of the taken timeslot are not accepted afterwards.
+ *
+ *  @param req Address of the structure the timeslot is copied to.
+ *
+ *  @retval 0 if the timeslot was taken.
+ *  @retval -ENOENT if the queue is empty.
+ */
+int timeslot_queue_pop(struct timeslot_request *req);
+
+/** @brief Get the number of timeslots in the queue.
  *
- *  @param None
+ *  @retval Number of scheduled timeslots.
+ */
+size_t timeslot_queue_count(void);
+
+/** @brief Get the timeslot queue statistics.
  *
- *  @retval Head element, or NULL if queue is empty.
+ *  @param stats Address of the structure the statistics are copied to.
  */
-struct timeslot_request *timeslot_queue_peek(void);
+void timeslot_queue_stats_get(struct timeslot_queue_stats *stats);
 
-/** @brief Remove the first item from the timeslot queue.
+/** @brief Get the timeslot queue statistics of a peer.
+ *
+ *  @param addr Bluetooth LE address of the peer.
+ *  @param stats Address of the structure the statistics are copied to.
  *
- *  @param None
+ *  @retval 0 if the statistics were copied.
+ *  @retval -ENOENT if the peer is not tracked.
  */
-void timeslot_queue_remove_first(void);
+int timeslot_queue_peer_stats_get(const bt_addr_le_t *addr,
+				  struct timeslot_queue_peer_stats *stats);
 
 #ifdef __cplusplus
 }
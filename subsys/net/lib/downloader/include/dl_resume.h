@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef DL_RESUME_H
+#define DL_RESUME_H
+
+#include <net/downloader.h>
+
+#if defined(CONFIG_DOWNLOADER_RESUME)
+
+#include <ocrypto_sha256.h>
+
+/* Layout version of the resume record, increment when the record changes */
+#define DL_RESUME_RECORD_VERSION 1
+
+/* Resume record, as stored in the settings */
+struct dl_resume_record {
+	/* Layout version */
+	uint8_t version;
+	/* Length of the validator, zero if the server did not provide one */
+	uint8_t validator_len;
+	/* Truncated SHA-256 hash of the URL */
+	uint8_t url_hash[8];
+	/* Number of bytes accepted by the application */
+	uint32_t offset;
+	/* Number of bytes hashed into the SHA-256 state */
+	uint32_t hashed;
+	/* ETag or Last-Modified value for HTTP, ETag option for CoAP */
+	uint8_t validator[CONFIG_DOWNLOADER_RESUME_VALIDATOR_SIZE];
+	/* SHA-256 state of the bytes accepted by the application */
+	ocrypto_sha256_ctx sha;
+};
+
+/* Resume state of a downloader instance, stored in dl->resume_internal */
+struct dl_resume_state {
+	/* Record of the current download */
+	struct dl_resume_record rec;
+	/* Offset of the last saved checkpoint */
+	size_t saved;
+	/* SHA-256 digest of the file, once the download is complete */
+	uint8_t digest[ocrypto_sha256_BYTES];
+	/* The digest is valid */
+	bool digest_valid;
+};
+
+/* Restore the progress of the download from the resume store, if the URL matches */
+void dl_resume_start(struct downloader *dl, const char *url);
+/* Hash the data accepted by the application, and save a checkpoint when due */
+void dl_resume_data(struct downloader *dl, const void *data, size_t len);
+/* Save a checkpoint, the download is stopped before completion */
+void dl_resume_save(struct downloader *dl);
+/* Finalize the digest and remove the record, the download is complete */
+void dl_resume_done(struct downloader *dl);
+/* Restart the download from the beginning, the file has changed on the server */
+void dl_resume_reset(struct downloader *dl);
+/* Validator of the file, NULL if the download is not resumable or the validator is unknown */
+const uint8_t *dl_resume_validator_get(struct downloader *dl, size_t *len);
+void dl_resume_validator_set(struct downloader *dl, const void *validator, size_t len);
+
+#else
+
+static inline void dl_resume_start(struct downloader *dl, const char *url) {}
+static inline void dl_resume_data(struct downloader *dl, const void *data, size_t len) {}
+static inline void dl_resume_save(struct downloader *dl) {}
+static inline void dl_resume_done(struct downloader *dl) {}
+static inline void dl_resume_reset(struct downloader *dl) {}
+static inline const uint8_t *dl_resume_validator_get(struct downloader *dl, size_t *len)
+{
+	return NULL;
+}
+static inline void dl_resume_validator_set(struct downloader *dl, const void *validator,
+					   size_t len) {}
+
+#endif /* CONFIG_DOWNLOADER_RESUME */
+
+#endif /* DL_RESUME_H */
@@ -0,0 +1,328 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/settings/settings.h>
+#include <ocrypto_sha256.h>
+#include <net/downloader.h>
+
+#include "dl_resume.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_DECLARE(downloader, CONFIG_DOWNLOADER_LOG_LEVEL);
+
+#define RESUME_SETTINGS_KEY  "downloader/resume"
+#define RESUME_DEFAULT_NAME  "default"
+
+BUILD_ASSERT(CONFIG_DOWNLOADER_RESUME_STATE_SIZE >= sizeof(struct dl_resume_state),
+	     "CONFIG_DOWNLOADER_RESUME_STATE_SIZE is too small");
+
+static struct dl_resume_state *state_get(struct downloader *dl)
+{
+	return (struct dl_resume_state *)dl->resume_internal;
+}
+
+static const char *name_get(struct downloader *dl)
+{
+	return dl->cfg.resume_name ? dl->cfg.resume_name : RESUME_DEFAULT_NAME;
+}
+
+struct record_load_param {
+	const char *name;
+	struct dl_resume_record *rec;
+};
+
+static int record_load_cb(const char *key, size_t len, settings_read_cb read_cb, void *cb_arg,
+			  void *param)
+{
+	struct record_load_param *p = param;
+
+	if (!key || strcmp(key, p->name) != 0) {
+		return 0;
+	}
+
+	/* Ignore records written with another layout */
+	if (len != sizeof(*p->rec) || read_cb(cb_arg, p->rec, len) != len ||
+	    p->rec->version != DL_RESUME_RECORD_VERSION) {
+		LOG_WRN("Discarding invalid resume record");
+		memset(p->rec, 0, sizeof(*p->rec));
+	}
+
+	return 0;
+}
+
+/* Load the record of the instance stored for the URL */
+static int record_load(struct downloader *dl, const char *url, struct dl_resume_record *rec)
+{
+	int err;
+	uint8_t hash[ocrypto_sha256_BYTES];
+	struct record_load_param param = {
+		.name = name_get(dl),
+		.rec = rec,
+	};
+
+	err = settings_subsys_init();
+	if (err) {
+		LOG_ERR("Failed to initialize settings, err %d", err);
+		return err;
+	}
+
+	memset(rec, 0, sizeof(*rec));
+	err = settings_load_subtree_direct(RESUME_SETTINGS_KEY, record_load_cb, &param);
+	if (err) {
+		LOG_ERR("Failed to load resume record, err %d", err);
+		return err;
+	}
+
+	ocrypto_sha256(hash, (const uint8_t *)url, strlen(url));
+	if (rec->offset == 0 || memcmp(rec->url_hash, hash, sizeof(rec->url_hash)) != 0) {
+		goto discard;
+	}
+
+	/* The SHA-256 state must cover exactly the bytes before the offset */
+	if (rec->hashed != rec->offset) {
+		LOG_WRN("Resume record hashed %u bytes, offset %u, restarting download",
+			rec->hashed, rec->offset);
+		goto discard;
+	}
+
+	return 0;
+
+discard:
+	memset(rec, 0, sizeof(*rec));
+	rec->version = DL_RESUME_RECORD_VERSION;
+	memcpy(rec->url_hash, hash, sizeof(rec->url_hash));
+	return -ENOENT;
+}
+
+static int record_key_get(struct downloader *dl, char *key, size_t len)
+{
+	int ret;
+
+	ret = snprintf(key, len, RESUME_SETTINGS_KEY "/%s", name_get(dl));
+	if (ret < 0 || ret >= len) {
+		LOG_ERR("Resume record name too long");
+		return -ENAMETOOLONG;
+	}
+
+	return 0;
+}
+
+static int record_delete(struct downloader *dl)
+{
+	int err;
+	char key[SETTINGS_MAX_NAME_LEN + 1];
+
+	err = record_key_get(dl, key, sizeof(key));
+	if (err) {
+		return err;
+	}
+
+	return settings_delete(key);
+}
+
+static void record_save(struct downloader *dl)
+{
+	int err;
+	char key[SETTINGS_MAX_NAME_LEN + 1];
+	struct dl_resume_state *resume = state_get(dl);
+
+	if (resume->saved == resume->rec.offset) {
+		return;
+	}
+
+	err = record_key_get(dl, key, sizeof(key));
+	if (err) {
+		return;
+	}
+
+	err = settings_save_one(key, &resume->rec, sizeof(resume->rec));
+	if (err) {
+		LOG_ERR("Failed to save resume record, err %d", err);
+		return;
+	}
+
+	resume->saved = resume->rec.offset;
+	LOG_DBG("Resume checkpoint at %u", resume->rec.offset);
+}
+
+void dl_resume_start(struct downloader *dl, const char *url)
+{
+	int err;
+	struct dl_resume_state *resume = state_get(dl);
+
+	resume->digest_valid = false;
+
+	if (!dl->host_cfg.resume) {
+		return;
+	}
+
+	err = record_load(dl, url, &resume->rec);
+	if (err) {
+		/* No progress to resume, start from the beginning */
+		ocrypto_sha256_init(&resume->rec.sha);
+		resume->saved = 0;
+		dl->progress = 0;
+		return;
+	}
+
+	LOG_INF("Resuming download from offset %u", resume->rec.offset);
+	resume->saved = resume->rec.offset;
+	dl->progress = resume->rec.offset;
+}
+
+void dl_resume_data(struct downloader *dl, const void *data, size_t len)
+{
+	struct dl_resume_state *resume = state_get(dl);
+
+	if (!dl->host_cfg.resume) {
+		return;
+	}
+
+	ocrypto_sha256_update(&resume->rec.sha, data, len);
+	resume->rec.hashed += len;
+	resume->rec.offset = dl->progress;
+
+	if (resume->rec.offset - resume->saved >= CONFIG_DOWNLOADER_RESUME_CHECKPOINT_SIZE) {
+		record_save(dl);
+	}
+}
+
+void dl_resume_save(struct downloader *dl)
+{
+	if (!dl->host_cfg.resume || dl->complete) {
+		return;
+	}
+
+	record_save(dl);
+}
+
+void dl_resume_done(struct downloader *dl)
+{
+	int err;
+	struct dl_resume_state *resume = state_get(dl);
+
+	if (!dl->host_cfg.resume) {
+		return;
+	}
+
+	ocrypto_sha256_final(&resume->rec.sha, resume->digest);
+	resume->digest_valid = true;
+
+	err = record_delete(dl);
+	if (err) {
+		LOG_ERR("Failed to delete resume record, err %d", err);
+	}
+}
+
+void dl_resume_reset(struct downloader *dl)
+{
+	int err;
+	struct dl_resume_state *resume = state_get(dl);
+
+	if (!dl->host_cfg.resume) {
+		return;
+	}
+
+	LOG_WRN("File has changed on the server, restarting download");
+
+	resume->rec.offset = 0;
+	resume->rec.hashed = 0;
+	resume->rec.validator_len = 0;
+	ocrypto_sha256_init(&resume->rec.sha);
+	resume->saved = 0;
+	dl->progress = 0;
+	dl->file_size = 0;
+
+	err = record_delete(dl);
+	if (err) {
+		LOG_ERR("Failed to delete resume record, err %d", err);
+	}
+}
+
+const uint8_t *dl_resume_validator_get(struct downloader *dl, size_t *len)
+{
+	struct dl_resume_state *resume = state_get(dl);
+
+	if (!dl->host_cfg.resume || !resume->rec.validator_len) {
+		return NULL;
+	}
+
+	*len = resume->rec.validator_len;
+	return resume->rec.validator;
+}
+
+void dl_resume_validator_set(struct downloader *dl, const void *validator, size_t len)
+{
+	struct dl_resume_state *resume = state_get(dl);
+
+	if (!dl->host_cfg.resume) {
+		return;
+	}
+
+	if (len > sizeof(resume->rec.validator)) {
+		LOG_WRN("Validator too long (%zu), changes to the file will not be detected", len);
+		resume->rec.validator_len = 0;
+		return;
+	}
+
+	memcpy(resume->rec.validator, validator, len);
+	resume->rec.validator_len = len;
+}
+
+int downloader_resume_offset_get(struct downloader *dl, const char *url, size_t *offset)
+{
+	int err;
+	struct dl_resume_record rec;
+
+	if (!dl || !url || !offset) {
+		return -EINVAL;
+	}
+
+	err = record_load(dl, url, &rec);
+	if (err) {
+		return err;
+	}
+
+	*offset = rec.offset;
+	return 0;
+}
+
+int downloader_resume_clear(struct downloader *dl)
+{
+	int err;
+
+	if (!dl) {
+		return -EINVAL;
+	}
+
+	err = settings_subsys_init();
+	if (err) {
+		return err;
+	}
+
+	return record_delete(dl);
+}
+
+int downloader_resume_sha256_get(struct downloader *dl, uint8_t digest[32])
+{
+	struct dl_resume_state *resume;
+
+	if (!dl || !digest) {
+		return -EINVAL;
+	}
+
+	resume = state_get(dl);
+	if (!resume->digest_valid) {
+		return -ENODATA;
+	}
+
+	memcpy(digest, resume->digest, sizeof(resume->digest));
+	return 0;
+}
@@ -13,6 +13,7 @@
 #include <net/downloader_transport.h>
 
 #include "dl_parse.h"
+#include "dl_resume.h"
 #include "dl_socket.h"
 
 #include <zephyr/logging/log.h>
@@ -201,6 +202,8 @@ static int stopped_evt_send(struct downloader *dl)
 		.id = DOWNLOADER_EVT_STOPPED,
 	};
 
+	dl_resume_save(dl);
+
 	return dl->cfg.callback(&evt);
 }
 
@@ -241,8 +244,11 @@ int dl_transport_evt_data(struct downloader *dl, void *data, size_t len)
 	if (err) {
 		/* Application refused data, suspend */
 		restart_and_suspend(dl);
+		return 0;
 	}
 
+	dl_resume_data(dl, data, len);
+
 	return 0;
 }
 
@@ -319,6 +325,7 @@ reconnect:
 
 			if (dl->complete) {
 				LOG_INF("Download complete");
+				dl_resume_done(dl);
 				restart_and_suspend(dl);
 				download_complete_evt_send(dl);
 			}
@@ -459,6 +466,8 @@ static int downloader_start(struct downloader *dl, const struct downloader_host_
 	dl->buf_offset = 0;
 	dl->complete = false;
 
+	dl_resume_start(dl, url);
+
 	if (dl->host_cfg.redirects_max == 0) {
 		dl->host_cfg.redirects_max = CONFIG_DOWNLOADER_MAX_REDIRECTS;
 	}
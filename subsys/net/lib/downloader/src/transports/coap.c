@@ -22,6 +22,7 @@
 #include <zephyr/sys/__assert.h>
 #include "dl_socket.h"
 #include "dl_parse.h"
+#include "dl_resume.h"
 
 LOG_MODULE_DECLARE(downloader, CONFIG_DOWNLOADER_LOG_LEVEL);
 
@@ -180,10 +181,11 @@ static int coap_block_update(struct downloader *dl, struct coap_packet *pkt, siz
 		return new_current;
 	}
 
-	if (new_current < coap->block_ctx.current) {
+	/* The block containing the current offset is requested when resuming a download */
+	if (new_current < coap->block_ctx.current - *blk_off) {
 		LOG_WRN("Block out of order %d, expected %d", new_current, coap->block_ctx.current);
 		return -1;
-	} else if (new_current > coap->block_ctx.current) {
+	} else if (new_current > coap->block_ctx.current - *blk_off) {
 		LOG_WRN("Block out of order %d, expected %d", new_current, coap->block_ctx.current);
 		return -1;
 	}
@@ -206,6 +208,39 @@ static int coap_block_update(struct downloader *dl, struct coap_packet *pkt, siz
 	return 0;
 }
 
+/* Compare the ETag of the block with the one of the blocks received before,
+ * possibly before a restart, to detect that the file has changed on the server.
+ */
+static int coap_etag_check(struct downloader *dl, const struct coap_packet *pkt)
+{
+	int ret;
+	size_t stored_len;
+	const uint8_t *stored;
+	struct coap_option etag;
+
+	if (!IS_ENABLED(CONFIG_DOWNLOADER_RESUME) || !dl->host_cfg.resume) {
+		return 0;
+	}
+
+	ret = coap_find_options(pkt, COAP_OPTION_ETAG, &etag, 1);
+	if (ret <= 0) {
+		return 0;
+	}
+
+	stored = dl_resume_validator_get(dl, &stored_len);
+	if (!stored) {
+		dl_resume_validator_set(dl, etag.value, etag.len);
+		return 0;
+	}
+
+	if (stored_len != etag.len || memcmp(stored, etag.value, etag.len) != 0) {
+		dl_resume_reset(dl);
+		return -ESTALE;
+	}
+
+	return 0;
+}
+
 static int coap_parse(struct downloader *dl, size_t len)
 {
 	int err;
@@ -247,6 +282,11 @@ static int coap_parse(struct downloader *dl, size_t len)
 		return -EBADMSG;
 	}
 
+	err = coap_etag_check(dl, &response);
+	if (err) {
+		return err;
+	}
+
 	err = coap_block_update(dl, &response, &blk_off, &more);
 	if (err) {
 		return -EBADMSG;
@@ -258,6 +298,17 @@ static int coap_parse(struct downloader *dl, size_t len)
 		return -EBADMSG;
 	}
 
+	if (blk_off) {
+		if (blk_off >= payload_len) {
+			LOG_WRN("CoAP payload ends before offset %d", blk_off);
+			return -EBADMSG;
+		}
+
+		/* Skip the part of the block that is already downloaded */
+		payload += blk_off;
+		payload_len -= blk_off;
+	}
+
 	/* Accumulate buffer offset */
 	dl->progress += payload_len;
 	dl->buf_offset = 0;
@@ -561,6 +612,10 @@ static int dl_coap_download(struct downloader *dl)
 	}
 
 	ret = coap_parse(dl, len);
+	if (ret == -ESTALE) {
+		/* Reconnect to download the file from the beginning */
+		return ret;
+	}
 	if (ret < 0) {
 		/* Request data again */
 		coap->retransmission_req = true;
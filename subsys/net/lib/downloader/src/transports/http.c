@@ -16,6 +16,7 @@
 #include <net/downloader_transport_http.h>
 #include "dl_socket.h"
 #include "dl_parse.h"
+#include "dl_resume.h"
 
 LOG_MODULE_DECLARE(downloader, CONFIG_DOWNLOADER_LOG_LEVEL);
 
@@ -47,23 +48,30 @@ LOG_MODULE_DECLARE(downloader, CONFIG_DOWNLOADER_LOG_LEVEL);
 #define HTTP_GET                                                                                   \
 	"GET /%s HTTP/1.1\r\n"                                                                     \
 	"Host: %s\r\n"                                                                             \
-	"Connection: keep-alive\r\n"                                                               \
-	"\r\n"
+	"Connection: keep-alive\r\n"
 
 /* Request remaining bytes from offset; use with HTTP */
 #define HTTP_GET_OFFSET                                                                            \
 	"GET /%s HTTP/1.1\r\n"                                                                     \
 	"Host: %s\r\n"                                                                             \
 	"Range: bytes=%u-\r\n"                                                                     \
-	"Connection: keep-alive\r\n"                                                               \
-	"\r\n"
+	"Connection: keep-alive\r\n"
 
 /* Request a range of bytes; use with HTTPS due to modem limitations */
 #define HTTP_GET_RANGE                                                                             \
 	"GET /%s HTTP/1.1\r\n"                                                                     \
 	"Host: %s\r\n"                                                                             \
 	"Range: bytes=%u-%u\r\n"                                                                   \
-	"Connection: keep-alive\r\n"                                                               \
+	"Connection: keep-alive\r\n"
+
+/* End of request header */
+#define HTTP_HDR_END "\r\n"
+
+/* End of request header when resuming a download, the server sends the whole file
+ * instead of the range if the validator does not match anymore.
+ */
+#define HTTP_HDR_END_IF_RANGE                                                                      \
+	"If-Range: %.*s\r\n"                                                                       \
 	"\r\n"
 
 struct transport_params_http {
@@ -73,6 +81,8 @@ struct transport_params_http {
 	bool connection_close;
 	/** Is using ranged query. */
 	bool ranged;
+	/** Requests carry an If-Range header. */
+	bool if_range;
 	/** Ranged progress */
 	size_t ranged_progress;
 	/** HTTP header */
@@ -102,6 +112,12 @@ struct transport_params_http {
 
 	/** Request new data */
 	bool new_data_req;
+	/** Offset of the first byte not requested yet */
+	size_t req_offset;
+	/** Number of requests sent whose response has not been fully received */
+	uint8_t in_flight;
+	/** Bytes of the next response received together with the current one */
+	size_t pending;
 	/** Redirect retries */
 	uint8_t redirects;
 };
@@ -139,17 +155,46 @@ extern char *strnstr(const char *haystack, const char *needle, size_t haystack_s
 
 static int parse_protocol(struct downloader *dl, const char *url);
 
+static void http_response_reset(struct transport_params_http *http)
+{
+	http->header.has_end = false;
+	http->header.status_code = 0;
+	http->ranged_progress = 0;
+}
+
+static int http_hdr_end(struct downloader *dl, char *buf, size_t size, bool range)
+{
+	size_t validator_len;
+	const uint8_t *validator;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	validator = dl_resume_validator_get(dl, &validator_len);
+	http->if_range = range && validator;
+	if (http->if_range) {
+		return snprintf(buf, size, HTTP_HDR_END_IF_RANGE, (int)validator_len,
+				validator);
+	}
+
+	return snprintf(buf, size, HTTP_HDR_END);
+}
+
 static int http_get_request_send(struct downloader *dl)
 {
 	int err;
 	int len;
 	size_t off = 0;
+	size_t used;
+	char *req;
 	bool tls_force_range;
 	struct transport_params_http *http;
 
 	http = (struct transport_params_http *)dl->transport_internal;
 
-	http->header.has_end = false;
+	/* Received data that is not processed yet stays in front of the request */
+	used = dl->buf_offset + http->pending;
+	req = dl->cfg.buf + used;
 
 	/* nRF91 series has a limitation of decoding ~2k of data at once when using TLS */
 	tls_force_range = (http->sock.proto == IPPROTO_TLS_1_2 && !dl->host_cfg.set_native_tls &&
@@ -164,50 +209,167 @@ static int http_get_request_send(struct downloader *dl)
 	}
 
 	if (dl->host_cfg.range_override) {
-		off = dl->progress + dl->host_cfg.range_override - 1;
+		off = http->req_offset + dl->host_cfg.range_override - 1;
 
 		if (dl->file_size) {
 			/* Don't request bytes past the end of file */
 			off = MIN(off, dl->file_size - 1);
 		}
 
-		len = snprintf(dl->cfg.buf, dl->cfg.buf_size, HTTP_GET_RANGE, dl->file,
-			       dl->hostname, dl->progress, off);
+		len = snprintf(req, dl->cfg.buf_size - used, HTTP_GET_RANGE, dl->file,
+			       dl->hostname, http->req_offset, off);
 		http->ranged = true;
-		http->ranged_progress = 0;
 		LOG_DBG("Range request up to %d bytes", dl->host_cfg.range_override);
 		goto send;
 	} else if (dl->progress) {
-		len = snprintf(dl->cfg.buf, dl->cfg.buf_size, HTTP_GET_OFFSET, dl->file,
+		len = snprintf(req, dl->cfg.buf_size - used, HTTP_GET_OFFSET, dl->file,
 			       dl->hostname, dl->progress);
 		http->ranged = false;
 	} else {
-		len = snprintf(dl->cfg.buf, dl->cfg.buf_size, HTTP_GET, dl->file,
+		len = snprintf(req, dl->cfg.buf_size - used, HTTP_GET, dl->file,
 			       dl->hostname);
 		http->ranged = false;
 	}
 
 send:
-	if (len < 0 || len > dl->cfg.buf_size) {
-		LOG_ERR("Cannot create GET request, buffer too small");
+	if (len >= 0 && len < dl->cfg.buf_size - used) {
+		int end = http_hdr_end(dl, req + len, dl->cfg.buf_size - used - len,
+				       http->ranged || dl->progress);
+
+		len = end < 0 ? end : len + end;
+	}
+
+	if (len < 0 || len >= dl->cfg.buf_size - used) {
+		if (!used) {
+			LOG_ERR("Cannot create GET request, buffer too small");
+		}
 		return -ENOMEM;
 	}
 
 	if (IS_ENABLED(CONFIG_DOWNLOADER_LOG_HEADERS)) {
-		LOG_HEXDUMP_DBG(dl->cfg.buf, len, "HTTP request");
+		LOG_HEXDUMP_DBG(req, len, "HTTP request");
 	}
 
-	LOG_DBG("http request:\n%s", dl->cfg.buf);
+	LOG_DBG("http request:\n%s", req);
 
-	err = dl_socket_send(http->sock.fd, dl->cfg.buf, len);
+	err = dl_socket_send(http->sock.fd, req, len);
 	if (err) {
 		LOG_ERR("Failed to send HTTP request, errno %d", errno);
 		return err;
 	}
 
+	if (http->ranged) {
+		http->req_offset = off + 1;
+	}
+	http->in_flight++;
+
+	return 0;
+}
+
+/* Send range requests ahead on the connection until the pipeline is full.
+ * The first request is sent alone, as the file size is needed to avoid
+ * requesting bytes past the end of the file.
+ */
+static int http_requests_send(struct downloader *dl)
+{
+	int err;
+	uint8_t depth;
+	struct transport_params_http *http;
+
+	http = (struct transport_params_http *)dl->transport_internal;
+
+	if (http->new_data_req) {
+		if (!http->in_flight) {
+			dl->buf_offset = 0;
+			http->pending = 0;
+			http->req_offset = dl->progress;
+			http_response_reset(http);
+
+			err = http_get_request_send(dl);
+			if (err) {
+				return err;
+			}
+		}
+
+		http->new_data_req = false;
+	}
+
+	depth = http->cfg.pipeline_depth ? http->cfg.pipeline_depth :
+					   CONFIG_DOWNLOADER_TRANSPORT_HTTP_PIPELINE_DEPTH;
+
+	while (http->ranged && dl->file_size && http->req_offset < dl->file_size &&
+	       http->in_flight < depth) {
+		err = http_get_request_send(dl);
+		if (err == -ENOMEM) {
+			/* Not enough room next to the received data, retry later */
+			break;
+		} else if (err) {
+			return err;
+		}
+	}
+
 	return 0;
 }
 
+/* Returns the value of a complete header line, without surrounding spaces */
+static char *http_header_value(struct downloader *dl, const char *name, size_t parse_len,
+			       size_t *len)
+{
+	char *p;
+	char *q;
+
+	p = strnstr(dl->cfg.buf, name, parse_len);
+	if (!p) {
+		return NULL;
+	}
+
+	p += strlen(name);
+	q = strnstr(p, "\r\n", parse_len - (p - dl->cfg.buf));
+	if (!q) {
+		/* Missing end of line */
+		return NULL;
+	}
+
+	while (p < q && *p == ' ') {
+		p++;
+	}
+	while (q > p && *(q - 1) == ' ') {
+		q--;
+	}
+
+	*len = q - p;
+	return p;
+}
+
+/* Store the ETag of the file to resume the download, or the Last-Modified date
+ * if the server does not send a strong ETag.
+ */
+static void http_validator_parse(struct downloader *dl, size_t parse_len)
+{
+	char *p;
+	size_t len;
+	size_t stored_len;
+	const uint8_t *stored;
+
+	if (!IS_ENABLED(CONFIG_DOWNLOADER_RESUME) || !dl->host_cfg.resume) {
+		return;
+	}
+
+	p = http_header_value(dl, "\r\netag:", parse_len, &len);
+	if (p && *p == '"') {
+		dl_resume_validator_set(dl, p, len);
+		return;
+	}
+
+	p = http_header_value(dl, "\r\nlast-modified:", parse_len, &len);
+	if (p) {
+		stored = dl_resume_validator_get(dl, &stored_len);
+		if (!stored || *stored != '"') {
+			dl_resume_validator_set(dl, p, len);
+		}
+	}
+}
+
 /* Returns:
  * Number of bytes parsed on success.
  * Negative errno on error.
@@ -359,6 +521,8 @@ static int http_header_parse(struct downloader *dl, size_t buf_len)
 		http->connection_close = true;
 	}
 
+	http_validator_parse(dl, parse_len);
+
 	if (http->header.has_end) {
 		/* We have received the end of the header.
 		 * Verify that we have received everything that we need.
@@ -369,6 +533,12 @@ static int http_header_parse(struct downloader *dl, size_t buf_len)
 			return -EBADMSG;
 		}
 
+		if (http->if_range && http->header.status_code == HTTP_RESPONSE_OK) {
+			/* The validator does not match, the whole file is sent */
+			dl_resume_reset(dl);
+			return -ESTALE;
+		}
+
 		expected_status = (http->ranged || dl->progress) ? HTTP_RESPONSE_PARTIAL_CONTENT :
 								   HTTP_RESPONSE_OK;
 		if (http->header.status_code != expected_status) {
@@ -384,16 +554,16 @@ static int http_header_parse(struct downloader *dl, size_t buf_len)
 		return parse_len;
 	}
 
-	q = dl->cfg.buf + buf_len;
+	q = dl->cfg.buf + buf_len - 1;
 	/* We are still missing part of the header.
 	 * Return the lines (in number of bytes) that we have parsed.
 	 */
-	while (q > dl->cfg.buf && (*q != '\r') && (*q != '\n')) {
+	while (q > dl->cfg.buf && (*q != '\n')) {
 		q--;
 	}
 
 	/* Keep \r and \n in the buffer in case it is part of the header ending. */
-	while (*(q - 1) == '\r' || *(q - 1) == '\n') {
+	while (q > dl->cfg.buf && (*(q - 1) == '\r' || *(q - 1) == '\n')) {
 		q--;
 	}
 
@@ -430,7 +600,7 @@ static int http_parse(struct downloader *dl, size_t len)
 		if (parsed_len == len) {
 			dl->buf_offset = 0;
 			return 0;
-		} else if (parsed_len) {
+		} else {
 			/* Keep remaining payload */
 			len = len - parsed_len;
 			memmove(dl->cfg.buf, dl->cfg.buf + parsed_len, len);
@@ -566,6 +736,8 @@ static int dl_http_connect(struct downloader *dl)
 
 	http->connection_close = false;
 	http->new_data_req = true;
+	http->in_flight = 0;
+	http->pending = 0;
 
 	return err;
 }
@@ -590,30 +762,33 @@ static int dl_http_close(struct downloader *dl)
 static int dl_http_download(struct downloader *dl)
 {
 	int ret, recv_len, data_len, expected_len;
+	size_t remaining;
+	size_t excess = 0;
 	struct transport_params_http *http;
 
 	http = (struct transport_params_http *)dl->transport_internal;
 
-	if (http->new_data_req) {
-		/* Request next fragment */
-		dl->buf_offset = 0;
-		ret = http_get_request_send(dl);
-		if (ret) {
-			LOG_DBG("data_req failed, err %d", ret);
-			/** Attempt reconnection. */
-			return -ECONNRESET;
-		}
-
-		http->new_data_req = false;
+	/* Request next fragments */
+	ret = http_requests_send(dl);
+	if (ret) {
+		LOG_DBG("data_req failed, err %d", ret);
+		/** Attempt reconnection. */
+		return -ECONNRESET;
 	}
 
 	__ASSERT(dl->buf_offset < dl->cfg.buf_size, "Buffer overflow");
 
-	LOG_DBG("Receiving up to %d bytes at %p...", (dl->cfg.buf_size - dl->buf_offset),
-		(void *)(dl->cfg.buf + dl->buf_offset));
+	if (http->pending) {
+		/* Process the next response received together with the previous one */
+		recv_len = http->pending;
+		http->pending = 0;
+	} else {
+		LOG_DBG("Receiving up to %d bytes at %p...", (dl->cfg.buf_size - dl->buf_offset),
+			(void *)(dl->cfg.buf + dl->buf_offset));
 
-	recv_len = dl_socket_recv(http->sock.fd, dl->cfg.buf + dl->buf_offset,
-			     dl->cfg.buf_size - dl->buf_offset);
+		recv_len = dl_socket_recv(http->sock.fd, dl->cfg.buf + dl->buf_offset,
+					  dl->cfg.buf_size - dl->buf_offset);
+	}
 
 	if (recv_len < 0) {
 		if (recv_len == -EMSGSIZE && dl->host_cfg.range_override) {
@@ -641,7 +816,22 @@ static int dl_http_download(struct downloader *dl)
 		return data_len;
 	}
 
-	expected_len = MIN(MIN_SIZE_IDENTIFY_BUF, dl->file_size - dl->progress);
+	if (!http->header.has_end) {
+		/* Wait for rest of header, the file size may not be known yet */
+		return recv_len > 0 ? 0 : -ECONNRESET;
+	}
+
+	remaining = dl->file_size - dl->progress;
+	if (http->ranged) {
+		/* Pipelined responses follow each other, keep the data after the range */
+		remaining = MIN(remaining, dl->host_cfg.range_override - http->ranged_progress);
+		if (data_len > remaining) {
+			excess = data_len - remaining;
+			data_len = remaining;
+		}
+	}
+
+	expected_len = MIN(MIN_SIZE_IDENTIFY_BUF, remaining);
 
 	if (data_len < expected_len) {
 		/* Wait for more data after the HTTP headers,
@@ -657,10 +847,13 @@ static int dl_http_download(struct downloader *dl)
 	}
 	if (http->ranged) {
 		http->ranged_progress += data_len;
-		if (http->ranged_progress < dl->host_cfg.range_override) {
+		if (http->ranged_progress < dl->host_cfg.range_override &&
+		    dl->progress < dl->file_size) {
 			/* Ranged query: read until a full fragment is received */
 		} else {
 			/* Ranged query: request next fragment */
+			http->in_flight--;
+			http_response_reset(http);
 			http->new_data_req = true;
 		}
 	}
@@ -668,9 +861,16 @@ static int dl_http_download(struct downloader *dl)
 		/* A full file has been received */
 		dl->complete = true;
 		http->new_data_req = true;
+		http->in_flight = 0;
+		excess = 0;
 	}
 	dl->buf_offset = 0;
 
+	if (excess) {
+		memmove(dl->cfg.buf, dl->cfg.buf + data_len, excess);
+		http->pending = excess;
+	}
+
 	if (dl->complete) {
 		return 0;
 	}
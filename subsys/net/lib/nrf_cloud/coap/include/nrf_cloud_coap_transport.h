@@ -35,6 +35,8 @@ struct nrf_cloud_coap_client {
 };
 
 #define NRF_CLOUD_COAP_PROXY_RSC "proxy"
+#define NRF_CLOUD_COAP_D2C_RSC "msg/d2c"
+#define NRF_CLOUD_COAP_D2C_BULK_RSC NRF_CLOUD_COAP_D2C_RSC "/bulk"
 
 /**
  * @defgroup nrf_cloud_coap_transport nRF CoAP API
@@ -245,6 +247,39 @@ int nrf_cloud_coap_patch(const char *resource, const char *query,
 			 enum coap_content_format fmt, bool reliable,
 			 coap_client_response_cb_t cb, void *user);
 
+/**@brief Start a CoAP request without waiting for the response.
+ * The function returns as soon as the request has been sent. Up to
+ * CONFIG_NRF_CLOUD_COAP_ASYNC_REQUESTS_MAX asynchronous requests can be outstanding on the
+ * DTLS session at the same time, including while a blocking request is in progress.
+ * Each response is matched to its request by the CoAP token and passed to the callback
+ * given for that request. The callback is called from the CoAP client thread, once for each
+ * block received; the request has ended when last_block is true or the result code is an error.
+ * A negative result code means the request failed on the device side, for example
+ * -ETIMEDOUT when no response was received or -ECANCELED when the client disconnected.
+ * The Accept message option is included for GET and FETCH requests.
+ * @param method CoAP method of the request.
+ * @param resource String containing the specific CoAP endpoint to access.
+ * @param query Optional string containing REST-style query parameters.
+ * @param buf Optional pointer to buffer containing a payload to include with the request.
+ *            It must remain valid until the request has ended.
+ * @param len Length of payload or 0 if none.
+ * @param fmt_out CoAP content format for the Content-Format message option of the payload.
+ * @param fmt_in CoAP content format for the Accept message option of the returned payload.
+ * @param reliable True to use a Confirmable message, otherwise, a Non-confirmable message.
+ * @param cb Optional pointer to a callback function to receive the results.
+ * @param user Pointer to user-specific data to be passed back to the callback.
+ * @retval -EACCES Device does not have a valid nRF Cloud CoAP connection.
+ * @retval -ENOBUFS The maximum number of requests are already in progress.
+ * @retval -EAGAIN The CoAP client has no free request slot; try again later.
+ * @return 0 if the request was sent, otherwise a negative error number.
+ */
+int nrf_cloud_coap_async_request(enum coap_method method,
+				 const char *resource, const char *query,
+				 const uint8_t *buf, size_t len,
+				 enum coap_content_format fmt_out,
+				 enum coap_content_format fmt_in, bool reliable,
+				 coap_client_response_cb_t cb, void *user);
+
 /**
  * @brief Send binary log data to nRF Cloud on the /msg/d2c/bin topic. The data sent should
  * come from the nrf_cloud_log_backend. It will be assembled in sequential order and made
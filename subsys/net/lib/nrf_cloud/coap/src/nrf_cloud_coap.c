@@ -22,6 +22,7 @@
 #include <net/nrf_cloud_coap.h>
 #include "nrf_cloud_coap_transport.h"
 #include "nrf_cloud_codec_internal.h"
+#include "nrf_cloud_json_writer.h"
 #include "nrf_cloud_mem.h"
 #include "nrf_cloud_client_id.h"
 #include "coap_codec.h"
@@ -36,17 +37,15 @@ LOG_MODULE_REGISTER(nrf_cloud_coap, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
 #define COAP_SHDW_RSC "state"
 #define COAP_SHDW_REP_RSC "state/reported"
 #define COAP_SHDW_DES_RSC "state/desired"
-#define COAP_D2C_RSC "msg/d2c"
-#define COAP_D2C_BULK_RSC COAP_D2C_RSC "/bulk"
-#define COAP_D2C_RAW_RSC COAP_D2C_RSC "/raw"
-#define COAP_D2C_BIN_RSC COAP_D2C_RSC "/bin"
+#define COAP_D2C_RAW_RSC NRF_CLOUD_COAP_D2C_RSC "/raw"
+#define COAP_D2C_BIN_RSC NRF_CLOUD_COAP_D2C_RSC "/bin"
 
 #define MAX_COAP_PAYLOAD_SIZE (CONFIG_COAP_CLIENT_BLOCK_SIZE - \
 			       CONFIG_COAP_CLIENT_MESSAGE_HEADER_SIZE)
 
 /* Semaphore to guard CoAP client callback data/error codes for GET and FETCH operations.
  * A single semaphore is sufficient for all public functions since nrf_cloud_coap_transport
- * only allows one transfer at a time.
+ * only allows one blocking transfer at a time.
  */
 static K_SEM_DEFINE(coap_transfer_sem, 1, 1);
 
@@ -272,9 +271,10 @@ int nrf_cloud_coap_obj_send(struct nrf_cloud_obj *const obj, bool confirmable)
 		return -EINVAL;
 	}
 
-	/* Only support sending of the CoAP CBOR or JSON type or a pre-encoded CBOR buffer. */
+	/* Only support sending of the CoAP CBOR or JSON types or a pre-encoded CBOR buffer. */
 	if ((obj->type != NRF_CLOUD_OBJ_TYPE_COAP_CBOR) &&
 	    (obj->type != NRF_CLOUD_OBJ_TYPE_JSON) &&
+	    (obj->type != NRF_CLOUD_OBJ_TYPE_JSON_WRITER) &&
 	    (obj->enc_src != NRF_CLOUD_ENC_SRC_PRE_ENCODED)) {
 		return -ENOTSUP;
 	}
@@ -287,7 +287,7 @@ int nrf_cloud_coap_obj_send(struct nrf_cloud_obj *const obj, bool confirmable)
 
 	int err = 0;
 	bool enc = false;
-	const char *resource = bulk ? COAP_D2C_BULK_RSC : COAP_D2C_RSC;
+	const char *resource = bulk ? NRF_CLOUD_COAP_D2C_BULK_RSC : NRF_CLOUD_COAP_D2C_RSC;
 
 	if (!resource) {
 		return -EINVAL;
@@ -318,6 +318,92 @@ int nrf_cloud_coap_obj_send(struct nrf_cloud_obj *const obj, bool confirmable)
 	return err;
 }
 
+#if defined(CONFIG_NRF_CLOUD_COAP_SENSOR_BATCH)
+/* Non-confirmable sensor values are collected in a JSON array, which is sent to the
+ * bulk resource once the next value does not fit in a single CoAP block.
+ */
+static K_MUTEX_DEFINE(sensor_batch_mut);
+static char sensor_batch_buf[MAX_COAP_PAYLOAD_SIZE];
+static struct nrf_cloud_obj_json_writer sensor_batch = {
+	.buf = sensor_batch_buf,
+	.size = sizeof(sensor_batch_buf)
+};
+
+static int sensor_batch_value_add(const char *app_id, double value, int64_t ts)
+{
+	int err;
+
+	if (nrf_cloud_json_writer_is_empty(&sensor_batch)) {
+		err = nrf_cloud_json_writer_start(&sensor_batch, true);
+		if (err) {
+			return err;
+		}
+	}
+
+	return nrf_cloud_json_writer_data_msg_add(&sensor_batch, app_id, value, ts);
+}
+
+static int sensor_batch_send(void)
+{
+	int err;
+
+	if (nrf_cloud_json_writer_is_empty(&sensor_batch)) {
+		return 0;
+	}
+
+	(void)nrf_cloud_json_writer_finish(&sensor_batch);
+	err = nrf_cloud_coap_post(NRF_CLOUD_COAP_D2C_BULK_RSC, NULL,
+				  sensor_batch.buf, sensor_batch.len,
+				  COAP_CONTENT_FORMAT_APP_JSON, false, NULL, NULL);
+	nrf_cloud_json_writer_reset(&sensor_batch);
+	if (err < 0) {
+		LOG_ERR("Failed to send POST request: %d", err);
+	} else if (err > 0) {
+		LOG_RESULT_CODE_ERR("Error from server:", err);
+	}
+	return err;
+}
+
+static int sensor_batch_add(const char *app_id, double value, int64_t ts)
+{
+	int send_err;
+	int err;
+
+	k_mutex_lock(&sensor_batch_mut, K_FOREVER);
+	err = sensor_batch_value_add(app_id, value, ts);
+	if ((err == -ENOMEM) && !nrf_cloud_json_writer_is_empty(&sensor_batch)) {
+		LOG_DBG("Sending batch of sensor values, %zd bytes", sensor_batch.len);
+		send_err = sensor_batch_send();
+		/* The batch is emptied even if sending failed, so the value is still added */
+		err = sensor_batch_value_add(app_id, value, ts);
+		if (!err) {
+			err = send_err;
+		}
+	}
+	if (err == -ENOMEM) {
+		LOG_ERR("Sensor value does not fit in a CoAP block");
+	}
+	k_mutex_unlock(&sensor_batch_mut);
+
+	return err;
+}
+
+int nrf_cloud_coap_sensor_batch_flush(void)
+{
+	int err;
+
+	if (!nrf_cloud_coap_is_connected()) {
+		return -EACCES;
+	}
+
+	k_mutex_lock(&sensor_batch_mut, K_FOREVER);
+	err = sensor_batch_send();
+	k_mutex_unlock(&sensor_batch_mut);
+
+	return err;
+}
+#endif /* CONFIG_NRF_CLOUD_COAP_SENSOR_BATCH */
+
 int nrf_cloud_coap_sensor_send(const char *app_id, double value, int64_t ts_ms, bool confirmable)
 {
 	__ASSERT_NO_MSG(app_id != NULL);
@@ -329,13 +415,19 @@ int nrf_cloud_coap_sensor_send(const char *app_id, double value, int64_t ts_ms,
 	size_t len = sizeof(buffer);
 	int err;
 
+#if defined(CONFIG_NRF_CLOUD_COAP_SENSOR_BATCH)
+	if (!confirmable) {
+		return sensor_batch_add(app_id, value, ts);
+	}
+#endif
+
 	err = coap_codec_sensor_encode(app_id, value, ts, buffer, &len,
 				       COAP_CONTENT_FORMAT_APP_CBOR);
 	if (err) {
 		LOG_ERR("Unable to encode sensor data: %d", err);
 		return err;
 	}
-	err = nrf_cloud_coap_post(COAP_D2C_RSC, NULL, buffer, len,
+	err = nrf_cloud_coap_post(NRF_CLOUD_COAP_D2C_RSC, NULL, buffer, len,
 				  COAP_CONTENT_FORMAT_APP_CBOR, confirmable, NULL, NULL);
 	if (err < 0) {
 		LOG_ERR("Failed to send POST request: %d", err);
@@ -369,7 +461,7 @@ int nrf_cloud_coap_message_send(const char *app_id, const char *message, bool js
 		LOG_ERR("Unable to encode sensor data: %d", err);
 		return err;
 	}
-	err = nrf_cloud_coap_post(COAP_D2C_RSC, NULL, buffer, len,
+	err = nrf_cloud_coap_post(NRF_CLOUD_COAP_D2C_RSC, NULL, buffer, len,
 				  json ? COAP_CONTENT_FORMAT_APP_JSON :
 					 COAP_CONTENT_FORMAT_APP_CBOR,
 				  confirmable, NULL, NULL);
@@ -387,7 +479,7 @@ int nrf_cloud_coap_json_message_send(const char *message, bool bulk, bool confir
 		return -EACCES;
 	}
 	size_t len = strlen(message);
-	const char *resource = bulk ? COAP_D2C_BULK_RSC : COAP_D2C_RSC;
+	const char *resource = bulk ? NRF_CLOUD_COAP_D2C_BULK_RSC : NRF_CLOUD_COAP_D2C_RSC;
 	int err;
 
 	if (!resource) {
@@ -426,7 +518,7 @@ int nrf_cloud_coap_location_send(const struct nrf_cloud_gnss_data *gnss, bool co
 		LOG_ERR("Unable to encode GNSS PVT data: %d", err);
 		return err;
 	}
-	err = nrf_cloud_coap_post(COAP_D2C_RSC, NULL, buffer, len,
+	err = nrf_cloud_coap_post(NRF_CLOUD_COAP_D2C_RSC, NULL, buffer, len,
 				  COAP_CONTENT_FORMAT_APP_CBOR, confirmable, NULL, NULL);
 	if (err < 0) {
 		LOG_ERR("Failed to send POST request: %d", err);
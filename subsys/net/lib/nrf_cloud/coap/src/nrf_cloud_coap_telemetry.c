@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+
+#include <zephyr/kernel.h>
+#include <zephyr/net/coap.h>
+#include <zephyr/sys/ring_buffer.h>
+#include <date_time.h>
+#if defined(CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_ON_RRC)
+#include <modem/lte_lc.h>
+#endif
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_coap.h>
+#include "nrf_cloud_coap_transport.h"
+#include "nrf_cloud_json_writer.h"
+
+#include <zephyr/logging/log.h>
+LOG_MODULE_REGISTER(nrf_cloud_coap_telemetry, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
+
+/* Retry delay when all CoAP client request slots are in use */
+#define FLUSH_BUSY_RETRY_DELAY K_MSEC(500)
+
+BUILD_ASSERT(CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_THRESHOLD <=
+	     CONFIG_NRF_CLOUD_COAP_TELEMETRY_BUF_SIZE,
+	     "Flush threshold must not be larger than the queue size");
+
+/* Samples are queued in this binary form, followed by the app ID without a terminator */
+struct telemetry_rec_hdr {
+	int64_t ts;
+	double value;
+	uint8_t app_id_len;
+} __packed;
+
+RING_BUF_DECLARE(telemetry_rb, CONFIG_NRF_CLOUD_COAP_TELEMETRY_BUF_SIZE);
+static K_MUTEX_DEFINE(telemetry_mut);
+
+/* The message stays in the buffer until the cloud has responded to it.
+ * Its samples are left in the queue until then, so they can be sent again if it fails.
+ */
+static char msg_buf[CONFIG_NRF_CLOUD_COAP_TELEMETRY_MSG_SIZE];
+static struct nrf_cloud_obj_json_writer msg = {
+	.buf = msg_buf,
+	.size = sizeof(msg_buf)
+};
+static bool msg_busy;
+static uint32_t msg_samples;
+/* Number of queued bytes the message was built from */
+static uint32_t msg_rec_bytes;
+/* Samples were left in the queue because the previous message was full */
+static bool flush_pending;
+
+static struct nrf_cloud_coap_telemetry_stats stats;
+
+static void flush_work_fn(struct k_work *work);
+static K_WORK_DELAYABLE_DEFINE(flush_work, flush_work_fn);
+
+static void flush_now(void)
+{
+	(void)k_work_reschedule(&flush_work, K_NO_WAIT);
+}
+
+#if defined(CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_ON_RRC)
+static void lte_handler(const struct lte_lc_evt *const evt)
+{
+	if ((evt->type != LTE_LC_EVT_RRC_UPDATE) ||
+	    (evt->rrc_mode != LTE_LC_RRC_MODE_CONNECTED)) {
+		return;
+	}
+
+	k_mutex_lock(&telemetry_mut, K_FOREVER);
+	if (!ring_buf_is_empty(&telemetry_rb)) {
+		LOG_DBG("RRC connected, sending queued samples");
+		flush_now();
+	}
+	k_mutex_unlock(&telemetry_mut);
+}
+#endif
+
+/* Copy the next len bytes of the queue into out, without removing them.
+ * A record can wrap around the end of the buffer, in which case it takes two claims.
+ */
+static int rec_claim(uint8_t *out, size_t len)
+{
+	uint8_t *data;
+	uint32_t claimed;
+
+	while (len > 0) {
+		claimed = ring_buf_get_claim(&telemetry_rb, &data, len);
+		if (claimed == 0) {
+			return -ENODATA;
+		}
+		memcpy(out, data, claimed);
+		out += claimed;
+		len -= claimed;
+	}
+
+	return 0;
+}
+
+/* Encode as many queued samples as fit into the message.
+ * The samples stay in the queue until msg_sent_cb() has received the response.
+ */
+static int msg_build(void)
+{
+	char app_id[UINT8_MAX + 1];
+	struct telemetry_rec_hdr hdr;
+	size_t rec_len;
+	int err;
+
+	msg_samples = 0;
+	msg_rec_bytes = 0;
+	flush_pending = false;
+
+	err = nrf_cloud_json_writer_start(&msg, true);
+	if (err) {
+		return err;
+	}
+
+	/* Claimed bytes are not included in the size */
+	while (ring_buf_size_get(&telemetry_rb) > 0) {
+		err = rec_claim((uint8_t *)&hdr, sizeof(hdr));
+		if (!err) {
+			err = rec_claim((uint8_t *)app_id, hdr.app_id_len);
+		}
+		if (err) {
+			break;
+		}
+		app_id[hdr.app_id_len] = '\0';
+		rec_len = sizeof(hdr) + hdr.app_id_len;
+
+		err = nrf_cloud_json_writer_data_msg_add(&msg, app_id, hdr.value, hdr.ts);
+		if ((err == -ENOMEM) && (msg_samples == 0)) {
+			/* The sample is at the head of the queue, so it can be removed */
+			LOG_ERR("Sample does not fit in a message, dropping it");
+			(void)ring_buf_get_finish(&telemetry_rb, rec_len);
+			stats.samples_dropped++;
+			continue;
+		} else if (err == -ENOMEM) {
+			flush_pending = true;
+			break;
+		} else if (err) {
+			break;
+		}
+
+		msg_rec_bytes += rec_len;
+		msg_samples++;
+	}
+
+	/* Release the claims; the records are removed once the message has been sent */
+	(void)ring_buf_get_finish(&telemetry_rb, 0);
+
+	if (err && (err != -ENOMEM)) {
+		return err;
+	}
+
+	return nrf_cloud_json_writer_finish(&msg);
+}
+
+/* Called with telemetry_mut held, once the message has ended */
+static void msg_end(int16_t result_code)
+{
+	if ((result_code >= 0) && (result_code < COAP_RESPONSE_CODE_BAD_REQUEST)) {
+		stats.uplinks++;
+		stats.bytes_sent += msg.len;
+		stats.samples_sent += msg_samples;
+		(void)ring_buf_get(&telemetry_rb, NULL, msg_rec_bytes);
+		LOG_DBG("Sent %u samples, %zd bytes", msg_samples, msg.len);
+	} else if ((result_code >= COAP_RESPONSE_CODE_BAD_REQUEST) &&
+		   (result_code < COAP_RESPONSE_CODE_INTERNAL_ERROR)) {
+		/* The cloud rejected the message, so sending it again would not help */
+		LOG_ERR("Samples rejected, dropping %u samples: %d", msg_samples, result_code);
+		stats.samples_dropped += msg_samples;
+		(void)ring_buf_get(&telemetry_rb, NULL, msg_rec_bytes);
+	} else {
+		LOG_WRN("Failed to send %u samples, trying again later: %d", msg_samples,
+			result_code);
+		flush_pending = false;
+	}
+
+	if (!ring_buf_is_empty(&telemetry_rb)) {
+		/* Does not postpone an earlier deadline */
+		(void)k_work_schedule(&flush_work,
+				      K_SECONDS(CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_TIMEOUT_S));
+	}
+
+	nrf_cloud_json_writer_reset(&msg);
+	msg_samples = 0;
+	msg_rec_bytes = 0;
+	msg_busy = false;
+	if (flush_pending) {
+		flush_now();
+	}
+}
+
+static void msg_sent_cb(int16_t result_code, size_t offset, const uint8_t *payload, size_t len,
+			bool last_block, void *user_data)
+{
+	ARG_UNUSED(offset);
+	ARG_UNUSED(payload);
+	ARG_UNUSED(len);
+	ARG_UNUSED(user_data);
+
+	if (!last_block && (result_code >= 0) && (result_code < COAP_RESPONSE_CODE_BAD_REQUEST)) {
+		return;
+	}
+
+	k_mutex_lock(&telemetry_mut, K_FOREVER);
+	msg_end(result_code);
+	k_mutex_unlock(&telemetry_mut);
+}
+
+static void flush_work_fn(struct k_work *work)
+{
+	ARG_UNUSED(work);
+
+	int err;
+
+	k_mutex_lock(&telemetry_mut, K_FOREVER);
+	if (msg_busy || ring_buf_is_empty(&telemetry_rb)) {
+		/* Samples queued meanwhile are sent once the message in flight has ended */
+		flush_pending = (ring_buf_size_get(&telemetry_rb) > msg_rec_bytes);
+		goto unlock;
+	}
+
+	if (!nrf_cloud_coap_is_connected()) {
+		LOG_DBG("Not connected, sending queued samples later");
+		(void)k_work_schedule(&flush_work,
+				      K_SECONDS(CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_TIMEOUT_S));
+		goto unlock;
+	}
+
+	err = msg_build();
+	if (err) {
+		LOG_ERR("Unable to encode queued samples: %d", err);
+		nrf_cloud_json_writer_reset(&msg);
+		goto unlock;
+	}
+	if (msg_samples == 0) {
+		nrf_cloud_json_writer_reset(&msg);
+		goto unlock;
+	}
+	msg_busy = true;
+	k_mutex_unlock(&telemetry_mut);
+
+	/* The mutex is not held here, since msg_sent_cb() takes it in the CoAP client thread */
+	err = nrf_cloud_coap_async_request(COAP_METHOD_POST, NRF_CLOUD_COAP_D2C_BULK_RSC, NULL,
+					   msg.buf, msg.len,
+					   COAP_CONTENT_FORMAT_APP_JSON,
+					   COAP_CONTENT_FORMAT_APP_JSON, true,
+					   msg_sent_cb, NULL);
+	if (!err) {
+		return;
+	}
+
+	k_mutex_lock(&telemetry_mut, K_FOREVER);
+	if ((err == -EAGAIN) || (err == -ENOBUFS)) {
+		/* The samples are still queued; send them once a request slot is free */
+		LOG_DBG("No free request slot, sending queued samples later");
+		nrf_cloud_json_writer_reset(&msg);
+		msg_busy = false;
+		(void)k_work_reschedule(&flush_work, FLUSH_BUSY_RETRY_DELAY);
+	} else {
+		LOG_ERR("Failed to send POST request: %d", err);
+		msg_end(err);
+	}
+
+unlock:
+	k_mutex_unlock(&telemetry_mut);
+}
+
+int nrf_cloud_coap_telemetry_add(const char *app_id, double value, int64_t ts_ms)
+{
+	__ASSERT_NO_MSG(app_id != NULL);
+
+#if defined(CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_ON_RRC)
+	static bool lte_handler_registered;
+#endif
+	size_t app_id_len = strlen(app_id);
+	struct telemetry_rec_hdr hdr = {
+		.ts = ts_ms,
+		.value = value,
+		.app_id_len = (uint8_t)app_id_len
+	};
+	int err = 0;
+
+	if ((app_id_len == 0) || (app_id_len > UINT8_MAX)) {
+		return -EINVAL;
+	}
+
+	/* Samples are sent later, so the time must be taken now */
+	if ((ts_ms == NRF_CLOUD_NO_TIMESTAMP) && date_time_now(&hdr.ts)) {
+		hdr.ts = 0;
+	}
+
+	k_mutex_lock(&telemetry_mut, K_FOREVER);
+
+#if defined(CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_ON_RRC)
+	if (!lte_handler_registered) {
+		lte_lc_register_handler(lte_handler);
+		lte_handler_registered = true;
+	}
+#endif
+
+	if (ring_buf_space_get(&telemetry_rb) < (sizeof(hdr) + app_id_len)) {
+		LOG_WRN("Telemetry queue full, dropping sample");
+		stats.samples_dropped++;
+		flush_now();
+		err = -ENOMEM;
+		goto unlock;
+	}
+
+	if (ring_buf_is_empty(&telemetry_rb)) {
+		/* The deadline counts from the oldest queued sample */
+		(void)k_work_schedule(&flush_work,
+				      K_SECONDS(CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_TIMEOUT_S));
+	}
+
+	(void)ring_buf_put(&telemetry_rb, (const uint8_t *)&hdr, sizeof(hdr));
+	(void)ring_buf_put(&telemetry_rb, (const uint8_t *)app_id, app_id_len);
+	stats.samples++;
+
+	if (ring_buf_size_get(&telemetry_rb) >= CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_THRESHOLD) {
+		flush_now();
+	}
+
+unlock:
+	k_mutex_unlock(&telemetry_mut);
+	return err;
+}
+
+int nrf_cloud_coap_telemetry_flush(void)
+{
+	if (!nrf_cloud_coap_is_connected()) {
+		return -EACCES;
+	}
+
+	flush_now();
+	return 0;
+}
+
+void nrf_cloud_coap_telemetry_stats_get(struct nrf_cloud_coap_telemetry_stats *const out)
+{
+	__ASSERT_NO_MSG(out != NULL);
+
+	k_mutex_lock(&telemetry_mut, K_FOREVER);
+	*out = stats;
+	out->bytes_per_uplink = stats.uplinks ? (stats.bytes_sent / stats.uplinks) : 0;
+	out->uplinks_avoided = (stats.samples_sent > stats.uplinks) ?
+			       (stats.samples_sent - stats.uplinks) : 0;
+	k_mutex_unlock(&telemetry_mut);
+}
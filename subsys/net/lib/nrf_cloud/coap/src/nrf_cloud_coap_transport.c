@@ -54,6 +54,9 @@ LOG_MODULE_REGISTER(nrf_cloud_coap_transport, CONFIG_NRF_CLOUD_COAP_LOG_LEVEL);
 
 #define NRF_CLOUD_COAP_AUTH_RSC "auth/jwt"
 
+BUILD_ASSERT(CONFIG_NRF_CLOUD_COAP_ASYNC_REQUESTS_MAX < CONFIG_COAP_CLIENT_MAX_REQUESTS,
+	     "A CoAP client request slot must be left for blocking requests");
+
 /* CoAP client transfer data */
 struct cc_xfer_data {
 	struct nrf_cloud_coap_client *nrfc_cc;
@@ -61,6 +64,11 @@ struct cc_xfer_data {
 	void *user_data;
 	int result_code;
 	struct k_sem *sem;
+	/* The transfer was started by nrf_cloud_coap_async_request() */
+	bool async;
+	/* Request data that coap_client refers to until the transfer ends */
+	char path[MAX_COAP_PATH + 1];
+	struct coap_client_option accept;
 	atomic_t used;
 };
 
@@ -73,6 +81,9 @@ static K_MUTEX_DEFINE(internal_transfer_mut);
 
 static struct nrf_cloud_coap_client internal_cc = {0};
 
+/* Number of asynchronous transfers that have not ended yet */
+static atomic_t async_xfer_count;
+
 #if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
 static const char *const coap_method_str[] = {
 	NULL,		/* 0 */
@@ -158,9 +169,17 @@ static struct cc_xfer_data *xfer_data_init(struct nrf_cloud_coap_client *cc,
 	xfer->user_data = user;
 	xfer->result_code = -ECANCELED;
 	xfer->sem = sem;
+	xfer->async = false;
 	return xfer;
 }
 
+static void async_xfer_end(struct cc_xfer_data *xfer)
+{
+	xfer->async = false;
+	xfer_ctx_release(xfer);
+	atomic_dec(&async_xfer_count);
+}
+
 bool nrf_cloud_coap_is_connected(void)
 {
 	return internal_cc.authenticated && !internal_cc.paused;
@@ -406,70 +425,94 @@ static void client_callback(int16_t result_code, size_t offset, const uint8_t *p
 		if (xfer->sem) {
 			k_sem_give(xfer->sem);
 		}
+		if (xfer->async) {
+			async_xfer_end(xfer);
+		}
 	}
 }
 
 
-static int client_transfer(enum coap_method method,
-			   const char *resource, const char *query,
-			   const uint8_t *buf, size_t buf_len,
-			   enum coap_content_format fmt_out,
-			   enum coap_content_format fmt_in,
-			   bool response_expected,
-			   bool reliable,
-			   struct cc_xfer_data *xfer)
+static int client_request_init(struct coap_client_request *const request,
+			       enum coap_method method,
+			       const char *resource, const char *query,
+			       const uint8_t *buf, size_t buf_len,
+			       enum coap_content_format fmt_out,
+			       enum coap_content_format fmt_in,
+			       bool response_expected,
+			       bool reliable,
+			       struct cc_xfer_data *xfer)
 {
-	if (xfer == NULL) {
-		return -ENOBUFS;
-	}
-	__ASSERT_NO_MSG(resource != NULL);
+	int err;
 
-	int err = 0;
-	int retry;
-	char path[MAX_COAP_PATH + 1];
-	struct coap_client_option options[1] = {{
-		.code = COAP_OPTION_ACCEPT,
-		.len = 1,
-		.value[0] = fmt_in
-	}};
-	struct coap_client_request request = {
+	*request = (struct coap_client_request) {
 		.method = method,
 		.confirmable = reliable,
-		.path = path,
+		.path = xfer->path,
 		.fmt = fmt_out,
 		.payload = (uint8_t *)buf,
 		.len = buf_len,
 		.cb = client_callback,
 		.user_data = xfer
 	};
-	struct coap_client *const cc = &xfer->nrfc_cc->cc;
 
 	if (response_expected) {
-		request.options = options;
-		request.num_options = ARRAY_SIZE(options);
+		xfer->accept = (struct coap_client_option) {
+			.code = COAP_OPTION_ACCEPT,
+			.len = 1,
+			.value[0] = fmt_in
+		};
+		request->options = &xfer->accept;
+		request->num_options = 1;
 	} else {
-		request.options = NULL;
-		request.num_options = 0;
+		request->options = NULL;
+		request->num_options = 0;
 	}
 
 	if (!query) {
-		strncpy(path, resource, MAX_COAP_PATH);
-		path[MAX_COAP_PATH] = '\0';
+		strncpy(xfer->path, resource, MAX_COAP_PATH);
+		xfer->path[MAX_COAP_PATH] = '\0';
 	} else {
-		err = snprintk(path, sizeof(path), "%s?%s", resource, query);
-		if ((err <= 0) || (err >= sizeof(path))) {
+		err = snprintk(xfer->path, sizeof(xfer->path), "%s?%s", resource, query);
+		if ((err <= 0) || (err >= sizeof(xfer->path))) {
 			LOG_ERR("Could not format string");
-			err = -ETXTBSY;
-			goto transfer_end;
+			return -ETXTBSY;
 		}
 	}
 
 #if defined(CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG)
 	LOG_DBG("%s %s %s Content-Format:%s, %zd bytes out, Accept:%s", reliable ? "CON" : "NON",
-		METHOD_NAME(method), path, fmt_name(fmt_out), buf_len,
+		METHOD_NAME(method), xfer->path, fmt_name(fmt_out), buf_len,
 		response_expected ? fmt_name(fmt_in) : "none");
 #endif /* CONFIG_NRF_CLOUD_COAP_LOG_LEVEL_DBG */
 
+	return 0;
+}
+
+static int client_transfer(enum coap_method method,
+			   const char *resource, const char *query,
+			   const uint8_t *buf, size_t buf_len,
+			   enum coap_content_format fmt_out,
+			   enum coap_content_format fmt_in,
+			   bool response_expected,
+			   bool reliable,
+			   struct cc_xfer_data *xfer)
+{
+	if (xfer == NULL) {
+		return -ENOBUFS;
+	}
+	__ASSERT_NO_MSG(resource != NULL);
+
+	int err;
+	int retry;
+	struct coap_client_request request = {0};
+	struct coap_client *const cc = &xfer->nrfc_cc->cc;
+
+	err = client_request_init(&request, method, resource, query, buf, buf_len,
+				  fmt_out, fmt_in, response_expected, reliable, xfer);
+	if (err) {
+		goto transfer_end;
+	}
+
 	retry = 0;
 	k_sem_reset(xfer->sem);
 	while ((xfer->nrfc_cc->sock >= 0) &&
@@ -636,6 +679,58 @@ int nrf_cloud_coap_patch(const char *resource, const char *query,
 	return err;
 }
 
+int nrf_cloud_coap_async_request(enum coap_method method,
+				 const char *resource, const char *query,
+				 const uint8_t *buf, size_t len,
+				 enum coap_content_format fmt_out,
+				 enum coap_content_format fmt_in, bool reliable,
+				 coap_client_response_cb_t cb, void *user)
+{
+	__ASSERT_NO_MSG(resource != NULL);
+
+	struct coap_client_request request;
+	struct cc_xfer_data *xfer;
+	int err;
+
+	if (!nrf_cloud_coap_is_connected()) {
+		return -EACCES;
+	}
+
+	if (atomic_inc(&async_xfer_count) >= CONFIG_NRF_CLOUD_COAP_ASYNC_REQUESTS_MAX) {
+		atomic_dec(&async_xfer_count);
+		LOG_DBG("Maximum number of asynchronous requests are already in progress");
+		return -ENOBUFS;
+	}
+
+	xfer = xfer_data_init(&internal_cc, cb, user, NULL);
+	if (!xfer) {
+		atomic_dec(&async_xfer_count);
+		return -ENOBUFS;
+	}
+
+	err = client_request_init(&request, method, resource, query, buf, len, fmt_out, fmt_in,
+				  (method == COAP_METHOD_GET) || (method == COAP_METHOD_FETCH),
+				  reliable, xfer);
+	if (err) {
+		async_xfer_end(xfer);
+		return err;
+	}
+
+	/* Responses are matched to their requests by token in coap_client, so the transfer
+	 * is handed over and the callback ends it; the internal transfer mutex is not taken
+	 * since it is held by blocking requests for the whole exchange.
+	 */
+	xfer->async = true;
+	err = coap_client_req(&internal_cc.cc, internal_cc.sock, NULL, &request, NULL);
+	if (err < 0) {
+		LOG_DBG("Could not start asynchronous request: %d", err);
+		async_xfer_end(xfer);
+		return err;
+	}
+
+	return 0;
+}
+
 static void auth_cb(int16_t result_code, size_t offset, const uint8_t *payload, size_t len,
 		    bool last_block, void *user_data)
 {
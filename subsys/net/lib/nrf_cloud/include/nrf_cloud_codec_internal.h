@@ -32,6 +32,8 @@
 #include "nrf_cloud_log_internal.h"
 #include "nrf_cloud_fota.h"
 #include "nrf_cloud_transport.h"
+#include "nrf_cloud_json_reader.h"
+#include "nrf_cloud_json_writer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -281,6 +283,12 @@ int nrf_cloud_cell_info_json_encode(cJSON * const data_obj,
 int nrf_cloud_cell_pos_req_json_encode(struct lte_lc_cells_info const *const inf,
 				       cJSON * const req_obj_out);
 
+/** @brief Write a cellular positioning request to the current object of the provided writer
+ * using the provided cell info. Nothing is written if an error is returned.
+ */
+int nrf_cloud_cell_pos_req_json_write(struct lte_lc_cells_info const *const inf,
+				      struct nrf_cloud_obj_json_writer *const writer);
+
 /** @brief Add the location request data payload to the provided initialized object */
 int nrf_cloud_obj_location_request_payload_add(struct nrf_cloud_obj *const obj,
 					       struct lte_lc_cells_info const *const cells_inf,
@@ -296,6 +304,17 @@ int nrf_cloud_obj_location_request_payload_add(struct nrf_cloud_obj *const obj,
 int nrf_cloud_wifi_req_json_encode(struct wifi_scan_info const *const wifi,
 				   cJSON *const req_obj_out);
 
+/** @brief Write a Wi-Fi positioning request to the current object of the provided writer.
+ * Local MAC addresses are not included in the request. Nothing is written if an error
+ * is returned.
+ *
+ * @retval 0 Success.
+ * @retval -ENODATA Access point (non-local) count less than NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN.
+ * @retval -ENOMEM Buffer too small.
+ */
+int nrf_cloud_wifi_req_json_write(struct wifi_scan_info const *const wifi,
+				  struct nrf_cloud_obj_json_writer *const writer);
+
 /** @brief Get the required information from the modem for a single-cell location request. */
 int nrf_cloud_get_single_cell_modem_info(struct lte_lc_cell *const cell_inf);
 
@@ -350,6 +369,10 @@ int nrf_cloud_rest_error_decode(const char *const buf, enum nrf_cloud_error *con
 int nrf_cloud_pvt_data_encode(const struct nrf_cloud_gnss_pvt *const pvt,
 			      cJSON * const pvt_data_obj);
 
+/** @brief Write PVT data to the current object of the provided writer */
+int nrf_cloud_pvt_data_json_write(const struct nrf_cloud_gnss_pvt *const pvt,
+				  struct nrf_cloud_obj_json_writer * const writer);
+
 /** @brief Replace legacy c2d topic with wilcard topic string.
  * Return true, if the topic was modified; otherwise false.
  */
@@ -375,6 +398,10 @@ int nrf_cloud_agnss_req_data_json_encode(const enum nrf_cloud_agnss_type *const
 /** @brief Encode a modem PVT data frame to be sent to nRF Cloud */
 int nrf_cloud_modem_pvt_data_encode(const struct nrf_modem_gnss_pvt_data_frame	*const mdm_pvt,
 				    cJSON * const pvt_data_obj);
+
+/** @brief Write a modem PVT data frame to the current object of the provided writer */
+int nrf_cloud_modem_pvt_data_json_write(const struct nrf_modem_gnss_pvt_data_frame *const mdm_pvt,
+					struct nrf_cloud_obj_json_writer * const writer);
 #endif
 
 #if defined(CONFIG_NRF_CLOUD_AGNSS) || defined(CONFIG_NRF_CLOUD_PGPS)
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_JSON_READER_H__
+#define NRF_CLOUD_JSON_READER_H__
+
+#include <errno.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The reader finds values in JSON text without allocating memory or building a tree.
+ * A value is found by its path: the keys of the objects and the indexes of the arrays
+ * leading to it, separated by '.', for example "data.anchors.0.name".
+ * The text is only checked up to the end of the value that is found.
+ *
+ * Unless stated otherwise, the functions return:
+ *   -ENOENT if the value is not found,
+ *   -EBADMSG if the JSON text is not valid,
+ *   -E2BIG if objects and arrays are nested deeper than the reader supports,
+ *   -ENOMSG if the value is not of the requested type.
+ */
+
+/** @brief Type of a JSON value. */
+enum nrf_cloud_json_reader_type {
+	NRF_CLOUD_JSON_READER_TYPE_NULL,
+	NRF_CLOUD_JSON_READER_TYPE_BOOL,
+	NRF_CLOUD_JSON_READER_TYPE_NUMBER,
+	NRF_CLOUD_JSON_READER_TYPE_STRING,
+	NRF_CLOUD_JSON_READER_TYPE_ARRAY,
+	NRF_CLOUD_JSON_READER_TYPE_OBJECT,
+};
+
+/** @brief A value in the JSON text. Nothing is copied, the value points to the text. */
+struct nrf_cloud_json_reader_val {
+	/** Type of the value */
+	enum nrf_cloud_json_reader_type type;
+	/** Text of the value. For strings, the quotes are left out and escapes are kept. */
+	const char *ptr;
+	/** Length of the text */
+	size_t len;
+};
+
+/** @brief Find the value at the given path in the JSON text.
+ *  A NULL or empty path selects the root value.
+ */
+int nrf_cloud_json_reader_get(const char *const json, const size_t len, const char *const path,
+			      struct nrf_cloud_json_reader_val *const val);
+
+/** @brief Find the value at the given path, relative to an object or array value. */
+static inline int nrf_cloud_json_reader_child_get(const struct nrf_cloud_json_reader_val *parent,
+						  const char *const path,
+						  struct nrf_cloud_json_reader_val *const val)
+{
+	if ((parent->type != NRF_CLOUD_JSON_READER_TYPE_OBJECT) &&
+	    (parent->type != NRF_CLOUD_JSON_READER_TYPE_ARRAY)) {
+		return -ENOENT;
+	}
+
+	return nrf_cloud_json_reader_get(parent->ptr, parent->len, path, val);
+}
+
+/** @brief Get the next item of an array.
+ *  Set item->ptr to NULL to get the first item. Returns -ENOENT after the last item.
+ */
+int nrf_cloud_json_reader_array_next(const struct nrf_cloud_json_reader_val *const array,
+				     struct nrf_cloud_json_reader_val *const item);
+
+/** @brief Copy a string value to a buffer, unescaped and NULL-terminated.
+ *  If buf is NULL, only the length is calculated.
+ *  Returns the length of the string, or -ENOMEM if the buffer is too small.
+ */
+int nrf_cloud_json_reader_str_get(const struct nrf_cloud_json_reader_val *const val,
+				  char *const buf, const size_t size);
+
+/** @brief Check whether the value is a string that is equal to str once unescaped. */
+bool nrf_cloud_json_reader_str_eq(const struct nrf_cloud_json_reader_val *const val,
+				  const char *const str);
+
+/** @brief Get a number value. */
+int nrf_cloud_json_reader_num_get(const struct nrf_cloud_json_reader_val *const val,
+				  double *const num);
+
+/** @brief Get a number value as an integer, saturated the same way as cJSON does. */
+int nrf_cloud_json_reader_int_get(const struct nrf_cloud_json_reader_val *const val,
+				  int *const num);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_CLOUD_JSON_READER_H__ */
@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_CLOUD_JSON_WRITER_H__
+#define NRF_CLOUD_JSON_WRITER_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <zephyr/sys/util.h>
+#include <net/nrf_cloud_codec.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* The writer produces the same text as cJSON_PrintUnformatted() for the same items.
+ * Space for closing the open objects and arrays is always kept in the buffer, so
+ * nrf_cloud_json_writer_finish() cannot fail once the text has been started.
+ * If adding an item fails, the writer is left as it was before the call.
+ *
+ * Unless stated otherwise, the functions return:
+ *   -ENOENT if there is no open object or array,
+ *   -EINVAL if a key is provided for an array item, or missing for an object item,
+ *   -ENOMEM if the buffer is too small.
+ */
+
+/** @brief Clear the writer; the buffer is kept. */
+void nrf_cloud_json_writer_reset(struct nrf_cloud_obj_json_writer *const writer);
+
+/** @brief Start the JSON text with a root object, or a root array if array is true. */
+int nrf_cloud_json_writer_start(struct nrf_cloud_obj_json_writer *const writer,
+				const bool array);
+
+/** @brief Open an object. Returns -E2BIG if NRF_CLOUD_OBJ_JSON_WRITER_DEPTH_MAX is reached. */
+int nrf_cloud_json_writer_object_begin(struct nrf_cloud_obj_json_writer *const writer,
+				       const char *const key);
+
+/** @brief Open an array. Returns -E2BIG if NRF_CLOUD_OBJ_JSON_WRITER_DEPTH_MAX is reached. */
+int nrf_cloud_json_writer_array_begin(struct nrf_cloud_obj_json_writer *const writer,
+				      const char *const key);
+
+/** @brief Close the innermost open object or array. */
+int nrf_cloud_json_writer_end(struct nrf_cloud_obj_json_writer *const writer);
+
+/** @brief Add a number, printed the same way as cJSON does. */
+int nrf_cloud_json_writer_num_add(struct nrf_cloud_obj_json_writer *const writer,
+				  const char *const key, const double val);
+
+/** @brief Add a string, escaped the same way as cJSON does. */
+int nrf_cloud_json_writer_str_add(struct nrf_cloud_obj_json_writer *const writer,
+				  const char *const key, const char *const val);
+
+/** @brief Add a boolean. */
+int nrf_cloud_json_writer_bool_add(struct nrf_cloud_obj_json_writer *const writer,
+				   const char *const key, const bool val);
+
+/** @brief Add a null value. */
+int nrf_cloud_json_writer_null_add(struct nrf_cloud_obj_json_writer *const writer,
+				   const char *const key);
+
+/** @brief Add a value that is already encoded as JSON text. */
+int nrf_cloud_json_writer_raw_add(struct nrf_cloud_obj_json_writer *const writer,
+				  const char *const key, const char *const json,
+				  const size_t len);
+
+/** @brief Add a data message object, as sent in an array to the d2c/bulk resource,
+ *  with the app ID, the value and the timestamp in milliseconds.
+ */
+int nrf_cloud_json_writer_data_msg_add(struct nrf_cloud_obj_json_writer *const writer,
+				       const char *const app_id, const double val,
+				       const int64_t ts);
+
+/** @brief Close all open objects and arrays and NULL-terminate the text.
+ *  Returns -ENOENT if the text has not been started.
+ */
+int nrf_cloud_json_writer_finish(struct nrf_cloud_obj_json_writer *const writer);
+
+/** @brief Check whether the text has not been started. */
+static inline bool nrf_cloud_json_writer_is_empty(const struct nrf_cloud_obj_json_writer *writer)
+{
+	return writer->len == 0;
+}
+
+/** @brief Check whether the root of the text is an array. */
+static inline bool nrf_cloud_json_writer_is_array(const struct nrf_cloud_obj_json_writer *writer)
+{
+	return (writer->len > 0) && (writer->array_mask & BIT(0));
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_CLOUD_JSON_WRITER_H__ */
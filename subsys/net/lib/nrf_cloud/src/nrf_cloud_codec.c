@@ -8,6 +8,7 @@
 #include <net/nrf_cloud_codec.h>
 #include "nrf_cloud_mem.h"
 #include "nrf_cloud_codec_internal.h"
+#include "nrf_cloud_json_writer.h"
 #if defined(CONFIG_NRF_CLOUD_COAP)
 #include <zephyr/net/coap.h>
 #include "../coap/include/coap_codec.h"
@@ -38,8 +39,9 @@ int nrf_cloud_obj_input_decode(struct nrf_cloud_obj *const obj,
 		return -EINVAL;
 	}
 
-	if (obj->type == NRF_CLOUD_OBJ_TYPE_COAP_CBOR) {
-		/* Decoding CoAP CBOR input is not supported */
+	if ((obj->type == NRF_CLOUD_OBJ_TYPE_COAP_CBOR) ||
+	    (obj->type == NRF_CLOUD_OBJ_TYPE_JSON_WRITER)) {
+		/* Decoding CoAP CBOR or JSON writer input is not supported */
 		return -ENOTSUP;
 	}
 
@@ -190,6 +192,19 @@ int nrf_cloud_obj_object_detach(struct nrf_cloud_obj *const obj, const char *con
 	return -ENOTSUP;
 }
 
+static int writer_init(struct nrf_cloud_obj *const obj, const bool array)
+{
+	if (!obj->writer) {
+		return -EINVAL;
+	}
+
+	if (!nrf_cloud_json_writer_is_empty(obj->writer)) {
+		return -ENOTEMPTY;
+	}
+
+	return nrf_cloud_json_writer_start(obj->writer, array);
+}
+
 int nrf_cloud_obj_msg_init(struct nrf_cloud_obj *const obj, const char *const app_id,
 	const char *const msg_type)
 {
@@ -251,6 +266,28 @@ int nrf_cloud_obj_msg_init(struct nrf_cloud_obj *const obj, const char *const ap
 
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		int err = writer_init(obj, false);
+
+		if (err) {
+			return err;
+		}
+
+		err = nrf_cloud_json_writer_str_add(obj->writer, NRF_CLOUD_JSON_APPID_KEY, app_id);
+
+		if (!err && msg_type) {
+			err = nrf_cloud_json_writer_str_add(obj->writer,
+							    NRF_CLOUD_JSON_MSG_TYPE_KEY,
+							    msg_type);
+		}
+
+		if (err) {
+			nrf_cloud_json_writer_reset(obj->writer);
+		}
+
+		return err;
+	}
 	default:
 		break;
 	}
@@ -274,6 +311,10 @@ int nrf_cloud_obj_init(struct nrf_cloud_obj *const obj)
 		obj->json = cJSON_CreateObject();
 		return obj->json ? 0 : -ENOMEM;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		return writer_init(obj, false);
+	}
 	default:
 		break;
 	}
@@ -293,6 +334,13 @@ int nrf_cloud_obj_reset(struct nrf_cloud_obj *const obj)
 		obj->json = NULL;
 		break;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		if (obj->writer) {
+			nrf_cloud_json_writer_reset(obj->writer);
+		}
+		break;
+	}
 	default:
 		return -ENOTSUP;
 	}
@@ -321,6 +369,10 @@ int nrf_cloud_obj_bulk_init(struct nrf_cloud_obj *const bulk)
 		bulk->json = cJSON_CreateArray();
 		return bulk->json ? 0 : -ENOMEM;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		return writer_init(bulk, true);
+	}
 	default:
 		break;
 	}
@@ -361,6 +413,14 @@ int nrf_cloud_obj_cloud_encoded_free(struct nrf_cloud_obj *const obj)
 		obj->enc_src = NRF_CLOUD_ENC_SRC_NONE;
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		/* The encoded data is in the writer's buffer, which is not owned by the object */
+		obj->encoded_data.ptr = NULL;
+		obj->encoded_data.len = 0;
+		obj->enc_src = NRF_CLOUD_ENC_SRC_NONE;
+		return 0;
+	}
 	default:
 		break;
 	}
@@ -406,6 +466,13 @@ int nrf_cloud_obj_free(struct nrf_cloud_obj *const obj)
 		}
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		if (obj->writer) {
+			nrf_cloud_json_writer_reset(obj->writer);
+		}
+		return 0;
+	}
 	default:
 		break;
 	}
@@ -415,9 +482,37 @@ int nrf_cloud_obj_free(struct nrf_cloud_obj *const obj)
 
 bool nrf_cloud_obj_bulk_check(struct nrf_cloud_obj *const obj)
 {
+	if (obj && (obj->type == NRF_CLOUD_OBJ_TYPE_JSON_WRITER)) {
+		return obj->writer && nrf_cloud_json_writer_is_array(obj->writer);
+	}
+
 	return (obj && (obj->type == NRF_CLOUD_OBJ_TYPE_JSON) && cJSON_IsArray(obj->json));
 }
 
+/* Copy the JSON text of a writer object into another and reset the source */
+static int writer_obj_copy(struct nrf_cloud_obj_json_writer *const dest, const char *const key,
+			   struct nrf_cloud_obj *const src)
+{
+	int err;
+
+	if ((src->type != NRF_CLOUD_OBJ_TYPE_JSON_WRITER) || !src->writer) {
+		return -ENOTSUP;
+	}
+
+	err = nrf_cloud_json_writer_finish(src->writer);
+	if (err) {
+		return err;
+	}
+
+	err = nrf_cloud_json_writer_raw_add(dest, key, src->writer->buf, src->writer->len);
+	if (err) {
+		return err;
+	}
+
+	(void)nrf_cloud_obj_reset(src);
+	return 0;
+}
+
 int nrf_cloud_obj_bulk_add(struct nrf_cloud_obj *const bulk, struct nrf_cloud_obj *const obj)
 {
 	if (!bulk || !obj) {
@@ -437,6 +532,20 @@ int nrf_cloud_obj_bulk_add(struct nrf_cloud_obj *const bulk, struct nrf_cloud_ob
 
 		return cJSON_AddItemToArray(bulk->json, obj->json) ? 0 : -EIO;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		if ((bulk->type != obj->type) || !bulk->writer || !obj->writer ||
+		    nrf_cloud_json_writer_is_empty(bulk->writer) ||
+		    nrf_cloud_json_writer_is_empty(obj->writer)) {
+			return -ENOENT;
+		}
+
+		if (!nrf_cloud_json_writer_is_array(bulk->writer)) {
+			return -ENODEV;
+		}
+
+		return writer_obj_copy(bulk->writer, NULL, obj) ? -EIO : 0;
+	}
 	default:
 		break;
 	}
@@ -444,6 +553,43 @@ int nrf_cloud_obj_bulk_add(struct nrf_cloud_obj *const bulk, struct nrf_cloud_ob
 	return -ENOTSUP;
 }
 
+/* Make the writer's current container the "data" object or the root object. Since the text
+ * is written in order, the "data" object is closed by the first item added to the root object
+ * after it, and cannot be added to again.
+ */
+static int dest_writer_set(struct nrf_cloud_obj *const obj, const bool data_child)
+{
+	struct nrf_cloud_obj_json_writer *const writer = obj->writer;
+	int err;
+
+	if (!writer || (writer->depth == 0)) {
+		return -ENOENT;
+	}
+
+	if (writer->data_open) {
+		if (data_child) {
+			return 0;
+		}
+
+		err = nrf_cloud_json_writer_end(writer);
+		writer->data_open = false;
+		writer->data_closed = true;
+		return err;
+	}
+
+	if (!data_child) {
+		return 0;
+	}
+
+	if (writer->data_closed || nrf_cloud_json_writer_is_array(writer)) {
+		return -ENOTSUP;
+	}
+
+	err = nrf_cloud_json_writer_object_begin(writer, NRF_CLOUD_JSON_DATA_KEY);
+	writer->data_open = (err == 0);
+	return err;
+}
+
 int nrf_cloud_obj_ts_add(struct nrf_cloud_obj *const obj, const int64_t time_ms)
 {
 	if (!obj) {
@@ -470,6 +616,14 @@ int nrf_cloud_obj_ts_add(struct nrf_cloud_obj *const obj, const int64_t time_ms)
 		obj->coap_cbor->ts = time_ms;
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		int err = dest_writer_set(obj, false);
+
+		return err ? err : nrf_cloud_json_writer_num_add(obj->writer,
+								 NRF_CLOUD_MSG_TIMESTAMP_KEY,
+								 time_ms);
+	}
 	default:
 		break;
 	}
@@ -530,6 +684,12 @@ int nrf_cloud_obj_num_add(struct nrf_cloud_obj *const obj, const char *const key
 
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		int err = dest_writer_set(obj, data_child);
+
+		return err ? err : nrf_cloud_json_writer_num_add(obj->writer, key, val);
+	}
 	default:
 		break;
 	}
@@ -580,6 +740,16 @@ int nrf_cloud_obj_str_add(struct nrf_cloud_obj *const obj, const char *const key
 
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		if (!key) {
+			return -EINVAL;
+		}
+
+		int err = dest_writer_set(obj, data_child);
+
+		return err ? err : nrf_cloud_json_writer_str_add(obj->writer, key, val);
+	}
 	default:
 		break;
 	}
@@ -603,6 +773,12 @@ int nrf_cloud_obj_bool_add(struct nrf_cloud_obj *const obj, const char *const ke
 		return cJSON_AddBoolToObjectCS(dest_json_get(obj, data_child),
 					       key, val) ? 0 : -ENOMEM;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		int err = dest_writer_set(obj, data_child);
+
+		return err ? err : nrf_cloud_json_writer_bool_add(obj->writer, key, val);
+	}
 	default:
 		break;
 	}
@@ -625,6 +801,12 @@ int nrf_cloud_obj_null_add(struct nrf_cloud_obj *const obj, const char *const ke
 		}
 		return cJSON_AddNullToObjectCS(dest_json_get(obj, data_child), key) ? 0 : -ENOMEM;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		int err = dest_writer_set(obj, data_child);
+
+		return err ? err : nrf_cloud_json_writer_null_add(obj->writer, key);
+	}
 	default:
 		break;
 	}
@@ -654,6 +836,20 @@ int nrf_cloud_obj_object_add(struct nrf_cloud_obj *const obj, const char *const
 		(void)nrf_cloud_obj_reset(obj_to_add);
 		return 0;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		if (obj_to_add->type != NRF_CLOUD_OBJ_TYPE_JSON_WRITER) {
+			return -ENOTSUP;
+		}
+
+		if (!obj_to_add->writer || nrf_cloud_json_writer_is_empty(obj_to_add->writer)) {
+			return -ENOENT;
+		}
+
+		int err = dest_writer_set(obj, data_child);
+
+		return err ? err : writer_obj_copy(obj->writer, key, obj_to_add);
+	}
 	default:
 		break;
 	}
@@ -677,6 +873,33 @@ int nrf_cloud_obj_int_array_add(struct nrf_cloud_obj *const obj, const char *con
 		return cJSON_AddItemToObjectCS(dest_json_get(obj, data_child),
 					       key, array) ? 0 : -ENOMEM;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		int err = dest_writer_set(obj, data_child);
+
+		if (err) {
+			return err;
+		}
+
+		const struct nrf_cloud_obj_json_writer prev = *obj->writer;
+
+		err = nrf_cloud_json_writer_array_begin(obj->writer, key);
+
+		for (uint32_t i = 0; !err && (i < ints_cnt); i++) {
+			/* Same as cJSON_CreateIntArray(), which takes an int array */
+			err = nrf_cloud_json_writer_num_add(obj->writer, NULL, (int)ints[i]);
+		}
+
+		if (!err) {
+			err = nrf_cloud_json_writer_end(obj->writer);
+		}
+
+		if (err) {
+			*obj->writer = prev;
+		}
+
+		return err;
+	}
 	default:
 		break;
 	}
@@ -703,6 +926,32 @@ int nrf_cloud_obj_str_array_add(struct nrf_cloud_obj *const obj, const char *con
 		return cJSON_AddItemToObjectCS(dest_json_get(obj, data_child),
 					       key, array) ? 0 : -ENOMEM;
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		int err = dest_writer_set(obj, data_child);
+
+		if (err) {
+			return err;
+		}
+
+		const struct nrf_cloud_obj_json_writer prev = *obj->writer;
+
+		err = nrf_cloud_json_writer_array_begin(obj->writer, key);
+
+		for (uint32_t i = 0; !err && (i < strs_cnt); i++) {
+			err = nrf_cloud_json_writer_str_add(obj->writer, NULL, strs[i]);
+		}
+
+		if (!err) {
+			err = nrf_cloud_json_writer_end(obj->writer);
+		}
+
+		if (err) {
+			*obj->writer = prev;
+		}
+
+		return err;
+	}
 	default:
 		break;
 	}
@@ -762,6 +1011,24 @@ int nrf_cloud_obj_cloud_encode(struct nrf_cloud_obj *const obj)
 		return -ENOSYS;
 #endif
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		if (!obj->writer) {
+			return -ENOENT;
+		}
+
+		int ret = nrf_cloud_json_writer_finish(obj->writer);
+
+		if (ret) {
+			return ret;
+		}
+
+		obj->encoded_data.ptr = obj->writer->buf;
+		obj->encoded_data.len = obj->writer->len;
+		obj->enc_src = NRF_CLOUD_ENC_SRC_CLOUD_ENCODED;
+
+		return 0;
+	}
 	default:
 		break;
 	}
@@ -769,6 +1036,26 @@ int nrf_cloud_obj_cloud_encode(struct nrf_cloud_obj *const obj)
 	return -ENOTSUP;
 }
 
+static int writer_gnss_pvt_add(struct nrf_cloud_obj *const obj,
+			       const struct nrf_cloud_gnss_data *const gnss)
+{
+	int ret = dest_writer_set(obj, true);
+
+	if (ret) {
+		return ret;
+	}
+
+	if (gnss->type == NRF_CLOUD_GNSS_TYPE_PVT) {
+		return nrf_cloud_pvt_data_json_write(&gnss->pvt, obj->writer);
+	}
+
+#if defined(CONFIG_NRF_MODEM)
+	return nrf_cloud_modem_pvt_data_json_write(gnss->mdm_pvt, obj->writer);
+#else
+	return -ENOSYS;
+#endif
+}
+
 int nrf_cloud_obj_gnss_msg_create(struct nrf_cloud_obj *const obj,
 				  const struct nrf_cloud_gnss_data *const gnss)
 {
@@ -810,7 +1097,8 @@ int nrf_cloud_obj_gnss_msg_create(struct nrf_cloud_obj *const obj,
 			goto cleanup;
 		}
 		return nrf_cloud_obj_pvt_add(obj, &gnss->pvt);
-	} else if (obj->type != NRF_CLOUD_OBJ_TYPE_JSON) {
+	} else if ((obj->type != NRF_CLOUD_OBJ_TYPE_JSON) &&
+		   (obj->type != NRF_CLOUD_OBJ_TYPE_JSON_WRITER)) {
 		ret = -ENOTSUP;
 		goto cleanup;
 	}
@@ -820,6 +1108,18 @@ int nrf_cloud_obj_gnss_msg_create(struct nrf_cloud_obj *const obj,
 	case NRF_CLOUD_GNSS_TYPE_MODEM_PVT:
 	case NRF_CLOUD_GNSS_TYPE_PVT:
 
+		if (obj->type == NRF_CLOUD_OBJ_TYPE_JSON_WRITER) {
+			/* There is no separate object to build, the PVT data is written
+			 * directly to the "data" object.
+			 */
+			ret = writer_gnss_pvt_add(obj, gnss);
+			if (ret) {
+				goto cleanup;
+			}
+
+			break;
+		}
+
 		ret = nrf_cloud_obj_init(&pvt_obj);
 		if (ret) {
 			goto cleanup;
@@ -916,6 +1216,12 @@ int nrf_cloud_obj_pvt_add(struct nrf_cloud_obj *const obj,
 
 		return nrf_cloud_pvt_data_encode(pvt, obj->json);
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		int err = dest_writer_set(obj, false);
+
+		return err ? err : nrf_cloud_pvt_data_json_write(pvt, obj->writer);
+	}
 	case NRF_CLOUD_OBJ_TYPE_COAP_CBOR:
 	{
 		if (!obj->coap_cbor) {
@@ -964,6 +1270,12 @@ int nrf_cloud_obj_modem_pvt_add(struct nrf_cloud_obj *const obj,
 
 		return nrf_cloud_modem_pvt_data_encode(mdm_pvt, obj->json);
 	}
+	case NRF_CLOUD_OBJ_TYPE_JSON_WRITER:
+	{
+		int err = dest_writer_set(obj, false);
+
+		return err ? err : nrf_cloud_modem_pvt_data_json_write(mdm_pvt, obj->writer);
+	}
 	default:
 		break;
 	}
@@ -972,6 +1284,68 @@ int nrf_cloud_obj_modem_pvt_add(struct nrf_cloud_obj *const obj,
 }
 #endif /* CONFIG_NRF_MODEM */
 
+static bool location_config_is_set(const struct nrf_cloud_location_config *const config)
+{
+	return config &&
+	       ((config->do_reply != NRF_CLOUD_LOCATION_DOREPLY_DEFAULT) ||
+		(config->hi_conf != NRF_CLOUD_LOCATION_HICONF_DEFAULT) ||
+		(config->fallback != NRF_CLOUD_LOCATION_FALLBACK_DEFAULT));
+}
+
+/* Write the request in the same order as the JSON object type: message, config, and data */
+static int location_request_write(struct nrf_cloud_obj *const obj,
+				  const struct lte_lc_cells_info *const cells_inf,
+				  const struct wifi_scan_info *const wifi_inf,
+				  const struct nrf_cloud_location_config *const config)
+{
+	struct nrf_cloud_obj_json_writer *const writer = obj->writer;
+	int err;
+
+	err = nrf_cloud_obj_msg_init(obj, NRF_CLOUD_JSON_APPID_VAL_LOCATION,
+				     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	if (err) {
+		return err;
+	}
+
+	if (location_config_is_set(config)) {
+		err = nrf_cloud_json_writer_object_begin(writer,
+							 NRF_CLOUD_LOCATION_JSON_KEY_CONFIG);
+
+		if (!err && (config->do_reply != NRF_CLOUD_LOCATION_DOREPLY_DEFAULT)) {
+			err = nrf_cloud_json_writer_bool_add(writer,
+							     NRF_CLOUD_LOCATION_JSON_KEY_DOREPLY,
+							     config->do_reply);
+		}
+		if (!err && (config->hi_conf != NRF_CLOUD_LOCATION_HICONF_DEFAULT)) {
+			err = nrf_cloud_json_writer_bool_add(writer,
+							     NRF_CLOUD_LOCATION_JSON_KEY_HICONF,
+							     config->hi_conf);
+		}
+		if (!err && (config->fallback != NRF_CLOUD_LOCATION_FALLBACK_DEFAULT)) {
+			err = nrf_cloud_json_writer_bool_add(writer,
+							     NRF_CLOUD_LOCATION_JSON_KEY_FALLBACK,
+							     config->fallback);
+		}
+		if (!err) {
+			err = nrf_cloud_json_writer_end(writer);
+		}
+	}
+
+	/* Add cell/wifi info to the data object */
+	if (!err) {
+		err = dest_writer_set(obj, true);
+	}
+	if (!err) {
+		err = nrf_cloud_obj_location_request_payload_add(obj, cells_inf, wifi_inf);
+	}
+
+	if (err) {
+		(void)nrf_cloud_obj_free(obj);
+	}
+
+	return err;
+}
+
 int nrf_cloud_obj_location_request_create(struct nrf_cloud_obj *const obj,
 					  const struct lte_lc_cells_info *const cells_inf,
 					  const struct wifi_scan_info *const wifi_inf,
@@ -986,6 +1360,9 @@ int nrf_cloud_obj_location_request_create(struct nrf_cloud_obj *const obj,
 	if (!NRF_CLOUD_OBJ_TYPE_VALID(obj)) {
 		return -EBADF;
 	}
+	if (obj->type == NRF_CLOUD_OBJ_TYPE_JSON_WRITER) {
+		return location_request_write(obj, cells_inf, wifi_inf, config);
+	}
 	if (obj->type != NRF_CLOUD_OBJ_TYPE_JSON) {
 		return -ENOTSUP;
 	}
@@ -1007,10 +1384,7 @@ int nrf_cloud_obj_location_request_create(struct nrf_cloud_obj *const obj,
 		goto cleanup;
 	}
 
-	if (config &&
-	    ((config->do_reply != NRF_CLOUD_LOCATION_DOREPLY_DEFAULT) ||
-	     (config->hi_conf != NRF_CLOUD_LOCATION_HICONF_DEFAULT) ||
-	     (config->fallback != NRF_CLOUD_LOCATION_FALLBACK_DEFAULT))) {
+	if (location_config_is_set(config)) {
 		err = nrf_cloud_obj_init(&config_obj);
 		if (err) {
 			goto cleanup;
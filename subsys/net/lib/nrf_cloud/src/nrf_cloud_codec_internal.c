@@ -231,6 +231,23 @@ static char *json_strdup(cJSON *const string_obj)
 	return dest;
 }
 
+static char *reader_strdup(const struct nrf_cloud_json_reader_val *const val)
+{
+	char *dest;
+	int len = nrf_cloud_json_reader_str_get(val, NULL, 0);
+
+	if (len < 0) {
+		return NULL;
+	}
+
+	dest = nrf_cloud_calloc(len + 1, 1);
+	if (dest) {
+		(void)nrf_cloud_json_reader_str_get(val, dest, len + 1);
+	}
+
+	return dest;
+}
+
 static int json_add_obj_cs(cJSON *parent, const char *str, cJSON *item)
 {
 	if (!parent || !str || !item) {
@@ -958,6 +975,33 @@ int nrf_cloud_pvt_data_encode(const struct nrf_cloud_gnss_pvt * const pvt,
 	return 0;
 }
 
+int nrf_cloud_pvt_data_json_write(const struct nrf_cloud_gnss_pvt * const pvt,
+				  struct nrf_cloud_obj_json_writer * const writer)
+{
+	if (!pvt || !writer) {
+		return -EINVAL;
+	}
+
+	if (nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_JSON_GNSS_PVT_KEY_LON, pvt->lon) ||
+	    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_JSON_GNSS_PVT_KEY_LAT, pvt->lat) ||
+	    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_JSON_GNSS_PVT_KEY_ACCURACY,
+					  pvt->accuracy) ||
+	    (pvt->has_alt &&
+	     nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_JSON_GNSS_PVT_KEY_ALTITUDE,
+					   pvt->alt)) ||
+	    (pvt->has_speed &&
+	     nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_JSON_GNSS_PVT_KEY_SPEED,
+					   pvt->speed)) ||
+	    (pvt->has_heading &&
+	     nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_JSON_GNSS_PVT_KEY_HEADING,
+					   pvt->heading))) {
+		LOG_DBG("Failed to write PVT data");
+		return -ENOMEM;
+	}
+
+	return 0;
+}
+
 int nrf_cloud_encode_message(const char *app_id, double value, const char *str_val,
 			     const char *topic, int64_t ts, struct nrf_cloud_data *output)
 {
@@ -1903,27 +1947,32 @@ int nrf_cloud_fota_job_decode(struct nrf_cloud_fota_job_info *const job_info,
 	int err = -ENOMSG;
 	size_t job_id_len;
 	int offset = !ble_id ? 1 : 0;
-	cJSON *array = cJSON_Parse(input->ptr);
+	struct nrf_cloud_json_reader_val array;
+	struct nrf_cloud_json_reader_val item = {0};
+	struct nrf_cloud_json_reader_val items[RCV_ITEM_IDX__SIZE] = {0};
 
-	if (!array || !cJSON_IsArray(array)) {
+	memset(job_info, 0, sizeof(*job_info));
+
+	/* The job is read in place, the payload may include the NULL-terminator */
+	if (nrf_cloud_json_reader_get(input->ptr, strnlen(input->ptr, input->len), NULL, &array) ||
+	    (array.type != NRF_CLOUD_JSON_READER_TYPE_ARRAY)) {
 		LOG_ERR("Invalid JSON array");
 		err = -EINVAL;
 		goto cleanup;
 	}
 
-	if (IS_ENABLED(CONFIG_NRF_CLOUD_LOG_LEVEL_DBG)) {
-		char *temp = cJSON_PrintUnformatted(array);
+	LOG_DBG("JSON array: %.*s", (int)array.len, array.ptr);
 
-		if (temp) {
-			LOG_DBG("JSON array: %s", temp);
-			cJSON_FreeString(temp);
+	/* Locate the job items in a single pass, missing items are left as null values */
+	for (int idx = offset; idx < RCV_ITEM_IDX__SIZE; idx++) {
+		if (nrf_cloud_json_reader_array_next(&array, &item)) {
+			break;
 		}
+		items[idx] = item;
 	}
 
-	memset(job_info, 0, sizeof(*job_info));
-
 	/* Get the job ID separately, it may be needed to reject an invalid job */
-	job_info->id = json_strdup(cJSON_GetArrayItem(array, RCV_ITEM_IDX_JOB_ID - offset));
+	job_info->id = reader_strdup(&items[RCV_ITEM_IDX_JOB_ID]);
 	if (job_info->id == NULL) {
 		LOG_ERR("FOTA job ID not found");
 		goto cleanup;
@@ -1939,11 +1988,11 @@ int nrf_cloud_fota_job_decode(struct nrf_cloud_fota_job_info *const job_info,
 
 #if CONFIG_NRF_CLOUD_FOTA_BLE_DEVICES
 	if (ble_id) {
-		char *ble_str;
+		char ble_str[BT_ADDR_LE_STR_LEN];
 
 		/* Get the BLE ID string and copy to bt_addr_t structure */
-		if (json_array_str_get(array, RCV_ITEM_IDX_BLE_ID,
-					  &ble_str)) {
+		if (nrf_cloud_json_reader_str_get(&items[RCV_ITEM_IDX_BLE_ID], ble_str,
+						  sizeof(ble_str)) < 0) {
 			LOG_ERR("Failed to get BLE ID from job");
 			goto cleanup;
 		}
@@ -1957,13 +2006,13 @@ int nrf_cloud_fota_job_decode(struct nrf_cloud_fota_job_info *const job_info,
 #endif
 
 	/* Get and allocate host and path strings */
-	job_info->host = json_strdup(cJSON_GetArrayItem(array, RCV_ITEM_IDX_FILE_HOST - offset));
-	job_info->path = json_strdup(cJSON_GetArrayItem(array, RCV_ITEM_IDX_FILE_PATH - offset));
+	job_info->host = reader_strdup(&items[RCV_ITEM_IDX_FILE_HOST]);
+	job_info->path = reader_strdup(&items[RCV_ITEM_IDX_FILE_PATH]);
 
 	/* Get type and file size */
 	if ((job_info->host == NULL) || (job_info->path == NULL) ||
-	    json_array_num_get(array, RCV_ITEM_IDX_FW_TYPE - offset, (int *)&job_info->type) ||
-	    json_array_num_get(array, RCV_ITEM_IDX_FILE_SIZE - offset, &job_info->file_size)) {
+	    nrf_cloud_json_reader_int_get(&items[RCV_ITEM_IDX_FW_TYPE], (int *)&job_info->type) ||
+	    nrf_cloud_json_reader_int_get(&items[RCV_ITEM_IDX_FILE_SIZE], &job_info->file_size)) {
 		LOG_ERR("Error parsing job info");
 		goto cleanup;
 	}
@@ -1979,10 +2028,6 @@ int nrf_cloud_fota_job_decode(struct nrf_cloud_fota_job_info *const job_info,
 	err = 0;
 
 cleanup:
-	if (array) {
-		cJSON_Delete(array);
-	}
-
 	if (err) {
 		/* On error, leave the job ID so that the job can be cancelled */
 		nrf_cloud_free(job_info->host);
@@ -2545,6 +2590,155 @@ cleanup:
 	return err;
 }
 
+static int ncells_json_write(struct nrf_cloud_obj_json_writer *const writer,
+	const uint8_t ncells_count, const struct lte_lc_ncell *const neighbor_cells)
+{
+	if (!ncells_count || !neighbor_cells) {
+		return -ENODATA;
+	}
+
+	if (nrf_cloud_json_writer_array_begin(writer, NRF_CLOUD_CELL_POS_JSON_KEY_NBORS)) {
+		return -ENOMEM;
+	}
+
+	for (uint8_t i = 0; i < ncells_count; ++i) {
+		const struct lte_lc_ncell *ncell = neighbor_cells + i;
+
+		/* Required parameters for the API call */
+		if (nrf_cloud_json_writer_object_begin(writer, NULL) ||
+		    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_EARFCN,
+						  ncell->earfcn) ||
+		    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_PCI,
+						  ncell->phys_cell_id)) {
+			return -ENOMEM;
+		}
+
+		/* Optional parameters for the API call */
+		if ((ncell->rsrp != NRF_CLOUD_LOCATION_CELL_OMIT_RSRP) &&
+		    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_RSRP,
+						  RSRP_IDX_TO_DBM(ncell->rsrp))) {
+			return -ENOMEM;
+		}
+		if ((ncell->rsrq != NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ) &&
+		    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_RSRQ,
+						  RSRQ_IDX_TO_DB(ncell->rsrq))) {
+			return -ENOMEM;
+		}
+		if ((ncell->time_diff != LTE_LC_CELL_TIME_DIFF_INVALID) &&
+		    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_TDIFF,
+						  ncell->time_diff)) {
+			return -ENOMEM;
+		}
+
+		if (nrf_cloud_json_writer_end(writer)) {
+			return -ENOMEM;
+		}
+	}
+
+	return nrf_cloud_json_writer_end(writer) ? -ENOMEM : 0;
+}
+
+/* Open a cell object in the LTE array; the caller closes it */
+static int lte_inf_json_write(struct nrf_cloud_obj_json_writer *const writer,
+			      struct lte_lc_cell const *const inf)
+{
+	/* Required parameters for the API call */
+	if (nrf_cloud_json_writer_object_begin(writer, NULL) ||
+	    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_ECI, inf->id) ||
+	    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_MCC, inf->mcc) ||
+	    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_MNC, inf->mnc) ||
+	    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_TAC, inf->tac)) {
+		return -ENOMEM;
+	}
+
+	/* Optional parameters for the API call */
+	if ((inf->earfcn != NRF_CLOUD_LOCATION_CELL_OMIT_EARFCN) &&
+	    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_EARFCN,
+					  inf->earfcn)) {
+		return -ENOMEM;
+	}
+
+	if ((inf->rsrp != NRF_CLOUD_LOCATION_CELL_OMIT_RSRP) &&
+	    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_RSRP,
+					  RSRP_IDX_TO_DBM(inf->rsrp))) {
+		return -ENOMEM;
+	}
+
+	if ((inf->rsrq != NRF_CLOUD_LOCATION_CELL_OMIT_RSRQ) &&
+	    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_RSRQ,
+					  RSRQ_IDX_TO_DB(inf->rsrq))) {
+		return -ENOMEM;
+	}
+
+	if (inf->timing_advance != NRF_CLOUD_LOCATION_CELL_OMIT_TIME_ADV) {
+		uint16_t t_adv = MIN(inf->timing_advance, NRF_CLOUD_LOCATION_CELL_TIME_ADV_MAX);
+
+		if (nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_CELL_POS_JSON_KEY_T_ADV,
+						  t_adv)) {
+			return -ENOMEM;
+		}
+	}
+
+	return 0;
+}
+
+int nrf_cloud_cell_pos_req_json_write(struct lte_lc_cells_info const *const inf,
+	struct nrf_cloud_obj_json_writer *const writer)
+{
+	if (!inf || !writer) {
+		return -EINVAL;
+	}
+
+	LOG_DBG("Writing lte_lc_cells_info with ncells_count: %u and gci_cells_count: %u",
+		inf->ncells_count, inf->gci_cells_count);
+
+	/* Restored on failure, so that no partial request is left in the buffer */
+	const struct nrf_cloud_obj_json_writer start = *writer;
+	int err = -ENOMEM;
+
+	if (nrf_cloud_json_writer_array_begin(writer, NRF_CLOUD_CELL_POS_JSON_KEY_LTE)) {
+		goto cleanup;
+	}
+
+	/* Add the current cell to the array; if using a GCI search type, sometimes
+	 * there is no current cell.
+	 */
+	if (inf->current_cell.id != LTE_LC_CELL_EUTRAN_ID_INVALID) {
+		if (lte_inf_json_write(writer, &inf->current_cell)) {
+			goto cleanup;
+		}
+
+		/* Add neighbor cells if present */
+		if ((ncells_json_write(writer, inf->ncells_count,
+				       inf->neighbor_cells) == -ENOMEM) ||
+		    nrf_cloud_json_writer_end(writer)) {
+			goto cleanup;
+		}
+	} else if (!inf->gci_cells_count || !inf->gci_cells) {
+		err = -ENODATA;
+		goto cleanup;
+	}
+
+	/* Add GCI cells if present */
+	for (uint8_t i = 0; inf->gci_cells && (i < inf->gci_cells_count); ++i) {
+		if (lte_inf_json_write(writer, inf->gci_cells + i) ||
+		    nrf_cloud_json_writer_end(writer)) {
+			goto cleanup;
+		}
+	}
+
+	if (nrf_cloud_json_writer_end(writer)) {
+		goto cleanup;
+	}
+
+	return 0;
+
+cleanup:
+	*writer = start;
+	LOG_ERR("Failed to format location request: %d", err);
+	return err;
+}
+
 int nrf_cloud_obj_location_request_payload_add(struct nrf_cloud_obj *const obj,
 	struct lte_lc_cells_info const *const cells_inf,
 	struct wifi_scan_info const *const wifi_inf)
@@ -2558,15 +2752,18 @@ int nrf_cloud_obj_location_request_payload_add(struct nrf_cloud_obj *const obj,
 	}
 
 	/* Currently, only JSON is supported */
-	if (obj->type != NRF_CLOUD_OBJ_TYPE_JSON) {
+	if ((obj->type != NRF_CLOUD_OBJ_TYPE_JSON) &&
+	    (obj->type != NRF_CLOUD_OBJ_TYPE_JSON_WRITER)) {
 		return -ENOTSUP;
 	}
 
 	int err = 0;
 	bool cell_inf_added = false;
+	const bool write = (obj->type == NRF_CLOUD_OBJ_TYPE_JSON_WRITER);
 
 	if (cells_inf) {
-		err = nrf_cloud_cell_pos_req_json_encode(cells_inf, obj->json);
+		err = write ? nrf_cloud_cell_pos_req_json_write(cells_inf, obj->writer) :
+			      nrf_cloud_cell_pos_req_json_encode(cells_inf, obj->json);
 		if ((err == -ENODATA) && (wifi_inf != NULL)) {
 			LOG_WRN("No GCI cells, excluding cellular data from request");
 		} else if (err) {
@@ -2578,7 +2775,8 @@ int nrf_cloud_obj_location_request_payload_add(struct nrf_cloud_obj *const obj,
 	}
 
 	if (wifi_inf) {
-		err = nrf_cloud_wifi_req_json_encode(wifi_inf, obj->json);
+		err = write ? nrf_cloud_wifi_req_json_write(wifi_inf, obj->writer) :
+			      nrf_cloud_wifi_req_json_encode(wifi_inf, obj->json);
 		if (err == -ENODATA) {
 			LOG_WRN("At least %d APs (with a non-local MAC address) are required",
 				NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN);
@@ -2706,6 +2904,109 @@ cleanup:
 	return err;
 }
 
+int nrf_cloud_wifi_req_json_write(struct wifi_scan_info const *const wifi,
+	struct nrf_cloud_obj_json_writer *const writer)
+{
+	if (!wifi || !writer || !wifi->ap_info || !wifi->cnt) {
+		return -EINVAL;
+	}
+
+	/* Restored on failure, so that no partial request is left in the buffer */
+	const struct nrf_cloud_obj_json_writer start = *writer;
+	int err = -ENOMEM;
+	int encoded_cnt = 0;
+	const bool add_all = IS_ENABLED(CONFIG_NRF_CLOUD_WIFI_LOCATION_ENCODE_OPT_ALL);
+	const bool add_rssi = (add_all ||
+			       IS_ENABLED(CONFIG_NRF_CLOUD_WIFI_LOCATION_ENCODE_OPT_MAC_RSSI));
+
+	LOG_DBG("Writing wifi_scan_info with count: %u", wifi->cnt);
+
+	if (nrf_cloud_json_writer_object_begin(writer, NRF_CLOUD_LOCATION_JSON_KEY_WIFI) ||
+	    nrf_cloud_json_writer_array_begin(writer, NRF_CLOUD_LOCATION_JSON_KEY_APS)) {
+		goto cleanup;
+	}
+
+	for (uint8_t cnt = 0; cnt < wifi->cnt; ++cnt) {
+		char str_buf[MAX(WIFI_MAC_ADDR_STR_LEN, WIFI_SSID_MAX_LEN) + 1];
+		struct wifi_scan_result const *const ap = (wifi->ap_info + cnt);
+		int ret;
+
+		if (is_local_mac(ap->mac)) {
+			LOG_DBG("Skipping local MAC %02x:%02x:%02x:...",
+				ap->mac[0], ap->mac[1], ap->mac[2]);
+			continue;
+		}
+
+		/* MAC address is the only required parameter for the API call */
+		ret = snprintk(str_buf, sizeof(str_buf),
+			       WIFI_MAC_ADDR_TEMPLATE,
+			       ap->mac[0], ap->mac[1], ap->mac[2],
+			       ap->mac[3], ap->mac[4], ap->mac[5]);
+		if ((ret != WIFI_MAC_ADDR_STR_LEN) ||
+		    nrf_cloud_json_writer_object_begin(writer, NULL) ||
+		    nrf_cloud_json_writer_str_add(writer, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_MAC,
+						  str_buf)) {
+			goto cleanup;
+		}
+
+		/* Optional parameters for the API call */
+		if (add_rssi && (ap->rssi != NRF_CLOUD_LOCATION_WIFI_OMIT_RSSI) &&
+		    nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_LOCATION_JSON_KEY_WIFI_RSSI,
+						  ap->rssi)) {
+			goto cleanup;
+		}
+
+		if (add_all) {
+			memset(str_buf, 0, sizeof(str_buf));
+			if ((ap->ssid_length > 0) && (ap->ssid_length <= WIFI_SSID_MAX_LEN)) {
+				memcpy(str_buf, ap->ssid, ap->ssid_length);
+			}
+
+			if ((str_buf[0] != '\0') &&
+			    nrf_cloud_json_writer_str_add(writer,
+							  NRF_CLOUD_LOCATION_JSON_KEY_WIFI_SSID,
+							  str_buf)) {
+				goto cleanup;
+			}
+
+			if ((ap->channel != NRF_CLOUD_LOCATION_WIFI_OMIT_CHAN) &&
+			    nrf_cloud_json_writer_num_add(writer,
+							  NRF_CLOUD_LOCATION_JSON_KEY_WIFI_CH,
+							  ap->channel)) {
+				goto cleanup;
+			}
+		}
+
+		if (nrf_cloud_json_writer_end(writer)) {
+			goto cleanup;
+		}
+
+		++encoded_cnt;
+	}
+
+	LOG_DBG("Wrote %d access points", encoded_cnt);
+
+	if (encoded_cnt < NRF_CLOUD_LOCATION_WIFI_AP_CNT_MIN) {
+		err = -ENODATA;
+		goto cleanup;
+	}
+
+	/* Close the access point array and the Wi-Fi object */
+	if (nrf_cloud_json_writer_end(writer) || nrf_cloud_json_writer_end(writer)) {
+		goto cleanup;
+	}
+
+	return 0;
+
+cleanup:
+	*writer = start;
+	if (err == -ENOMEM) {
+		LOG_ERR("Failed to format Wi-Fi location request, buffer too small");
+	}
+
+	return err;
+}
+
 static bool json_item_string_exists(const cJSON *const obj, const char *const key,
 				    const char *const val)
 {
@@ -2731,10 +3032,13 @@ static bool json_item_string_exists(const cJSON *const obj, const char *const ke
 	return (strcmp(str_val, val) == 0);
 }
 
-static void nrf_cloud_parse_location_anchors_json(const cJSON * const loc_obj,
+static void nrf_cloud_parse_location_anchors_json(
+	const struct nrf_cloud_json_reader_val *const loc_obj,
 	struct nrf_cloud_location_result * const location_out)
 {
-	cJSON *anchors, *mac, *name;
+	struct nrf_cloud_json_reader_val anchors;
+	struct nrf_cloud_json_reader_val anc = {0};
+	struct nrf_cloud_json_reader_val mac, name;
 	size_t buf_idx = 0;
 	size_t node_sz;
 	size_t name_sz;
@@ -2742,27 +3046,32 @@ static void nrf_cloud_parse_location_anchors_json(const cJSON * const loc_obj,
 
 	/* Init anchor output */
 	sys_slist_init(&location_out->anchor_list);
+	location_out->anchor_cnt = 0;
 	if (buf_exists) {
 		location_out->anchor_buf[0] = '\0';
 	}
 
 	/* Anchor info is provided in an array of objects */
-	anchors	= cJSON_GetObjectItem(loc_obj, NRF_CLOUD_LOCATION_JSON_KEY_ANCHORS);
-	location_out->anchor_cnt = (uint32_t)cJSON_GetArraySize(anchors);
+	if (nrf_cloud_json_reader_child_get(loc_obj, NRF_CLOUD_LOCATION_JSON_KEY_ANCHORS,
+					    &anchors)) {
+		return;
+	}
 
-	for (int idx = 0; idx < location_out->anchor_cnt; ++idx) {
+	while (nrf_cloud_json_reader_array_next(&anchors, &anc) == 0) {
 		struct nrf_cloud_anchor_list_node *node;
-		cJSON *anc = cJSON_GetArrayItem(anchors, idx);
 
-		mac	= cJSON_GetObjectItem(anc, NRF_CLOUD_LOCATION_JSON_KEY_ANC_MAC);
-		name	= cJSON_GetObjectItem(anc, NRF_CLOUD_LOCATION_JSON_KEY_ANC_NAME);
+		location_out->anchor_cnt++;
 
-		if (cJSON_IsString(mac)) {
-			LOG_DBG("Wi-Fi anchor MAC: %s", mac->valuestring);
+		if (!nrf_cloud_json_reader_child_get(&anc, NRF_CLOUD_LOCATION_JSON_KEY_ANC_MAC,
+						     &mac) &&
+		    (mac.type == NRF_CLOUD_JSON_READER_TYPE_STRING)) {
+			LOG_DBG("Wi-Fi anchor MAC: %.*s", (int)mac.len, mac.ptr);
 		}
 
-		if (cJSON_IsString(name)) {
-			LOG_DBG("Wi-Fi anchor name: %s", name->valuestring);
+		if (!nrf_cloud_json_reader_child_get(&anc, NRF_CLOUD_LOCATION_JSON_KEY_ANC_NAME,
+						     &name) &&
+		    (name.type == NRF_CLOUD_JSON_READER_TYPE_STRING)) {
+			LOG_DBG("Wi-Fi anchor name: %.*s", (int)name.len, name.ptr);
 		} else {
 			continue;
 		}
@@ -2773,7 +3082,7 @@ static void nrf_cloud_parse_location_anchors_json(const cJSON * const loc_obj,
 		}
 
 		/* Get the size of the anchor name and node container */
-		name_sz = strlen(name->valuestring) + 1;
+		name_sz = nrf_cloud_json_reader_str_get(&name, NULL, 0) + 1;
 		node_sz = sizeof(*node) + name_sz;
 
 		/* Ensure node will fit in buffer */
@@ -2786,7 +3095,7 @@ static void nrf_cloud_parse_location_anchors_json(const cJSON * const loc_obj,
 		node = (struct nrf_cloud_anchor_list_node *)&location_out->anchor_buf[buf_idx];
 		node->node.next = NULL;
 		/* Copy the anchor name */
-		memcpy(node->name, name->valuestring, name_sz);
+		(void)nrf_cloud_json_reader_str_get(&name, node->name, name_sz);
 		/* Update the buffer index */
 		buf_idx += node_sz;
 		/* Add node to list */
@@ -2794,43 +3103,47 @@ static void nrf_cloud_parse_location_anchors_json(const cJSON * const loc_obj,
 	}
 }
 
-static int nrf_cloud_parse_location_json(const cJSON *const loc_obj,
+static int nrf_cloud_parse_location_json(const struct nrf_cloud_json_reader_val *const loc_obj,
 	struct nrf_cloud_location_result *const location_out)
 {
 	if (!loc_obj || !location_out) {
 		return -EINVAL;
 	}
 
-	cJSON *lat, *lon, *unc;
+	struct nrf_cloud_json_reader_val lat, lon, unc, type;
 	bool anchor = false;
-	char *type;
-
-	lat = cJSON_GetObjectItem(loc_obj, NRF_CLOUD_LOCATION_JSON_KEY_LAT);
-	lon = cJSON_GetObjectItem(loc_obj, NRF_CLOUD_LOCATION_JSON_KEY_LON);
-	unc = cJSON_GetObjectItem(loc_obj, NRF_CLOUD_LOCATION_JSON_KEY_UNCERT);
-
-	if (!cJSON_IsNumber(lat) || !cJSON_IsNumber(lon) || !cJSON_IsNumber(unc)) {
+	double lat_val, lon_val;
+	int unc_val;
+
+	if (nrf_cloud_json_reader_child_get(loc_obj, NRF_CLOUD_LOCATION_JSON_KEY_LAT, &lat) ||
+	    nrf_cloud_json_reader_child_get(loc_obj, NRF_CLOUD_LOCATION_JSON_KEY_LON, &lon) ||
+	    nrf_cloud_json_reader_child_get(loc_obj, NRF_CLOUD_LOCATION_JSON_KEY_UNCERT, &unc) ||
+	    nrf_cloud_json_reader_num_get(&lat, &lat_val) ||
+	    nrf_cloud_json_reader_num_get(&lon, &lon_val) ||
+	    nrf_cloud_json_reader_int_get(&unc, &unc_val)) {
 		return -EBADMSG;
 	}
 
-	location_out->lat = lat->valuedouble;
-	location_out->lon = lon->valuedouble;
-	location_out->unc = (uint32_t)unc->valueint;
+	location_out->lat = lat_val;
+	location_out->lon = lon_val;
+	location_out->unc = (uint32_t)unc_val;
 
 	location_out->type = LOCATION_TYPE__INVALID;
 
-	if (!get_string_from_obj(loc_obj, NRF_CLOUD_JSON_FULFILL_KEY, &type)) {
-		if (!strcmp(type, NRF_CLOUD_LOCATION_TYPE_VAL_MCELL)) {
+	if (!nrf_cloud_json_reader_child_get(loc_obj, NRF_CLOUD_JSON_FULFILL_KEY, &type) &&
+	    (type.type == NRF_CLOUD_JSON_READER_TYPE_STRING)) {
+		if (nrf_cloud_json_reader_str_eq(&type, NRF_CLOUD_LOCATION_TYPE_VAL_MCELL)) {
 			location_out->type = LOCATION_TYPE_MULTI_CELL;
-		} else if (!strcmp(type, NRF_CLOUD_LOCATION_TYPE_VAL_SCELL)) {
+		} else if (nrf_cloud_json_reader_str_eq(&type, NRF_CLOUD_LOCATION_TYPE_VAL_SCELL)) {
 			location_out->type = LOCATION_TYPE_SINGLE_CELL;
-		} else if (!strcmp(type, NRF_CLOUD_LOCATION_TYPE_VAL_WIFI)) {
+		} else if (nrf_cloud_json_reader_str_eq(&type, NRF_CLOUD_LOCATION_TYPE_VAL_WIFI)) {
 			location_out->type = LOCATION_TYPE_WIFI;
-		} else if (!strcmp(type, NRF_CLOUD_LOCATION_TYPE_VAL_ANCHOR)) {
+		} else if (nrf_cloud_json_reader_str_eq(&type,
+							NRF_CLOUD_LOCATION_TYPE_VAL_ANCHOR)) {
 			location_out->type = LOCATION_TYPE_WIFI;
 			anchor = true;
 		} else {
-			LOG_WRN("Unhandled location type: %s", type);
+			LOG_WRN("Unhandled location type: %.*s", (int)type.len, type.ptr);
 		}
 	} else {
 		LOG_WRN("Location type not found in message");
@@ -2844,6 +3157,43 @@ static int nrf_cloud_parse_location_json(const cJSON *const loc_obj,
 	return 0;
 }
 
+/* Check for a string item, or a null item if val is NULL */
+static bool reader_item_string_exists(const struct nrf_cloud_json_reader_val *const obj,
+				      const char *const key, const char *const val)
+{
+	struct nrf_cloud_json_reader_val item;
+
+	if (nrf_cloud_json_reader_child_get(obj, key, &item)) {
+		return false;
+	}
+
+	if (!val) {
+		return item.type == NRF_CLOUD_JSON_READER_TYPE_NULL;
+	}
+
+	return nrf_cloud_json_reader_str_eq(&item, val);
+}
+
+static int reader_error_code_get(const struct nrf_cloud_json_reader_val *const obj,
+				 enum nrf_cloud_error * const err)
+{
+	struct nrf_cloud_json_reader_val err_obj;
+	double err_val;
+
+	if (nrf_cloud_json_reader_child_get(obj, NRF_CLOUD_JSON_ERR_KEY, &err_obj)) {
+		return -ENOMSG;
+	}
+
+	if (nrf_cloud_json_reader_num_get(&err_obj, &err_val)) {
+		LOG_WRN("Invalid JSON data type for error value");
+		return -EBADMSG;
+	}
+
+	*err = (enum nrf_cloud_error)err_val;
+
+	return 0;
+}
+
 int nrf_cloud_error_msg_decode(const char *const buf,
 			       const char *const app_id,
 			       const char *const msg_type,
@@ -2890,15 +3240,15 @@ int nrf_cloud_location_response_decode(const char *const buf,
 				       struct nrf_cloud_location_result *result)
 {
 	int ret;
-	cJSON *loc_obj;
-	cJSON *data_obj;
+	struct nrf_cloud_json_reader_val loc_obj;
+	struct nrf_cloud_json_reader_val data_obj;
 
 	if ((buf == NULL) || (result == NULL)) {
 		return -EINVAL;
 	}
 
-	loc_obj = cJSON_Parse(buf);
-	if (!loc_obj) {
+	/* The response is read in place, without building a cJSON tree */
+	if (nrf_cloud_json_reader_get(buf, strlen(buf), NULL, &loc_obj)) {
 		LOG_DBG("No JSON found for location");
 		return 1;
 	}
@@ -2906,7 +3256,7 @@ int nrf_cloud_location_response_decode(const char *const buf,
 	/* First, check to see if this is a REST payload, which is not wrapped in
 	 * an nRF Cloud MQTT message
 	 */
-	ret = nrf_cloud_parse_location_json(loc_obj, result);
+	ret = nrf_cloud_parse_location_json(&loc_obj, result);
 	if (ret == 0) {
 		goto cleanup;
 	}
@@ -2916,18 +3266,17 @@ int nrf_cloud_location_response_decode(const char *const buf,
 	ret = 1;
 
 	/* Check for nRF Cloud MQTT message; valid appId and msgType */
-	if (!json_item_string_exists(loc_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
-				     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA) ||
-	    !json_item_string_exists(loc_obj, NRF_CLOUD_JSON_APPID_KEY,
-				     NRF_CLOUD_JSON_APPID_VAL_LOCATION)) {
+	if (!reader_item_string_exists(&loc_obj, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+				       NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA) ||
+	    !reader_item_string_exists(&loc_obj, NRF_CLOUD_JSON_APPID_KEY,
+				       NRF_CLOUD_JSON_APPID_VAL_LOCATION)) {
 		/* Not a location data message */
 		goto cleanup;
 	}
 
 	/* MQTT payload format found, parse the data */
-	data_obj = cJSON_GetObjectItem(loc_obj, NRF_CLOUD_JSON_DATA_KEY);
-	if (data_obj) {
-		ret = nrf_cloud_parse_location_json(data_obj, result);
+	if (!nrf_cloud_json_reader_child_get(&loc_obj, NRF_CLOUD_JSON_DATA_KEY, &data_obj)) {
+		ret = nrf_cloud_parse_location_json(&data_obj, result);
 		if (ret) {
 			LOG_ERR("Failed to parse location data");
 		}
@@ -2936,7 +3285,7 @@ int nrf_cloud_location_response_decode(const char *const buf,
 	}
 
 	/* Check for error code */
-	ret = get_error_code_value(loc_obj, &result->err);
+	ret = reader_error_code_get(&loc_obj, &result->err);
 	if (ret) {
 		/* No data or error was found */
 		LOG_ERR("Expected data not found in location message");
@@ -2947,8 +3296,6 @@ int nrf_cloud_location_response_decode(const char *const buf,
 	}
 
 cleanup:
-	cJSON_Delete(loc_obj);
-
 	if (ret < 0) {
 		/* Clear data on error */
 		result->lat = 0.0;
@@ -3292,14 +3639,10 @@ cleanup:
 }
 
 #if defined(CONFIG_NRF_MODEM)
-int nrf_cloud_modem_pvt_data_encode(const struct nrf_modem_gnss_pvt_data_frame	* const mdm_pvt,
-				    cJSON * const pvt_data_obj)
+static struct nrf_cloud_gnss_pvt modem_pvt_convert(
+	const struct nrf_modem_gnss_pvt_data_frame * const mdm_pvt)
 {
-	if (!mdm_pvt || !pvt_data_obj) {
-		return -EINVAL;
-	}
-
-	struct nrf_cloud_gnss_pvt pvt = {
+	return (struct nrf_cloud_gnss_pvt) {
 		.lon =		mdm_pvt->longitude,
 		.lat =		mdm_pvt->latitude,
 		.accuracy =	mdm_pvt->accuracy,
@@ -3310,9 +3653,31 @@ int nrf_cloud_modem_pvt_data_encode(const struct nrf_modem_gnss_pvt_data_frame	*
 		.heading =	mdm_pvt->heading,
 		.has_heading =	1
 	};
+}
+
+int nrf_cloud_modem_pvt_data_encode(const struct nrf_modem_gnss_pvt_data_frame	* const mdm_pvt,
+				    cJSON * const pvt_data_obj)
+{
+	if (!mdm_pvt || !pvt_data_obj) {
+		return -EINVAL;
+	}
+
+	struct nrf_cloud_gnss_pvt pvt = modem_pvt_convert(mdm_pvt);
 
 	return nrf_cloud_pvt_data_encode(&pvt, pvt_data_obj);
 }
+
+int nrf_cloud_modem_pvt_data_json_write(const struct nrf_modem_gnss_pvt_data_frame * const mdm_pvt,
+					struct nrf_cloud_obj_json_writer * const writer)
+{
+	if (!mdm_pvt || !writer) {
+		return -EINVAL;
+	}
+
+	struct nrf_cloud_gnss_pvt pvt = modem_pvt_convert(mdm_pvt);
+
+	return nrf_cloud_pvt_data_json_write(&pvt, writer);
+}
 #endif /* CONFIG_NRF_MODEM */
 
 #if defined(CONFIG_NRF_CLOUD_AGNSS) || defined(CONFIG_NRF_CLOUD_PGPS)
@@ -0,0 +1,708 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <limits.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include "nrf_cloud_json_reader.h"
+
+/* Deepest nesting of objects and arrays, one bit of the array mask per level */
+#define DEPTH_MAX 32
+
+/* Longest number text, the same limit as cJSON's parse_number() */
+#define NUM_STR_SIZE 64
+
+/* Largest array index in a path */
+#define INDEX_DIGITS_MAX 9
+
+struct reader {
+	const char *pos;
+	const char *end;
+};
+
+static bool at_end(const struct reader *const r)
+{
+	return r->pos >= r->end;
+}
+
+static void ws_skip(struct reader *const r)
+{
+	while (!at_end(r) &&
+	       ((*r->pos == ' ') || (*r->pos == '\t') || (*r->pos == '\n') || (*r->pos == '\r'))) {
+		r->pos++;
+	}
+}
+
+/* Skip the whitespace and the expected character */
+static int char_skip(struct reader *const r, const char c)
+{
+	ws_skip(r);
+
+	if (at_end(r) || (*r->pos != c)) {
+		return -EBADMSG;
+	}
+
+	r->pos++;
+
+	return 0;
+}
+
+static bool hex4_get(const char *const p, const char *const end, uint32_t *const val)
+{
+	if ((end - p) < 4) {
+		return false;
+	}
+
+	*val = 0;
+
+	for (int i = 0; i < 4; i++) {
+		const char c = p[i];
+
+		if ((c >= '0') && (c <= '9')) {
+			*val = (*val << 4) | (c - '0');
+		} else if ((c >= 'a') && (c <= 'f')) {
+			*val = (*val << 4) | (c - 'a' + 10);
+		} else if ((c >= 'A') && (c <= 'F')) {
+			*val = (*val << 4) | (c - 'A' + 10);
+		} else {
+			return false;
+		}
+	}
+
+	return true;
+}
+
+/* Decode a \uXXXX escape, or a surrogate pair of them, to UTF-8 */
+static size_t utf16_decode(const char *const p, const char *const end, char out[4],
+			   size_t *const out_len)
+{
+	size_t used = 6;
+	uint32_t low;
+	uint32_t cp;
+
+	if (!hex4_get(&p[2], end, &cp) || (cp == 0) || ((cp >= 0xDC00) && (cp <= 0xDFFF))) {
+		return 0;
+	}
+
+	if ((cp >= 0xD800) && (cp <= 0xDBFF)) {
+		if (((end - p) < 12) || (p[6] != '\\') || (p[7] != 'u') ||
+		    !hex4_get(&p[8], end, &low) || (low < 0xDC00) || (low > 0xDFFF)) {
+			return 0;
+		}
+
+		cp = 0x10000 + (((cp & 0x3FF) << 10) | (low & 0x3FF));
+		used = 12;
+	}
+
+	if (cp < 0x80) {
+		out[0] = (char)cp;
+		*out_len = 1;
+	} else if (cp < 0x800) {
+		out[0] = (char)(0xC0 | (cp >> 6));
+		out[1] = (char)(0x80 | (cp & 0x3F));
+		*out_len = 2;
+	} else if (cp < 0x10000) {
+		out[0] = (char)(0xE0 | (cp >> 12));
+		out[1] = (char)(0x80 | ((cp >> 6) & 0x3F));
+		out[2] = (char)(0x80 | (cp & 0x3F));
+		*out_len = 3;
+	} else {
+		out[0] = (char)(0xF0 | (cp >> 18));
+		out[1] = (char)(0x80 | ((cp >> 12) & 0x3F));
+		out[2] = (char)(0x80 | ((cp >> 6) & 0x3F));
+		out[3] = (char)(0x80 | (cp & 0x3F));
+		*out_len = 4;
+	}
+
+	return used;
+}
+
+/* Decode the character at p in an escaped string.
+ * Returns the number of characters used, or 0 if the escape is not valid.
+ */
+static size_t char_decode(const char *const p, const char *const end, char out[4],
+			  size_t *const out_len)
+{
+	if (*p != '\\') {
+		out[0] = *p;
+		*out_len = 1;
+		return 1;
+	}
+
+	if ((end - p) < 2) {
+		return 0;
+	}
+
+	switch (p[1]) {
+	case '"':
+	case '\\':
+	case '/':
+		out[0] = p[1];
+		break;
+	case 'b':
+		out[0] = '\b';
+		break;
+	case 'f':
+		out[0] = '\f';
+		break;
+	case 'n':
+		out[0] = '\n';
+		break;
+	case 'r':
+		out[0] = '\r';
+		break;
+	case 't':
+		out[0] = '\t';
+		break;
+	case 'u':
+		return utf16_decode(p, end, out, out_len);
+	default:
+		return 0;
+	}
+
+	*out_len = 1;
+
+	return 2;
+}
+
+/* Compare an escaped string with an unescaped one */
+static bool str_match(const char *const esc, const size_t esc_len, const char *const str,
+		      const size_t str_len)
+{
+	const char *const end = esc + esc_len;
+	const char *p = esc;
+	size_t pos = 0;
+
+	if (!memchr(esc, '\\', esc_len)) {
+		return (esc_len == str_len) && (memcmp(esc, str, str_len) == 0);
+	}
+
+	while (p < end) {
+		char out[4];
+		size_t out_len;
+		size_t used = char_decode(p, end, out, &out_len);
+
+		if (!used || ((pos + out_len) > str_len) || memcmp(&str[pos], out, out_len)) {
+			return false;
+		}
+
+		p += used;
+		pos += out_len;
+	}
+
+	return pos == str_len;
+}
+
+static int str_skip(struct reader *const r)
+{
+	/* Skip the opening quote */
+	r->pos++;
+
+	while (!at_end(r)) {
+		char out[4];
+		size_t out_len;
+		size_t used;
+
+		if (*r->pos == '"') {
+			r->pos++;
+			return 0;
+		}
+
+		used = char_decode(r->pos, r->end, out, &out_len);
+		if (!used) {
+			return -EBADMSG;
+		}
+
+		r->pos += used;
+	}
+
+	return -EBADMSG;
+}
+
+static bool digit_skip(struct reader *const r)
+{
+	const char *const start = r->pos;
+
+	while (!at_end(r) && (*r->pos >= '0') && (*r->pos <= '9')) {
+		r->pos++;
+	}
+
+	return r->pos > start;
+}
+
+static int num_skip(struct reader *const r)
+{
+	if (*r->pos == '-') {
+		r->pos++;
+	}
+
+	if (!at_end(r) && (*r->pos == '0')) {
+		r->pos++;
+	} else if (!digit_skip(r)) {
+		return -EBADMSG;
+	}
+
+	if (!at_end(r) && (*r->pos == '.')) {
+		r->pos++;
+		if (!digit_skip(r)) {
+			return -EBADMSG;
+		}
+	}
+
+	if (!at_end(r) && ((*r->pos == 'e') || (*r->pos == 'E'))) {
+		r->pos++;
+		if (!at_end(r) && ((*r->pos == '+') || (*r->pos == '-'))) {
+			r->pos++;
+		}
+		if (!digit_skip(r)) {
+			return -EBADMSG;
+		}
+	}
+
+	return 0;
+}
+
+static int literal_skip(struct reader *const r, const char *const literal, const size_t len)
+{
+	if (((size_t)(r->end - r->pos) < len) || memcmp(r->pos, literal, len)) {
+		return -EBADMSG;
+	}
+
+	r->pos += len;
+
+	return 0;
+}
+
+static int scalar_skip(struct reader *const r)
+{
+	switch (*r->pos) {
+	case '"':
+		return str_skip(r);
+	case 't':
+		return literal_skip(r, "true", 4);
+	case 'f':
+		return literal_skip(r, "false", 5);
+	case 'n':
+		return literal_skip(r, "null", 4);
+	default:
+		return num_skip(r);
+	}
+}
+
+static enum nrf_cloud_json_reader_type type_get(const char c)
+{
+	switch (c) {
+	case '{':
+		return NRF_CLOUD_JSON_READER_TYPE_OBJECT;
+	case '[':
+		return NRF_CLOUD_JSON_READER_TYPE_ARRAY;
+	case '"':
+		return NRF_CLOUD_JSON_READER_TYPE_STRING;
+	case 't':
+	case 'f':
+		return NRF_CLOUD_JSON_READER_TYPE_BOOL;
+	case 'n':
+		return NRF_CLOUD_JSON_READER_TYPE_NULL;
+	default:
+		return NRF_CLOUD_JSON_READER_TYPE_NUMBER;
+	}
+}
+
+/* Skip the key and the colon of an object member */
+static int key_skip(struct reader *const r)
+{
+	ws_skip(r);
+
+	if (at_end(r) || (*r->pos != '"')) {
+		return -EBADMSG;
+	}
+
+	int err = str_skip(r);
+
+	return err ? err : char_skip(r, ':');
+}
+
+/* Skip the separator after an item; returns -ENOENT at the end of the container */
+static int item_next(struct reader *const r, const char close)
+{
+	ws_skip(r);
+
+	if (at_end(r)) {
+		return -EBADMSG;
+	}
+
+	if (*r->pos == close) {
+		r->pos++;
+		return -ENOENT;
+	}
+
+	if (*r->pos != ',') {
+		return -EBADMSG;
+	}
+
+	r->pos++;
+
+	return 0;
+}
+
+/* Skip a value, checking the nested objects and arrays without recursion */
+static int value_skip(struct reader *const r, struct nrf_cloud_json_reader_val *const val)
+{
+	uint32_t array_mask = 0;
+	size_t depth = 0;
+	int err;
+
+	ws_skip(r);
+
+	if (at_end(r)) {
+		return -EBADMSG;
+	}
+
+	val->type = type_get(*r->pos);
+	val->ptr = r->pos;
+
+	do {
+		bool item_done = true;
+
+		err = 0;
+		ws_skip(r);
+
+		if (at_end(r)) {
+			return -EBADMSG;
+		}
+
+		if ((*r->pos == '{') || (*r->pos == '[')) {
+			const bool array = (*r->pos == '[');
+
+			if (depth == DEPTH_MAX) {
+				return -E2BIG;
+			}
+
+			WRITE_BIT(array_mask, depth, array);
+			depth++;
+			r->pos++;
+			ws_skip(r);
+
+			if (!at_end(r) && (*r->pos == (array ? ']' : '}'))) {
+				r->pos++;
+				depth--;
+			} else {
+				item_done = false;
+				err = array ? 0 : key_skip(r);
+			}
+		} else {
+			err = scalar_skip(r);
+		}
+
+		if (err) {
+			return err;
+		}
+
+		/* Close the containers that end after this item */
+		while (item_done && (depth > 0)) {
+			const bool array = array_mask & BIT(depth - 1);
+
+			err = item_next(r, array ? ']' : '}');
+			if (err == -ENOENT) {
+				depth--;
+			} else if (err) {
+				return err;
+			} else {
+				item_done = false;
+				err = array ? 0 : key_skip(r);
+				if (err) {
+					return err;
+				}
+			}
+		}
+	} while (depth > 0);
+
+	val->len = r->pos - val->ptr;
+
+	if (val->type == NRF_CLOUD_JSON_READER_TYPE_STRING) {
+		val->ptr++;
+		val->len -= 2;
+	}
+
+	return 0;
+}
+
+/* Move to the value of the object member with the given key */
+static int member_find(struct reader *const r, const char *const key, const size_t key_len)
+{
+	struct nrf_cloud_json_reader_val skipped;
+	int err;
+
+	/* Skip the opening brace */
+	r->pos++;
+	ws_skip(r);
+
+	if (!at_end(r) && (*r->pos == '}')) {
+		return -ENOENT;
+	}
+
+	do {
+		const char *name;
+		bool match;
+
+		ws_skip(r);
+
+		if (at_end(r) || (*r->pos != '"')) {
+			return -EBADMSG;
+		}
+
+		name = r->pos + 1;
+		err = str_skip(r);
+		if (err) {
+			return err;
+		}
+
+		match = str_match(name, r->pos - 1 - name, key, key_len);
+
+		err = char_skip(r, ':');
+		if (err || match) {
+			return err;
+		}
+
+		err = value_skip(r, &skipped);
+		if (err) {
+			return err;
+		}
+
+		err = item_next(r, '}');
+	} while (!err);
+
+	return err;
+}
+
+/* Move to the array item with the given index */
+static int item_find(struct reader *const r, const char *const index_str, const size_t len)
+{
+	struct nrf_cloud_json_reader_val skipped;
+	size_t index = 0;
+	int err;
+
+	if ((len == 0) || (len > INDEX_DIGITS_MAX)) {
+		return -ENOENT;
+	}
+
+	for (size_t i = 0; i < len; i++) {
+		if ((index_str[i] < '0') || (index_str[i] > '9')) {
+			return -ENOENT;
+		}
+		index = (index * 10) + (index_str[i] - '0');
+	}
+
+	/* Skip the opening bracket */
+	r->pos++;
+	ws_skip(r);
+
+	if (!at_end(r) && (*r->pos == ']')) {
+		return -ENOENT;
+	}
+
+	for (size_t i = 0; i < index; i++) {
+		err = value_skip(r, &skipped);
+		if (!err) {
+			err = item_next(r, ']');
+		}
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+int nrf_cloud_json_reader_get(const char *const json, const size_t len, const char *const path,
+			      struct nrf_cloud_json_reader_val *const val)
+{
+	if (!json || !val) {
+		return -EINVAL;
+	}
+
+	struct reader r = {
+		.pos = json,
+		.end = json + len,
+	};
+	const char *seg = path;
+	int err;
+
+	while (seg && (*seg != '\0')) {
+		size_t seg_len = strcspn(seg, ".");
+
+		ws_skip(&r);
+
+		if (at_end(&r)) {
+			return -EBADMSG;
+		}
+
+		if (*r.pos == '{') {
+			err = member_find(&r, seg, seg_len);
+		} else if (*r.pos == '[') {
+			err = item_find(&r, seg, seg_len);
+		} else {
+			err = -ENOENT;
+		}
+
+		if (err) {
+			return err;
+		}
+
+		seg += seg_len;
+		if (*seg == '.') {
+			seg++;
+		}
+	}
+
+	return value_skip(&r, val);
+}
+
+int nrf_cloud_json_reader_array_next(const struct nrf_cloud_json_reader_val *const array,
+				     struct nrf_cloud_json_reader_val *const item)
+{
+	if (!array || !item) {
+		return -EINVAL;
+	}
+
+	if (array->type != NRF_CLOUD_JSON_READER_TYPE_ARRAY) {
+		return -ENOMSG;
+	}
+
+	struct reader r = {
+		.end = array->ptr + array->len,
+	};
+	int err;
+
+	if (!item->ptr) {
+		/* Skip the opening bracket */
+		r.pos = array->ptr + 1;
+		ws_skip(&r);
+
+		if (!at_end(&r) && (*r.pos == ']')) {
+			return -ENOENT;
+		}
+	} else {
+		/* Continue after the previous item, including the closing quote of a string */
+		r.pos = item->ptr + item->len +
+			((item->type == NRF_CLOUD_JSON_READER_TYPE_STRING) ? 1 : 0);
+
+		err = item_next(&r, ']');
+		if (err) {
+			return err;
+		}
+	}
+
+	return value_skip(&r, item);
+}
+
+int nrf_cloud_json_reader_str_get(const struct nrf_cloud_json_reader_val *const val,
+				  char *const buf, const size_t size)
+{
+	if (!val || (buf && (size == 0))) {
+		return buf ? -ENOMEM : -EINVAL;
+	}
+
+	if (val->type != NRF_CLOUD_JSON_READER_TYPE_STRING) {
+		return -ENOMSG;
+	}
+
+	const char *const end = val->ptr + val->len;
+	const char *p = val->ptr;
+	size_t len = 0;
+
+	while (p < end) {
+		char out[4];
+		size_t out_len;
+		size_t used = char_decode(p, end, out, &out_len);
+
+		if (!used) {
+			return -EBADMSG;
+		}
+
+		if (buf) {
+			/* Keep room for the NULL-terminator */
+			if ((len + out_len) >= size) {
+				return -ENOMEM;
+			}
+			memcpy(&buf[len], out, out_len);
+		}
+
+		p += used;
+		len += out_len;
+	}
+
+	if (buf) {
+		buf[len] = '\0';
+	}
+
+	return (int)len;
+}
+
+bool nrf_cloud_json_reader_str_eq(const struct nrf_cloud_json_reader_val *const val,
+				  const char *const str)
+{
+	if (!val || !str || (val->type != NRF_CLOUD_JSON_READER_TYPE_STRING)) {
+		return false;
+	}
+
+	return str_match(val->ptr, val->len, str, strlen(str));
+}
+
+int nrf_cloud_json_reader_num_get(const struct nrf_cloud_json_reader_val *const val,
+				  double *const num)
+{
+	char num_str[NUM_STR_SIZE];
+
+	if (!val || !num) {
+		return -EINVAL;
+	}
+
+	if (val->type != NRF_CLOUD_JSON_READER_TYPE_NUMBER) {
+		return -ENOMSG;
+	}
+
+	if (val->len >= sizeof(num_str)) {
+		return -EBADMSG;
+	}
+
+	/* The text is not NULL-terminated, so copy it for strtod() */
+	memcpy(num_str, val->ptr, val->len);
+	num_str[val->len] = '\0';
+
+	*num = strtod(num_str, NULL);
+
+	return 0;
+}
+
+int nrf_cloud_json_reader_int_get(const struct nrf_cloud_json_reader_val *const val,
+				  int *const num)
+{
+	double dbl;
+	int err;
+
+	if (!num) {
+		return -EINVAL;
+	}
+
+	err = nrf_cloud_json_reader_num_get(val, &dbl);
+	if (err) {
+		return err;
+	}
+
+	if (dbl >= INT_MAX) {
+		*num = INT_MAX;
+	} else if (dbl <= (double)INT_MIN) {
+		*num = INT_MIN;
+	} else {
+		*num = (int)dbl;
+	}
+
+	return 0;
+}
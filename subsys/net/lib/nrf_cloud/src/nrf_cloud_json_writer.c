@@ -0,0 +1,403 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <errno.h>
+#include <float.h>
+#include <limits.h>
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/sys/util.h>
+#include <net/nrf_cloud_defs.h>
+#include "nrf_cloud_json_writer.h"
+
+/* Large enough for a number printed with "%1.17g" */
+#define NUM_STR_SIZE 26
+
+/* Bit of the container at the given depth in the array and item masks */
+#define DEPTH_BIT(_depth) BIT((_depth) - 1)
+
+static bool in_array(const struct nrf_cloud_obj_json_writer *const writer)
+{
+	return (writer->array_mask & DEPTH_BIT(writer->depth)) != 0;
+}
+
+/* Append to the text, keeping room for closing the open containers and the NULL-terminator */
+static int put(struct nrf_cloud_obj_json_writer *const writer, const char *const data,
+	       const size_t len)
+{
+	if ((writer->len + len + writer->depth + 1) > writer->size) {
+		return -ENOMEM;
+	}
+
+	memcpy(&writer->buf[writer->len], data, len);
+	writer->len += len;
+
+	return 0;
+}
+
+static int put_char(struct nrf_cloud_obj_json_writer *const writer, const char c)
+{
+	return put(writer, &c, 1);
+}
+
+/* Escape the string the same way as cJSON's print_string_ptr() */
+static int put_str(struct nrf_cloud_obj_json_writer *const writer, const char *const str)
+{
+	const char *run = str;
+	const char *pos;
+	int err;
+
+	err = put_char(writer, '"');
+
+	for (pos = str; !err && (*pos != '\0'); pos++) {
+		const unsigned char c = *pos;
+		char esc[7] = { '\\' };
+		size_t esc_len = 2;
+
+		switch (c) {
+		case '"':
+		case '\\':
+			esc[1] = c;
+			break;
+		case '\b':
+			esc[1] = 'b';
+			break;
+		case '\f':
+			esc[1] = 'f';
+			break;
+		case '\n':
+			esc[1] = 'n';
+			break;
+		case '\r':
+			esc[1] = 'r';
+			break;
+		case '\t':
+			esc[1] = 't';
+			break;
+		default:
+			if (c >= 32) {
+				continue;
+			}
+			esc_len = snprintf(esc, sizeof(esc), "\\u%04x", c);
+			break;
+		}
+
+		err = put(writer, run, pos - run);
+		if (!err) {
+			err = put(writer, esc, esc_len);
+		}
+		run = pos + 1;
+	}
+
+	if (!err) {
+		err = put(writer, run, pos - run);
+	}
+	if (!err) {
+		err = put_char(writer, '"');
+	}
+
+	return err;
+}
+
+static size_t int_print(char *const out, const int val)
+{
+	unsigned int u = (val < 0) ? (0U - (unsigned int)val) : (unsigned int)val;
+	char digits[10];
+	size_t cnt = 0;
+	size_t len = 0;
+
+	do {
+		digits[cnt++] = '0' + (u % 10);
+		u /= 10;
+	} while (u > 0);
+
+	if (val < 0) {
+		out[len++] = '-';
+	}
+
+	while (cnt > 0) {
+		out[len++] = digits[--cnt];
+	}
+
+	return len;
+}
+
+/* Print the number the same way as cJSON's print_number() */
+static size_t num_print(char *const out, const size_t size, const double val)
+{
+	double check;
+	int ival;
+	int len;
+
+	if (isnan(val) || isinf(val)) {
+		memcpy(out, "null", 4);
+		return 4;
+	}
+
+	/* cJSON saturates the integer value of a number */
+	if (val >= INT_MAX) {
+		ival = INT_MAX;
+	} else if (val <= (double)INT_MIN) {
+		ival = INT_MIN;
+	} else {
+		ival = (int)val;
+	}
+
+	if (val == (double)ival) {
+		return int_print(out, ival);
+	}
+
+	/* Use 15 digits if they are enough to read back the same value */
+	len = snprintf(out, size, "%1.15g", val);
+	check = strtod(out, NULL);
+	if (fabs(check - val) > (MAX(fabs(check), fabs(val)) * DBL_EPSILON)) {
+		len = snprintf(out, size, "%1.17g", val);
+	}
+
+	return (len > 0) ? MIN((size_t)len, size - 1) : 0;
+}
+
+/* Write the separator and key of a new item in the innermost open container */
+static int item_begin(struct nrf_cloud_obj_json_writer *const writer, const char *const key)
+{
+	int err = 0;
+
+	if (writer->depth == 0) {
+		return -ENOENT;
+	}
+
+	if ((key != NULL) == in_array(writer)) {
+		return -EINVAL;
+	}
+
+	if (writer->item_mask & DEPTH_BIT(writer->depth)) {
+		err = put_char(writer, ',');
+	} else {
+		writer->item_mask |= DEPTH_BIT(writer->depth);
+	}
+
+	if (!err && key) {
+		err = put_str(writer, key);
+		if (!err) {
+			err = put_char(writer, ':');
+		}
+	}
+
+	return err;
+}
+
+/* Undo a failed call by restoring the state from before it */
+static int item_end(struct nrf_cloud_obj_json_writer *const writer,
+		    const struct nrf_cloud_obj_json_writer *const prev, const int err)
+{
+	if (err) {
+		*writer = *prev;
+	}
+
+	return err;
+}
+
+static int container_begin(struct nrf_cloud_obj_json_writer *const writer,
+			   const char *const key, const bool array)
+{
+	const struct nrf_cloud_obj_json_writer prev = *writer;
+	int err;
+
+	if (writer->depth >= NRF_CLOUD_OBJ_JSON_WRITER_DEPTH_MAX) {
+		return -E2BIG;
+	}
+
+	err = item_begin(writer, key);
+	if (!err) {
+		writer->depth++;
+		WRITE_BIT(writer->array_mask, writer->depth - 1, array);
+		writer->item_mask &= ~DEPTH_BIT(writer->depth);
+		err = put_char(writer, array ? '[' : '{');
+	}
+
+	return item_end(writer, &prev, err);
+}
+
+void nrf_cloud_json_writer_reset(struct nrf_cloud_obj_json_writer *const writer)
+{
+	writer->len = 0;
+	writer->depth = 0;
+	writer->array_mask = 0;
+	writer->item_mask = 0;
+	writer->data_open = false;
+	writer->data_closed = false;
+}
+
+int nrf_cloud_json_writer_start(struct nrf_cloud_obj_json_writer *const writer,
+				const bool array)
+{
+	int err;
+
+	if (!writer->buf) {
+		return -EINVAL;
+	}
+
+	nrf_cloud_json_writer_reset(writer);
+
+	writer->depth = 1;
+	writer->array_mask = array ? DEPTH_BIT(1) : 0;
+
+	err = put_char(writer, array ? '[' : '{');
+	if (err) {
+		nrf_cloud_json_writer_reset(writer);
+	}
+
+	return err;
+}
+
+int nrf_cloud_json_writer_object_begin(struct nrf_cloud_obj_json_writer *const writer,
+				       const char *const key)
+{
+	return container_begin(writer, key, false);
+}
+
+int nrf_cloud_json_writer_array_begin(struct nrf_cloud_obj_json_writer *const writer,
+				      const char *const key)
+{
+	return container_begin(writer, key, true);
+}
+
+int nrf_cloud_json_writer_end(struct nrf_cloud_obj_json_writer *const writer)
+{
+	if (writer->depth == 0) {
+		return -ENOENT;
+	}
+
+	/* Room for the closing character was kept by put() */
+	writer->buf[writer->len++] = in_array(writer) ? ']' : '}';
+	writer->depth--;
+
+	return 0;
+}
+
+int nrf_cloud_json_writer_num_add(struct nrf_cloud_obj_json_writer *const writer,
+				  const char *const key, const double val)
+{
+	const struct nrf_cloud_obj_json_writer prev = *writer;
+	char num[NUM_STR_SIZE];
+	size_t len = num_print(num, sizeof(num), val);
+	int err;
+
+	err = item_begin(writer, key);
+	if (!err) {
+		err = put(writer, num, len);
+	}
+
+	return item_end(writer, &prev, err);
+}
+
+int nrf_cloud_json_writer_str_add(struct nrf_cloud_obj_json_writer *const writer,
+				  const char *const key, const char *const val)
+{
+	const struct nrf_cloud_obj_json_writer prev = *writer;
+	int err;
+
+	err = item_begin(writer, key);
+	if (!err) {
+		err = put_str(writer, val);
+	}
+
+	return item_end(writer, &prev, err);
+}
+
+int nrf_cloud_json_writer_bool_add(struct nrf_cloud_obj_json_writer *const writer,
+				   const char *const key, const bool val)
+{
+	const struct nrf_cloud_obj_json_writer prev = *writer;
+	int err;
+
+	err = item_begin(writer, key);
+	if (!err) {
+		err = val ? put(writer, "true", 4) : put(writer, "false", 5);
+	}
+
+	return item_end(writer, &prev, err);
+}
+
+int nrf_cloud_json_writer_null_add(struct nrf_cloud_obj_json_writer *const writer,
+				   const char *const key)
+{
+	const struct nrf_cloud_obj_json_writer prev = *writer;
+	int err;
+
+	err = item_begin(writer, key);
+	if (!err) {
+		err = put(writer, "null", 4);
+	}
+
+	return item_end(writer, &prev, err);
+}
+
+int nrf_cloud_json_writer_raw_add(struct nrf_cloud_obj_json_writer *const writer,
+				  const char *const key, const char *const json,
+				  const size_t len)
+{
+	const struct nrf_cloud_obj_json_writer prev = *writer;
+	int err;
+
+	err = item_begin(writer, key);
+	if (!err) {
+		err = put(writer, json, len);
+	}
+
+	return item_end(writer, &prev, err);
+}
+
+int nrf_cloud_json_writer_data_msg_add(struct nrf_cloud_obj_json_writer *const writer,
+				       const char *const app_id, const double val,
+				       const int64_t ts)
+{
+	const struct nrf_cloud_obj_json_writer prev = *writer;
+	int err;
+
+	err = nrf_cloud_json_writer_object_begin(writer, NULL);
+	if (!err) {
+		err = nrf_cloud_json_writer_str_add(writer, NRF_CLOUD_JSON_APPID_KEY, app_id);
+	}
+	if (!err) {
+		err = nrf_cloud_json_writer_str_add(writer, NRF_CLOUD_JSON_MSG_TYPE_KEY,
+						    NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	}
+	if (!err) {
+		err = nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_MSG_TIMESTAMP_KEY,
+						    (double)ts);
+	}
+	if (!err) {
+		err = nrf_cloud_json_writer_num_add(writer, NRF_CLOUD_JSON_DATA_KEY, val);
+	}
+	if (!err) {
+		err = nrf_cloud_json_writer_end(writer);
+	}
+	if (err) {
+		/* A partial object is never left in the text */
+		*writer = prev;
+	}
+
+	return err;
+}
+
+int nrf_cloud_json_writer_finish(struct nrf_cloud_obj_json_writer *const writer)
+{
+	if (nrf_cloud_json_writer_is_empty(writer)) {
+		return -ENOENT;
+	}
+
+	while (writer->depth > 0) {
+		(void)nrf_cloud_json_writer_end(writer);
+	}
+
+	writer->data_open = false;
+	writer->buf[writer->len] = '\0';
+
+	return 0;
+}
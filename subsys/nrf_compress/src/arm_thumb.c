@@ -57,14 +57,9 @@ static int arm_thumb_reset(void *inst, size_t decompressed_size)
 	return 0;
 }
 
-static size_t arm_thumb_bytes_needed(void *inst)
-{
-	return CONFIG_NRF_COMPRESS_CHUNK_SIZE;
-}
-
-static int arm_thumb_decompress(void *inst, const uint8_t *input, size_t input_size,
-				bool last_part, uint32_t *offset, uint8_t **output,
-				size_t *output_size)
+/* The filter converts instructions in both directions, compression only selects the direction. */
+static int arm_thumb_process(const uint8_t *input, size_t input_size, bool last_part,
+			     bool compress, uint32_t *offset, uint8_t **output, size_t *output_size)
 {
 	bool end_part_match = false;
 	bool extra_buffer_used = false;
@@ -85,7 +80,7 @@ static int arm_thumb_decompress(void *inst, const uint8_t *input, size_t input_s
 		memcpy(output_buffer, input, input_size);
 	}
 
-	arm_thumb_filter(output_buffer, input_size, data_position, false, &end_part_match);
+	arm_thumb_filter(output_buffer, input_size, data_position, compress, &end_part_match);
 	data_position += input_size;
 	*offset = input_size;
 
@@ -111,6 +106,29 @@ static int arm_thumb_decompress(void *inst, const uint8_t *input, size_t input_s
 	return 0;
 }
 
+#if defined(CONFIG_NRF_COMPRESS_COMPRESSION)
+static int arm_thumb_compress(void *inst, const uint8_t *input, size_t input_size,
+			      bool last_part, uint32_t *offset, uint8_t **output,
+			      size_t *output_size)
+{
+	return arm_thumb_process(input, input_size, last_part, true, offset, output, output_size);
+}
+#endif
+
+#if defined(CONFIG_NRF_COMPRESS_DECOMPRESSION)
+static size_t arm_thumb_bytes_needed(void *inst)
+{
+	return CONFIG_NRF_COMPRESS_CHUNK_SIZE;
+}
+
+static int arm_thumb_decompress(void *inst, const uint8_t *input, size_t input_size,
+				bool last_part, uint32_t *offset, uint8_t **output,
+				size_t *output_size)
+{
+	return arm_thumb_process(input, input_size, last_part, false, offset, output, output_size);
+}
+#endif
+
 NRF_COMPRESS_IMPLEMENTATION_DEFINE(arm_thumb, NRF_COMPRESS_TYPE_ARM_THUMB, arm_thumb_init,
-				   arm_thumb_deinit, arm_thumb_reset, NULL,
+				   arm_thumb_deinit, arm_thumb_reset, arm_thumb_compress,
 				   arm_thumb_bytes_needed, arm_thumb_decompress);
@@ -0,0 +1,708 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <nrf_compress/implementation.h>
+#include <zephyr/kernel.h>
+#include <zephyr/logging/log.h>
+#include <zephyr/sys/util.h>
+
+LOG_MODULE_REGISTER(nrf_compress_lz, CONFIG_NRF_COMPRESS_LOG_LEVEL);
+
+/*
+ * Greedy LZ encoder producing an LZMA2 stream in the format decoded by the LZMA implementation:
+ * a 2 byte header holding the dictionary size and the lc/lp/pb properties, followed by LZMA2
+ * chunks and the LZMA2 end marker. The matches are found with a single-entry hash table over
+ * a sliding window, so the RAM usage is fixed by the window size and the hash table size.
+ */
+
+#define WINDOW_SIZE		CONFIG_NRF_COMPRESS_LZ_WINDOW_SIZE
+#define HASH_SIZE		BIT(CONFIG_NRF_COMPRESS_LZ_HASH_BITS)
+
+/* History of the window size followed by the data that is not encoded yet. */
+#define BUFFER_SIZE		(2 * WINDOW_SIZE)
+
+/* Uncompressed size after which an LZMA2 chunk is finished. */
+#define CHUNK_SIZE		MIN(WINDOW_SIZE, 16384)
+
+/* Upper bound of the range coder output for a single symbol and of the range coder flush. */
+#define SYMBOL_SIZE_MAX		32
+#define FLUSH_SIZE		5
+
+/* Stream header and the LZMA2 chunk header with properties. */
+#define LZMA2_HEADER_SIZE	2
+#define CHUNK_HEADER_SIZE_MAX	6
+#define OUTPUT_HEADROOM		(LZMA2_HEADER_SIZE + CHUNK_HEADER_SIZE_MAX)
+
+/* The end marker is appended after the last chunk. */
+#define OUTPUT_SIZE		(OUTPUT_HEADROOM + CHUNK_SIZE + SYMBOL_SIZE_MAX + FLUSH_SIZE + 1)
+
+#define LZMA2_CONTROL_RESET_DIC	0xE0
+#define LZMA2_CONTROL_LZMA	0x80
+#define LZMA2_END_MARKER	0x00
+
+#define LC			CONFIG_NRF_COMPRESS_LZ_LITERAL_CONTEXT_BITS
+#define LP			0
+#define PB			2
+#define POS_STATES		BIT(PB)
+#define PROPERTIES		((PB * 5 + LP) * 9 + LC)
+
+#define NUM_STATES		12
+#define NUM_LIT_STATES		7
+#define MATCH_LEN_MIN		2
+#define MATCH_LEN_MAX		273
+#define LEN_LOW_BITS		3
+#define LEN_MID_BITS		3
+#define LEN_HIGH_BITS		8
+#define LEN_TO_POS_STATES	4
+#define POS_SLOT_BITS		6
+#define END_POS_MODEL_INDEX	14
+#define FULL_DISTANCES		128
+#define ALIGN_BITS		4
+
+#define PROB_BITS		11
+#define PROB_INIT		BIT(PROB_BITS - 1)
+#define PROB_MOVE_BITS		5
+#define RC_TOP			BIT(24)
+
+/* Candidate for a new match of this length is only taken for short distances. */
+#define SHORT_MATCH_DIST_MAX	128
+
+BUILD_ASSERT(LC + LP <= 4, "LZMA2 limits the sum of lc and lp to 4");
+
+struct lz_len_probs {
+	uint16_t choice;
+	uint16_t choice2;
+	uint16_t low[POS_STATES][BIT(LEN_LOW_BITS)];
+	uint16_t mid[POS_STATES][BIT(LEN_MID_BITS)];
+	uint16_t high[BIT(LEN_HIGH_BITS)];
+};
+
+/* Contains only probabilities so it can be initialized as a flat array. */
+struct lz_probs {
+	uint16_t is_match[NUM_STATES][POS_STATES];
+	uint16_t is_rep[NUM_STATES];
+	uint16_t is_rep_g0[NUM_STATES];
+	uint16_t is_rep_g1[NUM_STATES];
+	uint16_t is_rep_g2[NUM_STATES];
+	uint16_t is_rep0_long[NUM_STATES][POS_STATES];
+	uint16_t pos_slot[LEN_TO_POS_STATES][BIT(POS_SLOT_BITS)];
+	/* Bit trees are indexed from 1, so the first entry is not used. */
+	uint16_t pos_special[1 + FULL_DISTANCES - END_POS_MODEL_INDEX];
+	uint16_t align[BIT(ALIGN_BITS)];
+	struct lz_len_probs len;
+	struct lz_len_probs rep_len;
+	uint16_t literal[BIT(LC + LP)][0x300];
+};
+
+struct lz_range_encoder {
+	uint64_t low;
+	uint32_t range;
+	uint32_t cache_size;
+	uint8_t cache;
+	uint8_t *out;
+	size_t out_pos;
+};
+
+struct lz_encoder {
+	struct lz_probs probs;
+	struct lz_range_encoder rc;
+	uint32_t hash[HASH_SIZE];
+	uint8_t buffer[BUFFER_SIZE];
+	uint8_t output[OUTPUT_SIZE];
+
+	/* Stream positions of the first buffered byte, the end of the buffered data and the
+	 * next byte to encode.
+	 */
+	uint32_t buffer_pos;
+	uint32_t buffer_end;
+	uint32_t encode_pos;
+
+	uint32_t reps[4];
+	uint8_t state;
+	uint32_t chunk_start;
+	bool chunk_open;
+	bool header_written;
+	bool finished;
+};
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_STATIC)
+static struct lz_encoder lz_encoder_data;
+static struct lz_encoder *enc = &lz_encoder_data;
+#else
+static struct lz_encoder *enc;
+#endif
+
+static inline const uint8_t *buffer_at(uint32_t pos)
+{
+	return &enc->buffer[pos - enc->buffer_pos];
+}
+
+static void rc_shift_low(struct lz_range_encoder *rc)
+{
+	if ((uint32_t)rc->low < 0xFF000000 || (rc->low >> 32) != 0) {
+		uint8_t carry = (uint8_t)(rc->low >> 32);
+		uint8_t temp = rc->cache;
+
+		do {
+			rc->out[rc->out_pos++] = temp + carry;
+			temp = 0xFF;
+		} while (--rc->cache_size != 0);
+
+		rc->cache = (uint8_t)(rc->low >> 24);
+	}
+
+	rc->cache_size++;
+	rc->low = (rc->low & 0x00FFFFFF) << 8;
+}
+
+static void rc_bit(uint16_t *prob, uint32_t bit)
+{
+	struct lz_range_encoder *rc = &enc->rc;
+	uint32_t bound = (rc->range >> PROB_BITS) * *prob;
+
+	if (bit == 0) {
+		rc->range = bound;
+		*prob += (BIT(PROB_BITS) - *prob) >> PROB_MOVE_BITS;
+	} else {
+		rc->low += bound;
+		rc->range -= bound;
+		*prob -= *prob >> PROB_MOVE_BITS;
+	}
+
+	while (rc->range < RC_TOP) {
+		rc->range <<= 8;
+		rc_shift_low(rc);
+	}
+}
+
+static void rc_direct_bits(uint32_t value, uint32_t num_bits)
+{
+	struct lz_range_encoder *rc = &enc->rc;
+
+	while (num_bits-- > 0) {
+		rc->range >>= 1;
+
+		if ((value >> num_bits) & 1) {
+			rc->low += rc->range;
+		}
+
+		if (rc->range < RC_TOP) {
+			rc->range <<= 8;
+			rc_shift_low(rc);
+		}
+	}
+}
+
+static void rc_bittree(uint16_t *probs, uint32_t num_bits, uint32_t symbol)
+{
+	uint32_t m = 1;
+
+	while (num_bits-- > 0) {
+		uint32_t bit = (symbol >> num_bits) & 1;
+
+		rc_bit(&probs[m], bit);
+		m = (m << 1) | bit;
+	}
+}
+
+static void rc_bittree_reverse(uint16_t *probs, uint32_t num_bits, uint32_t symbol)
+{
+	uint32_t m = 1;
+
+	while (num_bits-- > 0) {
+		uint32_t bit = symbol & 1;
+
+		rc_bit(&probs[m], bit);
+		m = (m << 1) | bit;
+		symbol >>= 1;
+	}
+}
+
+static void rc_start(void)
+{
+	enc->rc.low = 0;
+	enc->rc.range = UINT32_MAX;
+	enc->rc.cache = 0;
+	enc->rc.cache_size = 1;
+	enc->rc.out = &enc->output[OUTPUT_HEADROOM];
+	enc->rc.out_pos = 0;
+}
+
+static void rc_flush(void)
+{
+	for (int i = 0; i < FLUSH_SIZE; i++) {
+		rc_shift_low(&enc->rc);
+	}
+}
+
+static size_t rc_pending(void)
+{
+	return enc->rc.out_pos + enc->rc.cache_size;
+}
+
+static void encode_len(struct lz_len_probs *probs, uint32_t len, uint32_t pos_state)
+{
+	len -= MATCH_LEN_MIN;
+
+	if (len < BIT(LEN_LOW_BITS)) {
+		rc_bit(&probs->choice, 0);
+		rc_bittree(probs->low[pos_state], LEN_LOW_BITS, len);
+		return;
+	}
+
+	rc_bit(&probs->choice, 1);
+	len -= BIT(LEN_LOW_BITS);
+
+	if (len < BIT(LEN_MID_BITS)) {
+		rc_bit(&probs->choice2, 0);
+		rc_bittree(probs->mid[pos_state], LEN_MID_BITS, len);
+	} else {
+		rc_bit(&probs->choice2, 1);
+		rc_bittree(probs->high, LEN_HIGH_BITS, len - BIT(LEN_MID_BITS));
+	}
+}
+
+static void encode_literal(void)
+{
+	const uint8_t *cur = buffer_at(enc->encode_pos);
+	uint32_t pos_state = enc->encode_pos & (POS_STATES - 1);
+	uint32_t prev_byte = enc->encode_pos > 0 ? cur[-1] : 0;
+	uint16_t *probs = enc->probs.literal[prev_byte >> (8 - LC)];
+	uint32_t symbol = 1;
+
+	rc_bit(&enc->probs.is_match[enc->state][pos_state], 0);
+
+	if (enc->state < NUM_LIT_STATES) {
+		rc_bittree(probs, 8, *cur);
+	} else {
+		/* Mirrors the matched literal decoding, the probabilities are shared with the
+		 * plain literal coding once the byte differs from the match byte.
+		 */
+		uint32_t match_byte = cur[-(int32_t)enc->reps[0]];
+		uint32_t offs = 0x100;
+
+		for (int i = 7; i >= 0; i--) {
+			uint32_t bit = (*cur >> i) & 1;
+			uint32_t match_bit;
+
+			match_byte <<= 1;
+			match_bit = offs;
+			offs &= match_byte;
+			rc_bit(&probs[offs + match_bit + symbol], bit);
+			symbol = (symbol << 1) | bit;
+
+			if (bit == 0) {
+				offs ^= match_bit;
+			}
+		}
+	}
+
+	if (enc->state < 4) {
+		enc->state = 0;
+	} else if (enc->state < 10) {
+		enc->state -= 3;
+	} else {
+		enc->state -= 6;
+	}
+}
+
+static void encode_match(uint32_t dist, uint32_t len)
+{
+	uint32_t pos_state = enc->encode_pos & (POS_STATES - 1);
+	uint32_t d = dist - 1;
+	uint32_t pos_slot;
+
+	rc_bit(&enc->probs.is_match[enc->state][pos_state], 1);
+	rc_bit(&enc->probs.is_rep[enc->state], 0);
+	encode_len(&enc->probs.len, len, pos_state);
+
+	if (d < 4) {
+		pos_slot = d;
+	} else {
+		uint32_t top = 31 - __builtin_clz(d);
+
+		pos_slot = (top << 1) | ((d >> (top - 1)) & 1);
+	}
+
+	rc_bittree(enc->probs.pos_slot[MIN(len - MATCH_LEN_MIN, LEN_TO_POS_STATES - 1)],
+		   POS_SLOT_BITS, pos_slot);
+
+	if (pos_slot >= 4) {
+		uint32_t footer_bits = (pos_slot >> 1) - 1;
+		uint32_t base = (2 | (pos_slot & 1)) << footer_bits;
+		uint32_t reduced = d - base;
+
+		if (pos_slot < END_POS_MODEL_INDEX) {
+			rc_bittree_reverse(&enc->probs.pos_special[base - pos_slot],
+					   footer_bits, reduced);
+		} else {
+			rc_direct_bits(reduced >> ALIGN_BITS, footer_bits - ALIGN_BITS);
+			rc_bittree_reverse(enc->probs.align, ALIGN_BITS, reduced);
+		}
+	}
+
+	enc->reps[3] = enc->reps[2];
+	enc->reps[2] = enc->reps[1];
+	enc->reps[1] = enc->reps[0];
+	enc->reps[0] = dist;
+	enc->state = enc->state < NUM_LIT_STATES ? 7 : 10;
+}
+
+/* Length of 1 encodes a short rep, which is only valid for the rep index 0. */
+static void encode_rep(uint32_t rep, uint32_t len)
+{
+	uint32_t pos_state = enc->encode_pos & (POS_STATES - 1);
+
+	rc_bit(&enc->probs.is_match[enc->state][pos_state], 1);
+	rc_bit(&enc->probs.is_rep[enc->state], 1);
+
+	if (rep == 0) {
+		rc_bit(&enc->probs.is_rep_g0[enc->state], 0);
+		rc_bit(&enc->probs.is_rep0_long[enc->state][pos_state], len == 1 ? 0 : 1);
+	} else {
+		uint32_t dist = enc->reps[rep];
+
+		rc_bit(&enc->probs.is_rep_g0[enc->state], 1);
+
+		if (rep == 1) {
+			rc_bit(&enc->probs.is_rep_g1[enc->state], 0);
+		} else {
+			rc_bit(&enc->probs.is_rep_g1[enc->state], 1);
+			rc_bit(&enc->probs.is_rep_g2[enc->state], rep - 2);
+
+			if (rep == 3) {
+				enc->reps[3] = enc->reps[2];
+			}
+
+			enc->reps[2] = enc->reps[1];
+		}
+
+		enc->reps[1] = enc->reps[0];
+		enc->reps[0] = dist;
+	}
+
+	if (len == 1) {
+		enc->state = enc->state < NUM_LIT_STATES ? 9 : 11;
+	} else {
+		encode_len(&enc->probs.rep_len, len, pos_state);
+		enc->state = enc->state < NUM_LIT_STATES ? 8 : 11;
+	}
+}
+
+static inline uint32_t hash_get(const uint8_t *data)
+{
+	uint32_t value = data[0] | (data[1] << 8) | (data[2] << 16);
+
+	return (value * 2654435761U) >> (32 - CONFIG_NRF_COMPRESS_LZ_HASH_BITS);
+}
+
+static uint32_t match_len_get(const uint8_t *cur, uint32_t dist, uint32_t limit)
+{
+	const uint8_t *ref = cur - dist;
+	uint32_t len = 0;
+
+	while (len < limit && cur[len] == ref[len]) {
+		len++;
+	}
+
+	return len;
+}
+
+static inline bool dist_valid(uint32_t dist)
+{
+	return dist > 0 && dist <= WINDOW_SIZE && dist <= (enc->encode_pos - enc->buffer_pos);
+}
+
+static void hash_insert(uint32_t pos)
+{
+	if (enc->buffer_end - pos >= 3) {
+		enc->hash[hash_get(buffer_at(pos))] = pos;
+	}
+}
+
+static void encode_symbol(void)
+{
+	const uint8_t *cur = buffer_at(enc->encode_pos);
+	uint32_t limit = MIN(enc->buffer_end - enc->encode_pos, MATCH_LEN_MAX);
+	uint32_t rep_len = 0;
+	uint32_t rep = 0;
+	uint32_t match_len = 0;
+	uint32_t match_dist = 0;
+	uint32_t len;
+
+	for (uint32_t i = 0; i < ARRAY_SIZE(enc->reps); i++) {
+		if (dist_valid(enc->reps[i])) {
+			len = match_len_get(cur, enc->reps[i], limit);
+
+			if (len > rep_len) {
+				rep_len = len;
+				rep = i;
+			}
+		}
+	}
+
+	if (limit >= 3) {
+		uint32_t *entry = &enc->hash[hash_get(cur)];
+		uint32_t dist = enc->encode_pos - *entry;
+
+		if (*entry < enc->encode_pos && dist_valid(dist)) {
+			match_len = match_len_get(cur, dist, limit);
+			match_dist = dist;
+		}
+
+		*entry = enc->encode_pos;
+	}
+
+	/* Repeated distances are much cheaper to encode than new ones. */
+	if (rep_len >= MATCH_LEN_MIN && rep_len + 2 >= match_len) {
+		len = rep_len;
+		encode_rep(rep, len);
+	} else if (match_len >= 3 ||
+		   (match_len == MATCH_LEN_MIN && match_dist <= SHORT_MATCH_DIST_MAX)) {
+		len = match_len;
+		encode_match(match_dist, len);
+	} else if (dist_valid(enc->reps[0]) && *cur == cur[-(int32_t)enc->reps[0]]) {
+		len = 1;
+		encode_rep(0, len);
+	} else {
+		len = 1;
+		encode_literal();
+	}
+
+	for (uint32_t i = 1; i < len; i++) {
+		hash_insert(enc->encode_pos + i);
+	}
+
+	enc->encode_pos += len;
+}
+
+static void chunk_open(void)
+{
+	rc_start();
+	enc->chunk_start = enc->encode_pos;
+	enc->chunk_open = true;
+}
+
+static bool chunk_full(void)
+{
+	return (enc->encode_pos - enc->chunk_start) >= CHUNK_SIZE || rc_pending() >= CHUNK_SIZE;
+}
+
+/* Finishes the open chunk, if any, and returns its data with the stream header prepended when
+ * the stream starts with it.
+ */
+static void chunk_close(uint8_t **output, size_t *output_size)
+{
+	uint8_t *header = &enc->output[OUTPUT_HEADROOM];
+	size_t size = 0;
+
+	if (enc->chunk_open) {
+		uint32_t unpacked = enc->encode_pos - enc->chunk_start - 1;
+		size_t packed;
+		bool first = !enc->header_written;
+
+		rc_flush();
+		packed = enc->rc.out_pos - 1;
+		size = enc->rc.out_pos;
+
+		if (first) {
+			*(--header) = PROPERTIES;
+		}
+
+		*(--header) = packed & 0xFF;
+		*(--header) = packed >> 8;
+		*(--header) = unpacked & 0xFF;
+		*(--header) = (unpacked >> 8) & 0xFF;
+		*(--header) = (first ? LZMA2_CONTROL_RESET_DIC : LZMA2_CONTROL_LZMA) |
+			      (unpacked >> 16);
+		size += &enc->output[OUTPUT_HEADROOM] - header;
+		enc->chunk_open = false;
+	}
+
+	if (!enc->header_written) {
+		uint32_t dict_prop = 0;
+
+		/* Smallest LZMA2 dictionary size that covers the window. */
+		while (((2 | (dict_prop & 1)) << (dict_prop / 2 + 11)) < WINDOW_SIZE) {
+			dict_prop++;
+		}
+
+		*(--header) = PROPERTIES;
+		*(--header) = dict_prop;
+		size += LZMA2_HEADER_SIZE;
+		enc->header_written = true;
+	}
+
+	*output = header;
+	*output_size = size;
+}
+
+static void buffer_compact(void)
+{
+	uint32_t keep_pos = enc->encode_pos - MIN(WINDOW_SIZE, enc->encode_pos - enc->buffer_pos);
+
+	if (keep_pos == enc->buffer_pos) {
+		return;
+	}
+
+	memmove(enc->buffer, buffer_at(keep_pos), enc->buffer_end - keep_pos);
+	enc->buffer_pos = keep_pos;
+}
+
+static void encoder_reset(void)
+{
+	uint16_t *probs = (uint16_t *)&enc->probs;
+
+	for (size_t i = 0; i < sizeof(enc->probs) / sizeof(uint16_t); i++) {
+		probs[i] = PROB_INIT;
+	}
+
+	memset(enc->hash, 0x00, sizeof(enc->hash));
+	enc->buffer_pos = 0;
+	enc->buffer_end = 0;
+	enc->encode_pos = 0;
+
+	for (size_t i = 0; i < ARRAY_SIZE(enc->reps); i++) {
+		enc->reps[i] = 1;
+	}
+
+	enc->state = 0;
+	enc->chunk_start = 0;
+	enc->chunk_open = false;
+	enc->header_written = false;
+	enc->finished = false;
+}
+
+static int lz_init(void *inst, size_t decompressed_size)
+{
+	ARG_UNUSED(inst);
+	ARG_UNUSED(decompressed_size);
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (enc == NULL) {
+		enc = malloc(sizeof(*enc));
+
+		if (enc == NULL) {
+			LOG_ERR("Failed to allocate nRF compression library buffer (0x%x)",
+				sizeof(*enc));
+			return -ENOMEM;
+		}
+	}
+#endif
+
+	encoder_reset();
+
+	return 0;
+}
+
+static int lz_deinit(void *inst)
+{
+	ARG_UNUSED(inst);
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (enc == NULL) {
+		return 0;
+	}
+#endif
+
+#ifdef CONFIG_NRF_COMPRESS_CLEANUP
+	memset(enc, 0x00, sizeof(*enc));
+#endif
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	free(enc);
+	enc = NULL;
+#endif
+
+	return 0;
+}
+
+static int lz_reset(void *inst, size_t decompressed_size)
+{
+	ARG_UNUSED(inst);
+	ARG_UNUSED(decompressed_size);
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (enc == NULL) {
+		return -ESRCH;
+	}
+#endif
+
+	encoder_reset();
+
+	return 0;
+}
+
+static int lz_compress(void *inst, const uint8_t *input, size_t input_size, bool last_part,
+		       uint32_t *offset, uint8_t **output, size_t *output_size)
+{
+	size_t copy_size;
+	bool flush;
+
+	ARG_UNUSED(inst);
+
+	if ((input == NULL && input_size > 0) || offset == NULL || output == NULL ||
+	    output_size == NULL) {
+		return -EINVAL;
+	}
+
+#if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC)
+	if (enc == NULL) {
+		return -ESRCH;
+	}
+#endif
+
+	*offset = 0;
+	*output = NULL;
+	*output_size = 0;
+
+	if (enc->finished) {
+		return input_size > 0 ? -EINVAL : 0;
+	}
+
+	buffer_compact();
+	copy_size = MIN(input_size, BUFFER_SIZE - (enc->buffer_end - enc->buffer_pos));
+
+	if (copy_size > 0) {
+		memcpy(&enc->buffer[enc->buffer_end - enc->buffer_pos], input, copy_size);
+		enc->buffer_end += copy_size;
+		*offset = copy_size;
+	}
+
+	/* Without more input to come, the remaining data is encoded with a shorter lookahead. */
+	flush = last_part && copy_size == input_size;
+
+	while (enc->encode_pos < enc->buffer_end) {
+		if (!flush && (enc->buffer_end - enc->encode_pos) < MATCH_LEN_MAX) {
+			break;
+		}
+
+		if (!enc->chunk_open) {
+			chunk_open();
+		}
+
+		encode_symbol();
+
+		if (chunk_full()) {
+			chunk_close(output, output_size);
+			return 0;
+		}
+	}
+
+	if (flush) {
+		chunk_close(output, output_size);
+		(*output)[(*output_size)++] = LZMA2_END_MARKER;
+		enc->finished = true;
+	}
+
+	return 0;
+}
+
+NRF_COMPRESS_IMPLEMENTATION_DEFINE(lz, NRF_COMPRESS_TYPE_LZ, lz_init, lz_deinit, lz_reset,
+				   lz_compress, NULL, NULL);
@@ -146,6 +146,22 @@ typedef struct dict_cache_t {
 } dict_cache;
 
 static dict_cache cache;
+
+#if CONFIG_NRF_COMPRESS_DICTIONARY_READ_CACHE_SIZE > 0
+/**
+ * @brief Dictionary Read Cache Structure
+ */
+typedef struct dict_read_cache_t {
+	/** Data read from external dictionary. */
+	uint8_t data[CONFIG_NRF_COMPRESS_DICTIONARY_READ_CACHE_SIZE];
+	/** Indicates which dictionary element is stored as first element of @a data. */
+	SizeT dict_pos_begin;
+	/** Number of valid bytes in @a data, zero if the cache is empty. */
+	SizeT len;
+} dict_read_cache;
+
+static dict_read_cache read_cache;
+#endif
 #endif
 #endif
 
@@ -158,6 +174,73 @@ static CLzmaDec lzma_decoder;
 #endif
 
 #if CONFIG_NRF_COMPRESS_DICTIONARY_CACHE_SIZE > 0
+/**
+ * @brief Invalidate read cache if it holds any of the given dictionary elements.
+ *
+ * @param pos first dictionary element written to external dictionary.
+ * @param len number of dictionary elements written to external dictionary.
+ */
+static void read_cache_invalidate(SizeT pos, SizeT len)
+{
+#if CONFIG_NRF_COMPRESS_DICTIONARY_READ_CACHE_SIZE > 0
+	if (pos < read_cache.dict_pos_begin + read_cache.len &&
+	    pos + len > read_cache.dict_pos_begin) {
+		read_cache.len = 0;
+	}
+#else
+	ARG_UNUSED(pos);
+	ARG_UNUSED(len);
+#endif
+}
+
+/**
+ * @brief Read data that is not held by dictionary cache from external dictionary.
+ *
+ * @param handle pointer to Lzma dictionary handle struct, for dictionary size reference.
+ * @param pos position of the dictionary to start reading from.
+ * @param data data buffer to read into.
+ * @param len number of bytes to read.
+ *
+ * @return Number of bytes read.
+ */
+static SizeT dict_read(const DictHandle *handle, SizeT pos, uint8_t *data, SizeT len)
+{
+#if CONFIG_NRF_COMPRESS_DICTIONARY_READ_CACHE_SIZE > 0
+	SizeT bytes_read = 0;
+
+	while (bytes_read < len) {
+		SizeT read_pos = pos + bytes_read;
+		SizeT copy_len;
+
+		if (read_pos < read_cache.dict_pos_begin ||
+		    read_pos >= read_cache.dict_pos_begin + read_cache.len) {
+			SizeT fill_pos = read_pos - (read_pos % sizeof(read_cache.data));
+			SizeT fill_len = MIN(sizeof(read_cache.data), handle->dicBufSize - fill_pos);
+
+			if (ext_dict->read(fill_pos, read_cache.data, fill_len) != fill_len) {
+				read_cache.len = 0;
+				break;
+			}
+
+			read_cache.dict_pos_begin = fill_pos;
+			read_cache.len = fill_len;
+		}
+
+		copy_len = MIN(len - bytes_read,
+			       read_cache.dict_pos_begin + read_cache.len - read_pos);
+		memcpy(data + bytes_read, read_cache.data + (read_pos - read_cache.dict_pos_begin),
+		       copy_len);
+		bytes_read += copy_len;
+	}
+
+	return bytes_read;
+#else
+	ARG_UNUSED(handle);
+
+	return ext_dict->read(pos, data, len);
+#endif
+}
+
 /**
  * @brief Synchronize dictionary cache with external dictionary.
  *
@@ -179,6 +262,7 @@ static int synchronize_cache(const DictHandle *handle)
 		return -EIO;
 	}
 
+	read_cache_invalidate(cache.dict_pos_begin, dict_write_size);
 	cache.write_offset = 0;
 
 	cache.dict_pos_begin = cache.dict_pos_end + 1;
@@ -194,10 +278,13 @@ static int synchronize_cache(const DictHandle *handle)
 
 	cache.dict_pos_end = cache.dict_pos_begin + dict_read_size - 1;
 
+	/* Output dictionary never wraps, so there is no data to read for the next window yet. */
+#if !defined(CONFIG_NRF_COMPRESS_OUTPUT_DICTIONARY)
 	if (ext_dict->read(cache.dict_pos_begin,
 			cache.data, dict_read_size) != dict_read_size) {
 		return -EIO;
 	}
+#endif
 
 	cache.invalid = false;
 
@@ -526,6 +613,15 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 	curr_dic_pos = decoder->dicPos;
 
 	if (!allocated_probs) {
+		SizeT dict_size;
+
+#if defined(CONFIG_NRF_COMPRESS_OUTPUT_DICTIONARY)
+		if (lzma_output_limit == SIZE_MAX) {
+			/* Whole output must fit in the dictionary, its size must be known. */
+			return -EINVAL;
+		}
+#endif
+
 #ifdef CONFIG_NRF_COMPRESS_LZMA_VERSION_LZMA2
 		rc = Lzma2Dec_AllocateProbs(&lzma_decoder, input[0], &lzma_probs_allocator);
 #else
@@ -537,7 +633,12 @@ static int lzma_decompress(void *inst, const uint8_t *input, size_t input_size,
 			return -EINVAL;
 		}
 
-		decoder->dicHandle = LzmaDictionaryOpen(decoder->prop.dicSize);
+		dict_size = decoder->prop.dicSize;
+#if defined(CONFIG_NRF_COMPRESS_OUTPUT_DICTIONARY)
+		dict_size = MAX(dict_size, lzma_output_limit);
+#endif
+
+		decoder->dicHandle = LzmaDictionaryOpen(dict_size);
 
 		if (decoder->dicHandle == NULL) {
 			rc = -EINVAL;
@@ -647,6 +748,9 @@ DictHandle *LzmaDictionaryOpen(SizeT size)
 	cache.dict_pos_end = sizeof(cache.data) - 1;
 	cache.write_offset = 0;
 #endif
+#if CONFIG_NRF_COMPRESS_DICTIONARY_READ_CACHE_SIZE > 0
+	read_cache.len = 0;
+#endif
 
 	return &dict_handle;
 }
@@ -722,7 +826,7 @@ SizeT LzmaDictionaryRead(DictHandle *handle, SizeT pos, Byte *data, SizeT len)
 
 		if (pos < cache.dict_pos_begin) {
 			/* First part of data is from dictionary... */
-			bytes_read = ext_dict->read(pos, data, cache.dict_pos_begin - pos);
+			bytes_read = dict_read(handle, pos, data, cache.dict_pos_begin - pos);
 			if (bytes_read != cache.dict_pos_begin - pos) {
 				return bytes_read;
 			}
@@ -741,12 +845,12 @@ SizeT LzmaDictionaryRead(DictHandle *handle, SizeT pos, Byte *data, SizeT len)
 
 		if (bytes_read != read_len) {
 			/* Last part of data is from dictionary. */
-			bytes_read += ext_dict->read(pos + bytes_read, data + bytes_read,
-								read_len - bytes_read);
+			bytes_read += dict_read(handle, pos + bytes_read, data + bytes_read,
+						read_len - bytes_read);
 		}
 	} else {
 		/* Requested data is not cached at all. */
-		bytes_read = ext_dict->read(pos, data, read_len);
+		bytes_read = dict_read(handle, pos, data, read_len);
 	}
 	return bytes_read;
 #else
@@ -771,6 +875,10 @@ SRes LzmaDictionaryClose(DictHandle *handle)
 
 	/* Clear the cache. */
 	memset(cache.data, 0, sizeof(cache.data));
+#if CONFIG_NRF_COMPRESS_DICTIONARY_READ_CACHE_SIZE > 0
+	memset(read_cache.data, 0, sizeof(read_cache.data));
+	read_cache.len = 0;
+#endif
 #endif
 
 	if (ext_dict->close() != 0) {
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef BENCH_HOST_CLOCK_H_
+#define BENCH_HOST_CLOCK_H_
+
+#include <stdint.h>
+#include <zephyr/kernel.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#ifdef CONFIG_ARCH_POSIX
+/* Implemented on the runner side in bench_host_clock.c, as simulated time does not advance
+ * while the code under test is running.
+ */
+uint64_t bench_host_time_ns(void);
+#endif
+
+/** @brief Get the time used to measure benchmarks, in nanoseconds. */
+static inline uint64_t bench_time_ns(void)
+{
+#if defined(CONFIG_ARCH_POSIX)
+	return bench_host_time_ns();
+#elif defined(CONFIG_TIMER_HAS_64BIT_CYCLE_COUNTER)
+	return k_cyc_to_ns_floor64(k_cycle_get_64());
+#else
+	return k_cyc_to_ns_floor64(k_cycle_get_32());
+#endif
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BENCH_HOST_CLOCK_H_ */
@@ -0,0 +1,333 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <unity.h>
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <modem/at_monitor.h>
+
+#include "cmock_nrf_modem_at.h"
+
+#define RECEIVED_MAX_COUNT 32
+#define NOTIF_MAX_LEN 64
+
+/* Number of +CMT notifications sent by the ring wrap test */
+#define WRAP_NOTIF_COUNT 30
+/* Number of +CMT notifications sent by the overflow test, more than fit in the buffer */
+#define OVERFLOW_NOTIF_COUNT 10
+
+/* at_monitor_dispatch() is implemented in the AT monitor library and
+ * we'll call it directly to fake received AT notifications
+ */
+extern void at_monitor_dispatch(const char *notif);
+
+AT_MONITOR(mon_cereg, "+CEREG", on_cereg);
+AT_MONITOR(mon_cmt, "+CMT", on_cmt);
+AT_MONITOR(mon_cesq, "CESQ", on_cesq);
+AT_MONITOR(mon_any, ANY, on_any, PAUSED);
+AT_MONITOR_ISR(mon_xtime, "%XTIME", on_xtime);
+
+static int cereg_count;
+static int cesq_count;
+static int any_count;
+static int xtime_count;
+
+/* +CMT notifications, in the order they were received */
+static char received[RECEIVED_MAX_COUNT][NOTIF_MAX_LEN];
+static int received_count;
+
+/* Number of +CMT notifications still to be sent from the +CMT monitor */
+static int chain_left;
+static int chain_seq;
+
+static void cmt_notif_build(char *buf, int seq)
+{
+	/* Vary the length so that the records end at different places in the buffer.
+	 * Records do not wrap around the end of the buffer, so two of them always fit only if
+	 * they are at most a third of the buffer size.
+	 */
+	snprintf(buf, NOTIF_MAX_LEN, "+CMT: %d,\"%.*s\"\r\n", seq, (seq * 7) % 16,
+		 "0123456789012345");
+}
+
+static void overflow_notif_build(char *buf, int seq)
+{
+	/* Same length for all, so that no notification fits after one has been dropped */
+	snprintf(buf, NOTIF_MAX_LEN, "+CMT: %d,\"0123456789012345678901234\"\r\n", seq);
+}
+
+static void on_cereg(const char *notif)
+{
+	cereg_count++;
+}
+
+static void on_cmt(const char *notif)
+{
+	char next[NOTIF_MAX_LEN];
+
+	if (received_count < RECEIVED_MAX_COUNT) {
+		strcpy(received[received_count], notif);
+	}
+	received_count++;
+
+	/* A notification received while this one is being dispatched is queued behind it,
+	 * so that the records go around the buffer.
+	 */
+	if (chain_left > 0) {
+		chain_left--;
+		cmt_notif_build(next, ++chain_seq);
+		at_monitor_dispatch(next);
+	}
+}
+
+static void on_cesq(const char *notif)
+{
+	cesq_count++;
+}
+
+static void on_any(const char *notif)
+{
+	any_count++;
+}
+
+static void on_xtime(const char *notif)
+{
+	xtime_count++;
+}
+
+void setUp(void)
+{
+	cereg_count = 0;
+	cesq_count = 0;
+	any_count = 0;
+	xtime_count = 0;
+	received_count = 0;
+	chain_left = 0;
+	chain_seq = 0;
+
+	at_monitor_stats_reset();
+}
+
+void tearDown(void)
+{
+}
+
+void test_at_monitor_prefix_filter(void)
+{
+	at_monitor_dispatch("+CEREG: 1,\"002F\",\"0012BEEF\",7\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_EQUAL(1, cereg_count);
+	TEST_ASSERT_EQUAL(0, received_count);
+	TEST_ASSERT_EQUAL(0, cesq_count);
+	/* Paused */
+	TEST_ASSERT_EQUAL(0, any_count);
+
+	/* Filter is longer than the notification */
+	at_monitor_dispatch("+CE\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_EQUAL(1, cereg_count);
+}
+
+void test_at_monitor_substring_filter(void)
+{
+	/* Filter not at the start of the notification */
+	at_monitor_dispatch("%CESQ: 54,2,16,2\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_EQUAL(1, cesq_count);
+
+	/* Filter starting with '+' inside the notification */
+	at_monitor_dispatch("%XFOO: \"+CEREG: 5\"\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_EQUAL(1, cereg_count);
+	TEST_ASSERT_EQUAL(1, cesq_count);
+
+	/* Notification starting with the filter */
+	at_monitor_dispatch("+CMTI: \"SM\",1\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_EQUAL(1, received_count);
+	TEST_ASSERT_EQUAL_STRING("+CMTI: \"SM\",1\r\n", received[0]);
+	TEST_ASSERT_EQUAL(1, cereg_count);
+}
+
+void test_at_monitor_no_match(void)
+{
+	struct at_monitor_stats stats;
+
+	at_monitor_dispatch("%XMODEMSLEEP: 1,3600000\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_EQUAL(0, cereg_count);
+	TEST_ASSERT_EQUAL(0, received_count);
+	TEST_ASSERT_EQUAL(0, cesq_count);
+
+	/* Notifications without monitors are not copied */
+	at_monitor_stats_get(&stats);
+	TEST_ASSERT_EQUAL(0, stats.dispatched);
+	TEST_ASSERT_EQUAL(0, stats.buf_used_peak);
+}
+
+void test_at_monitor_paused(void)
+{
+	at_monitor_pause(&mon_cereg);
+
+	at_monitor_dispatch("+CEREG: 1\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_EQUAL(0, cereg_count);
+
+	at_monitor_resume(&mon_cereg);
+
+	at_monitor_dispatch("+CEREG: 1\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_EQUAL(1, cereg_count);
+}
+
+void test_at_monitor_any(void)
+{
+	at_monitor_resume(&mon_any);
+
+	at_monitor_dispatch("+CEREG: 1\r\n");
+	at_monitor_dispatch("%XMODEMSLEEP: 1,3600000\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_EQUAL(2, any_count);
+	TEST_ASSERT_EQUAL(1, cereg_count);
+
+	at_monitor_pause(&mon_any);
+
+	at_monitor_dispatch("%XMODEMSLEEP: 1,3600000\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_EQUAL(2, any_count);
+}
+
+void test_at_monitor_direct(void)
+{
+	struct at_monitor_stats stats;
+
+	/* Dispatched in the calling context */
+	at_monitor_dispatch("%XTIME: \"80\",\"42502141507140\",\"01\"\r\n");
+	TEST_ASSERT_EQUAL(1, xtime_count);
+
+	k_sleep(K_MSEC(1));
+	TEST_ASSERT_EQUAL(1, xtime_count);
+
+	/* Only monitors dispatched in the workqueue need a copy */
+	at_monitor_stats_get(&stats);
+	TEST_ASSERT_EQUAL(0, stats.dispatched);
+
+	at_monitor_pause(&mon_xtime);
+
+	at_monitor_dispatch("%XTIME: \"80\",\"42502141507140\",\"01\"\r\n");
+	TEST_ASSERT_EQUAL(1, xtime_count);
+
+	at_monitor_resume(&mon_xtime);
+}
+
+void test_at_monitor_ring_wrap(void)
+{
+	char expected[NOTIF_MAX_LEN];
+	struct at_monitor_stats stats;
+
+	chain_left = WRAP_NOTIF_COUNT - 1;
+	cmt_notif_build(expected, chain_seq);
+	at_monitor_dispatch(expected);
+	k_sleep(K_MSEC(10));
+
+	TEST_ASSERT_EQUAL(WRAP_NOTIF_COUNT, received_count);
+
+	for (int i = 0; i < WRAP_NOTIF_COUNT; i++) {
+		cmt_notif_build(expected, i);
+		TEST_ASSERT_EQUAL_STRING(expected, received[i]);
+	}
+
+	at_monitor_stats_get(&stats);
+	TEST_ASSERT_EQUAL(WRAP_NOTIF_COUNT, stats.dispatched);
+	TEST_ASSERT_EQUAL(0, stats.dropped);
+	TEST_ASSERT_LESS_OR_EQUAL(CONFIG_AT_MONITOR_HEAP_SIZE, stats.buf_used_peak);
+}
+
+void test_at_monitor_overflow(void)
+{
+	char notif[NOTIF_MAX_LEN];
+	struct at_monitor_stats stats;
+	int queued;
+
+	/* Keep the workqueue from dispatching while the notifications arrive */
+	k_sched_lock();
+	for (int i = 0; i < OVERFLOW_NOTIF_COUNT; i++) {
+		overflow_notif_build(notif, i);
+		at_monitor_dispatch(notif);
+	}
+	k_sched_unlock();
+
+	at_monitor_stats_get(&stats);
+	TEST_ASSERT_GREATER_THAN(0, stats.dropped);
+	TEST_ASSERT_LESS_THAN(OVERFLOW_NOTIF_COUNT, stats.dropped);
+	TEST_ASSERT_LESS_OR_EQUAL(CONFIG_AT_MONITOR_HEAP_SIZE, stats.buf_used_peak);
+	queued = OVERFLOW_NOTIF_COUNT - stats.dropped;
+
+	k_sleep(K_MSEC(1));
+
+	/* The notifications that fit are dispatched in order */
+	TEST_ASSERT_EQUAL(queued, received_count);
+	for (int i = 0; i < queued; i++) {
+		overflow_notif_build(notif, i);
+		TEST_ASSERT_EQUAL_STRING(notif, received[i]);
+	}
+
+	/* The buffer is available again */
+	at_monitor_dispatch("+CMT: 1\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_EQUAL(queued + 1, received_count);
+
+	at_monitor_stats_get(&stats);
+	TEST_ASSERT_EQUAL(queued + 1, stats.dispatched);
+	TEST_ASSERT_EQUAL(OVERFLOW_NOTIF_COUNT - queued, stats.dropped);
+}
+
+void test_at_monitor_entry_stats(void)
+{
+	at_monitor_dispatch("+CEREG: 1\r\n");
+	at_monitor_dispatch("+CEREG: 2\r\n");
+	k_sleep(K_MSEC(1));
+
+	TEST_ASSERT_EQUAL(2, mon_cereg.stats.dispatched);
+	TEST_ASSERT_EQUAL(0, mon_cesq.stats.dispatched);
+	/* Dispatched in the calling context */
+	TEST_ASSERT_EQUAL(0, mon_xtime.stats.dispatched);
+}
+
+/* This is needed because AT Monitor library is initialized in SYS_INIT. */
+static int at_monitor_test_sys_init(void)
+{
+	__cmock_nrf_modem_at_notif_handler_set_ExpectAnyArgsAndReturn(0);
+
+	return 0;
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
+
+SYS_INIT(at_monitor_test_sys_init, POST_KERNEL, 0);
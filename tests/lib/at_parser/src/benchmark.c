@@ -0,0 +1,210 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+
+#include <modem/at_parser.h>
+
+#include "bench_host_clock.h"
+
+/* Number of times each response is decoded */
+#define BENCH_ITERATIONS 200
+
+/* Neighbor cells in the largest response */
+#define BENCH_NCELLS_MAX 64
+
+/* Parameters before the neighbor cells */
+#define BENCH_CELL_PARAMS 10
+/* Parameters of one neighbor cell */
+#define BENCH_NCELL_PARAMS 5
+
+struct bench_ncell {
+	uint32_t earfcn;
+	uint16_t phys_cell_id;
+	int16_t rsrp;
+	int16_t rsrq;
+	int32_t time_diff;
+};
+
+struct bench_cells {
+	int32_t status;
+	uint32_t cell_id;
+	char plmn[7];
+	uint32_t tac;
+	int32_t timing_advance;
+	uint32_t earfcn;
+	uint16_t phys_cell_id;
+	int16_t rsrp;
+	int16_t rsrq;
+	uint64_t measurement_time;
+	uint8_t ncells_count;
+	struct bench_ncell ncells[BENCH_NCELLS_MAX];
+};
+
+AT_PARSER_SCHEMA_DEFINE(bench_ncell_schema,
+	AT_PARSER_FIELD(struct bench_ncell, earfcn),
+	AT_PARSER_FIELD(struct bench_ncell, phys_cell_id),
+	AT_PARSER_FIELD(struct bench_ncell, rsrp),
+	AT_PARSER_FIELD(struct bench_ncell, rsrq),
+	AT_PARSER_FIELD(struct bench_ncell, time_diff));
+
+AT_PARSER_SCHEMA_DEFINE(bench_cells_schema,
+	AT_PARSER_FIELD(struct bench_cells, status),
+	AT_PARSER_FIELD_HEX_OPTIONAL(struct bench_cells, cell_id),
+	AT_PARSER_FIELD(struct bench_cells, plmn),
+	AT_PARSER_FIELD_HEX_OPTIONAL(struct bench_cells, tac),
+	AT_PARSER_FIELD(struct bench_cells, timing_advance),
+	AT_PARSER_FIELD(struct bench_cells, earfcn),
+	AT_PARSER_FIELD(struct bench_cells, phys_cell_id),
+	AT_PARSER_FIELD(struct bench_cells, rsrp),
+	AT_PARSER_FIELD(struct bench_cells, rsrq),
+	AT_PARSER_FIELD(struct bench_cells, measurement_time),
+	AT_PARSER_FIELD_GROUP(struct bench_cells, ncells, ncells_count, bench_ncell_schema));
+
+static char response[64 + BENCH_NCELLS_MAX * 32];
+static struct bench_cells decoded;
+static struct bench_cells indexed;
+
+/* Build a %NCELLMEAS style response with the given number of neighbor cells */
+static void response_build(size_t ncells)
+{
+	size_t len;
+
+	len = snprintf(response, sizeof(response),
+		       "%%NCELLMEAS: 0,\"00011B07\",\"26295\",\"00B7\",10,6400,412,-95,-9,"
+		       "150344527");
+
+	for (size_t i = 0; i < ncells; i++) {
+		len += snprintf(&response[len], sizeof(response) - len, ",%d,%d,%d,%d,%d",
+				(int)(1300 + i), (int)(100 + i), -(int)(80 + i % 40), -(int)(i % 20),
+				(int)(20 * i));
+	}
+
+	snprintf(&response[len], sizeof(response) - len, "\r\nOK\r\n");
+}
+
+static int hex_get(struct at_parser *parser, size_t index, uint32_t *value)
+{
+	int err;
+	char str[9];
+	size_t len = sizeof(str);
+
+	err = at_parser_string_get(parser, index, str, &len);
+	if (err) {
+		return err;
+	}
+
+	*value = strtoul(str, NULL, 16);
+
+	return 0;
+}
+
+/* Decode the response with the index based API, as done by the modem libraries */
+static int index_decode(struct bench_cells *cells)
+{
+	int err;
+	size_t count;
+	size_t len = sizeof(cells->plmn);
+	struct at_parser parser;
+
+	err = at_parser_init(&parser, response);
+	if (err) {
+		return err;
+	}
+
+	err = at_parser_cmd_count_get(&parser, &count);
+	err = err ? err : at_parser_num_get(&parser, 1, &cells->status);
+	err = err ? err : hex_get(&parser, 2, &cells->cell_id);
+	err = err ? err : at_parser_string_get(&parser, 3, cells->plmn, &len);
+	err = err ? err : hex_get(&parser, 4, &cells->tac);
+	err = err ? err : at_parser_num_get(&parser, 5, &cells->timing_advance);
+	err = err ? err : at_parser_num_get(&parser, 6, &cells->earfcn);
+	err = err ? err : at_parser_num_get(&parser, 7, &cells->phys_cell_id);
+	err = err ? err : at_parser_num_get(&parser, 8, &cells->rsrp);
+	err = err ? err : at_parser_num_get(&parser, 9, &cells->rsrq);
+	err = err ? err : at_parser_num_get(&parser, 10, &cells->measurement_time);
+	if (err) {
+		return err;
+	}
+
+	cells->ncells_count = (count - 1 - BENCH_CELL_PARAMS) / BENCH_NCELL_PARAMS;
+
+	for (size_t i = 0; i < cells->ncells_count; i++) {
+		struct bench_ncell *ncell = &cells->ncells[i];
+		size_t start = 1 + BENCH_CELL_PARAMS + i * BENCH_NCELL_PARAMS;
+
+		err = at_parser_num_get(&parser, start, &ncell->earfcn);
+		err = err ? err : at_parser_num_get(&parser, start + 1, &ncell->phys_cell_id);
+		err = err ? err : at_parser_num_get(&parser, start + 2, &ncell->rsrp);
+		err = err ? err : at_parser_num_get(&parser, start + 3, &ncell->rsrq);
+		err = err ? err : at_parser_num_get(&parser, start + 4, &ncell->time_diff);
+		if (err) {
+			return err;
+		}
+	}
+
+	return 0;
+}
+
+static int schema_decode(struct bench_cells *cells)
+{
+	int ret;
+	struct at_parser parser;
+
+	ret = at_parser_init(&parser, response);
+	if (ret) {
+		return ret;
+	}
+
+	ret = at_parser_decode(&parser, &bench_cells_schema, cells);
+
+	return ret < 0 ? ret : 0;
+}
+
+static uint64_t bench_run(int (*decode)(struct bench_cells *cells), struct bench_cells *cells)
+{
+	int err;
+	uint64_t start = bench_time_ns();
+
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		err = decode(cells);
+		zassert_ok(err, "Decoding failed (%d)", err);
+	}
+
+	return (bench_time_ns() - start) / BENCH_ITERATIONS;
+}
+
+ZTEST(at_parser_benchmark, test_benchmark_ncellmeas)
+{
+	static const size_t ncells[] = {0, 4, 17, 32, BENCH_NCELLS_MAX};
+	uint64_t index_ns;
+	uint64_t schema_ns;
+
+	for (size_t i = 0; i < ARRAY_SIZE(ncells); i++) {
+		response_build(ncells[i]);
+
+		memset(&indexed, 0, sizeof(indexed));
+		memset(&decoded, 0, sizeof(decoded));
+
+		index_ns = bench_run(index_decode, &indexed);
+		schema_ns = bench_run(schema_decode, &decoded);
+
+		zassert_equal(decoded.ncells_count, ncells[i]);
+		zassert_mem_equal(&decoded, &indexed, sizeof(decoded),
+				  "Decoders disagree with %d neighbor cells", (int)ncells[i]);
+
+		TC_PRINT("%2d neighbor cells, %4d bytes: index based %6u ns, schema %6u ns\n",
+			 (int)ncells[i], (int)strlen(response), (uint32_t)index_ns,
+			 (uint32_t)schema_ns);
+	}
+}
+
+ZTEST_SUITE(at_parser_benchmark, NULL, NULL, NULL, NULL, NULL);
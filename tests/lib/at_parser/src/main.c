@@ -2088,4 +2088,309 @@ ZTEST(at_parser, test_at_parser_cmd_next)
 	zassert_equal(num, 6);
 }
 
+struct decode_cell {
+	int32_t status;
+	uint32_t cell_id;
+	char plmn[7];
+	struct at_parser_str band;
+	int16_t rsrp;
+	uint8_t ncells_count;
+	struct decode_ncell {
+		uint32_t earfcn;
+		uint16_t phys_cell_id;
+		int16_t rsrp;
+	} ncells[2];
+};
+
+AT_PARSER_SCHEMA_DEFINE(decode_ncell_schema,
+	AT_PARSER_FIELD(struct decode_ncell, earfcn),
+	AT_PARSER_FIELD(struct decode_ncell, phys_cell_id),
+	AT_PARSER_FIELD_OPTIONAL(struct decode_ncell, rsrp));
+
+AT_PARSER_SCHEMA_DEFINE(decode_cell_schema,
+	AT_PARSER_FIELD(struct decode_cell, status),
+	AT_PARSER_FIELD_HEX_OPTIONAL(struct decode_cell, cell_id),
+	AT_PARSER_FIELD(struct decode_cell, plmn),
+	AT_PARSER_FIELD_OPTIONAL(struct decode_cell, band),
+	AT_PARSER_FIELD_SKIP,
+	AT_PARSER_FIELD_OPTIONAL(struct decode_cell, rsrp),
+	AT_PARSER_FIELD_GROUP(struct decode_cell, ncells, ncells_count, decode_ncell_schema));
+
+ZTEST(at_parser, test_at_parser_decode_einval)
+{
+	int ret;
+	struct at_parser parser;
+	struct decode_cell cell;
+
+	ret = at_parser_init(&parser, "+CELL: 0\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(NULL, &decode_cell_schema, &cell);
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_decode(&parser, NULL, &cell);
+	zassert_equal(ret, -EINVAL);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, NULL);
+	zassert_equal(ret, -EINVAL);
+}
+
+ZTEST(at_parser, test_at_parser_decode_eperm)
+{
+	int ret;
+	struct at_parser parser = {0};
+	struct decode_cell cell;
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, -EPERM);
+}
+
+ZTEST(at_parser, test_at_parser_decode)
+{
+	int ret;
+	struct at_parser parser;
+	struct decode_cell cell = {0};
+
+	const char *at = "%CELL: 0,\"00011B07\",\"26295\",(1,3,20),\"skip\",-97,"
+			 "6400,412,-102,300,8,\r\nOK\r\n";
+
+	ret = at_parser_init(&parser, at);
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, 7);
+	zassert_equal(cell.status, 0);
+	zassert_equal(cell.cell_id, 0x00011B07);
+	zassert_str_equal(cell.plmn, "26295");
+	zassert_equal(cell.band.len, strlen("(1,3,20)"));
+	zassert_mem_equal(cell.band.ptr, "(1,3,20)", cell.band.len);
+	zassert_equal(cell.rsrp, -97);
+	zassert_equal(cell.ncells_count, 2);
+	zassert_equal(cell.ncells[0].earfcn, 6400);
+	zassert_equal(cell.ncells[0].phys_cell_id, 412);
+	zassert_equal(cell.ncells[0].rsrp, -102);
+	zassert_equal(cell.ncells[1].earfcn, 300);
+	zassert_equal(cell.ncells[1].phys_cell_id, 8);
+	/* Empty optional field is left untouched */
+	zassert_equal(cell.ncells[1].rsrp, 0);
+
+	/* Decoding again gives the same result */
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, 7);
+}
+
+ZTEST(at_parser, test_at_parser_decode_optional)
+{
+	int ret;
+	struct at_parser parser;
+	struct decode_cell cell = {
+		.cell_id = UINT32_MAX,
+		.rsrp = INT16_MIN,
+		.ncells_count = 1,
+	};
+
+	const char *at = "%CELL: 1,,\"26295\"\r\n";
+
+	ret = at_parser_init(&parser, at);
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, 3);
+	zassert_equal(cell.status, 1);
+	zassert_equal(cell.cell_id, UINT32_MAX);
+	zassert_str_equal(cell.plmn, "26295");
+	zassert_equal(cell.rsrp, INT16_MIN);
+	/* Absent group leaves the count untouched */
+	zassert_equal(cell.ncells_count, 1);
+}
+
+ZTEST(at_parser, test_at_parser_decode_enodata)
+{
+	int ret;
+	struct at_parser parser;
+	struct decode_cell cell;
+
+	/* Mandatory field is absent */
+	ret = at_parser_init(&parser, "%CELL: 1,\"00011B07\"\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, -ENODATA);
+
+	/* Mandatory field is empty */
+	ret = at_parser_init(&parser, "%CELL: ,\"00011B07\",\"26295\"\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, -ENODATA);
+
+	/* Group element is incomplete */
+	ret = at_parser_init(&parser, "%CELL: 0,\"1\",\"26295\",(1),\"\",-97,6400\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, -ENODATA);
+}
+
+ZTEST(at_parser, test_at_parser_decode_errors)
+{
+	int ret;
+	struct at_parser parser;
+	struct decode_cell cell;
+
+	/* Integer field holds a string */
+	ret = at_parser_init(&parser, "%CELL: \"0\",\"1\",\"26295\"\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, -EOPNOTSUPP);
+
+	/* Hexadecimal field holds other characters */
+	ret = at_parser_init(&parser, "%CELL: 0,\"1G\",\"26295\"\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, -EOPNOTSUPP);
+
+	/* Hexadecimal field does not fit */
+	ret = at_parser_init(&parser, "%CELL: 0,\"100000000\",\"26295\"\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, -ERANGE);
+
+	/* Integer field does not fit */
+	ret = at_parser_init(&parser, "%CELL: 0,\"1\",\"26295\",,,-40000\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, -ERANGE);
+
+	/* String does not fit */
+	ret = at_parser_init(&parser, "%CELL: 0,\"1\",\"2629501\"\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, -ENOMEM);
+
+	/* Malformed string */
+	ret = at_parser_init(&parser, "%CELL: 0,\"1\",\"26295\" 1\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, -EBADMSG);
+}
+
+struct decode_reg {
+	int32_t status;
+	uint32_t tac;
+	int16_t act;
+	char active_time[9];
+};
+
+AT_PARSER_SCHEMA_DEFINE(decode_reg_schema,
+	AT_PARSER_FIELD(struct decode_reg, status),
+	AT_PARSER_FIELD_HEX_LENIENT(struct decode_reg, tac),
+	AT_PARSER_FIELD_LENIENT(struct decode_reg, act),
+	AT_PARSER_FIELD_LENIENT(struct decode_reg, active_time));
+
+ZTEST(at_parser, test_at_parser_decode_lenient)
+{
+	int ret;
+	struct at_parser parser;
+	struct decode_reg reg = {
+		.tac = 0xFFFFFFFF,
+		.act = -1,
+	};
+
+	/* Invalid lenient fields are left untouched and do not stop decoding */
+	ret = at_parser_init(&parser, "+REG: 1,\"XYZ\",\"7\",\"000010100\"\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_reg_schema, &reg);
+	zassert_equal(ret, 4);
+	zassert_equal(reg.status, 1);
+	zassert_equal(reg.tac, 0xFFFFFFFF);
+	zassert_equal(reg.act, -1);
+	zassert_str_equal(reg.active_time, "");
+
+	/* Out of range values are ignored as well */
+	ret = at_parser_init(&parser, "+REG: 5,\"100000000\",40000,\"00001010\"\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_reg_schema, &reg);
+	zassert_equal(ret, 4);
+	zassert_equal(reg.status, 5);
+	zassert_equal(reg.tac, 0xFFFFFFFF);
+	zassert_equal(reg.act, -1);
+	zassert_str_equal(reg.active_time, "00001010");
+
+	/* Valid values are decoded */
+	ret = at_parser_init(&parser, "+REG: 1,\"002F\",7\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_reg_schema, &reg);
+	zassert_equal(ret, 3);
+	zassert_equal(reg.tac, 0x2F);
+	zassert_equal(reg.act, 7);
+
+	/* Mandatory fields are still checked */
+	ret = at_parser_init(&parser, "+REG: \"1\",\"002F\"\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_reg_schema, &reg);
+	zassert_equal(ret, -EOPNOTSUPP);
+
+	/* Malformed lines are still rejected */
+	ret = at_parser_init(&parser, "+REG: 1,\"002F\" 1\r\n");
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_reg_schema, &reg);
+	zassert_equal(ret, -EBADMSG);
+}
+
+ZTEST(at_parser, test_at_parser_decode_e2big)
+{
+	int ret;
+	struct at_parser parser;
+	struct decode_cell cell = {0};
+
+	const char *at = "%CELL: 0,\"1\",\"26295\",,,-97,1,2,-3,4,5,-6,7,8,-9\r\n";
+
+	ret = at_parser_init(&parser, at);
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, -E2BIG);
+	zassert_equal(cell.ncells_count, ARRAY_SIZE(cell.ncells));
+	zassert_equal(cell.ncells[1].earfcn, 4);
+	zassert_equal(cell.ncells[1].rsrp, -6);
+}
+
+ZTEST(at_parser, test_at_parser_decode_cmd_next)
+{
+	int ret;
+	struct at_parser parser;
+	struct decode_cell cell = {0};
+
+	const char *at = "%CELL: 0,\"1\",\"26295\"\r\n"
+			 "%CELL: 2,\"ABBA\",\"24405\"\r\nOK\r\n";
+
+	ret = at_parser_init(&parser, at);
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, 3);
+	zassert_equal(cell.status, 0);
+
+	ret = at_parser_cmd_next(&parser);
+	zassert_ok(ret);
+
+	ret = at_parser_decode(&parser, &decode_cell_schema, &cell);
+	zassert_equal(ret, 3);
+	zassert_equal(cell.status, 2);
+	zassert_equal(cell.cell_id, 0xABBA);
+	zassert_str_equal(cell.plmn, "24405");
+}
+
 ZTEST_SUITE(at_parser, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,390 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <data_fifo.h>
+
+#define BENCH_ITERATIONS	 (10000)
+#define BENCH_BATCH_SIZE	 (4)
+#define BENCH_ELEMENTS_NUM	 (8)
+#define BENCH_BLOCK_SIZE	 (64)
+#define BENCH_THREAD_STACK_SIZE	 (1024)
+#define BENCH_THREAD_PRIORITY	 (5)
+
+K_THREAD_STACK_DEFINE(bench_producer_stack, BENCH_THREAD_STACK_SIZE);
+static struct k_thread bench_producer_thread;
+
+static void internal_test_spsc_used(struct data_fifo *data_fifo, uint32_t num_alloced_tgt,
+				    uint32_t num_locked_tgt, uint32_t line)
+{
+	uint32_t num_alloced;
+	uint32_t num_locked;
+	int ret;
+
+	ret = data_fifo_num_used_get(data_fifo, &num_alloced, &num_locked);
+	zassert_equal(ret, 0, "data_fifo_num_used_get did not return 0");
+	zassert_equal(num_alloced, num_alloced_tgt,
+		      "num_alloced target %d actual val %d. call from line: %d", num_alloced_tgt,
+		      num_alloced, line);
+	zassert_equal(num_locked, num_locked_tgt,
+		      "num_locked target %d actual val %d. call from line: %d", num_locked_tgt,
+		      num_locked, line);
+}
+
+ZTEST(suite_data_fifo_spsc, test_data_fifo_spsc_put_get_ok)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+	uint32_t *data_ptr;
+	void *data_ptr_read;
+	size_t data_size;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	/* Go around the ring several times */
+	for (uint32_t i = 0; i < 10; i++) {
+		ret = data_fifo_pointer_first_vacant_get(&data_fifo, (void **)&data_ptr, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+		*data_ptr = i;
+
+		internal_test_spsc_used(&data_fifo, 1, 0, __LINE__);
+
+		ret = data_fifo_block_lock(&data_fifo, (void **)&data_ptr, sizeof(i) + i);
+		zassert_equal(ret, 0, "block_lock did not return 0");
+
+		internal_test_spsc_used(&data_fifo, 1, 1, __LINE__);
+
+		ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+							K_NO_WAIT);
+		zassert_equal(ret, 0, "last_filled_get did not return 0");
+		zassert_equal(*(uint32_t *)data_ptr_read, i, "data contents are not identical");
+		zassert_equal(data_size, sizeof(i) + i, "data size incorrect");
+
+		internal_test_spsc_used(&data_fifo, 1, 0, __LINE__);
+
+		data_fifo_block_free(&data_fifo, data_ptr_read);
+
+		internal_test_spsc_used(&data_fifo, 0, 0, __LINE__);
+	}
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size, K_NO_WAIT);
+	zassert_equal(ret, -ENOMSG, "last_filled_get did not return -ENOMSG");
+
+	ret = data_fifo_pointer_last_filled_get(&data_fifo, &data_ptr_read, &data_size,
+						K_MSEC(10));
+	zassert_equal(ret, -EAGAIN, "last_filled_get did not return -EAGAIN");
+}
+
+ZTEST(suite_data_fifo_spsc, test_data_fifo_spsc_put_too_many)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+	void *data_ptr[5];
+	uint32_t num = ARRAY_SIZE(data_ptr);
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	ret = data_fifo_pointers_first_vacant_get(&data_fifo, data_ptr, &num, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	zassert_equal(num, 4, "Got %d blocks, expected 4", num);
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, &data_ptr[4], K_NO_WAIT);
+	zassert_equal(ret, -ENOMEM, "first_vacant_get did not return -ENOMEM");
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, &data_ptr[4], K_MSEC(10));
+	zassert_equal(ret, -EAGAIN, "first_vacant_get did not return -EAGAIN");
+
+	/* The producer returns the block it took last */
+	data_fifo_block_free(&data_fifo, data_ptr[3]);
+
+	internal_test_spsc_used(&data_fifo, 3, 0, __LINE__);
+
+	ret = data_fifo_pointer_first_vacant_get(&data_fifo, &data_ptr[4], K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+	zassert_equal_ptr(data_ptr[4], data_ptr[3], "Returned block was not reused");
+}
+
+ZTEST(suite_data_fifo_spsc, test_data_fifo_spsc_lock_errors)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 4, 128);
+
+	int ret;
+	void *data_ptr[2];
+	uint32_t num = ARRAY_SIZE(data_ptr);
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	ret = data_fifo_pointers_first_vacant_get(&data_fifo, data_ptr, &num, K_NO_WAIT);
+	zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+	ret = data_fifo_block_lock(&data_fifo, &data_ptr[0], 129);
+	zassert_equal(ret, -ENOMEM, "block_lock did not return -ENOMEM");
+
+	ret = data_fifo_block_lock(&data_fifo, &data_ptr[0], 0);
+	zassert_equal(ret, -EINVAL, "block_lock did not return -EINVAL");
+
+	ret = data_fifo_block_lock(&data_fifo, &data_ptr[1], 1);
+	zassert_equal(ret, -ESPIPE, "block_lock out of order did not return -ESPIPE");
+
+	internal_test_spsc_used(&data_fifo, 2, 0, __LINE__);
+
+	ret = data_fifo_uninit(&data_fifo);
+	zassert_equal(ret, 0, "uninit did not return 0");
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	internal_test_spsc_used(&data_fifo, 0, 0, __LINE__);
+}
+
+ZTEST(suite_data_fifo_spsc, test_data_fifo_spsc_batch)
+{
+	DATA_FIFO_SPSC_DEFINE(data_fifo, 8, 128);
+
+	int ret;
+	void *data_ptr[8];
+	size_t data_size[8];
+	uint32_t num;
+
+	ret = data_fifo_init(&data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	for (uint32_t round = 0; round < 4; round++) {
+		num = 6;
+		ret = data_fifo_pointers_first_vacant_get(&data_fifo, data_ptr, &num, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+		zassert_equal(num, 6, "Got %d blocks, expected 6", num);
+
+		for (uint32_t i = 0; i < num; i++) {
+			*(uint32_t *)data_ptr[i] = round * 10 + i;
+			data_size[i] = sizeof(uint32_t) + i;
+		}
+
+		ret = data_fifo_blocks_lock(&data_fifo, data_ptr, data_size, num);
+		zassert_equal(ret, 0, "blocks_lock did not return 0");
+
+		internal_test_spsc_used(&data_fifo, 6, 6, __LINE__);
+
+		num = ARRAY_SIZE(data_ptr);
+		ret = data_fifo_pointers_last_filled_get(&data_fifo, data_ptr, data_size, &num,
+							 K_NO_WAIT);
+		zassert_equal(ret, 0, "last_filled_get did not return 0");
+		zassert_equal(num, 6, "Got %d blocks, expected 6", num);
+
+		for (uint32_t i = 0; i < num; i++) {
+			zassert_equal(*(uint32_t *)data_ptr[i], round * 10 + i,
+				      "data contents are not identical");
+			zassert_equal(data_size[i], sizeof(uint32_t) + i, "data size incorrect");
+		}
+
+		data_fifo_blocks_free(&data_fifo, data_ptr, num);
+
+		internal_test_spsc_used(&data_fifo, 0, 0, __LINE__);
+	}
+}
+
+#define RACE_BLOCKS	   (500)
+#define RACE_ELEMENTS_NUM (8)
+
+DATA_FIFO_SPSC_DEFINE(race_fifo, RACE_ELEMENTS_NUM, BENCH_BLOCK_SIZE);
+static atomic_t race_received;
+static atomic_t race_stop;
+
+/* Take blocks in a loop and lock one only if the consumer has room for it, otherwise return
+ * it. The producer spends most of its time returning blocks, so the consumer often runs in
+ * the middle of that.
+ */
+static void race_producer(void *p1, void *p2, void *p3)
+{
+	int ret;
+	void *data;
+	uint32_t sent = 0;
+
+	while (!atomic_get(&race_stop)) {
+		ret = data_fifo_pointer_first_vacant_get(&race_fifo, &data, K_NO_WAIT);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		*(uint32_t *)data = sent;
+
+		if (sent < RACE_BLOCKS &&
+		    sent - atomic_get(&race_received) < RACE_ELEMENTS_NUM - 1) {
+			ret = data_fifo_block_lock(&race_fifo, &data, sizeof(uint32_t));
+			zassert_equal(ret, 0, "block_lock did not return 0");
+			sent++;
+		} else {
+			data_fifo_block_free(&race_fifo, data);
+		}
+	}
+}
+
+ZTEST(suite_data_fifo_spsc, test_data_fifo_spsc_producer_free_race)
+{
+	int ret;
+	void *data;
+	size_t size;
+	uint32_t received = 0;
+
+	ret = data_fifo_init(&race_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	atomic_clear(&race_received);
+	atomic_clear(&race_stop);
+
+	k_thread_create(&bench_producer_thread, bench_producer_stack,
+			K_THREAD_STACK_SIZEOF(bench_producer_stack), race_producer, NULL, NULL,
+			NULL, BENCH_THREAD_PRIORITY, 0, K_NO_WAIT);
+
+	/* Woken by the system timer, so the blocks are freed at any point of the producer loop */
+	while (received < RACE_BLOCKS) {
+		ret = data_fifo_pointer_last_filled_get(&race_fifo, &data, &size, K_NO_WAIT);
+		if (ret == -ENOMSG) {
+			k_sleep(K_TICKS(1));
+			continue;
+		}
+
+		zassert_equal(ret, 0, "last_filled_get did not return 0");
+		zassert_equal(*(uint32_t *)data, received, "Block out of order");
+
+		data_fifo_block_free(&race_fifo, data);
+		atomic_set(&race_received, ++received);
+	}
+
+	atomic_set(&race_stop, 1);
+	ret = k_thread_join(&bench_producer_thread, K_SECONDS(1));
+	zassert_equal(ret, 0, "Producer thread did not finish");
+
+	/* A tail moved backwards would leave blocks in use */
+	internal_test_spsc_used(&race_fifo, 0, 0, __LINE__);
+
+	ret = data_fifo_uninit(&race_fifo);
+	zassert_equal(ret, 0, "uninit did not return 0");
+}
+
+DATA_FIFO_DEFINE(bench_fifo, BENCH_ELEMENTS_NUM, BENCH_BLOCK_SIZE);
+DATA_FIFO_SPSC_DEFINE(bench_fifo_spsc, BENCH_ELEMENTS_NUM, BENCH_BLOCK_SIZE);
+
+static void bench_producer(void *p1, void *p2, void *p3)
+{
+	int ret;
+	struct data_fifo *data_fifo = p1;
+	uint32_t batch = POINTER_TO_UINT(p2);
+	void *data[BENCH_BATCH_SIZE];
+	size_t size[BENCH_BATCH_SIZE];
+	uint32_t num;
+
+	for (uint32_t sent = 0; sent < BENCH_ITERATIONS; sent += num) {
+		num = MIN(batch, BENCH_ITERATIONS - sent);
+
+		if (num == 1) {
+			ret = data_fifo_pointer_first_vacant_get(data_fifo, &data[0], K_FOREVER);
+			zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+			*(uint32_t *)data[0] = sent;
+
+			ret = data_fifo_block_lock(data_fifo, &data[0], sizeof(uint32_t));
+			zassert_equal(ret, 0, "block_lock did not return 0");
+			continue;
+		}
+
+		ret = data_fifo_pointers_first_vacant_get(data_fifo, data, &num, K_FOREVER);
+		zassert_equal(ret, 0, "first_vacant_get did not return 0");
+
+		for (uint32_t i = 0; i < num; i++) {
+			*(uint32_t *)data[i] = sent + i;
+			size[i] = sizeof(uint32_t);
+		}
+
+		ret = data_fifo_blocks_lock(data_fifo, data, size, num);
+		zassert_equal(ret, 0, "blocks_lock did not return 0");
+	}
+}
+
+/**
+ * @brief Pass blocks from a producer thread to the test thread, and return the number of
+ *        cycles per block.
+ */
+static uint32_t bench_run(struct data_fifo *data_fifo, uint32_t batch)
+{
+	int ret;
+	uint32_t start;
+	uint32_t cycles;
+	void *data[BENCH_BATCH_SIZE];
+	size_t size[BENCH_BATCH_SIZE];
+	uint32_t num;
+
+	ret = data_fifo_init(data_fifo);
+	zassert_equal(ret, 0, "init did not return 0");
+
+	start = k_cycle_get_32();
+
+	k_thread_create(&bench_producer_thread, bench_producer_stack,
+			K_THREAD_STACK_SIZEOF(bench_producer_stack), bench_producer, data_fifo,
+			UINT_TO_POINTER(batch), NULL, BENCH_THREAD_PRIORITY, 0, K_NO_WAIT);
+
+	for (uint32_t received = 0; received < BENCH_ITERATIONS; received += num) {
+		num = batch;
+
+		if (num == 1) {
+			ret = data_fifo_pointer_last_filled_get(data_fifo, &data[0], &size[0],
+								K_FOREVER);
+		} else {
+			ret = data_fifo_pointers_last_filled_get(data_fifo, data, size, &num,
+								 K_FOREVER);
+		}
+		zassert_equal(ret, 0, "last_filled_get did not return 0");
+
+		for (uint32_t i = 0; i < num; i++) {
+			zassert_equal(*(uint32_t *)data[i], received + i, "Block out of order");
+		}
+
+		if (num == 1) {
+			data_fifo_block_free(data_fifo, data[0]);
+		} else {
+			data_fifo_blocks_free(data_fifo, data, num);
+		}
+	}
+
+	cycles = k_cycle_get_32() - start;
+
+	ret = k_thread_join(&bench_producer_thread, K_SECONDS(1));
+	zassert_equal(ret, 0, "Producer thread did not finish");
+
+	ret = data_fifo_uninit(data_fifo);
+	zassert_equal(ret, 0, "uninit did not return 0");
+
+	return cycles / BENCH_ITERATIONS;
+}
+
+ZTEST(suite_data_fifo_spsc, test_data_fifo_spsc_benchmark)
+{
+	uint32_t cycles_msgq;
+	uint32_t cycles_spsc;
+	uint32_t cycles_msgq_batch;
+	uint32_t cycles_spsc_batch;
+
+	cycles_msgq = bench_run(&bench_fifo, 1);
+	cycles_spsc = bench_run(&bench_fifo_spsc, 1);
+	cycles_msgq_batch = bench_run(&bench_fifo, BENCH_BATCH_SIZE);
+	cycles_spsc_batch = bench_run(&bench_fifo_spsc, BENCH_BATCH_SIZE);
+
+	TC_PRINT("Cycles per block, %d blocks:\n", BENCH_ITERATIONS);
+	TC_PRINT("  slab and message queue: %u, batches of %d: %u\n", cycles_msgq,
+		 BENCH_BATCH_SIZE, cycles_msgq_batch);
+	TC_PRINT("  SPSC:                   %u, batches of %d: %u\n", cycles_spsc,
+		 BENCH_BATCH_SIZE, cycles_spsc_batch);
+
+	zassert_true(cycles_spsc < cycles_msgq, "SPSC slower than slab and message queue");
+	zassert_true(cycles_spsc_batch < cycles_msgq_batch,
+		     "SPSC batches slower than slab and message queue batches");
+}
+
+ZTEST_SUITE(suite_data_fifo_spsc, NULL, NULL, NULL, NULL, NULL);
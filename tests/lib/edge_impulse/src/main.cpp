@@ -24,6 +24,14 @@ static size_t prediction_idx;
 /* Semaphore is used to wait until ei_wrapper returns prediction results. */
 static K_SEM_DEFINE(test_sem, 0, 1)
 
+#if CONFIG_EI_WRAPPER_PIPELINE
+#define EI_TEST_PIPELINE_PREDICTIONS		5
+
+/* Counts all prediction results, as the pipeline can report several before the test runs. */
+static K_SEM_DEFINE(pipeline_sem, 0, K_SEM_MAX_LIMIT);
+static atomic_t pipeline_restarts;
+#endif /* CONFIG_EI_WRAPPER_PIPELINE */
+
 
 static int add_input_data(const size_t pred_idx, const size_t frame_surplus)
 {
@@ -51,6 +59,29 @@ static int add_input_data(const size_t pred_idx, const size_t frame_surplus)
 	return err;
 }
 
+static int add_input_data_int16(const size_t pred_idx, const float scale)
+{
+	static int16_t data_buf[EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME];
+
+	int err = 0;
+	float value = EI_MOCK_GEN_FIRST_INPUT(pred_idx);
+
+	for (size_t i = 0; i < EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE;
+	     i += EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME) {
+		for (size_t j = 0; j < ARRAY_SIZE(data_buf); j++) {
+			data_buf[j] = (int16_t)(value / scale);
+			value++;
+		}
+
+		err = ei_wrapper_add_data_int16(data_buf, EI_CLASSIFIER_RAW_SAMPLES_PER_FRAME);
+		if (err) {
+			break;
+		}
+	}
+
+	return err;
+}
+
 static void verify_result(const size_t pred_idx)
 {
 	int err;
@@ -107,6 +138,12 @@ static void verify_result(const size_t pred_idx)
 	zassert_equal(classification_time, EI_MOCK_GEN_CLASSIFICATION_TIME(pred_idx),
 		      "Wrong classification time");
 	zassert_equal(anomaly_time, EI_MOCK_GEN_ANOMALY_TIME(pred_idx), "Wrong anomaly time");
+
+	int copy_time = -1;
+
+	err = ei_wrapper_get_data_copy_time(&copy_time);
+	zassert_ok(err, "ei_wrapper_get_data_copy_time returned an error");
+	zassert_true(copy_time >= 0, "Wrong copy time");
 }
 
 static void run_basic_setup(const size_t pred_idx,
@@ -141,7 +178,23 @@ static void result_ready_cb(int err)
 	} else {
 		k_sem_give(&test_sem);
 	}
+
+#if CONFIG_EI_WRAPPER_PIPELINE
+	k_sem_give(&pipeline_sem);
+#endif /* CONFIG_EI_WRAPPER_PIPELINE */
+}
+
+#if CONFIG_EI_WRAPPER_PIPELINE
+static void window_captured_cb(void)
+{
+	/* Start the next prediction while the classifier processes the captured window. */
+	if (atomic_dec(&pipeline_restarts) > 0) {
+		int err = ei_wrapper_start_prediction(1, 0);
+
+		zassert_ok(err, "Cannot start prediction");
+	}
 }
+#endif /* CONFIG_EI_WRAPPER_PIPELINE */
 
 static void *test_init(void)
 {
@@ -173,7 +226,14 @@ static void *test_init(void)
 	zassert_is_null(ei_wrapper_get_classifier_label(ei_wrapper_get_classifier_label_count()),
 			"Wrong label returned for index out of range");
 
-	int err = ei_wrapper_init(result_ready_cb);
+	int err;
+
+#if CONFIG_EI_WRAPPER_PIPELINE
+	err = ei_wrapper_set_window_captured_cb(window_captured_cb);
+	zassert_ok(err, "Cannot set window captured callback");
+#endif /* CONFIG_EI_WRAPPER_PIPELINE */
+
+	err = ei_wrapper_init(result_ready_cb);
 
 	zassert_ok(err, "Initialization failed");
 
@@ -240,6 +300,66 @@ ZTEST(suite0, test_data_add_fail)
 	zassert_true(err, "Expected error adding data with improper size");
 }
 
+ZTEST(suite0, test_data_int16)
+{
+	static const float scale = 0.5f;
+	int err;
+
+	err = ei_wrapper_set_data_scale(0.0f);
+	zassert_equal(err, -EINVAL, "Expected error setting zero scale");
+	err = ei_wrapper_set_data_scale(-1.0f);
+	zassert_equal(err, -EINVAL, "Expected error setting negative scale");
+
+	err = ei_wrapper_set_data_scale(scale);
+	zassert_ok(err, "Cannot set data scale");
+
+	for (size_t i = 0; i < 3; i++) {
+		err = add_input_data_int16(prediction_idx, scale);
+		zassert_ok(err, "Cannot add input data");
+
+		err = ei_wrapper_start_prediction((i == 0) ? (0) : (1), 0);
+		zassert_ok(err, "Cannot start prediction");
+
+		err = k_sem_take(&test_sem, EI_TEST_SEM_TIMEOUT);
+		zassert_ok(err, "Cannot take semaphore");
+	}
+
+	err = ei_wrapper_set_data_scale(1.0f);
+	zassert_ok(err, "Cannot set data scale");
+}
+
+#if CONFIG_EI_WRAPPER_PIPELINE
+ZTEST(suite0, test_pipeline)
+{
+	int err;
+
+	BUILD_ASSERT(EI_TEST_PIPELINE_PREDICTIONS * EI_CLASSIFIER_DSP_INPUT_FRAME_SIZE <
+		     CONFIG_EI_WRAPPER_DATA_BUF_SIZE);
+
+	k_sem_reset(&pipeline_sem);
+	atomic_set(&pipeline_restarts, EI_TEST_PIPELINE_PREDICTIONS - 1);
+
+	for (size_t i = 0; i < EI_TEST_PIPELINE_PREDICTIONS; i++) {
+		err = add_input_data(prediction_idx + i, 0);
+		zassert_ok(err, "Cannot add input data");
+	}
+
+	err = ei_wrapper_start_prediction(0, 0);
+	zassert_ok(err, "Cannot start prediction");
+
+	/* Results are verified in order by the result ready callback. */
+	for (size_t i = 0; i < EI_TEST_PIPELINE_PREDICTIONS; i++) {
+		err = k_sem_take(&pipeline_sem, EI_TEST_SEM_TIMEOUT);
+		zassert_ok(err, "Cannot take semaphore");
+	}
+
+	zassert_equal(prediction_idx, EI_TEST_PIPELINE_PREDICTIONS, "Wrong number of results");
+
+	/* The test semaphore is given for each result as well. */
+	k_sem_reset(&test_sem);
+}
+#endif /* CONFIG_EI_WRAPPER_PIPELINE */
+
 ZTEST(suite0, test_double_start)
 {
 	int err;
@@ -17,6 +17,8 @@
 #include "cmock_nrf_modem.h"
 #include "cmock_nrf_socket.h"
 
+#include "bench_host_clock.h"
+
 #define TEST_EVENT_MAX_COUNT 20
 #define IGNORE NULL
 
@@ -32,6 +34,58 @@ static uint8_t lte_lc_callback_count_occurred;
 static uint8_t lte_lc_callback_count_expected;
 static char at_notif[2048];
 
+/* Recorded maximum-size %NCELLMEAS notifications */
+static const char ncellmeas_max_cells_resp[] =
+	/* Status */
+	"%NCELLMEAS: 0,"
+	/* Current cell */
+	"\"00112233\",\"98712\",\"0AB9\",4800,7,63,31,456,4800,"
+	/* Neighbor cells (20). Last 3 are extra items to be ignored. */
+	"333333,100,101,102,0,333333,103,104,105,0,"
+	"333333,106,107,108,0,333333,109,110,111,0,"
+	"444444,112,113,114,0,444444,115,116,117,0,"
+	"444444,118,119,120,0,444444,121,122,123,0,"
+	"555555,124,125,126,0,555555,127,128,129,0,"
+	"555555,130,131,132,0,555555,133,134,135,0,"
+	"666666,136,137,138,0,666666,139,140,141,0,"
+	"666666,142,143,144,0,666666,145,146,147,0,"
+	"777777,148,149,150,0,777777,151,152,153,0,"
+	"888888,154,155,156,0,888888,157,158,159,0,"
+	"11\r\n"; /* Timing advance for current cell */
+
+static const char ncellmeas_gci_max_length_resp[] =
+	/* Status */
+	"%NCELLMEAS: 0,"
+	/* Current cell */
+	"\"00123456\",\"555555\",\"0102\",65534,18446744073709551614,"
+	"999999,123,127,-127,18446744073709551614,1,20,"
+	/* Neighbor cells (20). Last 3 are extra items to be ignored. */
+	"333333,100,101,102,0,333333,103,104,105,0,"
+	"333333,106,107,108,0,333333,109,110,111,0,"
+	"444444,112,113,114,0,444444,115,116,117,0,"
+	"444444,118,119,120,0,444444,121,122,123,0,"
+	"555555,124,125,126,0,555555,127,128,129,0,"
+	"555555,130,131,132,0,555555,133,134,135,0,"
+	"666666,136,137,138,0,666666,139,140,141,0,"
+	"666666,142,143,144,0,666666,145,146,147,0,"
+	"777777,148,149,150,0,777777,151,152,153,0,"
+	"888888,154,155,156,0,888888,157,158,159,0,"
+	/* GCI (surrounding) cells (14) */
+	"\"01234567\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"02345678\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"03456789\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"0456789A\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"056789AB\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"06789ABC\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"0789ABCD\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"089ABCDE\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"09ABCDEF\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"0ABCDEF0\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"0BCDEF01\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"0CDEF012\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"0DEF0123\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
+	"\"0EF01234\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0\r\n";
+
 K_SEM_DEFINE(event_handler_called_sem, 0, TEST_EVENT_MAX_COUNT);
 
 /* at_monitor_dispatch() is implemented in at_monitor library and
@@ -336,6 +390,9 @@ static void helper_lte_lc_data_clear(void)
 	memset(&test_gci_cells, 0, sizeof(test_gci_cells));
 }
 
+static bool ncellmeas_bench_handler_registered;
+static void ncellmeas_bench_handler(const struct lte_lc_evt *const evt);
+
 void setUp(void)
 {
 	mock_nrf_modem_at_Init();
@@ -354,7 +411,13 @@ void tearDown(void)
 
 	TEST_ASSERT_EQUAL(lte_lc_callback_count_expected, lte_lc_callback_count_occurred);
 
-	ret = lte_lc_deregister_handler(lte_lc_event_handler);
+	if (ncellmeas_bench_handler_registered) {
+		/* The benchmark registers its own handler instead of lte_lc_event_handler() */
+		ret = lte_lc_deregister_handler(ncellmeas_bench_handler);
+		ncellmeas_bench_handler_registered = false;
+	} else {
+		ret = lte_lc_deregister_handler(lte_lc_event_handler);
+	}
 	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
 
 	mock_nrf_modem_at_Verify();
@@ -2665,6 +2728,35 @@ void test_lte_lc_cereg_malformed_fail(void)
 	at_monitor_dispatch(at_notif);
 }
 
+/* Invalid optional parameters are ignored and the registration status is still reported */
+void test_lte_lc_cereg_invalid_optional_params(void)
+{
+	lte_lc_callback_count_expected = 3;
+
+	test_event_data[0].type = LTE_LC_EVT_NW_REG_STATUS;
+	test_event_data[0].nw_reg_status = LTE_LC_NW_REG_SEARCHING;
+
+	/* TAC is not hexadecimal */
+	test_event_data[1].type = LTE_LC_EVT_CELL_UPDATE;
+	test_event_data[1].cell.id = 0x0012BEEF;
+	test_event_data[1].cell.tac = LTE_LC_CELL_TAC_INVALID;
+
+	/* Cell ID does not fit in 32 bits */
+	test_event_data[2].type = LTE_LC_EVT_CELL_UPDATE;
+	test_event_data[2].cell.id = LTE_LC_CELL_EUTRAN_ID_INVALID;
+	test_event_data[2].cell.tac = 0xABBA;
+
+	/* LTE mode is a string and active time is too long */
+	strcpy(at_notif, "+CEREG: 2,\"XYZ\",\"0012BEEF\",\"7\",,,\"000010100\",\"00010011\"\r\n");
+	at_monitor_dispatch(at_notif);
+	k_sleep(K_MSEC(1));
+
+	/* LTE mode and reject cause are out of range */
+	strcpy(at_notif, "+CEREG: 2,\"ABBA\",\"1000000000\",99999999999,0,99999999999\r\n");
+	at_monitor_dispatch(at_notif);
+	k_sleep(K_MSEC(1));
+}
+
 void test_lte_lc_cereg_no_event_handler(void)
 {
 	int ret;
@@ -2825,23 +2917,7 @@ void test_lte_lc_neighbor_cell_measurement_normal_max_cells(void)
 	strcpy(at_notif,
 	       "%NCELLMEAS:0,\"00112233\",\"98712\",\"0AB9\",4800,7,63,31,"
 	       "456,4800,8,60,29,4,3500,9,99,18,5,5300,11\r\n");
-	strcpy(at_notif,
-	       /* Status */
-	       "%NCELLMEAS: 0,"
-	       /* Current cell */
-	       "\"00112233\",\"98712\",\"0AB9\",4800,7,63,31,456,4800,"
-	       /* Neighbor cells (20). Last 3 are extra items to be ignored. */
-	       "333333,100,101,102,0,333333,103,104,105,0,"
-	       "333333,106,107,108,0,333333,109,110,111,0,"
-	       "444444,112,113,114,0,444444,115,116,117,0,"
-	       "444444,118,119,120,0,444444,121,122,123,0,"
-	       "555555,124,125,126,0,555555,127,128,129,0,"
-	       "555555,130,131,132,0,555555,133,134,135,0,"
-	       "666666,136,137,138,0,666666,139,140,141,0,"
-	       "666666,142,143,144,0,666666,145,146,147,0,"
-	       "777777,148,149,150,0,777777,151,152,153,0,"
-	       "888888,154,155,156,0,888888,157,158,159,0,"
-	       "11\r\n"); /* Timing advance for current cell */
+	strcpy(at_notif, ncellmeas_max_cells_resp);
 
 	lte_lc_callback_count_expected = 1;
 
@@ -3442,38 +3518,7 @@ void test_lte_lc_neighbor_cell_measurement_gci_max_length(void)
 		.gci_count = 15,
 	};
 
-	strcpy(at_notif,
-	       /* Status */
-	       "%NCELLMEAS: 0,"
-	       /* Current cell */
-	       "\"00123456\",\"555555\",\"0102\",65534,18446744073709551614,"
-	       "999999,123,127,-127,18446744073709551614,1,20,"
-	       /* Neighbor cells (20). Last 3 are extra items to be ignored. */
-	       "333333,100,101,102,0,333333,103,104,105,0,"
-	       "333333,106,107,108,0,333333,109,110,111,0,"
-	       "444444,112,113,114,0,444444,115,116,117,0,"
-	       "444444,118,119,120,0,444444,121,122,123,0,"
-	       "555555,124,125,126,0,555555,127,128,129,0,"
-	       "555555,130,131,132,0,555555,133,134,135,0,"
-	       "666666,136,137,138,0,666666,139,140,141,0,"
-	       "666666,142,143,144,0,666666,145,146,147,0,"
-	       "777777,148,149,150,0,777777,151,152,153,0,"
-	       "888888,154,155,156,0,888888,157,158,159,0,"
-	       /* GCI (surrounding) cells (14) */
-	       "\"01234567\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"02345678\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"03456789\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"0456789A\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"056789AB\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"06789ABC\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"0789ABCD\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"089ABCDE\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"09ABCDEF\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"0ABCDEF0\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"0BCDEF01\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"0CDEF012\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"0DEF0123\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0,"
-	       "\"0EF01234\",\"555555\",\"0102\",65534,18446744073709551614,999999,123,127,-127,18446744073709551614,0,0\r\n");
+	strcpy(at_notif, ncellmeas_gci_max_length_resp);
 
 	lte_lc_callback_count_expected = 1;
 
@@ -3772,6 +3817,82 @@ void test_lte_lc_neighbor_cell_measurement_gci_max_length(void)
 	at_monitor_dispatch(at_notif);
 }
 
+#define NCELLMEAS_BENCH_ITERATIONS 100
+
+static uint8_t ncellmeas_bench_ncells_count;
+static uint8_t ncellmeas_bench_gci_cells_count;
+
+K_SEM_DEFINE(ncellmeas_bench_sem, 0, 1);
+
+static void ncellmeas_bench_handler(const struct lte_lc_evt *const evt)
+{
+	if (evt->type != LTE_LC_EVT_NEIGHBOR_CELL_MEAS) {
+		return;
+	}
+
+	ncellmeas_bench_ncells_count = evt->cells_info.ncells_count;
+	ncellmeas_bench_gci_cells_count = evt->cells_info.gci_cells_count;
+	k_sem_give(&ncellmeas_bench_sem);
+}
+
+/* Measure the time from dispatching the notification until the event has been handled. */
+static uint64_t ncellmeas_bench_run(struct lte_lc_ncellmeas_params *params, const char *cmd,
+				    const char *notif)
+{
+	int ret;
+	uint64_t start;
+	uint64_t total = 0;
+
+	for (int i = 0; i < NCELLMEAS_BENCH_ITERATIONS; i++) {
+		__mock_nrf_modem_at_printf_ExpectAndReturn(cmd, EXIT_SUCCESS);
+
+		ret = lte_lc_neighbor_cell_measurement(params);
+		TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+
+		start = bench_time_ns();
+		at_monitor_dispatch(notif);
+
+		ret = k_sem_take(&ncellmeas_bench_sem, K_SECONDS(1));
+		total += bench_time_ns() - start;
+		TEST_ASSERT_EQUAL(0, ret);
+	}
+
+	return total / NCELLMEAS_BENCH_ITERATIONS;
+}
+
+void test_lte_lc_neighbor_cell_measurement_benchmark(void)
+{
+	int ret;
+	uint64_t normal_ns;
+	uint64_t gci_ns;
+	struct lte_lc_ncellmeas_params params = {
+		.search_type = LTE_LC_NEIGHBOR_SEARCH_TYPE_EXTENDED_COMPLETE,
+	};
+
+	/* Replace the handler set in setUp() with one that only counts the results. The handler
+	 * is removed in tearDown(), also if an assertion fails.
+	 */
+	ret = lte_lc_deregister_handler(lte_lc_event_handler);
+	TEST_ASSERT_EQUAL(EXIT_SUCCESS, ret);
+	lte_lc_register_handler(ncellmeas_bench_handler);
+	ncellmeas_bench_handler_registered = true;
+
+	normal_ns = ncellmeas_bench_run(&params, "AT%NCELLMEAS=2", ncellmeas_max_cells_resp);
+	TEST_ASSERT_EQUAL(CONFIG_LTE_NEIGHBOR_CELLS_MAX, ncellmeas_bench_ncells_count);
+	TEST_ASSERT_EQUAL(0, ncellmeas_bench_gci_cells_count);
+
+	params.search_type = LTE_LC_NEIGHBOR_SEARCH_TYPE_GCI_EXTENDED_COMPLETE;
+	params.gci_count = 15;
+
+	gci_ns = ncellmeas_bench_run(&params, "AT%NCELLMEAS=5,15", ncellmeas_gci_max_length_resp);
+	TEST_ASSERT_EQUAL(CONFIG_LTE_NEIGHBOR_CELLS_MAX, ncellmeas_bench_ncells_count);
+	TEST_ASSERT_EQUAL(14, ncellmeas_bench_gci_cells_count);
+
+	printk("%%NCELLMEAS with 20 neighbor cells: %u ns\n", (uint32_t)normal_ns);
+	printk("%%NCELLMEAS with 15 GCI cells and 20 neighbor cells: %u ns\n",
+	       (uint32_t)gci_ns);
+}
+
 void test_lte_lc_neighbor_cell_measurement_cancel(void)
 {
 	int ret;
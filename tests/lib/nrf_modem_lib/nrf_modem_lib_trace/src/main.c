@@ -50,11 +50,16 @@ K_FIFO_DEFINE(get_fifo);
 K_FIFO_DEFINE(write_fifo);
 
 K_SEM_DEFINE(backend_deinit_sem, 0, 1);
+K_SEM_DEFINE(trace_processed_sem, 0, 1);
+K_SEM_DEFINE(write_async_eagain_sem, 0, 1);
 
 static int nrf_modem_trace_get_error;
 static int nrf_modem_trace_get_cmock_num_calls;
 static int trace_backend_write_error;
 static int trace_backend_write_cmock_num_calls;
+static trace_backend_write_done_cb write_done_cb;
+static bool write_async_eagain;
+static size_t trace_processed_len;
 
 static int callback_evt;
 
@@ -94,6 +99,9 @@ void setUp(void)
 	nrf_modem_trace_get_cmock_num_calls = 0;
 	trace_backend_write_error = 0;
 	trace_backend_write_cmock_num_calls = 9;
+	write_done_cb = NULL;
+	write_async_eagain = false;
+	trace_processed_len = 0;
 
 	RESET_FAKE(nrf_modem_at_printf);
 
@@ -191,6 +199,40 @@ int trace_backend_write_stub(const void *data, size_t len, int cmock_num_calls)
 	return (int)len;
 }
 
+int trace_backend_write_async_stub(const struct nrf_modem_trace_data *frags, size_t n_frags,
+				   trace_backend_write_done_cb done_cb, int cmock_num_calls)
+{
+	struct nrf_modem_trace_data *frag;
+
+	write_done_cb = done_cb;
+
+	if (write_async_eagain && cmock_num_calls == 1) {
+		k_sem_give(&write_async_eagain_sem);
+		return -EAGAIN;
+	}
+
+	/* Queue one fragment at a time when testing backpressure. */
+	if (write_async_eagain) {
+		n_frags = 1;
+	}
+
+	for (int i = 0; i < n_frags; i++) {
+		frag = &write_frags[(cmock_num_calls + i) % MAX_N_STATIC_FRAGS];
+		memcpy(frag, &frags[i], sizeof(*frag));
+		k_fifo_alloc_put(&write_fifo, frag);
+	}
+
+	return n_frags;
+}
+
+int nrf_modem_trace_processed_stub(size_t len, int cmock_num_calls)
+{
+	trace_processed_len += len;
+	k_sem_give(&trace_processed_sem);
+
+	return 0;
+}
+
 /* Function implementing a mechanism to synchronize main testing thread with trace thread via
  * a semaphore. This is the last function in the execution flow that can be mocked.
  */
@@ -418,6 +460,165 @@ void test_nrf_modem_lib_trace_enospc(void)
 	TEST_ASSERT_EQUAL_size_t(header.len, header_write->len);
 }
 
+static void write_async_setup(void)
+{
+	trace_backend.write = NULL;
+	trace_backend.write_async = trace_backend_write_async;
+
+	__cmock_trace_backend_init_ExpectAndReturn(nrf_modem_trace_processed, 0);
+	__cmock_nrf_modem_trace_get_Stub(nrf_modem_trace_get_stub);
+	__cmock_trace_backend_write_async_Stub(trace_backend_write_async_stub);
+	__cmock_nrf_modem_trace_processed_Stub(nrf_modem_trace_processed_stub);
+	__cmock_trace_backend_deinit_Stub(trace_backend_deinit_stub);
+	__cmock_nrf_modem_is_initialized_IgnoreAndReturn(true);
+}
+
+static void write_async_teardown(void)
+{
+	nrf_modem_trace_get_error = -ESHUTDOWN;
+
+	wait_trace_deinit();
+
+	trace_backend.write = trace_backend_write;
+	trace_backend.write_async = NULL;
+}
+
+void test_trace_thread_handler_write_async(void)
+{
+	int ret;
+	struct nrf_modem_trace_data header = { 0 };
+	struct nrf_modem_trace_data data = { 0 };
+	struct nrf_modem_trace_data *header_write;
+	struct nrf_modem_trace_data *data_write;
+	struct nrf_modem_lib_trace_pipeline_stats stats;
+
+	write_async_setup();
+
+	nrf_modem_lib_trace_init();
+
+	generate_trace_frag(&header);
+	generate_trace_frag(&data);
+
+	k_fifo_alloc_put(&get_fifo, &header);
+	k_fifo_alloc_put(&get_fifo, &data);
+
+	header_write = k_fifo_get(&write_fifo, K_FOREVER);
+	data_write = k_fifo_get(&write_fifo, K_FOREVER);
+
+	TEST_ASSERT_EQUAL_PTR(header.data, header_write->data);
+	TEST_ASSERT_EQUAL_size_t(header.len, header_write->len);
+	TEST_ASSERT_EQUAL_PTR(data.data, data_write->data);
+	TEST_ASSERT_EQUAL_size_t(data.len, data_write->len);
+
+	/* Trace data is not released before the backend has processed it. */
+	TEST_ASSERT_EQUAL_size_t(0, trace_processed_len);
+
+	ret = nrf_modem_lib_trace_pipeline_stats_get(&stats);
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(header.len + data.len, stats.queued_bytes);
+	TEST_ASSERT_GREATER_OR_EQUAL(header.len + data.len, stats.queued_bytes_max);
+
+	TEST_ASSERT_NOT_NULL(write_done_cb);
+	write_done_cb(header.len + data.len, 0);
+
+	k_sem_take(&trace_processed_sem, K_FOREVER);
+	TEST_ASSERT_EQUAL_size_t(header.len + data.len, trace_processed_len);
+
+	ret = nrf_modem_lib_trace_pipeline_stats_get(&stats);
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(0, stats.queued_bytes);
+
+	write_async_teardown();
+}
+
+void test_trace_thread_handler_write_async_eagain(void)
+{
+	int ret;
+	struct nrf_modem_trace_data header = { 0 };
+	struct nrf_modem_trace_data data = { 0 };
+	struct nrf_modem_trace_data *header_write;
+	struct nrf_modem_trace_data *data_write;
+	struct nrf_modem_lib_trace_pipeline_stats before;
+	struct nrf_modem_lib_trace_pipeline_stats after;
+
+	write_async_setup();
+	write_async_eagain = true;
+
+	ret = nrf_modem_lib_trace_pipeline_stats_get(&before);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	nrf_modem_lib_trace_init();
+
+	generate_trace_frag(&header);
+	generate_trace_frag(&data);
+
+	k_fifo_alloc_put(&get_fifo, &header);
+	k_fifo_alloc_put(&get_fifo, &data);
+
+	header_write = k_fifo_get(&write_fifo, K_FOREVER);
+	TEST_ASSERT_EQUAL_PTR(header.data, header_write->data);
+
+	/* The backend queue is full, processing the header makes room for the data. */
+	k_sem_take(&write_async_eagain_sem, K_FOREVER);
+	write_done_cb(header.len, 0);
+
+	data_write = k_fifo_get(&write_fifo, K_FOREVER);
+	TEST_ASSERT_EQUAL_PTR(data.data, data_write->data);
+	TEST_ASSERT_EQUAL_size_t(data.len, data_write->len);
+
+	write_done_cb(data.len, 0);
+
+	ret = nrf_modem_lib_trace_pipeline_stats_get(&after);
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(before.backpressure_count + 1, after.backpressure_count);
+
+	write_async_teardown();
+}
+
+void test_trace_thread_handler_write_async_dropped(void)
+{
+	int ret;
+	struct nrf_modem_trace_data header = { 0 };
+	struct nrf_modem_lib_trace_pipeline_stats before;
+	struct nrf_modem_lib_trace_pipeline_stats after;
+
+	write_async_setup();
+
+	ret = nrf_modem_lib_trace_pipeline_stats_get(&before);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	nrf_modem_lib_trace_init();
+
+	generate_trace_frag(&header);
+
+	k_fifo_alloc_put(&get_fifo, &header);
+	(void)k_fifo_get(&write_fifo, K_FOREVER);
+
+	/* Dropped trace data is released to the modem too. */
+	write_done_cb(header.len, -EIO);
+
+	k_sem_take(&trace_processed_sem, K_FOREVER);
+	TEST_ASSERT_EQUAL_size_t(header.len, trace_processed_len);
+
+	ret = nrf_modem_lib_trace_pipeline_stats_get(&after);
+	TEST_ASSERT_EQUAL(0, ret);
+	TEST_ASSERT_EQUAL(before.dropped_bytes + header.len, after.dropped_bytes);
+
+	write_async_teardown();
+}
+
+void test_nrf_modem_lib_trace_pipeline_stats_get_enotsup(void)
+{
+	int ret;
+	struct nrf_modem_lib_trace_pipeline_stats stats;
+
+	ret = nrf_modem_lib_trace_pipeline_stats_get(NULL);
+	TEST_ASSERT_EQUAL(-EINVAL, ret);
+
+	ret = nrf_modem_lib_trace_pipeline_stats_get(&stats);
+	TEST_ASSERT_EQUAL(-ENOTSUP, ret);
+}
+
 void test_nrf_modem_lib_trace_data_size(void)
 {
 	int ret;
@@ -5,6 +5,7 @@
  */
 #include <stdio.h>
 #include <modem/trace_backend.h>
+#include <nrf_modem_trace.h>
 
 int trace_backend_init(trace_backend_processed_cb trace_processed_cb)
 {
@@ -21,6 +22,12 @@ int trace_backend_write(const void *data, size_t len)
 	return 0;
 }
 
+int trace_backend_write_async(const struct nrf_modem_trace_data *frags, size_t n_frags,
+			      trace_backend_write_done_cb done_cb)
+{
+	return 0;
+}
+
 size_t trace_backend_data_size(void)
 {
 	return 0;
@@ -5,6 +5,7 @@
  */
 #include <stdio.h>
 #include <modem/trace_backend.h>
+#include <nrf_modem_trace.h>
 
 int trace_backend_init(trace_backend_processed_cb trace_processed_cb);
 
@@ -12,6 +13,9 @@ int trace_backend_deinit(void);
 
 int trace_backend_write(const void *data, size_t len);
 
+int trace_backend_write_async(const struct nrf_modem_trace_data *frags, size_t n_frags,
+			      trace_backend_write_done_cb done_cb);
+
 size_t trace_backend_data_size(void);
 
 int trace_backend_read(void *buf, size_t len);
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+#include <zephyr/kernel.h>
+#include <zephyr/sys/byteorder.h>
+#include <lz4.h>
+#include <modem/nrf_modem_lib_trace.h>
+
+#include "trace_backend.h"
+
+extern struct nrf_modem_lib_trace_backend trace_backend;
+
+/* Given by the trace library when a flash sector has been cleared */
+K_SEM_DEFINE(trace_clear_sem, 0, 1);
+
+/* More than fits in the flash buffer, so that both flash entries and buffered data are read */
+#define TRACE_DATA_SIZE 3000
+#define WRITE_CHUNK_SIZE 100
+#define READ_CHUNK_SIZE 100
+/* Room for the LZ4 frame header, end mark and block headers */
+#define READ_BUF_SIZE (TRACE_DATA_SIZE + 256)
+
+#define READ_COMPRESSED IS_ENABLED(CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_READ_COMPRESSED)
+#define BLOCK_UNCOMPRESSED BIT(31)
+
+static const uint8_t lz4_frame_header[] = {0x04, 0x22, 0x4d, 0x18, 0x60, 0x40, 0x82};
+
+static uint8_t trace_data[TRACE_DATA_SIZE];
+static uint8_t read_data[READ_BUF_SIZE];
+static uint8_t decoded_data[TRACE_DATA_SIZE];
+
+static int callback(size_t len)
+{
+	return 0;
+}
+
+/* It is required to be added to each test. That is because unity's
+ * main may return nonzero, while zephyr's main currently must
+ * return 0 in all cases (other values are reserved).
+ */
+extern int unity_main(void);
+
+static void trace_data_compressible_fill(void)
+{
+	size_t len = 0;
+
+	while (len < sizeof(trace_data)) {
+		char line[32];
+		int n = snprintf(line, sizeof(line), "trace %05u level 2\n", (unsigned int)len);
+
+		n = MIN(n, sizeof(trace_data) - len);
+		memcpy(&trace_data[len], line, n);
+		len += n;
+	}
+}
+
+static void trace_data_random_fill(void)
+{
+	uint32_t x = 0x2545f491;
+
+	for (size_t i = 0; i < sizeof(trace_data); i++) {
+		x ^= x << 13;
+		x ^= x >> 17;
+		x ^= x << 5;
+		trace_data[i] = x;
+	}
+}
+
+static void trace_data_write(void)
+{
+	int ret;
+
+	for (size_t i = 0; i < sizeof(trace_data); i += WRITE_CHUNK_SIZE) {
+		ret = trace_backend.write(&trace_data[i], MIN(WRITE_CHUNK_SIZE,
+							      sizeof(trace_data) - i));
+		TEST_ASSERT_EQUAL(MIN(WRITE_CHUNK_SIZE, sizeof(trace_data) - i), ret);
+	}
+}
+
+static size_t trace_data_read(void)
+{
+	int ret;
+	size_t len = 0;
+
+	while (true) {
+		TEST_ASSERT_TRUE(len + READ_CHUNK_SIZE <= sizeof(read_data));
+
+		ret = trace_backend.read(&read_data[len], READ_CHUNK_SIZE);
+		if (ret == -ENODATA) {
+			break;
+		}
+
+		TEST_ASSERT_GREATER_THAN(0, ret);
+		len += ret;
+	}
+
+	return len;
+}
+
+/* Decode the LZ4 frame returned when reading compressed traces */
+static size_t lz4_frame_decode(const uint8_t *frame, size_t len)
+{
+	int ret;
+	uint32_t block;
+	size_t block_len;
+	size_t pos = sizeof(lz4_frame_header);
+	size_t decoded_len = 0;
+
+	TEST_ASSERT_TRUE(len >= sizeof(lz4_frame_header));
+	TEST_ASSERT_EQUAL_UINT8_ARRAY(lz4_frame_header, frame, sizeof(lz4_frame_header));
+
+	while (true) {
+		TEST_ASSERT_TRUE(pos + sizeof(block) <= len);
+		block = sys_get_le32(&frame[pos]);
+		pos += sizeof(block);
+
+		if (!block) {
+			/* End mark */
+			break;
+		}
+
+		block_len = block & ~BLOCK_UNCOMPRESSED;
+		TEST_ASSERT_TRUE(pos + block_len <= len);
+
+		if (block & BLOCK_UNCOMPRESSED) {
+			TEST_ASSERT_TRUE(decoded_len + block_len <= sizeof(decoded_data));
+			memcpy(&decoded_data[decoded_len], &frame[pos], block_len);
+			ret = block_len;
+		} else {
+			ret = LZ4_decompress_safe((const char *)&frame[pos],
+						  (char *)&decoded_data[decoded_len], block_len,
+						  sizeof(decoded_data) - decoded_len);
+			TEST_ASSERT_GREATER_THAN(0, ret);
+		}
+
+		pos += block_len;
+		decoded_len += ret;
+	}
+
+	/* Nothing after the end mark */
+	TEST_ASSERT_EQUAL(len, pos);
+
+	return decoded_len;
+}
+
+static void trace_data_round_trip(void)
+{
+	size_t len;
+
+	trace_data_write();
+
+	len = trace_data_read();
+
+	if (READ_COMPRESSED) {
+		len = lz4_frame_decode(read_data, len);
+		TEST_ASSERT_EQUAL(sizeof(trace_data), len);
+		TEST_ASSERT_EQUAL_UINT8_ARRAY(trace_data, decoded_data, len);
+	} else {
+		TEST_ASSERT_EQUAL(sizeof(trace_data), len);
+		TEST_ASSERT_EQUAL_UINT8_ARRAY(trace_data, read_data, len);
+	}
+
+	TEST_ASSERT_EQUAL(0, trace_backend.data_size());
+}
+
+void setUp(void)
+{
+	int ret;
+
+	ret = trace_backend.init(callback);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	ret = trace_backend.clear();
+	TEST_ASSERT_EQUAL(0, ret);
+}
+
+void tearDown(void)
+{
+}
+
+void test_trace_backend_flash_round_trip(void)
+{
+	trace_data_compressible_fill();
+	trace_data_round_trip();
+}
+
+void test_trace_backend_flash_round_trip_incompressible(void)
+{
+	/* Stored as uncompressed blocks */
+	trace_data_random_fill();
+	trace_data_round_trip();
+}
+
+void test_trace_backend_flash_data_size(void)
+{
+	trace_data_compressible_fill();
+	trace_data_write();
+
+	if (!READ_COMPRESSED) {
+		TEST_ASSERT_EQUAL(sizeof(trace_data), trace_backend.data_size());
+	}
+
+	(void)trace_data_read();
+	TEST_ASSERT_EQUAL(0, trace_backend.data_size());
+}
+
+void test_trace_backend_flash_stats(void)
+{
+	int ret;
+	struct nrf_modem_lib_trace_backend_stats before;
+	struct nrf_modem_lib_trace_backend_stats after;
+
+	ret = trace_backend.stats_get(&before);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	trace_data_compressible_fill();
+	trace_data_write();
+
+	ret = trace_backend.stats_get(&after);
+	TEST_ASSERT_EQUAL(0, ret);
+
+	/* Only full buffers have been written to flash, and they compress */
+	TEST_ASSERT_EQUAL(sizeof(trace_data) / CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE *
+			  CONFIG_NRF_MODEM_LIB_TRACE_BACKEND_FLASH_BUF_SIZE,
+			  after.bytes_in - before.bytes_in);
+	TEST_ASSERT_LESS_THAN(after.bytes_in - before.bytes_in, after.bytes_out - before.bytes_out);
+}
+
+int main(void)
+{
+	(void)unity_main();
+
+	return 0;
+}
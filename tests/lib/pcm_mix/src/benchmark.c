@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <pcm_mix.h>
+
+/* One 10 ms stereo frame at 48 kHz */
+#define BENCH_NUM_SAMPLES 960
+#define BENCH_NUM_INPUTS  6
+#define BENCH_ITERATIONS  100
+
+static int16_t bench_in[BENCH_NUM_INPUTS][BENCH_NUM_SAMPLES];
+static int16_t bench_out[BENCH_NUM_SAMPLES];
+
+static void bench_fill(void)
+{
+	uint32_t seed = 0x12345678;
+
+	for (int n = 0; n < BENCH_NUM_INPUTS; n++) {
+		for (int i = 0; i < BENCH_NUM_SAMPLES; i++) {
+			seed = seed * 1103515245 + 12345;
+			bench_in[n][i] = (int16_t)(seed >> 16);
+		}
+	}
+}
+
+/* Scalar reference, the same loop as pcm_mix() used before it had a mixing kernel */
+static void ref_mix(int16_t *out, int16_t const *in, size_t num_samples)
+{
+	for (size_t i = 0; i < num_samples; i++) {
+		out[i] = (int16_t)CLAMP((int32_t)out[i] + in[i], INT16_MIN, INT16_MAX);
+	}
+}
+
+static uint32_t bench_scalar(void)
+{
+	uint32_t start = k_cycle_get_32();
+
+	for (int iter = 0; iter < BENCH_ITERATIONS; iter++) {
+		memcpy(bench_out, bench_in[0], sizeof(bench_out));
+
+		for (int n = 1; n < BENCH_NUM_INPUTS; n++) {
+			ref_mix(bench_out, bench_in[n], BENCH_NUM_SAMPLES);
+		}
+	}
+
+	return k_cycle_get_32() - start;
+}
+
+static void chained_mix(void)
+{
+	int ret;
+
+	memcpy(bench_out, bench_in[0], sizeof(bench_out));
+
+	for (int n = 1; n < BENCH_NUM_INPUTS; n++) {
+		ret = pcm_mix(bench_out, sizeof(bench_out), bench_in[n], sizeof(bench_in[n]),
+			      B_MONO_INTO_A_MONO);
+		zassert_equal(ret, 0, "pcm_mix failed (%d)", ret);
+	}
+}
+
+static uint32_t bench_multi(uint32_t gain)
+{
+	struct pcm_mix_input inputs[BENCH_NUM_INPUTS];
+	uint32_t start;
+
+	for (int n = 0; n < BENCH_NUM_INPUTS; n++) {
+		inputs[n].pcm = bench_in[n];
+		inputs[n].gain = gain;
+	}
+
+	start = k_cycle_get_32();
+
+	for (int iter = 0; iter < BENCH_ITERATIONS; iter++) {
+		(void)pcm_mix_multi(bench_out, sizeof(bench_out), inputs, BENCH_NUM_INPUTS, 16);
+	}
+
+	return k_cycle_get_32() - start;
+}
+
+static void bench_report(const char *name, uint32_t cycles)
+{
+	uint32_t samples = BENCH_NUM_SAMPLES * BENCH_ITERATIONS;
+
+	TC_PRINT("%-24s %u cycles, %u.%02u cycles/sample\n", name, cycles, cycles / samples,
+		 (uint32_t)(((uint64_t)(cycles % samples) * 100) / samples));
+}
+
+ZTEST(suite_pcm_mix_benchmark, test_benchmark_16_bit)
+{
+	uint32_t scalar;
+	uint32_t multi;
+	uint32_t multi_gain;
+	int16_t ref[BENCH_NUM_SAMPLES];
+
+	bench_fill();
+
+	scalar = bench_scalar();
+	memcpy(ref, bench_out, sizeof(ref));
+
+	chained_mix();
+	zassert_mem_equal(ref, bench_out, sizeof(ref), "pcm_mix output differs from reference");
+
+	multi = bench_multi(PCM_MIX_GAIN_UNITY);
+	/* Unity gain must give the same result as the scalar reference */
+	zassert_mem_equal(ref, bench_out, sizeof(ref), "pcm_mix_multi output differs from reference");
+
+	multi_gain = bench_multi(PCM_MIX_GAIN_UNITY / 4);
+
+	TC_PRINT("Mixing %d inputs of %d samples, %d iterations\n", BENCH_NUM_INPUTS,
+		 BENCH_NUM_SAMPLES, BENCH_ITERATIONS);
+	bench_report("Scalar reference:", scalar);
+	bench_report("pcm_mix_multi:", multi);
+	bench_report("pcm_mix_multi with gain:", multi_gain);
+}
+
+ZTEST_SUITE(suite_pcm_mix_benchmark, NULL, NULL, NULL, NULL, NULL);
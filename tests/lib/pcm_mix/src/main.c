@@ -127,4 +127,123 @@ ZTEST(suite_pcm_mix, test_mono_into_stereo_r)
 	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
 }
 
+ZTEST(suite_pcm_mix, test_mix_multi_16_bit)
+{
+	int ret;
+	int16_t sample_a[] = { 10, INT16_MAX, -5, 7, 1 };
+	int16_t sample_b[] = { 10, 10, -5, -7, 1 };
+	int16_t sample_c[] = { 4, 0, INT16_MIN, 4, 2 };
+	int16_t sample_out[ARRAY_SIZE(sample_a)];
+	int16_t sample_r[] = { 22, INT16_MAX, -16394, 2, 3 };
+	struct pcm_mix_input inputs[] = {
+		{ .pcm = sample_a, .gain = PCM_MIX_GAIN_UNITY },
+		{ .pcm = sample_b, .gain = PCM_MIX_GAIN_UNITY },
+		{ .pcm = sample_c, .gain = PCM_MIX_GAIN_UNITY / 2 },
+	};
+
+	ret = pcm_mix_multi(sample_out, sizeof(sample_out), inputs, ARRAY_SIZE(inputs), 16);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_out, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_multi_in_place)
+{
+	int ret;
+	int16_t sample_a[] = { 1, 2, 3, 4 };
+	int16_t sample_b[] = { 1, -2, 3, -4 };
+	int16_t sample_r[] = { 3, -2, 9, -4 };
+	struct pcm_mix_input inputs[] = {
+		{ .pcm = sample_a, .gain = PCM_MIX_GAIN_UNITY },
+		{ .pcm = NULL, .gain = PCM_MIX_GAIN_UNITY },
+		{ .pcm = sample_b, .gain = 2 * PCM_MIX_GAIN_UNITY },
+	};
+
+	ret = pcm_mix_multi(sample_a, sizeof(sample_a), inputs, ARRAY_SIZE(inputs), 16);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
+ZTEST(suite_pcm_mix, test_mix_multi_24_bit)
+{
+	int ret;
+	int32_t sample_a[] = { (1 << 23) - 10, -100, -(1 << 23) };
+	int32_t sample_b[] = { 100, -50, -1 };
+	int32_t sample_out[ARRAY_SIZE(sample_a)];
+	int32_t sample_r[] = { (1 << 23) - 1, -200, -(1 << 23) };
+	struct pcm_mix_input inputs[] = {
+		{ .pcm = sample_a, .gain = PCM_MIX_GAIN_UNITY },
+		{ .pcm = sample_b, .gain = 2 * PCM_MIX_GAIN_UNITY },
+	};
+
+	ret = pcm_mix_multi(sample_out, sizeof(sample_out), inputs, ARRAY_SIZE(inputs), 24);
+	ZEQ(ret, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sample_r); i++) {
+		ZEQ(sample_out[i], sample_r[i]);
+	}
+}
+
+ZTEST(suite_pcm_mix, test_mix_multi_32_bit)
+{
+	int ret;
+	int32_t sample_a[] = { INT32_MAX, INT32_MIN, 1000 };
+	int32_t sample_b[] = { 1, -1, -3000 };
+	int32_t sample_out[ARRAY_SIZE(sample_a)];
+	int32_t sample_r[] = { INT32_MAX, INT32_MIN, -2000 };
+	struct pcm_mix_input inputs[] = {
+		{ .pcm = sample_a, .gain = PCM_MIX_GAIN_UNITY },
+		{ .pcm = sample_b, .gain = PCM_MIX_GAIN_UNITY },
+	};
+
+	ret = pcm_mix_multi(sample_out, sizeof(sample_out), inputs, ARRAY_SIZE(inputs), 32);
+	ZEQ(ret, 0);
+
+	for (size_t i = 0; i < ARRAY_SIZE(sample_r); i++) {
+		ZEQ(sample_out[i], sample_r[i]);
+	}
+}
+
+ZTEST(suite_pcm_mix, test_mix_multi_illegal_arguments)
+{
+	int ret;
+	int16_t sample_a[] = { 0, 1, 2 };
+	struct pcm_mix_input inputs[] = {
+		{ .pcm = sample_a, .gain = PCM_MIX_GAIN_UNITY },
+	};
+
+	ret = pcm_mix_multi(NULL, sizeof(sample_a), inputs, ARRAY_SIZE(inputs), 16);
+	ZEQ(ret, -EINVAL);
+
+	ret = pcm_mix_multi(sample_a, 0, inputs, ARRAY_SIZE(inputs), 16);
+	ZEQ(ret, -EINVAL);
+
+	ret = pcm_mix_multi(sample_a, sizeof(sample_a), NULL, 1, 16);
+	ZEQ(ret, -EINVAL);
+
+	ret = pcm_mix_multi(sample_a, sizeof(sample_a), inputs, ARRAY_SIZE(inputs), 8);
+	ZEQ(ret, -EINVAL);
+
+	/* Size is not a multiple of the 32-bit carrier */
+	ret = pcm_mix_multi(sample_a, sizeof(sample_a), inputs, ARRAY_SIZE(inputs), 32);
+	ZEQ(ret, -EINVAL);
+
+	ret = pcm_mix_multi(sample_a, sizeof(sample_a), inputs,
+			    CONFIG_PCM_MIX_MULTI_INPUTS_MAX + 1, 16);
+	ZEQ(ret, -EINVAL);
+}
+
+ZTEST(suite_pcm_mix, test_mix_multi_no_inputs)
+{
+	int ret;
+	int16_t sample_a[] = { 5, 6, 7 };
+	int16_t sample_r[] = { 0, 0, 0 };
+
+	ret = pcm_mix_multi(sample_a, sizeof(sample_a), NULL, 0, 16);
+	ZEQ(ret, 0);
+
+	verify_array_eq(sample_a, sample_r, ARRAY_SIZE(sample_r));
+}
+
 ZTEST_SUITE(suite_pcm_mix, NULL, NULL, NULL, NULL, NULL);
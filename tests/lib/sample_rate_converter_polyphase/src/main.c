@@ -0,0 +1,265 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <math.h>
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+#include <sample_rate_converter.h>
+
+#include "bench_host_clock.h"
+
+/* Number of 10 ms blocks to convert in each test */
+#define NUM_BLOCKS	    100
+#define BLOCK_SAMPLES(rate) ((rate) / 100)
+#define MAX_OUTPUT_SAMPLES  (BLOCK_SAMPLES(48000) * NUM_BLOCKS)
+
+/* Skip the start of the output so the filter delay does not affect the THD+N estimate */
+#define THD_SKIP_SAMPLES 200
+
+#define TONE_FREQ_HZ 1000
+#define TONE_AMPL    16383
+
+static struct sample_rate_converter_poly_ctx poly_ctx;
+static struct sample_rate_converter_ctx chain_ctx[2];
+
+static int16_t input_buf[BLOCK_SAMPLES(48000)];
+/* Room for the rounding margin of the output size check on the last block */
+static int16_t output_samples[MAX_OUTPUT_SAMPLES + 2];
+
+static void tone_block_fill(uint32_t sample_rate, uint32_t block)
+{
+	uint32_t num_samples = BLOCK_SAMPLES(sample_rate);
+
+	for (uint32_t i = 0; i < num_samples; i++) {
+		uint32_t n = block * num_samples + i;
+
+		input_buf[i] =
+			(int16_t)lroundf(TONE_AMPL * sinf(2.0f * (float)M_PI * TONE_FREQ_HZ *
+							  (float)n / (float)sample_rate));
+	}
+}
+
+/* Estimate THD+N in dB by removing the least squares fit of the tone from the output */
+static float thd_n_db(int16_t const *samples, size_t num_samples, uint32_t sample_rate)
+{
+	double w = 2.0 * M_PI * TONE_FREQ_HZ / sample_rate;
+	double sc = 0, ss = 0, cc = 0, sn = 0, cs = 0;
+	double a, b, det, residual = 0;
+
+	samples += THD_SKIP_SAMPLES;
+	num_samples -= THD_SKIP_SAMPLES;
+
+	for (size_t i = 0; i < num_samples; i++) {
+		double c = cos(w * i);
+		double s = sin(w * i);
+
+		sc += samples[i] * c;
+		ss += samples[i] * s;
+		cc += c * c;
+		sn += s * s;
+		cs += c * s;
+	}
+
+	det = cc * sn - cs * cs;
+	a = (sc * sn - ss * cs) / det;
+	b = (ss * cc - sc * cs) / det;
+
+	for (size_t i = 0; i < num_samples; i++) {
+		double e = samples[i] - a * cos(w * i) - b * sin(w * i);
+
+		residual += e * e;
+	}
+
+	return (float)(10.0 * log10((residual / num_samples) / ((a * a + b * b) / 2.0)));
+}
+
+/* Convert NUM_BLOCKS blocks of tone with the polyphase converter and return the time spent */
+static uint64_t poly_convert(uint32_t rate_in, uint32_t rate_out, size_t *num_out)
+{
+	int ret;
+	size_t written;
+	uint64_t elapsed = 0;
+
+	*num_out = 0;
+
+	for (uint32_t block = 0; block < NUM_BLOCKS; block++) {
+		uint64_t start;
+
+		tone_block_fill(rate_in, block);
+
+		start = bench_time_ns();
+		ret = sample_rate_converter_poly_process(
+			&poly_ctx, input_buf, BLOCK_SAMPLES(rate_in) * sizeof(int16_t), rate_in,
+			&output_samples[*num_out], sizeof(output_samples) - *num_out * sizeof(int16_t),
+			&written, rate_out);
+		elapsed += bench_time_ns() - start;
+
+		zassert_equal(ret, 0, "Polyphase conversion failed (%d)", ret);
+		*num_out += written / sizeof(int16_t);
+	}
+
+	return elapsed;
+}
+
+static void test_setup(void *f)
+{
+	sample_rate_converter_poly_open(&poly_ctx);
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_output_count)
+{
+	static const uint32_t rates[][2] = {
+		{44100, 48000}, {48000, 44100}, {32000, 48000}, {48000, 32000},
+		{24000, 16000}, {16000, 48000}, {48000, 16000}, {48000, 48000},
+	};
+	size_t num_out;
+
+	for (size_t i = 0; i < ARRAY_SIZE(rates); i++) {
+		sample_rate_converter_poly_open(&poly_ctx);
+		(void)poly_convert(rates[i][0], rates[i][1], &num_out);
+
+		/* The filter history starts filled, so no samples are lost or added */
+		zassert_equal(num_out, BLOCK_SAMPLES(rates[i][1]) * NUM_BLOCKS,
+			      "Unexpected number of output samples %d for %d -> %d", num_out,
+			      rates[i][0], rates[i][1]);
+	}
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_thd_44k1_to_48k)
+{
+	size_t num_out;
+	float thd;
+
+	(void)poly_convert(44100, 48000, &num_out);
+
+	thd = thd_n_db(output_samples, num_out, 48000);
+	zassert_true(thd < -70.0f, "THD+N too high: %d dB", (int)thd);
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_drift_correction)
+{
+	int ret;
+	size_t num_out;
+
+	/* 1000 ppm faster consumption gives 0.1 percent fewer output samples */
+	ret = sample_rate_converter_poly_drift_set(&poly_ctx, 1000000);
+	zassert_equal(ret, 0, "Failed to set drift correction");
+
+	(void)poly_convert(48000, 48000, &num_out);
+	zassert_within(num_out, (MAX_OUTPUT_SAMPLES * 1000) / 1001, 1,
+		       "Unexpected number of output samples %d", num_out);
+}
+
+ZTEST(suite_sample_rate_converter_poly, test_poly_invalid_parameters)
+{
+	int ret;
+	size_t written;
+	int16_t output[4];
+
+	ret = sample_rate_converter_poly_open(NULL);
+	zassert_equal(ret, -EINVAL, "Open did not fail with NULL context");
+
+	ret = sample_rate_converter_poly_drift_set(&poly_ctx,
+						   SAMPLE_RATE_CONVERTER_POLY_DRIFT_PPB_MAX + 1);
+	zassert_equal(ret, -EINVAL, "Drift correction out of range was accepted");
+
+	/* No coefficient bank can prevent aliasing for such a large reduction */
+	ret = sample_rate_converter_poly_process(&poly_ctx, input_buf, sizeof(input_buf), 48000,
+						 output_samples, sizeof(output_samples), &written,
+						 8000);
+	zassert_equal(ret, -EINVAL, "Unsupported ratio was accepted");
+
+	ret = sample_rate_converter_poly_process(&poly_ctx, input_buf, 3, 48000, output_samples,
+						 sizeof(output_samples), &written, 44100);
+	zassert_equal(ret, -EINVAL, "Odd input size was accepted");
+
+	ret = sample_rate_converter_poly_process(&poly_ctx, input_buf, sizeof(input_buf), 48000,
+						 output, sizeof(output), &written, 44100);
+	zassert_equal(ret, -EINVAL, "Too small output buffer was accepted");
+
+	ret = sample_rate_converter_poly_process(&poly_ctx, NULL, sizeof(input_buf), 48000,
+						 output_samples, sizeof(output_samples), &written,
+						 44100);
+	zassert_equal(ret, -EINVAL, "NULL input was accepted");
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_poly, NULL, NULL, test_setup, NULL, NULL);
+
+/* 24 kHz -> 16 kHz needs two fixed ratio stages through 48 kHz */
+static uint64_t chain_convert(size_t *num_out)
+{
+	int ret;
+	size_t written;
+	uint64_t elapsed = 0;
+	static int16_t intermediate[BLOCK_SAMPLES(48000)];
+
+	sample_rate_converter_open(&chain_ctx[0]);
+	sample_rate_converter_open(&chain_ctx[1]);
+	*num_out = 0;
+
+	for (uint32_t block = 0; block < NUM_BLOCKS; block++) {
+		uint64_t start;
+
+		tone_block_fill(24000, block);
+
+		start = bench_time_ns();
+		ret = sample_rate_converter_process(
+			&chain_ctx[0], SAMPLE_RATE_FILTER_SIMPLE, input_buf,
+			BLOCK_SAMPLES(24000) * sizeof(int16_t), 24000, intermediate,
+			sizeof(intermediate), &written, 48000);
+		zassert_equal(ret, 0, "First stage failed (%d)", ret);
+
+		ret = sample_rate_converter_process(
+			&chain_ctx[1], SAMPLE_RATE_FILTER_SIMPLE, intermediate, written, 48000,
+			&output_samples[*num_out], sizeof(output_samples) - *num_out * sizeof(int16_t),
+			&written, 16000);
+		elapsed += bench_time_ns() - start;
+
+		zassert_equal(ret, 0, "Second stage failed (%d)", ret);
+		*num_out += written / sizeof(int16_t);
+	}
+
+	return elapsed;
+}
+
+static void bench_report(const char *name, uint64_t elapsed_ns, size_t num_out, float thd)
+{
+	TC_PRINT("%-28s %6u ns/output sample, THD+N %d dB\n", name,
+		 (uint32_t)(elapsed_ns / num_out), (int)thd);
+}
+
+ZTEST(suite_sample_rate_converter_poly_benchmark, test_benchmark_24k_to_16k)
+{
+	size_t num_out;
+	uint64_t poly_ns;
+	uint64_t chain_ns;
+	float poly_thd;
+	float chain_thd;
+
+	sample_rate_converter_poly_open(&poly_ctx);
+	poly_ns = poly_convert(24000, 16000, &num_out);
+	poly_thd = thd_n_db(output_samples, num_out, 16000);
+	bench_report("Polyphase 24k -> 16k:", poly_ns, num_out, poly_thd);
+
+	chain_ns = chain_convert(&num_out);
+	chain_thd = thd_n_db(output_samples, num_out, 16000);
+	bench_report("Chained 24k -> 48k -> 16k:", chain_ns, num_out, chain_thd);
+
+	zassert_true(poly_thd < -70.0f, "THD+N too high: %d dB", (int)poly_thd);
+}
+
+ZTEST(suite_sample_rate_converter_poly_benchmark, test_benchmark_44k1_to_48k)
+{
+	size_t num_out;
+	uint64_t poly_ns;
+
+	sample_rate_converter_poly_open(&poly_ctx);
+	poly_ns = poly_convert(44100, 48000, &num_out);
+	bench_report("Polyphase 44.1k -> 48k:", poly_ns, num_out,
+		     thd_n_db(output_samples, num_out, 48000));
+}
+
+ZTEST_SUITE(suite_sample_rate_converter_poly_benchmark, NULL, NULL, NULL, NULL, NULL);
@@ -0,0 +1,12 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "early_event.h"
+
+APP_EVENT_TYPE_DEFINE(early_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
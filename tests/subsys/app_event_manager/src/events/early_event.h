@@ -0,0 +1,36 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _EARLY_EVENT_H_
+#define _EARLY_EVENT_H_
+
+/**
+ * @brief Early Event
+ * @defgroup early_event Event submitted before the Application Event Manager initialization
+ * @{
+ */
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+struct early_event {
+	struct app_event_header header;
+};
+
+APP_EVENT_TYPE_DECLARE(early_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _EARLY_EVENT_H_ */
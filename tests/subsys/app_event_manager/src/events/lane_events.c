@@ -0,0 +1,21 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include "lane_events.h"
+
+APP_EVENT_TYPE_DEFINE(lane_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
+
+APP_EVENT_TYPE_DEFINE(batch_event,
+		  NULL,
+		  NULL,
+		  APP_EVENT_FLAGS_CREATE());
+
+#if CONFIG_APP_EVENT_MANAGER_LANES > 1
+APP_EVENT_TYPE_LANE_SET(lane_event, CONFIG_APP_EVENT_MANAGER_LANES - 1);
+#endif
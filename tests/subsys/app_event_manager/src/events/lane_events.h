@@ -0,0 +1,49 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _LANE_EVENTS_H_
+#define _LANE_EVENTS_H_
+
+/**
+ * @brief Lane and batch events
+ * @defgroup lane_events Events used to test processing lanes and batch listeners
+ * @{
+ */
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Event processed in the highest priority lane. */
+struct lane_event {
+	struct app_event_header header;
+
+	int val;
+};
+
+APP_EVENT_TYPE_DECLARE(lane_event);
+
+
+/* Event handled by a batch listener. */
+struct batch_event {
+	struct app_event_header header;
+
+	int val;
+};
+
+APP_EVENT_TYPE_DECLARE(batch_event);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _LANE_EVENTS_H_ */
@@ -0,0 +1,40 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef _POOL_EVENT_H_
+#define _POOL_EVENT_H_
+
+/**
+ * @brief Pool Event
+ * @defgroup pool_event Event with a declared pool size
+ * @{
+ */
+
+#include <app_event_manager.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TEST_POOL_EVENT_CNT 2
+
+struct pool_event {
+	struct app_event_header header;
+
+	int val;
+};
+
+APP_EVENT_TYPE_POOL_DECLARE(pool_event, TEST_POOL_EVENT_CNT);
+
+#ifdef __cplusplus
+}
+#endif
+
+/**
+ * @}
+ */
+
+#endif /* _POOL_EVENT_H_ */
@@ -29,6 +29,9 @@ enum test_id {
 	TEST_OOM,
 	TEST_MULTICONTEXT,
 	TEST_NAME_STYLE_SORTING,
+	TEST_LANES,
+	TEST_BATCH,
+	TEST_EARLY,
 
 	TEST_CNT
 };
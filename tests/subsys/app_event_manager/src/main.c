@@ -7,8 +7,11 @@
 #include <zephyr/ztest.h>
 #include <app_event_manager.h>
 
+#include "lane_events.h"
+#include "pool_event.h"
 #include "sized_events.h"
 #include "test_events.h"
+#include "test_event_allocator.h"
 
 static enum test_id cur_test_id;
 static K_SEM_DEFINE(test_end_sem, 0, 1);
@@ -93,22 +96,22 @@ ZTEST(suite0, test_event_size_static)
 	ev_s1 = new_test_size1_event();
 	zassert_equal(sizeof(*ev_s1), app_event_manager_event_size(&ev_s1->header),
 		"Event size1 unexpected size");
-	app_event_manager_free(ev_s1);
+	test_event_free(ev_s1);
 
 	ev_s2 = new_test_size2_event();
 	zassert_equal(sizeof(*ev_s2), app_event_manager_event_size(&ev_s2->header),
 		"Event size2 unexpected size");
-	app_event_manager_free(ev_s2);
+	test_event_free(ev_s2);
 
 	ev_s3 = new_test_size3_event();
 	zassert_equal(sizeof(*ev_s3), app_event_manager_event_size(&ev_s3->header),
 		"Event size3 unexpected size");
-	app_event_manager_free(ev_s3);
+	test_event_free(ev_s3);
 
 	ev_sb = new_test_size_big_event();
 	zassert_equal(sizeof(*ev_sb), app_event_manager_event_size(&ev_sb->header),
 		"Event size_big unexpected size");
-	app_event_manager_free(ev_sb);
+	test_event_free(ev_sb);
 }
 
 ZTEST(suite0, test_event_size_dynamic)
@@ -123,17 +126,17 @@ ZTEST(suite0, test_event_size_dynamic)
 	ev = new_test_dynamic_event(0);
 	zassert_equal(sizeof(*ev) + 0, app_event_manager_event_size(&ev->header),
 		"Event dynamic with 0 elements unexpected size");
-	app_event_manager_free(ev);
+	test_event_free(ev);
 
 	ev = new_test_dynamic_event(10);
 	zassert_equal(sizeof(*ev) + 10, app_event_manager_event_size(&ev->header),
 		"Event dynamic with 10 elements unexpected size");
-	app_event_manager_free(ev);
+	test_event_free(ev);
 
 	ev = new_test_dynamic_event(100);
 	zassert_equal(sizeof(*ev) + 100, app_event_manager_event_size(&ev->header),
 		"Event dynamic with 100 elements unexpected size");
-	app_event_manager_free(ev);
+	test_event_free(ev);
 }
 
 ZTEST(suite0, test_event_size_dynamic_with_data)
@@ -148,17 +151,17 @@ ZTEST(suite0, test_event_size_dynamic_with_data)
 	ev = new_test_dynamic_with_data_event(0);
 	zassert_equal(sizeof(*ev) + 0, app_event_manager_event_size(&ev->header),
 		"Event dynamic with 0 elements unexpected size");
-	app_event_manager_free(ev);
+	test_event_free(ev);
 
 	ev = new_test_dynamic_with_data_event(10);
 	zassert_equal(sizeof(*ev) + 10, app_event_manager_event_size(&ev->header),
 		"Event dynamic with 10 elements unexpected size");
-	app_event_manager_free(ev);
+	test_event_free(ev);
 
 	ev = new_test_dynamic_with_data_event(100);
 	zassert_equal(sizeof(*ev) + 100, app_event_manager_event_size(&ev->header),
 		"Event dynamic with 100 elements unexpected size");
-	app_event_manager_free(ev);
+	test_event_free(ev);
 }
 
 ZTEST(suite0, test_event_size_disabled)
@@ -176,7 +179,7 @@ ZTEST(suite0, test_event_size_disabled)
 		"Event size1 unexpected size");
 	zassert_false(expect_assert,
 		"Assertion during app_event_manager_event_size function execution was expected");
-	app_event_manager_free(ev_s1);
+	test_event_free(ev_s1);
 }
 
 ZTEST(suite0, test_name_style_events_sorting)
@@ -184,6 +187,99 @@ ZTEST(suite0, test_name_style_events_sorting)
 	test_start(TEST_NAME_STYLE_SORTING);
 }
 
+ZTEST(suite0, test_lanes)
+{
+	if (CONFIG_APP_EVENT_MANAGER_LANES == 1 ||
+	    !IS_ENABLED(CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS)) {
+		ztest_test_skip();
+		return;
+	}
+
+	test_start(TEST_LANES);
+}
+
+ZTEST(suite0, test_batch)
+{
+	if (!IS_ENABLED(CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS)) {
+		ztest_test_skip();
+		return;
+	}
+
+	test_start(TEST_BATCH);
+}
+
+ZTEST(suite0, test_early_event)
+{
+	test_start(TEST_EARLY);
+}
+
+ZTEST(suite0, test_stats)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_STATS)
+	struct app_event_manager_stats stats;
+
+	app_event_manager_stats_reset();
+	test_start(TEST_BASIC);
+
+	app_event_manager_stats_get(APP_EVENT_ID(test_start_event), &stats);
+	zassert_equal(stats.lane, 0, "Unexpected lane");
+	zassert_equal(stats.dispatched, 1, "Unexpected number of dispatched events");
+	zassert_equal(stats.queued, 0, "Unexpected number of queued events");
+	zassert_equal(stats.queued_max, 1, "Unexpected maximum number of queued events");
+
+	app_event_manager_stats_get(APP_EVENT_ID(lane_event), &stats);
+	zassert_equal(stats.lane, CONFIG_APP_EVENT_MANAGER_LANES - 1, "Unexpected lane");
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST(suite0, test_event_pools)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+	struct pool_event *events[TEST_POOL_EVENT_CNT + 1];
+	struct app_event_manager_pool_stats stats;
+	uint32_t heap_fallbacks;
+	int err;
+
+	err = app_event_manager_pool_stats_get(APP_EVENT_ID(pool_event), &stats);
+	zassert_ok(err, "Pool statistics not available");
+	zassert_equal(stats.total, TEST_POOL_EVENT_CNT, "Unexpected pool size");
+	zassert_equal(stats.used, 0, "Pool not empty");
+	heap_fallbacks = stats.heap_fallbacks;
+
+	/* The last event does not fit in the pool and is allocated from the heap. */
+	for (size_t i = 0; i < ARRAY_SIZE(events); i++) {
+		events[i] = new_pool_event();
+		zassert_not_null(events[i], "Event allocation failed");
+	}
+
+	err = app_event_manager_pool_stats_get(APP_EVENT_ID(pool_event), &stats);
+	zassert_ok(err, "Pool statistics not available");
+	zassert_equal(stats.used, TEST_POOL_EVENT_CNT, "Unexpected number of used blocks");
+	zassert_equal(stats.used_max, TEST_POOL_EVENT_CNT, "Unexpected maximum of used blocks");
+	zassert_equal(stats.heap_fallbacks, heap_fallbacks + 1, "Unexpected heap fallbacks");
+
+	for (size_t i = 0; i < ARRAY_SIZE(events); i++) {
+		test_event_free(events[i]);
+	}
+
+	err = app_event_manager_pool_stats_get(APP_EVENT_ID(pool_event), &stats);
+	zassert_ok(err, "Pool statistics not available");
+	zassert_equal(stats.used, 0, "Events not returned to the pool");
+
+	err = app_event_manager_pool_stats_get(APP_EVENT_ID(test_size1_event), &stats);
+	zassert_ok(err, "Pool statistics not available");
+	zassert_equal(stats.total, CONFIG_APP_EVENT_MANAGER_EVENT_POOL_SIZE,
+		      "Unexpected default pool size");
+
+	err = app_event_manager_pool_stats_get(APP_EVENT_ID(test_dynamic_event), &stats);
+	zassert_equal(err, -ENOENT, "Event with dynamic data has a pool");
+#else
+	ztest_test_skip();
+#endif
+}
+
 ZTEST_SUITE(suite0, NULL, test_init, NULL, NULL, NULL);
 
 static bool app_event_handler(const struct app_event_header *aeh)
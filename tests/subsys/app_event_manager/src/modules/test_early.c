@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/init.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "early_event.h"
+
+#define MODULE test_early
+#define MODULE_BATCH test_early_batch
+
+static atomic_t early_event_cnt;
+static atomic_t early_event_batch_cnt;
+
+/* Submitted before app_event_manager_init is called by the test suite setup. */
+static int early_event_submit(void)
+{
+	struct early_event *event = new_early_event();
+
+	APP_EVENT_SUBMIT(event);
+
+	return 0;
+}
+
+SYS_INIT(early_event_submit, APPLICATION, CONFIG_APPLICATION_INIT_PRIORITY);
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		if (st->test_id == TEST_EARLY) {
+			struct test_end_event *et = new_test_end_event();
+
+			zassert_equal(atomic_get(&early_event_cnt), 1,
+				      "Event submitted before initialization not processed");
+			if (IS_ENABLED(CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS)) {
+				zassert_equal(atomic_get(&early_event_batch_cnt), 1,
+					      "Batch listener not notified before initialization");
+			}
+
+			et->test_id = st->test_id;
+			APP_EVENT_SUBMIT(et);
+		}
+
+		return false;
+	}
+
+	if (is_early_event(aeh)) {
+		atomic_inc(&early_event_cnt);
+		return false;
+	}
+
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, early_event);
+
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_BATCH_LISTENERS)
+static bool app_event_batch_handler(sys_slist_t *events, size_t count)
+{
+	/* Events are passed one by one before the initialization. */
+	zassert_equal(count, 1, "Unexpected number of events");
+	atomic_inc(&early_event_batch_cnt);
+
+	return false;
+}
+
+APP_EVENT_LISTENER_BATCH(MODULE_BATCH, app_event_batch_handler);
+APP_EVENT_SUBSCRIBE(MODULE_BATCH, early_event);
+#endif
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+
+#include "test_events.h"
+#include "lane_events.h"
+
+#define MODULE test_lanes
+#define MODULE_BATCH test_lanes_batch
+
+#define TEST_BATCH_EVENT_CNT 3
+#define TEST_BATCH_CONSUMED_VAL 1
+
+static enum test_id cur_test_id;
+static bool lane_event_received;
+
+static void end_test(void)
+{
+	struct test_end_event *event = new_test_end_event();
+
+	event->test_id = cur_test_id;
+	APP_EVENT_SUBMIT(event);
+}
+
+static void submit_batch_event(int val)
+{
+	struct batch_event *event = new_batch_event();
+
+	event->val = val;
+	APP_EVENT_SUBMIT(event);
+}
+
+static bool app_event_handler(const struct app_event_header *aeh)
+{
+	if (is_test_start_event(aeh)) {
+		struct test_start_event *st = cast_test_start_event(aeh);
+
+		cur_test_id = st->test_id;
+
+		if (cur_test_id == TEST_LANES) {
+			struct lane_event *event = new_lane_event();
+
+			lane_event_received = false;
+
+			/* Submitted first to the lower priority lane. */
+			submit_batch_event(0);
+			APP_EVENT_SUBMIT(event);
+		} else if (cur_test_id == TEST_BATCH) {
+			for (size_t i = 0; i < TEST_BATCH_EVENT_CNT; i++) {
+				submit_batch_event(i);
+			}
+		}
+
+		return false;
+	}
+
+	if (is_lane_event(aeh)) {
+		zassert_equal(cur_test_id, TEST_LANES, "Unexpected lane event");
+		zassert_not_equal(k_current_get(), k_work_queue_thread_get(&k_sys_work_q),
+				  "Lane event processed in the system workqueue");
+		lane_event_received = true;
+
+		return false;
+	}
+
+	if (is_batch_event(aeh)) {
+		const struct batch_event *event = cast_batch_event(aeh);
+
+		return (cur_test_id == TEST_BATCH) && (event->val == TEST_BATCH_CONSUMED_VAL);
+	}
+
+	zassert_true(false, "Event unhandled");
+	return false;
+}
+
+APP_EVENT_LISTENER(MODULE, app_event_handler);
+APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
+APP_EVENT_SUBSCRIBE(MODULE, lane_event);
+APP_EVENT_SUBSCRIBE_EARLY(MODULE, batch_event);
+
+static bool app_event_batch_handler(sys_slist_t *events, size_t count)
+{
+	struct app_event_header *aeh;
+	int expected_val = 0;
+	size_t cnt = 0;
+
+	if (cur_test_id == TEST_LANES) {
+		zassert_equal(count, 1, "Unexpected number of events");
+		zassert_true(lane_event_received,
+			     "Event from the higher priority lane was not processed first");
+		end_test();
+
+		return false;
+	}
+
+	zassert_equal(cur_test_id, TEST_BATCH, "Unexpected batch event");
+	zassert_equal(count, TEST_BATCH_EVENT_CNT - 1, "Unexpected number of events");
+
+	APP_EVENT_BATCH_FOREACH(events, aeh) {
+		const struct batch_event *event = cast_batch_event(aeh);
+
+		zassert_not_null(event, "Unexpected event type in batch");
+		if (expected_val == TEST_BATCH_CONSUMED_VAL) {
+			expected_val++;
+		}
+		zassert_equal(event->val, expected_val, "Incorrect event order in batch");
+		expected_val++;
+		cnt++;
+	}
+
+	zassert_equal(cnt, count, "Invalid number of events in the list");
+	end_test();
+
+	return false;
+}
+
+APP_EVENT_LISTENER_BATCH(MODULE_BATCH, app_event_batch_handler);
+APP_EVENT_SUBSCRIBE(MODULE_BATCH, batch_event);
@@ -35,7 +35,7 @@ static void oom_test_run(void)
 
 	/* Freeing memory to enable further testing. */
 	for (i = 0; (i < ARRAY_SIZE(event_tab)) && event_tab[i]; i++) {
-		app_event_manager_free(event_tab[i]);
+		test_event_free(event_tab[i]);
 		event_tab[i] = NULL;
 	}
 }
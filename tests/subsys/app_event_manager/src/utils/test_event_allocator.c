@@ -32,3 +32,14 @@ void app_event_manager_free(void *addr)
 {
 	k_free(addr);
 }
+
+void test_event_free(void *event)
+{
+#if IS_ENABLED(CONFIG_APP_EVENT_MANAGER_EVENT_POOLS)
+	if (app_event_manager_pool_free(event)) {
+		return;
+	}
+#endif
+
+	app_event_manager_free(event);
+}
@@ -27,6 +27,14 @@ extern "C" {
  */
 void test_event_allocator_oom_expect(bool expected);
 
+/** Free an event that has not been submitted.
+ *
+ * The event is returned to its pool if it was allocated from one.
+ *
+ * @param[in] event	Pointer to the event.
+ */
+void test_event_free(void *event);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,286 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+#include <errno.h>
+#include <stdio.h>
+
+#include "audio_module/audio_module.h"
+
+#define TEST_OUTPUTS_NUM	    (CONFIG_AUDIO_MODULE_DESTINATIONS_MAX)
+#define TEST_MSG_QUEUE_SIZE	    (4)
+#define TEST_MSG_SIZE		    (sizeof(struct audio_module_message))
+#define TEST_MOD_THREAD_STACK_SIZE  (2048)
+#define TEST_INPUT_THREAD_PRIORITY  (6)
+#define TEST_OUTPUT_THREAD_PRIORITY (4)
+#define TEST_MOD_DATA_SIZE	    (960)
+#define TEST_SLAB_BLOCKS_NUM	    (CONFIG_AUDIO_MODULE_BUFFERS_NUM)
+#define TEST_AUDIO_DATA_ITEMS_NUM   (1000)
+#define TEST_ROUND_TIMEOUT	    (K_SECONDS(10))
+
+struct mod_config {
+	int unused;
+};
+
+struct mod_context {
+	struct mod_config config;
+};
+
+K_THREAD_STACK_DEFINE(input_stack, TEST_MOD_THREAD_STACK_SIZE);
+K_THREAD_STACK_ARRAY_DEFINE(output_stack, TEST_OUTPUTS_NUM, TEST_MOD_THREAD_STACK_SIZE);
+K_MEM_SLAB_DEFINE(input_data_slab, TEST_MOD_DATA_SIZE, TEST_SLAB_BLOCKS_NUM, 4);
+
+DATA_FIFO_DEFINE(msg_fifo_rx0, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx1, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx2, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx3, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx4, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx5, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx6, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+DATA_FIFO_DEFINE(msg_fifo_rx7, TEST_MSG_QUEUE_SIZE, TEST_MSG_SIZE);
+
+BUILD_ASSERT(TEST_OUTPUTS_NUM <= 8, "Add RX FIFOs for the number of outputs");
+
+static struct data_fifo *msg_fifo_rx_array[] = {&msg_fifo_rx0, &msg_fifo_rx1, &msg_fifo_rx2,
+						&msg_fifo_rx3, &msg_fifo_rx4, &msg_fifo_rx5,
+						&msg_fifo_rx6, &msg_fifo_rx7};
+
+static K_SEM_DEFINE(produce_sem, 0, TEST_AUDIO_DATA_ITEMS_NUM);
+static K_SEM_DEFINE(round_done_sem, 0, 1);
+
+/* Data buffer sent for each audio data item, to check that the outputs share it. */
+static void *item_data[TEST_AUDIO_DATA_ITEMS_NUM];
+static uint32_t sequence;
+static atomic_t delivered;
+static atomic_t delivered_expected;
+static atomic_t output_delivered[TEST_OUTPUTS_NUM];
+static atomic_t shared_failures;
+static uint32_t checksum;
+
+static int test_config_set(struct audio_module_handle_private *handle,
+			   struct audio_module_configuration const *const configuration)
+{
+	return 0;
+}
+
+static int test_config_get(struct audio_module_handle_private const *const handle,
+			   struct audio_module_configuration *configuration)
+{
+	return 0;
+}
+
+static int test_input_data_process(struct audio_module_handle_private *handle,
+				   struct audio_data const *const audio_data_rx,
+				   struct audio_data *audio_data_tx)
+{
+	uint32_t *samples = (uint32_t *)audio_data_tx->data;
+
+	k_sem_take(&produce_sem, K_FOREVER);
+
+	for (int i = 0; i < TEST_MOD_DATA_SIZE / sizeof(uint32_t); i++) {
+		samples[i] = sequence;
+	}
+
+	item_data[sequence % TEST_AUDIO_DATA_ITEMS_NUM] = audio_data_tx->data;
+	audio_data_tx->data_size = TEST_MOD_DATA_SIZE;
+	sequence++;
+
+	return 0;
+}
+
+static int test_output_data_process(struct audio_module_handle_private *handle,
+				    struct audio_data const *const audio_data_rx,
+				    struct audio_data *audio_data_tx)
+{
+	struct audio_module_handle *hdl = (struct audio_module_handle *)handle;
+	uint32_t const *samples = (uint32_t const *)audio_data_rx->data;
+	uint32_t seq = samples[0];
+
+	/* The audio data must be the producer's buffer, and not freed before all the outputs
+	 * have consumed it.
+	 */
+	if (audio_data_rx->data != item_data[seq % TEST_AUDIO_DATA_ITEMS_NUM] ||
+	    samples[TEST_MOD_DATA_SIZE / sizeof(uint32_t) - 1] != seq) {
+		atomic_inc(&shared_failures);
+	}
+
+	for (int i = 0; i < audio_data_rx->data_size / sizeof(uint32_t); i++) {
+		checksum += samples[i];
+	}
+
+	atomic_inc(&output_delivered[hdl - output_handles]);
+
+	if (atomic_inc(&delivered) + 1 == atomic_get(&delivered_expected)) {
+		k_sem_give(&round_done_sem);
+	}
+
+	return 0;
+}
+
+static const struct audio_module_functions input_functions = {
+	.configuration_set = test_config_set,
+	.configuration_get = test_config_get,
+	.data_process = test_input_data_process,
+};
+
+static const struct audio_module_functions output_functions = {
+	.configuration_set = test_config_set,
+	.configuration_get = test_config_get,
+	.data_process = test_output_data_process,
+};
+
+static struct audio_module_description input_description = {
+	.name = "Fan-out input",
+	.type = AUDIO_MODULE_TYPE_INPUT,
+	.functions = &input_functions,
+};
+
+static struct audio_module_description output_description = {
+	.name = "Fan-out output",
+	.type = AUDIO_MODULE_TYPE_OUTPUT,
+	.functions = &output_functions,
+};
+
+static struct audio_module_handle input_handle;
+static struct audio_module_handle output_handles[TEST_OUTPUTS_NUM];
+static struct mod_context input_context;
+static struct mod_context output_contexts[TEST_OUTPUTS_NUM];
+static struct mod_config config;
+
+static void test_modules_open(void)
+{
+	int ret;
+	char name[CONFIG_AUDIO_MODULE_NAME_SIZE + 1] = "Input";
+	struct audio_module_parameters parameters = {0};
+
+	AUDIO_MODULE_PARAMETERS(parameters, &input_description, input_stack,
+				K_THREAD_STACK_SIZEOF(input_stack), TEST_INPUT_THREAD_PRIORITY,
+				NULL, NULL, &input_data_slab, TEST_MOD_DATA_SIZE);
+
+	ret = audio_module_open(&parameters, (struct audio_module_configuration const *)&config,
+				name, (struct audio_module_context *)&input_context,
+				&input_handle);
+	zassert_equal(ret, 0, "Open function did not return successfully (0): ret %d", ret);
+
+	for (int i = 0; i < TEST_OUTPUTS_NUM; i++) {
+		AUDIO_MODULE_PARAMETERS(parameters, &output_description, output_stack[i],
+					K_THREAD_STACK_SIZEOF(output_stack[i]),
+					TEST_OUTPUT_THREAD_PRIORITY, msg_fifo_rx_array[i], NULL,
+					NULL, 0);
+
+		snprintf(name, sizeof(name), "Output %d", i);
+
+		ret = audio_module_open(&parameters,
+					(struct audio_module_configuration const *)&config, name,
+					(struct audio_module_context *)&output_contexts[i],
+					&output_handles[i]);
+		zassert_equal(ret, 0, "Open function did not return successfully (0): ret %d",
+			      ret);
+
+		ret = audio_module_start(&output_handles[i]);
+		zassert_equal(ret, 0, "Start function did not return successfully (0): ret %d",
+			      ret);
+	}
+
+	ret = audio_module_start(&input_handle);
+	zassert_equal(ret, 0, "Start function did not return successfully (0): ret %d", ret);
+}
+
+/**
+ * @brief Send audio data items from the input module to a number of output modules, check
+ *        that each output got all of them, and report the throughput.
+ *
+ * @param outputs_num  [in]  Number of output modules to connect.
+ */
+static void test_fanout_round(int outputs_num)
+{
+	int ret;
+	uint64_t start;
+	uint64_t elapsed_us;
+	struct audio_module_stats stats;
+
+	for (int i = 0; i < outputs_num; i++) {
+		ret = audio_module_connect(&input_handle, &output_handles[i], false);
+		zassert_equal(ret, 0, "Connect function did not return successfully (0): ret %d",
+			      ret);
+	}
+
+	atomic_set(&delivered, 0);
+	atomic_set(&delivered_expected, TEST_AUDIO_DATA_ITEMS_NUM * outputs_num);
+
+	for (int i = 0; i < TEST_OUTPUTS_NUM; i++) {
+		atomic_set(&output_delivered[i], 0);
+	}
+
+	start = k_cycle_get_64();
+
+	for (int i = 0; i < TEST_AUDIO_DATA_ITEMS_NUM; i++) {
+		k_sem_give(&produce_sem);
+	}
+
+	ret = k_sem_take(&round_done_sem, TEST_ROUND_TIMEOUT);
+	zassert_equal(ret, 0, "Timed out with %ld of %ld audio data items delivered",
+		      atomic_get(&delivered), atomic_get(&delivered_expected));
+
+	elapsed_us = k_cyc_to_us_ceil64(k_cycle_get_64() - start);
+
+	TC_PRINT("1 -> %d: %d items, %ld deliveries in %llu us (%llu deliveries/s)\n",
+		 outputs_num, TEST_AUDIO_DATA_ITEMS_NUM, atomic_get(&delivered), elapsed_us,
+		 elapsed_us ? (uint64_t)atomic_get(&delivered) * USEC_PER_SEC / elapsed_us : 0);
+
+	/* Let the outputs release the last audio data item. */
+	k_sleep(K_MSEC(10));
+
+	zassert_equal(atomic_get(&delivered), TEST_AUDIO_DATA_ITEMS_NUM * outputs_num,
+		      "%ld audio data items delivered, expected %d", atomic_get(&delivered),
+		      TEST_AUDIO_DATA_ITEMS_NUM * outputs_num);
+
+	for (int i = 0; i < TEST_OUTPUTS_NUM; i++) {
+		int expected = (i < outputs_num) ? TEST_AUDIO_DATA_ITEMS_NUM : 0;
+
+		zassert_equal(atomic_get(&output_delivered[i]), expected,
+			      "Output %d got %ld audio data items, expected %d", i,
+			      atomic_get(&output_delivered[i]), expected);
+	}
+
+	for (int i = 0; i < outputs_num; i++) {
+		ret = audio_module_stats_get(&output_handles[i], &stats);
+		zassert_equal(ret, 0, "Stats get function did not return successfully (0): ret %d",
+			      ret);
+		zassert_equal(stats.dropped, 0, "Output %d dropped %u audio data items", i,
+			      stats.dropped);
+		zassert_equal(stats.queue_depth, 0, "Output %d has %u audio data items queued", i,
+			      stats.queue_depth);
+
+		TC_PRINT("  output %d: queued %u, depth max %u, latency avg %u us, max %u us\n", i,
+			 stats.queued, stats.queue_depth_max, stats.latency_avg_us,
+			 stats.latency_max_us);
+	}
+
+	for (int i = 0; i < outputs_num; i++) {
+		ret = audio_module_disconnect(&input_handle, &output_handles[i], false);
+		zassert_equal(ret, 0,
+			      "Disconnect function did not return successfully (0): ret %d", ret);
+	}
+}
+
+ZTEST(suite_audio_module_fanout, test_fanout_scaling)
+{
+	test_modules_open();
+
+	for (int outputs_num = 1; outputs_num <= TEST_OUTPUTS_NUM; outputs_num *= 2) {
+		test_fanout_round(outputs_num);
+	}
+
+	zassert_equal(atomic_get(&shared_failures), 0,
+		      "%ld audio data items were not shared by the outputs",
+		      atomic_get(&shared_failures));
+
+	/* Only the block taken by the input module for the next audio data item is in use. */
+	zassert_equal(k_mem_slab_num_used_get(&input_data_slab), 1,
+		      "Audio data buffers leaked, %d in use",
+		      k_mem_slab_num_used_get(&input_data_slab));
+}
@@ -0,0 +1,9 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+
+ZTEST_SUITE(suite_audio_module_fanout, NULL, NULL, NULL, NULL, NULL);
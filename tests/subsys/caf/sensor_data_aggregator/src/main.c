@@ -9,6 +9,7 @@
 
 #include "test_events.h"
 #include <caf/events/sensor_event.h>
+#include <caf/sensor_data_aggregator.h>
 #include "test_config.h"
 #include <zephyr/drivers/sensor.h>
 
@@ -101,6 +102,42 @@ ZTEST(caf_sensor_aggregator_tests, test_status)
 	test_start(TEST_STATUS);
 }
 
+ZTEST(caf_sensor_aggregator_tests, test_direct)
+{
+	int handle = sensor_data_aggregator_handle_get(DIRECT_TEST_AGG_DESCR);
+	struct sensor_value *sample;
+
+	zassert_true(handle >= 0, "No aggregator found");
+	zassert_equal(sensor_data_aggregator_handle_get("void_unknown_sensor"), -ENOENT,
+		      "Aggregator found for unknown sensor");
+
+	cur_test_id = TEST_DIRECT;
+	struct test_start_event *ts = new_test_start_event();
+
+	zassert_not_null(ts, "Failed to allocate event");
+	ts->test_id = cur_test_id;
+	APP_EVENT_SUBMIT(ts);
+
+	/* Aborted sample must not be reported. */
+	sample = sensor_data_aggregator_sample_get(handle);
+	zassert_not_null(sample, "No free buffer");
+	sample->val1 = -1;
+	sensor_data_aggregator_sample_abort(handle);
+
+	for (size_t i = 0; i < SAMPLES_IN_AGG_BUF; i++) {
+		sample = sensor_data_aggregator_sample_get(handle);
+
+		zassert_not_null(sample, "No free buffer");
+		sample->val1 = i;
+		sample->val2 = 0;
+		sensor_data_aggregator_sample_commit(handle, DIRECT_TEST_TIMESTAMP(i));
+	}
+
+	int err = k_sem_take(&test_end_sem, K_SECONDS(30));
+
+	zassert_ok(err, "Test execution hanged");
+}
+
 static bool app_event_handler(const struct app_event_header *aeh)
 {
 	if (is_test_end_event(aeh)) {
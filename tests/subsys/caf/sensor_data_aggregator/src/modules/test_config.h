@@ -13,6 +13,9 @@
 #define BASIC_TEST_AGG_EVENTS 80
 #define ORDER_TEST_AGG_EVENTS 2
 #define STATUS_TEST_SENSOR_EVENTS 4
+#define DIRECT_TEST_SENSOR_SAMPLE_SIZE 1
+#define DIRECT_TEST_TIMESTAMP(i) (1000 + (i) * 10)
 #define BASIC_TEST_AGG_DESCR "void_basic_test_sensor"
 #define ORDER_TEST_AGG_DESCR "void_order_test_sensor"
 #define STATUS_TEST_AGG_DESCR "void_status_test_sensor"
+#define DIRECT_TEST_AGG_DESCR "void_direct_test_sensor"
@@ -19,6 +19,58 @@
 static enum test_id cur_test_id;
 int msg_num;
 int order_event_indicator = SAMPLES_IN_AGG_BUF * ORDER_TEST_AGG_EVENTS;
+static struct sensor_value *direct_held_buf;
+
+static void release_buffer(struct sensor_value *samples, const char *sensor_descr)
+{
+	struct sensor_data_aggregator_release_buffer_event *release_evt =
+		new_sensor_data_aggregator_release_buffer_event();
+
+	release_evt->samples = samples;
+	release_evt->sensor_descr = sensor_descr;
+	APP_EVENT_SUBMIT(release_evt);
+}
+
+static void handle_direct_data(const struct sensor_data_aggregator_event *event)
+{
+	zassert_equal(event->sample_cnt, SAMPLES_IN_AGG_BUF, "Wrong number of samples");
+	zassert_equal(event->values_in_sample, DIRECT_TEST_SENSOR_SAMPLE_SIZE,
+		      "Wrong sample size");
+	zassert_not_null(event->timestamps, "No per-sample timestamps");
+	zassert_equal(event->first_timestamp, DIRECT_TEST_TIMESTAMP(0),
+		      "Wrong first timestamp");
+	zassert_equal(event->last_timestamp, DIRECT_TEST_TIMESTAMP(SAMPLES_IN_AGG_BUF - 1),
+		      "Wrong last timestamp");
+
+	for (int i = 0; i < SAMPLES_IN_AGG_BUF; i++) {
+		zassert_equal(event->samples[i].val1, i, "Incorrect sample data");
+		zassert_equal(event->timestamps[i], DIRECT_TEST_TIMESTAMP(i),
+			      "Incorrect sample timestamp");
+	}
+
+	/* Hold the buffer to trigger the buffer pressure event. */
+	zassert_is_null(direct_held_buf, "Unexpected buffer");
+	direct_held_buf = event->samples;
+}
+
+static void handle_direct_pressure(const struct sensor_data_aggregator_pressure_event *event)
+{
+	if (event->high) {
+		zassert_equal(event->free_buf_cnt, 1, "Wrong number of free buffers");
+		zassert_not_null(direct_held_buf, "Pressure reported before buffer was sent");
+		release_buffer(direct_held_buf, event->sensor_descr);
+		direct_held_buf = NULL;
+	} else {
+		zassert_equal(event->free_buf_cnt, 2, "Wrong number of free buffers");
+		zassert_is_null(direct_held_buf, "Pressure released while buffer is held");
+
+		struct test_end_event *te = new_test_end_event();
+
+		zassert_not_null(te, "Failed to allocate event");
+		te->test_id = cur_test_id;
+		APP_EVENT_SUBMIT(te);
+	}
+}
 
 static bool app_event_handler(const struct app_event_header *aeh)
 {
@@ -34,12 +86,12 @@ static bool app_event_handler(const struct app_event_header *aeh)
 		const struct sensor_data_aggregator_event *event =
 			cast_sensor_data_aggregator_event(aeh);
 
-		struct sensor_data_aggregator_release_buffer_event *release_evt =
-		new_sensor_data_aggregator_release_buffer_event();
+		if (strcmp(event->sensor_descr, DIRECT_TEST_AGG_DESCR) == 0) {
+			handle_direct_data(event);
+			return false;
+		}
 
-		release_evt->samples = event->samples;
-		release_evt->sensor_descr = event->sensor_descr;
-		APP_EVENT_SUBMIT(release_evt);
+		release_buffer(event->samples, event->sensor_descr);
 
 		if (strcmp(event->sensor_descr, BASIC_TEST_AGG_DESCR) == 0) {
 
@@ -90,6 +142,16 @@ static bool app_event_handler(const struct app_event_header *aeh)
 		return false;
 	}
 
+	if (is_sensor_data_aggregator_pressure_event(aeh)) {
+		const struct sensor_data_aggregator_pressure_event *event =
+			cast_sensor_data_aggregator_pressure_event(aeh);
+
+		if (strcmp(event->sensor_descr, DIRECT_TEST_AGG_DESCR) == 0) {
+			handle_direct_pressure(event);
+		}
+
+		return false;
+	}
 
 	zassert_unreachable("Event unhandled");
 
@@ -99,3 +161,4 @@ static bool app_event_handler(const struct app_event_header *aeh)
 APP_EVENT_LISTENER(MODULE, app_event_handler);
 APP_EVENT_SUBSCRIBE(MODULE, test_start_event);
 APP_EVENT_SUBSCRIBE(MODULE, sensor_data_aggregator_event);
+APP_EVENT_SUBSCRIBE(MODULE, sensor_data_aggregator_pressure_event);
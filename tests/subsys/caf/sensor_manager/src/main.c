@@ -21,6 +21,8 @@ LOG_MODULE_REGISTER(MODULE);
 #define PRE_CHANGE_SAMPLING_PERIOD 20
 #define SAMPLING_PERIOD 40
 #define SAMPLING_PERIOD_LONG 33000
+#define BATCH_SIZE 4
+#define ACCEL_DATA_CNT 3
 
 static enum test_id cur_test_id;
 static K_SEM_DEFINE(test_end_sem, 0, 1);
@@ -56,6 +58,7 @@ static void test_before(void *f)
 	struct set_sensor_period_event *event_sensor1 = new_set_sensor_period_event();
 	struct set_sensor_period_event *event_sensor2 = new_set_sensor_period_event();
 	struct set_sensor_period_event *event_sensor3 = new_set_sensor_period_event();
+	struct set_sensor_period_event *event_sensor4 = new_set_sensor_period_event();
 	struct test_initialization_done_event *event_init_done =
 						new_test_initialization_done_event();
 
@@ -71,6 +74,10 @@ static void test_before(void *f)
 	event_sensor3->descr = "Simulated sensor 3";
 	APP_EVENT_SUBMIT(event_sensor3);
 
+	event_sensor4->sampling_period = SAMPLING_PERIOD_LONG;
+	event_sensor4->descr = "Simulated sensor 4";
+	APP_EVENT_SUBMIT(event_sensor4);
+
 	APP_EVENT_SUBMIT(event_init_done);
 
 	int err = k_sem_take(&test_init_sem, K_SECONDS(30));
@@ -122,6 +129,17 @@ ZTEST(caf_sensor_manager_tests, test_multiple_sensors)
 	test_start(TEST_MULTIPLE_SENSORS);
 }
 
+ZTEST(caf_sensor_manager_tests, test_batch)
+{
+	struct set_sensor_period_event *event = new_set_sensor_period_event();
+
+	event->sampling_period = PRE_CHANGE_SAMPLING_PERIOD;
+	event->descr = "Simulated sensor 4";
+	APP_EVENT_SUBMIT(event);
+
+	test_start(TEST_BATCH);
+}
+
 static bool app_event_handler(const struct app_event_header *aeh)
 {
 	if (is_test_end_event(aeh)) {
@@ -184,6 +202,30 @@ static bool app_event_handler(const struct app_event_header *aeh)
 			k_sem_give(&test_end_sem);
 			break;
 
+		case TEST_BATCH:
+			if (strcmp(ev->descr, "Simulated sensor 4")) {
+				break;
+			}
+
+			zassert_equal(sensor_event_get_data_cnt(ev), BATCH_SIZE * ACCEL_DATA_CNT,
+				      "Wrong number of samples in batch");
+
+			if (first_event_uptime == 0) {
+				first_event_uptime = k_uptime_get();
+				break;
+			}
+
+			int64_t batch_period = k_uptime_get() - first_event_uptime;
+
+			zassert_between_inclusive(batch_period,
+						  BATCH_SIZE * PRE_CHANGE_SAMPLING_PERIOD - 1,
+						  BATCH_SIZE * PRE_CHANGE_SAMPLING_PERIOD + 1,
+						  "Wrong batch period");
+			first_event_uptime = 0;
+			cur_test_id = TEST_IDLE;
+			k_sem_give(&test_end_sem);
+			break;
+
 		case TEST_MULTIPLE_SENSORS:
 			if (!strcmp(ev->descr, "Simulated sensor 1") &&
 					((BIT(0) & sensors_tested_mask) == 0)) {
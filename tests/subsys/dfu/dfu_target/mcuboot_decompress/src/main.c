@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/ztest.h>
+#include <zephyr/sys/byteorder.h>
+#include <dfu/dfu_target_mcuboot.h>
+#include <dfu/dfu_target_stream.h>
+#include <nrf_compress/implementation.h>
+#include <dfu_target_mcuboot_decompress.h>
+
+/* Larger than the LZMA dictionary, so that the decoder outputs data several times. */
+#define TEST_IMAGE_SIZE (160 * 1024)
+#define TEST_SLOT_SIZE (TEST_IMAGE_SIZE + 4096)
+#define TEST_FLASH_PAGE_SIZE 4096
+#define TEST_STREAM_FAILURE_NONE SIZE_MAX
+
+static uint8_t image[TEST_IMAGE_SIZE];
+static uint8_t filtered[TEST_IMAGE_SIZE];
+static uint8_t file[TEST_IMAGE_SIZE + 1024];
+static size_t file_size;
+
+/* Stubbed stream, the first bytes_flushed bytes are stored in flash. */
+static uint8_t slot[TEST_SLOT_SIZE];
+static size_t bytes_written;
+static size_t bytes_flushed;
+static size_t stream_failure_at;
+
+int dfu_target_stream_write(const uint8_t *buf, size_t len)
+{
+	if (bytes_written + len > stream_failure_at) {
+		return -EIO;
+	}
+
+	zassert_true(bytes_written + len <= sizeof(slot), "Slot overflow");
+	memcpy(&slot[bytes_written], buf, len);
+	bytes_written += len;
+	bytes_flushed = ROUND_DOWN(bytes_written, TEST_FLASH_PAGE_SIZE);
+
+	return 0;
+}
+
+int dfu_target_stream_offset_get(size_t *offset)
+{
+	*offset = bytes_flushed;
+
+	return 0;
+}
+
+static size_t stream_compress(uint16_t type, const uint8_t *input, size_t input_size,
+			      uint8_t *output, size_t output_max)
+{
+	struct nrf_compress_implementation *implementation;
+	size_t pos = 0;
+	size_t total = 0;
+	int rc;
+
+	implementation = nrf_compress_implementation_find(type);
+	zassert_not_null(implementation, "Expected implementation to not be NULL");
+
+	rc = implementation->init(NULL, 0);
+	zassert_ok(rc, "Expected init to be successful");
+
+	while (true) {
+		size_t chunk_size = MIN(CONFIG_NRF_COMPRESS_CHUNK_SIZE, input_size - pos);
+		bool last = (pos + chunk_size) == input_size;
+		uint32_t offset;
+		uint8_t *output_data;
+		size_t output_size;
+
+		rc = implementation->compress(NULL, &input[pos], chunk_size, last, &offset,
+					      &output_data, &output_size);
+		zassert_ok(rc, "Expected compression to be successful");
+		zassert_true(total + output_size <= output_max, "Output buffer overflow");
+
+		if (output_size > 0) {
+			memcpy(&output[total], output_data, output_size);
+			total += output_size;
+		}
+
+		pos += offset;
+
+		if (last && offset == chunk_size && output_size == 0) {
+			break;
+		}
+	}
+
+	rc = implementation->deinit(NULL);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	return total;
+}
+
+static void file_create(bool arm_thumb)
+{
+	struct dfu_target_mcuboot_compressed_header header = {
+		.magic = sys_cpu_to_le32(DFU_TARGET_MCUBOOT_COMPRESSED_MAGIC),
+		.image_size = sys_cpu_to_le32(sizeof(image)),
+		.flags = sys_cpu_to_le32(arm_thumb ? DFU_TARGET_MCUBOOT_COMPRESSED_FLAG_ARM_THUMB
+						   : 0),
+	};
+	const uint8_t *input = image;
+
+	if (arm_thumb) {
+		zassert_equal(stream_compress(NRF_COMPRESS_TYPE_ARM_THUMB, image, sizeof(image),
+					      filtered, sizeof(filtered)),
+			      sizeof(image), "Expected filter to keep the size");
+		input = filtered;
+	}
+
+	memcpy(file, &header, sizeof(header));
+	file_size = sizeof(header) + stream_compress(NRF_COMPRESS_TYPE_LZ, input, sizeof(image),
+						     &file[sizeof(header)],
+						     sizeof(file) - sizeof(header));
+	zassert_true(file_size < sizeof(image), "Expected image to be compressed");
+}
+
+static int file_write(size_t from, size_t to, size_t fragment_size)
+{
+	for (size_t pos = from; pos < to; pos += fragment_size) {
+		int rc = dfu_target_mcuboot_decompress_write(&file[pos],
+							     MIN(fragment_size, to - pos));
+
+		if (rc != 0) {
+			return rc;
+		}
+	}
+
+	return 0;
+}
+
+static void decompress_init(size_t slot_size)
+{
+	zassert_true(dfu_target_mcuboot_decompress_identify(file),
+		     "Expected compressed image to be identified");
+	zassert_true(dfu_target_mcuboot_decompress_init(file_size, slot_size),
+		     "Expected decompression to be active");
+}
+
+static void slot_verify(void)
+{
+	zassert_equal(bytes_written, sizeof(image), "Expected whole image to be written");
+	zassert_mem_equal(slot, image, sizeof(image), "Expected slot to hold the image");
+}
+
+static void *setup(void)
+{
+	size_t pos = 0;
+	uint32_t i = 0;
+
+	/* Text interleaved with thumb BL instructions, which is somewhat like firmware. */
+	while (pos < sizeof(image)) {
+		char line[48];
+		int len = snprintf(line, sizeof(line), "sensor %u: value %u\n", i % 11,
+				   (i * 37) % 1000);
+		uint32_t branch = 0xf800f000 | ((i * 13) & 0x7ff);
+
+		len = MIN(len, sizeof(image) - pos);
+		memcpy(&image[pos], line, len);
+		pos += len;
+
+		len = MIN(sizeof(branch), sizeof(image) - pos);
+		memcpy(&image[pos], &branch, len);
+		pos += len;
+		i++;
+	}
+
+	return NULL;
+}
+
+static void before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	dfu_target_mcuboot_decompress_reset();
+	memset(slot, 0, sizeof(slot));
+	bytes_written = 0;
+	bytes_flushed = 0;
+	stream_failure_at = TEST_STREAM_FAILURE_NONE;
+}
+
+ZTEST(dfu_target_mcuboot_decompress, test_identify)
+{
+	uint32_t magic = sys_cpu_to_le32(DFU_TARGET_MCUBOOT_COMPRESSED_MAGIC);
+	uint32_t other = sys_cpu_to_le32(0x96f3b83d);
+
+	zassert_true(dfu_target_mcuboot_decompress_identify(&magic), "Expected match");
+	zassert_false(dfu_target_mcuboot_decompress_identify(&other), "Expected no match");
+	zassert_false(dfu_target_mcuboot_decompress_init(1024, TEST_SLOT_SIZE),
+		      "Expected plain image to not be decompressed");
+	zassert_false(dfu_target_mcuboot_decompress_active(), "Expected to not be active");
+}
+
+ZTEST(dfu_target_mcuboot_decompress, test_fragments)
+{
+	static const size_t fragment_sizes[] = { 1, 7, 512, 4096 };
+	size_t offset;
+
+	file_create(false);
+
+	ARRAY_FOR_EACH(fragment_sizes, i) {
+		before(NULL);
+		decompress_init(TEST_SLOT_SIZE);
+
+		zassert_ok(file_write(0, file_size, fragment_sizes[i]), "Expected write to pass");
+		zassert_ok(dfu_target_mcuboot_decompress_offset_get(&offset), "Expected offset");
+		zassert_equal(offset, file_size, "Expected offset in compressed image");
+		zassert_ok(dfu_target_mcuboot_decompress_done(true), "Expected done to pass");
+		zassert_false(dfu_target_mcuboot_decompress_active(), "Expected to not be active");
+		slot_verify();
+	}
+}
+
+ZTEST(dfu_target_mcuboot_decompress, test_arm_thumb)
+{
+	file_create(true);
+	decompress_init(TEST_SLOT_SIZE);
+
+	zassert_ok(file_write(0, file_size, 1000), "Expected write to pass");
+	zassert_ok(dfu_target_mcuboot_decompress_done(true), "Expected done to pass");
+	slot_verify();
+}
+
+ZTEST(dfu_target_mcuboot_decompress, test_resume_offset)
+{
+	size_t offset;
+
+	file_create(false);
+	decompress_init(TEST_SLOT_SIZE);
+
+	/* Decoder state is kept, so the download continues from the compressed offset. */
+	zassert_ok(file_write(0, file_size / 2, 333), "Expected write to pass");
+	zassert_ok(dfu_target_mcuboot_decompress_offset_get(&offset), "Expected offset");
+	zassert_equal(offset, file_size / 2, "Expected offset in compressed image");
+
+	zassert_ok(file_write(offset, file_size, 333), "Expected write to pass");
+	zassert_ok(dfu_target_mcuboot_decompress_done(true), "Expected done to pass");
+	slot_verify();
+}
+
+ZTEST(dfu_target_mcuboot_decompress, test_resume_after_reboot)
+{
+	size_t offset;
+
+	file_create(false);
+	decompress_init(TEST_SLOT_SIZE);
+
+	/* The decoder outputs data once its dictionary is full, so stop close to the end. */
+	zassert_ok(file_write(0, file_size - 16, 512), "Expected write to pass");
+
+	/* Only the flushed data is kept over a reboot. */
+	dfu_target_mcuboot_decompress_reset();
+	bytes_written = bytes_flushed;
+	memset(&slot[bytes_written], 0, sizeof(slot) - bytes_written);
+	zassert_true(bytes_written > 0, "Expected some data to be flushed");
+
+	decompress_init(TEST_SLOT_SIZE);
+	zassert_ok(dfu_target_mcuboot_decompress_offset_get(&offset), "Expected offset");
+	zassert_equal(offset, 0, "Expected download to start over");
+
+	zassert_ok(file_write(0, file_size, 512), "Expected write to pass");
+	zassert_ok(dfu_target_mcuboot_decompress_done(true), "Expected done to pass");
+	slot_verify();
+}
+
+ZTEST(dfu_target_mcuboot_decompress, test_restart_after_failure)
+{
+	size_t offset;
+
+	file_create(false);
+	decompress_init(TEST_SLOT_SIZE);
+
+	stream_failure_at = sizeof(image) - 1000;
+	zassert_equal(file_write(0, file_size, 512), -EIO, "Expected stream failure");
+	zassert_ok(dfu_target_mcuboot_decompress_done(false), "Expected done to pass");
+	zassert_true(dfu_target_mcuboot_decompress_active(), "Expected to be active");
+	zassert_true(bytes_written > 0, "Expected some data to be written");
+
+	zassert_ok(dfu_target_mcuboot_decompress_offset_get(&offset), "Expected offset");
+	zassert_equal(offset, 0, "Expected download to start over");
+
+	stream_failure_at = TEST_STREAM_FAILURE_NONE;
+	zassert_ok(file_write(0, file_size, 512), "Expected write to pass");
+	zassert_ok(dfu_target_mcuboot_decompress_done(true), "Expected done to pass");
+	slot_verify();
+}
+
+ZTEST(dfu_target_mcuboot_decompress, test_invalid)
+{
+	struct dfu_target_mcuboot_compressed_header *header = (void *)file;
+
+	file_create(false);
+
+	/* Decompressed image does not fit in the slot */
+	decompress_init(sizeof(image) - 1);
+	zassert_equal(file_write(0, file_size, 512), -EINVAL, "Expected write to fail");
+
+	/* Truncated image */
+	before(NULL);
+	decompress_init(TEST_SLOT_SIZE);
+	zassert_ok(file_write(0, file_size - 16, 512), "Expected write to pass");
+	zassert_equal(dfu_target_mcuboot_decompress_done(true), -EINVAL,
+		      "Expected done to fail");
+
+	/* Data past the end of the file */
+	before(NULL);
+	decompress_init(TEST_SLOT_SIZE);
+	zassert_ok(file_write(0, file_size, 512), "Expected write to pass");
+	zassert_equal(dfu_target_mcuboot_decompress_write(file, 1), -EINVAL,
+		      "Expected write to fail");
+
+	/* Unknown flags */
+	before(NULL);
+	header->flags = sys_cpu_to_le32(BIT(7));
+	decompress_init(TEST_SLOT_SIZE);
+	zassert_equal(file_write(0, file_size, 512), -EINVAL, "Expected write to fail");
+}
+
+ZTEST_SUITE(dfu_target_mcuboot_decompress, NULL, setup, before, NULL, NULL);
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <zephyr/ztest.h>
+
+#include "timeslot_queue.h"
+#include "time.h"
+
+#define WINDOW_LEN_US		500
+#define TIMESLOT_LEN_US		1000
+
+/* Advancing by this many ticks always moves past the previously taken timeslot. */
+#define IDLE_TICKS		1000000
+
+uint32_t test_rtc_ticks;
+
+static struct dm_request request_get(uint8_t peer_id, uint32_t start_delay_us)
+{
+	struct dm_request req = {
+		.start_delay_us = start_delay_us,
+	};
+
+	req.bt_addr.a.val[0] = peer_id;
+
+	return req;
+}
+
+static int append(uint8_t peer_id, uint32_t start_delay_us)
+{
+	struct dm_request req = request_get(peer_id, start_delay_us);
+
+	return timeslot_queue_append(&req, time_now(), WINDOW_LEN_US, TIMESLOT_LEN_US);
+}
+
+static void test_before(void *fixture)
+{
+	struct timeslot_request req;
+
+	ARG_UNUSED(fixture);
+
+	while (!timeslot_queue_pop(&req)) {
+	}
+
+	test_rtc_ticks = (test_rtc_ticks + IDLE_TICKS) % (RTC_COUNTER_MAX + 1);
+}
+
+ZTEST(timeslot_queue, test_empty)
+{
+	struct timeslot_request req;
+
+	zassert_equal(timeslot_queue_count(), 0, "Queue not empty");
+	zassert_equal(timeslot_queue_pop(&req), -ENOENT, "Pop from empty queue");
+}
+
+ZTEST(timeslot_queue, test_start_time_order)
+{
+	static const uint8_t expected_peers[] = {2, 3, 1};
+	struct timeslot_request req;
+
+	zassert_ok(append(1, 30000));
+	zassert_ok(append(2, 10000));
+	zassert_ok(append(3, 20000));
+	zassert_equal(timeslot_queue_count(), 3, "Invalid queue length");
+
+	for (size_t i = 0; i < ARRAY_SIZE(expected_peers); i++) {
+		zassert_ok(timeslot_queue_pop(&req));
+		zassert_equal(req.dm_req.bt_addr.a.val[0], expected_peers[i],
+			      "Invalid timeslot order");
+		zassert_equal(req.timeslot_length_us, TIMESLOT_LEN_US, "Invalid timeslot length");
+		zassert_equal(req.window_length_us, WINDOW_LEN_US, "Invalid window length");
+	}
+}
+
+ZTEST(timeslot_queue, test_gap_insert)
+{
+	struct timeslot_queue_stats before;
+	struct timeslot_queue_stats after;
+
+	timeslot_queue_stats_get(&before);
+
+	zassert_ok(append(1, 0));
+	zassert_ok(append(2, 100000));
+
+	/* Fits into the gap between the scheduled timeslots. */
+	zassert_ok(append(3, 50000));
+
+	/* Overlap with a timeslot scheduled before and after. */
+	zassert_equal(append(4, 52000), -EBUSY, "Overlapping timeslot accepted");
+	zassert_equal(append(4, 95000), -EBUSY, "Overlapping timeslot accepted");
+
+	timeslot_queue_stats_get(&after);
+
+	zassert_equal(after.scheduled - before.scheduled, 3, "Invalid scheduled count");
+	zassert_equal(after.gap_inserts - before.gap_inserts, 1, "Invalid gap insert count");
+	zassert_equal(after.rejected_busy - before.rejected_busy, 2, "Invalid busy count");
+	zassert_true(after.max_depth >= 3, "Invalid max depth");
+}
+
+ZTEST(timeslot_queue, test_busy_after_pop)
+{
+	struct timeslot_request req;
+	uint32_t ref_tick = time_now();
+
+	zassert_ok(append(1, 0));
+	zassert_ok(timeslot_queue_pop(&req));
+
+	/* The taken timeslot still occupies the radio. */
+	zassert_equal(append(1, 0), -EBUSY, "Timeslot overlapping the taken one accepted");
+
+	test_rtc_ticks = (ref_tick + US_TO_RTC_TICKS(CONFIG_DM_RANGING_OFFSET_US + 10000)) %
+			 (RTC_COUNTER_MAX + 1);
+	zassert_ok(append(1, 0));
+}
+
+ZTEST(timeslot_queue, test_peer_fair_share)
+{
+	struct dm_request req = request_get(11, 0);
+	struct timeslot_queue_peer_stats peer_stats;
+	uint32_t delay = 0;
+
+	zassert_ok(append(10, delay));
+
+	/* Two active peers share the queue of eight timeslots. */
+	for (size_t i = 0; i < 4; i++) {
+		delay += 20000;
+		zassert_ok(append(11, delay));
+	}
+
+	delay += 20000;
+	zassert_equal(append(11, delay), -EAGAIN, "Peer exceeded its fair share");
+
+	/* The third peer gets the rest of the queue. */
+	for (size_t i = 0; i < 3; i++) {
+		delay += 20000;
+		zassert_ok(append(12, delay));
+	}
+
+	delay += 20000;
+	zassert_equal(append(13, delay), -ENOMEM, "Timeslot appended to a full queue");
+	zassert_equal(timeslot_queue_count(), CONFIG_DM_TIMESLOT_QUEUE_LENGTH,
+		      "Invalid queue length");
+
+	zassert_ok(timeslot_queue_peer_stats_get(&req.bt_addr, &peer_stats));
+	zassert_equal(peer_stats.scheduled, 4, "Invalid peer scheduled count");
+	zassert_equal(peer_stats.rejected, 1, "Invalid peer rejected count");
+}
+
+ZTEST(timeslot_queue, test_counter_wrap)
+{
+	static const uint8_t expected_peers[] = {1, 3, 2};
+	struct timeslot_request req;
+
+	/* The timeslots are scheduled on both sides of the counter overflow. */
+	test_rtc_ticks = RTC_COUNTER_MAX - US_TO_RTC_TICKS(CONFIG_DM_RANGING_OFFSET_US + 20000);
+
+	zassert_ok(append(1, 0));
+	zassert_ok(append(2, 60000));
+	zassert_ok(append(3, 30000));
+
+	for (size_t i = 0; i < ARRAY_SIZE(expected_peers); i++) {
+		zassert_ok(timeslot_queue_pop(&req));
+		zassert_equal(req.dm_req.bt_addr.a.val[0], expected_peers[i],
+			      "Invalid timeslot order");
+		zassert_true(req.start_time <= RTC_COUNTER_MAX, "Invalid start time");
+	}
+}
+
+ZTEST_SUITE(timeslot_queue, NULL, NULL, test_before, NULL, NULL);
@@ -0,0 +1,26 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#ifndef NRF_RTC_STUB_H__
+#define NRF_RTC_STUB_H__
+
+#include <stdint.h>
+
+/* Minimal replacement of the RTC HAL driven by the synthetic ticks of the test. */
+#define NRF_RTC_INPUT_FREQ	32768
+#define NRF_RTC_COUNTER_MAX	0xFFFFFF
+#define NRF_RTC0		((void *)0)
+
+extern uint32_t test_rtc_ticks;
+
+static inline uint32_t nrf_rtc_counter_get(const void *p_reg)
+{
+	(void)p_reg;
+
+	return test_rtc_ticks;
+}
+
+#endif /* NRF_RTC_STUB_H__ */
@@ -8,13 +8,18 @@
 
 #include <net/downloader.h>
 #include <net/downloader_transport_coap.h>
+#include <net/downloader_transport_http.h>
 #include <zephyr/net/socket.h>
 #include <zephyr/net/coap.h>
+#include <zephyr/settings/settings.h>
+#include <ocrypto_sha256.h>
 
 #include <zephyr/fff.h>
 #include <sys/types.h>
 #include <errno.h>
 
+#include "dl_resume.h"
+
 #define HOSTNAME "server.com"
 #define HOSTNAME2 "server2.com"
 
@@ -204,6 +209,11 @@ static struct downloader_host_cfg dl_host_conf_w_sec_tags_range_override_32 = {
 	.range_override = 32,
 };
 
+static struct downloader_host_cfg dl_host_cfg_pipeline = {
+	.pdn_id = 1,
+	.range_override = 128,
+};
+
 static struct downloader_host_cfg dl_host_conf_w_sec_tags_and_cid = {
 	.pdn_id = 1,
 	.sec_tag_list = sec_tags,
@@ -254,6 +264,16 @@ FAKE_VALUE_FUNC(int, coap_append_size2_option, struct coap_packet *, struct coap
 FAKE_VALUE_FUNC(struct coap_transmission_parameters, coap_get_transmission_parameters);
 FAKE_VALUE_FUNC(int, coap_pending_init, struct coap_pending *, const struct coap_packet *,
 		const struct sockaddr *, const struct coap_transmission_parameters *);
+FAKE_VALUE_FUNC(int, coap_find_options, const struct coap_packet *, uint16_t,
+		struct coap_option *, uint16_t);
+FAKE_VALUE_FUNC(int, settings_subsys_init);
+FAKE_VALUE_FUNC(int, settings_load_subtree_direct, const char *, settings_load_direct_cb, void *);
+FAKE_VALUE_FUNC(int, settings_save_one, const char *, const void *, size_t);
+FAKE_VALUE_FUNC(int, settings_delete, const char *);
+FAKE_VOID_FUNC(ocrypto_sha256, uint8_t *, const uint8_t *, size_t);
+FAKE_VOID_FUNC(ocrypto_sha256_init, ocrypto_sha256_ctx *);
+FAKE_VOID_FUNC(ocrypto_sha256_update, ocrypto_sha256_ctx *, const uint8_t *, size_t);
+FAKE_VOID_FUNC(ocrypto_sha256_final, ocrypto_sha256_ctx *, uint8_t *);
 
 uint16_t message_id;
 uint16_t coap_next_id(void)
@@ -885,6 +905,274 @@ static ssize_t z_impl_zsock_recvfrom_https_partial_content_partial_2nd_header(
 	return 0;
 }
 
+/* HTTP server stand-in answering range requests after a fixed latency */
+#define PIPELINE_FILE_SIZE 1024
+#define PIPELINE_LATENCY_MS 50
+#define PIPELINE_HDR \
+"HTTP/1.1 206 Partial Content\r\n" \
+"Content-Length: %u\r\n" \
+"Connection: keep-alive\r\n" \
+"Content-Range: bytes %u-%u/%u\r\n\r\n"
+
+static struct {
+	struct {
+		uint32_t start;
+		uint32_t end;
+		int64_t ready;
+	} req[16];
+	uint8_t head;
+	uint8_t count;
+	uint8_t in_flight_max;
+	/* Response being sent */
+	char wire[256 + 128];
+	size_t wire_len;
+	size_t wire_pos;
+	/* Data received by the application */
+	size_t received;
+} pipeline_server;
+
+static uint8_t pipeline_file_byte(size_t off)
+{
+	/* Not a multiple of the range size, so misplaced ranges are detected */
+	return off % 251;
+}
+
+static ssize_t z_impl_zsock_sendto_pipeline(int sock, const void *buf, size_t len, int flags,
+					    const struct sockaddr *dest_addr, socklen_t addrlen)
+{
+	char *p;
+	char req[512] = {0};
+	uint8_t idx;
+	unsigned int start;
+	unsigned int end;
+
+	TEST_ASSERT_EQUAL(FD, sock);
+	TEST_ASSERT(len < sizeof(req));
+
+	memcpy(req, buf, len);
+	p = strstr(req, "Range: bytes=");
+	TEST_ASSERT_NOT_NULL(p);
+	TEST_ASSERT_EQUAL(2, sscanf(p, "Range: bytes=%u-%u", &start, &end));
+	TEST_ASSERT(pipeline_server.count < ARRAY_SIZE(pipeline_server.req));
+
+	idx = (pipeline_server.head + pipeline_server.count) % ARRAY_SIZE(pipeline_server.req);
+	pipeline_server.req[idx].start = start;
+	pipeline_server.req[idx].end = end;
+	pipeline_server.req[idx].ready = k_uptime_get() + PIPELINE_LATENCY_MS;
+	pipeline_server.count++;
+	pipeline_server.in_flight_max = MAX(pipeline_server.in_flight_max, pipeline_server.count);
+
+	return len;
+}
+
+static ssize_t z_impl_zsock_recvfrom_pipeline(int sock, void *buf, size_t max_len, int flags,
+					      struct sockaddr *src_addr, socklen_t *addrlen)
+{
+	size_t copied = 0;
+
+	TEST_ASSERT_EQUAL(FD, sock);
+	TEST_ASSERT(pipeline_server.count > 0 || pipeline_server.wire_len);
+
+	if (!pipeline_server.wire_len) {
+		int64_t wait = pipeline_server.req[pipeline_server.head].ready - k_uptime_get();
+
+		if (wait > 0) {
+			k_sleep(K_MSEC(wait));
+		}
+	}
+
+	/* Send every response that is ready, back to back */
+	while (copied < max_len) {
+		size_t n;
+
+		if (!pipeline_server.wire_len) {
+			uint32_t start = pipeline_server.req[pipeline_server.head].start;
+			uint32_t end = pipeline_server.req[pipeline_server.head].end;
+
+			if (!pipeline_server.count ||
+			    pipeline_server.req[pipeline_server.head].ready > k_uptime_get()) {
+				break;
+			}
+
+			pipeline_server.wire_len = snprintf(pipeline_server.wire,
+							    sizeof(pipeline_server.wire),
+							    PIPELINE_HDR, end - start + 1, start, end,
+							    PIPELINE_FILE_SIZE);
+			for (uint32_t i = start; i <= end; i++) {
+				pipeline_server.wire[pipeline_server.wire_len++] =
+					pipeline_file_byte(i);
+			}
+			pipeline_server.wire_pos = 0;
+			pipeline_server.head =
+				(pipeline_server.head + 1) % ARRAY_SIZE(pipeline_server.req);
+			pipeline_server.count--;
+		}
+
+		n = MIN(max_len - copied, pipeline_server.wire_len - pipeline_server.wire_pos);
+		memcpy((char *)buf + copied, &pipeline_server.wire[pipeline_server.wire_pos], n);
+		copied += n;
+		pipeline_server.wire_pos += n;
+		if (pipeline_server.wire_pos == pipeline_server.wire_len) {
+			pipeline_server.wire_len = 0;
+		}
+	}
+
+	return copied;
+}
+
+#define RESUME_VALIDATOR "\"3147526947\""
+#define RESUME_SETTINGS_KEY "downloader/resume"
+#define RESUME_SETTINGS RESUME_SETTINGS_KEY "/default"
+
+#define HTTP_HDR_RESUME "HTTP/1.1 206 Partial Content\r\n" \
+"Content-Length: 64\r\n" \
+"Content-Range: bytes 64-127/128\r\n" \
+"Etag: " RESUME_VALIDATOR "\r\n\r\n"
+
+static struct dl_resume_record resume_stored;
+static size_t resume_hashed;
+
+static void ocrypto_sha256_xor(uint8_t *r, const uint8_t *in, size_t in_len)
+{
+	/* Good enough to tell URLs apart */
+	memset(r, 0, ocrypto_sha256_BYTES);
+	for (size_t i = 0; i < in_len; i++) {
+		r[i % ocrypto_sha256_BYTES] ^= in[i];
+	}
+}
+
+static void ocrypto_sha256_update_count(ocrypto_sha256_ctx *ctx, const uint8_t *in, size_t in_len)
+{
+	resume_hashed += in_len;
+}
+
+static ssize_t resume_read_cb(void *cb_arg, void *data, size_t len)
+{
+	memcpy(data, cb_arg, len);
+	return len;
+}
+
+static int settings_load_subtree_direct_resume(const char *subtree, settings_load_direct_cb cb,
+					       void *param)
+{
+	TEST_ASSERT_EQUAL_STRING(RESUME_SETTINGS_KEY, subtree);
+
+	if (!resume_stored.offset) {
+		return 0;
+	}
+
+	return cb("default", sizeof(resume_stored), resume_read_cb, &resume_stored, param);
+}
+
+static int settings_save_one_resume(const char *name, const void *value, size_t val_len)
+{
+	TEST_ASSERT_EQUAL_STRING(RESUME_SETTINGS, name);
+	TEST_ASSERT_EQUAL(sizeof(resume_stored), val_len);
+
+	memcpy(&resume_stored, value, val_len);
+	return 0;
+}
+
+static int settings_delete_resume(const char *name)
+{
+	TEST_ASSERT_EQUAL_STRING(RESUME_SETTINGS, name);
+
+	memset(&resume_stored, 0, sizeof(resume_stored));
+	return 0;
+}
+
+static void resume_record_store(const char *url, uint32_t offset, const void *validator,
+				size_t validator_len)
+{
+	uint8_t hash[ocrypto_sha256_BYTES];
+
+	ocrypto_sha256_xor(hash, (const uint8_t *)url, strlen(url));
+
+	memset(&resume_stored, 0, sizeof(resume_stored));
+	resume_stored.version = DL_RESUME_RECORD_VERSION;
+	memcpy(resume_stored.url_hash, hash, sizeof(resume_stored.url_hash));
+	resume_stored.offset = offset;
+	resume_stored.hashed = offset;
+	resume_stored.validator_len = validator_len;
+	memcpy(resume_stored.validator, validator, validator_len);
+	resume_hashed = 0;
+
+	settings_load_subtree_direct_fake.custom_fake = settings_load_subtree_direct_resume;
+	settings_save_one_fake.custom_fake = settings_save_one_resume;
+	settings_delete_fake.custom_fake = settings_delete_resume;
+	ocrypto_sha256_fake.custom_fake = ocrypto_sha256_xor;
+	ocrypto_sha256_update_fake.custom_fake = ocrypto_sha256_update_count;
+}
+
+static ssize_t z_impl_zsock_sendto_http_resume(int sock, const void *buf, size_t len, int flags,
+					       const struct sockaddr *dest_addr, socklen_t addrlen)
+{
+	char req[512] = {0};
+
+	TEST_ASSERT_EQUAL(FD, sock);
+	TEST_ASSERT(len < sizeof(req));
+	memcpy(req, buf, len);
+
+	switch (z_impl_zsock_sendto_fake.call_count) {
+	case 1:
+		TEST_ASSERT_NOT_NULL(strstr(req, "Range: bytes=64-\r\n"));
+		TEST_ASSERT_NOT_NULL(strstr(req, "If-Range: " RESUME_VALIDATOR "\r\n\r\n"));
+		break;
+	default:
+		/* Download restarted from the beginning */
+		TEST_ASSERT_NULL(strstr(req, "Range:"));
+		break;
+	}
+
+	return len;
+}
+
+static ssize_t z_impl_zsock_recvfrom_http_resume(
+	int sock, void *buf, size_t max_len, int flags, struct sockaddr *src_addr,
+	socklen_t *addrlen)
+{
+	switch (z_impl_zsock_recvfrom_fake.call_count) {
+	case 1:
+		memcpy(buf, HTTP_HDR_RESUME, strlen(HTTP_HDR_RESUME));
+		return strlen(HTTP_HDR_RESUME);
+	case 2:
+		memset(buf, 23, 64);
+		return 64;
+	}
+
+	return 0;
+}
+
+static ssize_t z_impl_zsock_recvfrom_http_resume_stale(
+	int sock, void *buf, size_t max_len, int flags, struct sockaddr *src_addr,
+	socklen_t *addrlen)
+{
+	switch (z_impl_zsock_recvfrom_fake.call_count) {
+	case 1:
+	case 2:
+		/* Whole file, the validator does not match */
+		memcpy(buf, HTTP_HDR_OK, strlen(HTTP_HDR_OK));
+		return strlen(HTTP_HDR_OK);
+	case 3:
+		memset(buf, 23, 128);
+		return 128;
+	}
+
+	return 0;
+}
+
+static int coap_find_options_etag(const struct coap_packet *cpkt, uint16_t code,
+				  struct coap_option *options, uint16_t veclen)
+{
+	TEST_ASSERT_EQUAL(COAP_OPTION_ETAG, code);
+	TEST_ASSERT(veclen >= 1);
+
+	options[0].len = 1;
+	options[0].value[0] = 0x02;
+
+	return 1;
+}
+
 static ssize_t z_impl_zsock_recvfrom_http_header_and_payload(
 	int sock, void *buf, size_t max_len, int flags, struct sockaddr *src_addr,
 	socklen_t *addrlen)
@@ -1257,6 +1545,23 @@ static int dl_callback_abort(const struct downloader_evt *event)
 	return 1; /* stop download*/
 }
 
+static int dl_callback_pipeline(const struct downloader_evt *event)
+{
+	TEST_ASSERT(event != NULL);
+
+	if (event->id != DOWNLOADER_EVT_FRAGMENT) {
+		return dl_callback(event);
+	}
+
+	for (size_t i = 0; i < event->fragment.len; i++) {
+		TEST_ASSERT_EQUAL(pipeline_file_byte(pipeline_server.received + i),
+				  ((uint8_t *)event->fragment.buf)[i]);
+	}
+	pipeline_server.received += event->fragment.len;
+
+	return 0;
+}
+
 static struct downloader_evt dl_wait_for_event(enum downloader_evt_id event,
 						     k_timeout_t timeout)
 {
@@ -1448,6 +1753,299 @@ void test_downloader_get_https_partial_content(void)
 	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
 }
 
+static int64_t pipeline_download(uint8_t depth)
+{
+	int err;
+	int64_t start;
+	struct downloader_cfg cfg = {
+		.callback = dl_callback_pipeline,
+		.buf = dl_buf,
+		.buf_size = sizeof(dl_buf),
+	};
+	struct downloader_transport_http_cfg http_cfg = {
+		.pipeline_depth = depth,
+	};
+
+	memset(&pipeline_server, 0, sizeof(pipeline_server));
+	RESET_FAKE(z_impl_zsock_setsockopt);
+	RESET_FAKE(z_impl_zsock_sendto);
+	RESET_FAKE(z_impl_zsock_recvfrom);
+
+	err = downloader_init(&dl, &cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	err = downloader_transport_http_set_config(&dl, &http_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ipv6_fail_ipv4_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv4;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_http_ipv4_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv4_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_http_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_pipeline;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_pipeline;
+
+	start = k_uptime_get();
+
+	err = downloader_get(&dl, &dl_host_cfg_pipeline, HTTP_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	start = k_uptime_get() - start;
+
+	TEST_ASSERT_EQUAL(PIPELINE_FILE_SIZE, pipeline_server.received);
+	TEST_ASSERT_EQUAL(depth, pipeline_server.in_flight_max);
+	TEST_ASSERT_EQUAL(PIPELINE_FILE_SIZE / dl_host_cfg_pipeline.range_override,
+			  z_impl_zsock_sendto_fake.call_count);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+
+	return start;
+}
+
+void test_downloader_get_http_pipelined_ranges(void)
+{
+	int64_t sequential_ms;
+	int64_t pipelined_ms;
+
+	sequential_ms = pipeline_download(1);
+	pipelined_ms = pipeline_download(4);
+
+	printk("%d ranges with %d ms latency: sequential %lld ms, pipelined %lld ms\n",
+	       PIPELINE_FILE_SIZE / dl_host_cfg_pipeline.range_override, PIPELINE_LATENCY_MS,
+	       sequential_ms, pipelined_ms);
+
+	/* Four requests in flight remove most of the round trips */
+	TEST_ASSERT(pipelined_ms * 2 < sequential_ms);
+}
+
+void test_downloader_get_http_resume(void)
+{
+	int err;
+	size_t size;
+	uint8_t digest[32];
+	struct downloader_host_cfg host_cfg = {
+		.pdn_id = 1,
+		.resume = true,
+	};
+
+	resume_record_store(HTTP_URL, 64, RESUME_VALIDATOR, strlen(RESUME_VALIDATOR));
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	err = downloader_resume_offset_get(&dl, HTTP_URL, &size);
+	TEST_ASSERT_EQUAL(0, err);
+	TEST_ASSERT_EQUAL(64, size);
+
+	err = downloader_resume_offset_get(&dl, HTTP_URL_FILE2, &size);
+	TEST_ASSERT_EQUAL(-ENOENT, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ipv6_fail_ipv4_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv4;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_http_ipv4_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv4_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_http_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_http_resume;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_http_resume;
+
+	/* The offset is taken from the resume store */
+	err = downloader_get(&dl, &host_cfg, HTTP_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	err = downloader_downloaded_size_get(&dl, &size);
+	TEST_ASSERT_EQUAL(0, err);
+	TEST_ASSERT_EQUAL(128, size);
+
+	/* Only the new bytes are hashed, on top of the stored state */
+	TEST_ASSERT_EQUAL(64, resume_hashed);
+	TEST_ASSERT_EQUAL(1, ocrypto_sha256_final_fake.call_count);
+	TEST_ASSERT_EQUAL(0, ocrypto_sha256_init_fake.call_count);
+
+	/* A checkpoint is saved, and the record is removed once the download is complete */
+	TEST_ASSERT_EQUAL(1, settings_save_one_fake.call_count);
+	TEST_ASSERT_EQUAL(1, settings_delete_fake.call_count);
+	TEST_ASSERT_EQUAL(0, resume_stored.offset);
+
+	err = downloader_resume_sha256_get(&dl, digest);
+	TEST_ASSERT_EQUAL(0, err);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
+void test_downloader_resume_record_invalid(void)
+{
+	int err;
+	size_t size;
+	struct downloader_cfg cfg = dl_cfg;
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	/* The SHA-256 state does not match the offset */
+	resume_record_store(HTTP_URL, 64, RESUME_VALIDATOR, strlen(RESUME_VALIDATOR));
+	resume_stored.hashed = 32;
+	err = downloader_resume_offset_get(&dl, HTTP_URL, &size);
+	TEST_ASSERT_EQUAL(-ENOENT, err);
+
+	/* Written with another layout */
+	resume_record_store(HTTP_URL, 64, RESUME_VALIDATOR, strlen(RESUME_VALIDATOR));
+	resume_stored.version = DL_RESUME_RECORD_VERSION + 1;
+	err = downloader_resume_offset_get(&dl, HTTP_URL, &size);
+	TEST_ASSERT_EQUAL(-ENOENT, err);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+
+	/* The record belongs to another instance */
+	cfg.resume_name = "other";
+	err = downloader_init(&dl, &cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	resume_record_store(HTTP_URL, 64, RESUME_VALIDATOR, strlen(RESUME_VALIDATOR));
+	err = downloader_resume_offset_get(&dl, HTTP_URL, &size);
+	TEST_ASSERT_EQUAL(-ENOENT, err);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
+void test_downloader_get_http_resume_stale(void)
+{
+	int err;
+	struct downloader_evt evt;
+	struct downloader_host_cfg host_cfg = {
+		.pdn_id = 1,
+		.resume = true,
+	};
+
+	resume_record_store(HTTP_URL, 64, RESUME_VALIDATOR, strlen(RESUME_VALIDATOR));
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ipv6_fail_ipv4_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv4;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_http_ipv4_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv4_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_http_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_http_resume;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_http_resume_stale;
+
+	err = downloader_get(&dl, &host_cfg, HTTP_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	evt = dl_wait_for_event(DOWNLOADER_EVT_ERROR, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(-ESTALE, evt.error);
+
+	dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	/* The whole file is downloaded again */
+	TEST_ASSERT_EQUAL(2, z_impl_zsock_sendto_fake.call_count);
+	TEST_ASSERT_EQUAL(128, resume_hashed);
+	TEST_ASSERT_EQUAL(1, ocrypto_sha256_init_fake.call_count);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
+void test_downloader_get_coap_resume(void)
+{
+	int err;
+	size_t size;
+	const uint8_t etag = 0x02;
+	struct downloader_host_cfg host_cfg = {
+		.pdn_id = 1,
+		.resume = true,
+	};
+
+	/* Resume in the middle of the first block */
+	resume_record_store(COAP_URL, 5, &etag, sizeof(etag));
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv6;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_coap_ipv6_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv6_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_coap_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_ok;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_coap;
+
+	coap_get_transmission_parameters_fake.custom_fake = coap_get_transmission_parameters_ok;
+	coap_pending_cycle_fake.custom_fake = coap_pending_cycle_ok;
+	coap_header_get_type_fake.custom_fake = coap_header_get_type_ack;
+	coap_header_get_code_fake.custom_fake = coap_header_get_code_ok;
+	coap_packet_get_payload_fake.custom_fake = coap_packet_get_payload_ok;
+	coap_find_options_fake.custom_fake = coap_find_options_etag;
+
+	err = downloader_get(&dl, &host_cfg, COAP_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	/* The part of the block downloaded before is skipped */
+	TEST_ASSERT_EQUAL(sizeof(COAP_PAYLOAD) - 5, resume_hashed);
+
+	err = downloader_downloaded_size_get(&dl, &size);
+	TEST_ASSERT_EQUAL(0, err);
+	TEST_ASSERT_EQUAL(sizeof(COAP_PAYLOAD), size);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
+void test_downloader_get_coap_resume_stale(void)
+{
+	int err;
+	struct downloader_evt evt;
+	const uint8_t etag = 0x01;
+	struct downloader_host_cfg host_cfg = {
+		.pdn_id = 1,
+		.resume = true,
+	};
+
+	resume_record_store(COAP_URL, 5, &etag, sizeof(etag));
+
+	err = downloader_init(&dl, &dl_cfg);
+	TEST_ASSERT_EQUAL(0, err);
+
+	zsock_getaddrinfo_fake.custom_fake = zsock_getaddrinfo_server_ok;
+	zsock_freeaddrinfo_fake.custom_fake = zsock_freeaddrinfo_server_ipv6;
+	z_impl_zsock_socket_fake.custom_fake = z_impl_zsock_socket_coap_ipv6_ok;
+	z_impl_zsock_connect_fake.custom_fake = z_impl_zsock_connect_ipv6_ok;
+	z_impl_zsock_setsockopt_fake.custom_fake = z_impl_zsock_setsockopt_coap_ok;
+	z_impl_zsock_sendto_fake.custom_fake = z_impl_zsock_sendto_ok;
+	z_impl_zsock_recvfrom_fake.custom_fake = z_impl_zsock_recvfrom_coap;
+
+	coap_get_transmission_parameters_fake.custom_fake = coap_get_transmission_parameters_ok;
+	coap_pending_cycle_fake.custom_fake = coap_pending_cycle_ok;
+	coap_header_get_type_fake.custom_fake = coap_header_get_type_ack;
+	coap_header_get_code_fake.custom_fake = coap_header_get_code_ok;
+	coap_packet_get_payload_fake.custom_fake = coap_packet_get_payload_ok;
+	coap_find_options_fake.custom_fake = coap_find_options_etag;
+
+	err = downloader_get(&dl, &host_cfg, COAP_URL, 0);
+	TEST_ASSERT_EQUAL(0, err);
+
+	evt = dl_wait_for_event(DOWNLOADER_EVT_ERROR, K_SECONDS(3));
+	TEST_ASSERT_EQUAL(-ESTALE, evt.error);
+
+	dl_wait_for_event(DOWNLOADER_EVT_DONE, K_SECONDS(3));
+
+	/* The whole file is downloaded again */
+	TEST_ASSERT_EQUAL(sizeof(COAP_PAYLOAD), resume_hashed);
+
+	downloader_deinit(&dl);
+	dl_wait_for_event(DOWNLOADER_EVT_DEINITIALIZED, K_SECONDS(1));
+}
+
 void test_downloader_get_https_partial_content_partial_2nd_header(void)
 {
 	int err;
@@ -2606,6 +3204,16 @@ void setUp(void)
 	RESET_FAKE(coap_append_size2_option);
 	RESET_FAKE(coap_get_transmission_parameters);
 	RESET_FAKE(coap_pending_init);
+	RESET_FAKE(coap_find_options);
+
+	RESET_FAKE(settings_subsys_init);
+	RESET_FAKE(settings_load_subtree_direct);
+	RESET_FAKE(settings_save_one);
+	RESET_FAKE(settings_delete);
+	RESET_FAKE(ocrypto_sha256);
+	RESET_FAKE(ocrypto_sha256_init);
+	RESET_FAKE(ocrypto_sha256_update);
+	RESET_FAKE(ocrypto_sha256_final);
 
 	pipe_reset(&event_pipe);
 }
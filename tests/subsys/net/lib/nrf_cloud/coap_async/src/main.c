@@ -0,0 +1,263 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/coap.h>
+#include <zephyr/net/coap_client.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_coap.h>
+#include "nrf_cloud_coap_transport.h"
+#include "nrf_cloud_dns.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(int, coap_client_init, struct coap_client *, const char *);
+FAKE_VALUE_FUNC(int, coap_client_req, struct coap_client *, int, const struct sockaddr *,
+		struct coap_client_request *, struct coap_transmission_parameters *);
+FAKE_VOID_FUNC(coap_client_cancel_requests, struct coap_client *);
+FAKE_VOID_FUNC(coap_client_cancel_request, struct coap_client *, struct coap_client_request *);
+FAKE_VALUE_FUNC(int, nrf_cloud_connect_host, const char *, uint16_t, struct zsock_addrinfo *,
+		nrf_cloud_connect_host_cb);
+FAKE_VALUE_FUNC(int, nrf_cloud_jwt_generate, uint32_t, char *const, size_t);
+
+/* Not a valid descriptor, so socket options on it fail without side effects */
+#define FAKE_SOCK 42
+#define HELD_REQUESTS_MAX 4
+
+/* A request held by the fake CoAP client until the test responds to it */
+struct held_request {
+	char path[64];
+	coap_client_response_cb_t cb;
+	void *user_data;
+};
+
+static struct held_request held[HELD_REQUESTS_MAX];
+static int held_count;
+/* Requests are answered right away with this code unless they are held */
+static bool hold_requests;
+static int16_t auto_result_code;
+
+/* Payloads sent to the bulk resource */
+static int bulk_posts;
+static int bulk_samples;
+static int last_bulk_samples;
+
+/* Results received by the asynchronous request callbacks */
+struct async_result {
+	int calls;
+	int16_t result_code;
+};
+
+static int samples_count(const uint8_t *payload, size_t len)
+{
+	static char json[CONFIG_COAP_CLIENT_BLOCK_SIZE + 1];
+	const char *p = json;
+	int count = 0;
+
+	len = MIN(len, sizeof(json) - 1);
+	memcpy(json, payload, len);
+	json[len] = '\0';
+
+	while ((p = strstr(p, "\"appId\"")) != NULL) {
+		count++;
+		p++;
+	}
+
+	return count;
+}
+
+static int coap_client_req_custom_fake(struct coap_client *client, int sock,
+				       const struct sockaddr *addr,
+				       struct coap_client_request *req,
+				       struct coap_transmission_parameters *params)
+{
+	if (strcmp(req->path, NRF_CLOUD_COAP_D2C_BULK_RSC) == 0) {
+		bulk_posts++;
+		last_bulk_samples = samples_count(req->payload, req->len);
+		bulk_samples += last_bulk_samples;
+	}
+
+	if (!hold_requests) {
+		req->cb(auto_result_code, 0, NULL, 0, true, req->user_data);
+		return 0;
+	}
+
+	zassert_true(held_count < HELD_REQUESTS_MAX);
+	strncpy(held[held_count].path, req->path, sizeof(held[0].path) - 1);
+	held[held_count].cb = req->cb;
+	held[held_count].user_data = req->user_data;
+	held_count++;
+
+	return 0;
+}
+
+static void held_respond(int idx, int16_t result_code)
+{
+	zassert_true(idx < held_count);
+	held[idx].cb(result_code, 0, NULL, 0, true, held[idx].user_data);
+}
+
+static int nrf_cloud_connect_host_custom_fake(const char *host_name, uint16_t port,
+					      struct zsock_addrinfo *hints,
+					      nrf_cloud_connect_host_cb connect_cb)
+{
+	return FAKE_SOCK;
+}
+
+static int nrf_cloud_jwt_generate_custom_fake(uint32_t time_valid_s, char *const jwt_buf,
+					      size_t jwt_buf_sz)
+{
+	strncpy(jwt_buf, "jwt", jwt_buf_sz);
+	return 0;
+}
+
+static void async_cb(int16_t result_code, size_t offset, const uint8_t *payload, size_t len,
+		     bool last_block, void *user_data)
+{
+	struct async_result *result = user_data;
+
+	result->calls++;
+	result->result_code = result_code;
+}
+
+static int async_post(struct async_result *result)
+{
+	return nrf_cloud_coap_async_request(COAP_METHOD_POST, NRF_CLOUD_COAP_D2C_RSC, NULL,
+					    "{}", 2, COAP_CONTENT_FORMAT_APP_JSON,
+					    COAP_CONTENT_FORMAT_APP_JSON, true, async_cb, result);
+}
+
+static void *coap_async_setup(void)
+{
+	coap_client_req_fake.custom_fake = coap_client_req_custom_fake;
+	nrf_cloud_connect_host_fake.custom_fake = nrf_cloud_connect_host_custom_fake;
+	nrf_cloud_jwt_generate_fake.custom_fake = nrf_cloud_jwt_generate_custom_fake;
+	auto_result_code = COAP_RESPONSE_CODE_CREATED;
+
+	zassert_ok(nrf_cloud_coap_init());
+	zassert_ok(nrf_cloud_coap_connect(NULL));
+	zassert_true(nrf_cloud_coap_is_connected());
+
+	return NULL;
+}
+
+static void coap_async_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	held_count = 0;
+	hold_requests = false;
+	auto_result_code = COAP_RESPONSE_CODE_CREATED;
+	bulk_posts = 0;
+	bulk_samples = 0;
+	last_bulk_samples = 0;
+}
+
+ZTEST(nrf_cloud_coap_async, test_async_responses_out_of_order)
+{
+	struct async_result first = {0};
+	struct async_result second = {0};
+
+	hold_requests = true;
+	zassert_ok(async_post(&first));
+	zassert_ok(async_post(&second));
+	zassert_equal(held_count, 2);
+
+	/* Each response is passed to the callback of its own request */
+	held_respond(1, COAP_RESPONSE_CODE_BAD_REQUEST);
+	zassert_equal(first.calls, 0);
+	zassert_equal(second.calls, 1);
+	zassert_equal(second.result_code, COAP_RESPONSE_CODE_BAD_REQUEST);
+
+	held_respond(0, COAP_RESPONSE_CODE_CREATED);
+	zassert_equal(first.calls, 1);
+	zassert_equal(first.result_code, COAP_RESPONSE_CODE_CREATED);
+	zassert_equal(second.calls, 1);
+}
+
+ZTEST(nrf_cloud_coap_async, test_async_request_limit)
+{
+	struct async_result results[CONFIG_NRF_CLOUD_COAP_ASYNC_REQUESTS_MAX + 1] = {0};
+	int i;
+
+	hold_requests = true;
+	for (i = 0; i < CONFIG_NRF_CLOUD_COAP_ASYNC_REQUESTS_MAX; i++) {
+		zassert_ok(async_post(&results[i]));
+	}
+	zassert_equal(async_post(&results[i]), -ENOBUFS);
+
+	/* A blocking request still gets a request slot */
+	hold_requests = false;
+	zassert_ok(nrf_cloud_coap_json_message_send("{}", false, true));
+
+	/* A slot is free again once a request has ended */
+	held_respond(0, COAP_RESPONSE_CODE_CREATED);
+	hold_requests = true;
+	zassert_ok(async_post(&results[i]));
+
+	for (int j = 1; j < held_count; j++) {
+		held_respond(j, COAP_RESPONSE_CODE_CREATED);
+	}
+	for (i = 0; i < ARRAY_SIZE(results); i++) {
+		zassert_equal(results[i].calls, 1);
+	}
+}
+
+ZTEST(nrf_cloud_coap_async, test_sensor_batch)
+{
+	int sent = 0;
+
+	/* Values are collected until the next one does not fit in a CoAP block */
+	while (bulk_posts == 0) {
+		zassert_ok(nrf_cloud_coap_sensor_send(NRF_CLOUD_JSON_APPID_VAL_TEMP, sent, 1,
+						      false));
+		sent++;
+		zassert_true(sent < 100, "Batch was never sent");
+	}
+	zassert_true(sent > 2);
+	zassert_equal(bulk_samples, sent - 1);
+
+	/* The value that did not fit is sent with the next batch */
+	zassert_ok(nrf_cloud_coap_sensor_batch_flush());
+	zassert_equal(bulk_posts, 2);
+	zassert_equal(last_bulk_samples, 1);
+
+	/* Nothing is left to send */
+	zassert_ok(nrf_cloud_coap_sensor_batch_flush());
+	zassert_equal(bulk_posts, 2);
+
+	/* Confirmable values are sent right away */
+	zassert_ok(nrf_cloud_coap_sensor_send(NRF_CLOUD_JSON_APPID_VAL_TEMP, 1, 1, true));
+	zassert_equal(bulk_posts, 2);
+	zassert_ok(nrf_cloud_coap_sensor_batch_flush());
+	zassert_equal(bulk_posts, 2);
+}
+
+ZTEST(nrf_cloud_coap_async, test_sensor_batch_send_error)
+{
+	int err = 0;
+	int sent = 0;
+
+	auto_result_code = COAP_RESPONSE_CODE_BAD_REQUEST;
+	while (bulk_posts == 0) {
+		err = nrf_cloud_coap_sensor_send(NRF_CLOUD_JSON_APPID_VAL_TEMP, sent, 1, false);
+		sent++;
+		zassert_true(sent < 100, "Batch was never sent");
+	}
+
+	/* The error is reported, and the new value is kept */
+	zassert_equal(err, COAP_RESPONSE_CODE_BAD_REQUEST);
+
+	auto_result_code = COAP_RESPONSE_CODE_CREATED;
+	zassert_ok(nrf_cloud_coap_sensor_batch_flush());
+	zassert_equal(bulk_posts, 2);
+	zassert_equal(last_bulk_samples, 1);
+}
+
+ZTEST_SUITE(nrf_cloud_coap_async, NULL, coap_async_setup, coap_async_before, NULL, NULL);
@@ -0,0 +1,266 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/fff.h>
+#include <zephyr/ztest.h>
+#include <zephyr/net/coap.h>
+#include <date_time.h>
+#include <modem/lte_lc.h>
+#include <net/nrf_cloud_coap.h>
+#include "nrf_cloud_coap_transport.h"
+
+DEFINE_FFF_GLOBALS;
+
+FAKE_VALUE_FUNC(bool, nrf_cloud_coap_is_connected);
+FAKE_VALUE_FUNC(int, date_time_now, int64_t *);
+FAKE_VOID_FUNC(lte_lc_register_handler, lte_lc_evt_handler_t);
+FAKE_VALUE_FUNC(int, nrf_cloud_coap_async_request, enum coap_method, const char *, const char *,
+		const uint8_t *, size_t, enum coap_content_format, enum coap_content_format, bool,
+		coap_client_response_cb_t, void *);
+
+#define APP_ID "TEMP"
+#define TS 1700000000000LL
+/* Samples that fit in the queue before the flush threshold is reached */
+#define SAMPLES_BELOW_THRESHOLD 6
+
+/* Time for the system workqueue to run the flush */
+#define WORK_WAIT K_MSEC(10)
+
+static lte_lc_evt_handler_t lte_handler;
+static coap_client_response_cb_t response_cb;
+static char payload[CONFIG_NRF_CLOUD_COAP_TELEMETRY_MSG_SIZE];
+static size_t payload_len;
+static int async_ret;
+
+static void lte_lc_register_handler_custom_fake(lte_lc_evt_handler_t handler)
+{
+	lte_handler = handler;
+}
+
+static int nrf_cloud_coap_async_request_custom_fake(enum coap_method method,
+						    const char *resource, const char *query,
+						    const uint8_t *buf, size_t len,
+						    enum coap_content_format fmt_out,
+						    enum coap_content_format fmt_in, bool reliable,
+						    coap_client_response_cb_t cb, void *user)
+{
+	zassert_equal(method, COAP_METHOD_POST);
+	zassert_str_equal(resource, NRF_CLOUD_COAP_D2C_BULK_RSC);
+	zassert_true(len < sizeof(payload));
+
+	memcpy(payload, buf, len);
+	payload[len] = '\0';
+	payload_len = len;
+	response_cb = cb;
+
+	return async_ret;
+}
+
+static void respond(int16_t result_code)
+{
+	zassert_not_null(response_cb);
+	response_cb(result_code, 0, NULL, 0, true, NULL);
+	response_cb = NULL;
+}
+
+static int samples_count(const char *json)
+{
+	int count = 0;
+
+	while ((json = strstr(json, "\"appId\"")) != NULL) {
+		count++;
+		json++;
+	}
+
+	return count;
+}
+
+static void samples_add(int count)
+{
+	for (int i = 0; i < count; i++) {
+		zassert_ok(nrf_cloud_coap_telemetry_add(APP_ID, i, TS + i));
+	}
+}
+
+static void telemetry_before(void *fixture)
+{
+	ARG_UNUSED(fixture);
+
+	RESET_FAKE(nrf_cloud_coap_is_connected);
+	RESET_FAKE(date_time_now);
+	RESET_FAKE(nrf_cloud_coap_async_request);
+	FFF_RESET_HISTORY();
+
+	nrf_cloud_coap_is_connected_fake.return_val = true;
+	nrf_cloud_coap_async_request_fake.custom_fake = nrf_cloud_coap_async_request_custom_fake;
+	lte_lc_register_handler_fake.custom_fake = lte_lc_register_handler_custom_fake;
+	response_cb = NULL;
+	payload_len = 0;
+	async_ret = 0;
+}
+
+ZTEST(nrf_cloud_coap_telemetry, test_flush_on_threshold)
+{
+	struct nrf_cloud_coap_telemetry_stats before;
+	struct nrf_cloud_coap_telemetry_stats after;
+
+	nrf_cloud_coap_telemetry_stats_get(&before);
+
+	samples_add(SAMPLES_BELOW_THRESHOLD);
+	k_sleep(WORK_WAIT);
+	zassert_equal(nrf_cloud_coap_async_request_fake.call_count, 0);
+
+	samples_add(1);
+	k_sleep(WORK_WAIT);
+	zassert_equal(nrf_cloud_coap_async_request_fake.call_count, 1);
+	zassert_equal(samples_count(payload), SAMPLES_BELOW_THRESHOLD + 1);
+
+	respond(COAP_RESPONSE_CODE_CREATED);
+
+	nrf_cloud_coap_telemetry_stats_get(&after);
+	zassert_equal(after.samples - before.samples, SAMPLES_BELOW_THRESHOLD + 1);
+	zassert_equal(after.samples_sent - before.samples_sent, SAMPLES_BELOW_THRESHOLD + 1);
+	zassert_equal(after.samples_dropped, before.samples_dropped);
+	zassert_equal(after.uplinks - before.uplinks, 1);
+	zassert_equal(after.bytes_sent - before.bytes_sent, payload_len);
+}
+
+ZTEST(nrf_cloud_coap_telemetry, test_flush_on_deadline)
+{
+	samples_add(1);
+	k_sleep(WORK_WAIT);
+	zassert_equal(nrf_cloud_coap_async_request_fake.call_count, 0);
+
+	k_sleep(K_SECONDS(CONFIG_NRF_CLOUD_COAP_TELEMETRY_FLUSH_TIMEOUT_S));
+	zassert_equal(nrf_cloud_coap_async_request_fake.call_count, 1);
+	zassert_equal(samples_count(payload), 1);
+
+	respond(COAP_RESPONSE_CODE_CREATED);
+}
+
+ZTEST(nrf_cloud_coap_telemetry, test_flush_on_rrc)
+{
+	struct lte_lc_evt evt = {
+		.type = LTE_LC_EVT_RRC_UPDATE,
+		.rrc_mode = LTE_LC_RRC_MODE_IDLE,
+	};
+
+	samples_add(1);
+	zassert_not_null(lte_handler);
+
+	lte_handler(&evt);
+	k_sleep(WORK_WAIT);
+	zassert_equal(nrf_cloud_coap_async_request_fake.call_count, 0);
+
+	evt.rrc_mode = LTE_LC_RRC_MODE_CONNECTED;
+	lte_handler(&evt);
+	k_sleep(WORK_WAIT);
+	zassert_equal(nrf_cloud_coap_async_request_fake.call_count, 1);
+
+	respond(COAP_RESPONSE_CODE_CREATED);
+}
+
+ZTEST(nrf_cloud_coap_telemetry, test_resend_after_failure)
+{
+	struct nrf_cloud_coap_telemetry_stats before;
+	struct nrf_cloud_coap_telemetry_stats after;
+
+	nrf_cloud_coap_telemetry_stats_get(&before);
+
+	samples_add(2);
+	zassert_ok(nrf_cloud_coap_telemetry_flush());
+	k_sleep(WORK_WAIT);
+	zassert_equal(nrf_cloud_coap_async_request_fake.call_count, 1);
+
+	respond(-ETIMEDOUT);
+
+	/* The samples are kept in the queue */
+	nrf_cloud_coap_telemetry_stats_get(&after);
+	zassert_equal(after.samples_dropped, before.samples_dropped);
+	zassert_equal(after.uplinks, before.uplinks);
+
+	zassert_ok(nrf_cloud_coap_telemetry_flush());
+	k_sleep(WORK_WAIT);
+	zassert_equal(nrf_cloud_coap_async_request_fake.call_count, 2);
+	zassert_equal(samples_count(payload), 2);
+
+	respond(COAP_RESPONSE_CODE_CREATED);
+
+	nrf_cloud_coap_telemetry_stats_get(&after);
+	zassert_equal(after.samples_sent - before.samples_sent, 2);
+	zassert_equal(after.uplinks - before.uplinks, 1);
+}
+
+ZTEST(nrf_cloud_coap_telemetry, test_resend_when_busy)
+{
+	samples_add(1);
+
+	async_ret = -EAGAIN;
+	zassert_ok(nrf_cloud_coap_telemetry_flush());
+	k_sleep(WORK_WAIT);
+	zassert_equal(nrf_cloud_coap_async_request_fake.call_count, 1);
+
+	/* Tried again once a request slot may have been freed */
+	async_ret = 0;
+	k_sleep(K_SECONDS(1));
+	zassert_equal(nrf_cloud_coap_async_request_fake.call_count, 2);
+	zassert_equal(samples_count(payload), 1);
+
+	respond(COAP_RESPONSE_CODE_CREATED);
+}
+
+ZTEST(nrf_cloud_coap_telemetry, test_drop_when_rejected)
+{
+	struct nrf_cloud_coap_telemetry_stats before;
+	struct nrf_cloud_coap_telemetry_stats after;
+
+	nrf_cloud_coap_telemetry_stats_get(&before);
+
+	samples_add(1);
+	zassert_ok(nrf_cloud_coap_telemetry_flush());
+	k_sleep(WORK_WAIT);
+	zassert_equal(nrf_cloud_coap_async_request_fake.call_count, 1);
+
+	respond(COAP_RESPONSE_CODE_BAD_REQUEST);
+
+	nrf_cloud_coap_telemetry_stats_get(&after);
+	zassert_equal(after.samples_dropped - before.samples_dropped, 1);
+
+	/* Nothing is left to send */
+	zassert_ok(nrf_cloud_coap_telemetry_flush());
+	k_sleep(WORK_WAIT);
+	zassert_equal(nrf_cloud_coap_async_request_fake.call_count, 1);
+}
+
+ZTEST(nrf_cloud_coap_telemetry, test_stats)
+{
+	struct nrf_cloud_coap_telemetry_stats stats;
+
+	/* Two messages of three samples each */
+	for (int i = 0; i < 2; i++) {
+		samples_add(3);
+		zassert_ok(nrf_cloud_coap_telemetry_flush());
+		k_sleep(WORK_WAIT);
+		respond(COAP_RESPONSE_CODE_CREATED);
+	}
+
+	nrf_cloud_coap_telemetry_stats_get(&stats);
+	zassert_true(stats.uplinks >= 2);
+	zassert_equal(stats.bytes_per_uplink, stats.bytes_sent / stats.uplinks);
+	zassert_equal(stats.uplinks_avoided, stats.samples_sent - stats.uplinks);
+}
+
+ZTEST(nrf_cloud_coap_telemetry, test_not_connected)
+{
+	nrf_cloud_coap_is_connected_fake.return_val = false;
+
+	zassert_equal(nrf_cloud_coap_telemetry_flush(), -EACCES);
+	zassert_equal(nrf_cloud_coap_telemetry_add("", 0, TS), -EINVAL);
+}
+
+ZTEST_SUITE(nrf_cloud_coap_telemetry, NULL, NULL, telemetry_before, NULL, NULL);
@@ -0,0 +1,379 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+#include <cJSON.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_location.h>
+#include <net/nrf_cloud_os.h>
+#include "nrf_cloud_codec_internal.h"
+#include "nrf_cloud_json_reader.h"
+
+/* Number of settings in the generated shadow delta */
+#define SHADOW_SETTING_CNT 40
+
+#define FOTA_JOB_ID "8d46d2be-6c7d-4e24-9c3e-49ae8a1f2e52"
+#define FOTA_JOB_HOST "firmware.nrfcloud.com"
+#define FOTA_JOB_PATH "v1/firmwares/app\\/update.bin"
+
+static const char fota_job[] =
+	"[\"" FOTA_JOB_ID "\",0,295632,\"" FOTA_JOB_HOST "\",\"" FOTA_JOB_PATH "\"]";
+
+static const char location_mqtt[] =
+	"{\"appId\":\"GROUND_FIX\",\"messageType\":\"DATA\",\"data\":"
+	"{\"lat\":61.49213831214847,\"lon\":23.773485504184917,\"uncertainty\":41.5,"
+	"\"fulfilledWith\":\"ANCHOR\",\"anchors\":["
+	"{\"macAddress\":\"f4:92:bf:1d:10:a0\",\"name\":\"Lab \\\"A\\\"\"},"
+	"{\"macAddress\":\"f4:92:bf:1d:10:a1\",\"name\":\"Caf\\u00e9\"}]}}";
+
+static const char location_rest[] =
+	"{\"lat\":45.5,\"lon\":-122.6,\"uncertainty\":2500,\"fulfilledWith\":\"SCELL\"}";
+
+static const char location_error[] =
+	"{\"appId\":\"GROUND_FIX\",\"messageType\":\"DATA\",\"err\":40410}";
+
+static char shadow_delta[4096];
+
+static char anchor_buf[2 * NRF_CLOUD_ANCHOR_LIST_BUF_MIN_SZ] __aligned(4);
+
+/* Each allocation is prefixed with its size, so that the heap in use can be tracked */
+struct alloc_hdr {
+	size_t size;
+} __aligned(8);
+
+static size_t heap_used;
+static size_t heap_peak;
+
+static void *track_malloc(size_t size)
+{
+	struct alloc_hdr *hdr = k_malloc(sizeof(*hdr) + size);
+
+	if (!hdr) {
+		return NULL;
+	}
+
+	hdr->size = size;
+	heap_used += size;
+	heap_peak = MAX(heap_peak, heap_used);
+
+	return hdr + 1;
+}
+
+static void *track_calloc(size_t count, size_t size)
+{
+	void *ptr = track_malloc(count * size);
+
+	if (ptr) {
+		memset(ptr, 0, count * size);
+	}
+
+	return ptr;
+}
+
+static void track_free(void *ptr)
+{
+	struct alloc_hdr *hdr;
+
+	if (!ptr) {
+		return;
+	}
+
+	hdr = (struct alloc_hdr *)ptr - 1;
+	heap_used -= hdr->size;
+	k_free(hdr);
+}
+
+static struct nrf_cloud_os_mem_hooks track_hooks = {
+	.malloc_fn = track_malloc,
+	.calloc_fn = track_calloc,
+	.free_fn = track_free,
+};
+
+static void heap_peak_reset(void)
+{
+	heap_peak = heap_used;
+}
+
+static size_t heap_peak_get(void)
+{
+	return heap_peak - heap_used;
+}
+
+/* Peak heap used by cJSON to parse the text, for comparison */
+static size_t cjson_peak_get(const char *const json)
+{
+	cJSON *root;
+
+	heap_peak_reset();
+	root = cJSON_Parse(json);
+	zassert_not_null(root, "Expected the text to be parsed by cJSON");
+	cJSON_Delete(root);
+
+	return heap_peak_get();
+}
+
+static int get(const char *const json, const char *const path,
+	       struct nrf_cloud_json_reader_val *const val)
+{
+	return nrf_cloud_json_reader_get(json, strlen(json), path, val);
+}
+
+static void *setup(void)
+{
+	size_t len;
+
+	nrf_cloud_os_mem_hooks_init(&track_hooks);
+
+	/* A delta with device settings, of which only the pairing state is needed */
+	len = snprintf(shadow_delta, sizeof(shadow_delta), "{\"state\":{\"config\":{");
+
+	for (int i = 0; i < SHADOW_SETTING_CNT; i++) {
+		len += snprintf(&shadow_delta[len], sizeof(shadow_delta) - len,
+				"%s\"setting%d\":{\"enabled\":%s,\"interval\":%d,\"name\":\"s%d\"}",
+				i ? "," : "", i, (i % 2) ? "true" : "false", 60 * i, i);
+	}
+
+	len += snprintf(&shadow_delta[len], sizeof(shadow_delta) - len,
+			"},\"pairing\":{\"state\":\"paired\"}},\"version\":42}");
+	zassert_true(len < sizeof(shadow_delta));
+
+	return NULL;
+}
+
+ZTEST(nrf_cloud_json_reader, test_get)
+{
+	static const char json[] = " { \"a\" : 1, \"b\" : { \"c\" : [ 10, \"x\", { \"d\" : true },"
+				   " [ ], { } ], \"e\" : null }, \"f\" : -1.5e2 } ";
+	struct nrf_cloud_json_reader_val val;
+	struct nrf_cloud_json_reader_val parent;
+	double num;
+	int i;
+
+	zassert_ok(get(json, NULL, &val));
+	zassert_equal(val.type, NRF_CLOUD_JSON_READER_TYPE_OBJECT);
+	zassert_equal(val.ptr[0], '{');
+	zassert_equal(val.ptr[val.len - 1], '}');
+
+	zassert_ok(get(json, "a", &val));
+	zassert_ok(nrf_cloud_json_reader_int_get(&val, &i));
+	zassert_equal(i, 1);
+
+	zassert_ok(get(json, "b.c.0", &val));
+	zassert_ok(nrf_cloud_json_reader_int_get(&val, &i));
+	zassert_equal(i, 10);
+
+	zassert_ok(get(json, "b.c.1", &val));
+	zassert_true(nrf_cloud_json_reader_str_eq(&val, "x"));
+
+	zassert_ok(get(json, "b.c.2.d", &val));
+	zassert_equal(val.type, NRF_CLOUD_JSON_READER_TYPE_BOOL);
+
+	zassert_ok(get(json, "b.c.3", &val));
+	zassert_equal(val.type, NRF_CLOUD_JSON_READER_TYPE_ARRAY);
+
+	zassert_ok(get(json, "b.e", &val));
+	zassert_equal(val.type, NRF_CLOUD_JSON_READER_TYPE_NULL);
+
+	zassert_ok(get(json, "f", &val));
+	zassert_ok(nrf_cloud_json_reader_num_get(&val, &num));
+	zassert_equal(num, -150.0);
+	zassert_equal(nrf_cloud_json_reader_str_get(&val, NULL, 0), -ENOMSG);
+
+	zassert_ok(get(json, "b", &parent));
+	zassert_ok(nrf_cloud_json_reader_child_get(&parent, "c.4", &val));
+	zassert_equal(val.type, NRF_CLOUD_JSON_READER_TYPE_OBJECT);
+
+	zassert_equal(get(json, "x", &val), -ENOENT);
+	zassert_equal(get(json, "b.c.5", &val), -ENOENT);
+	zassert_equal(get(json, "b.c.d", &val), -ENOENT);
+	zassert_equal(get(json, "a.b", &val), -ENOENT);
+}
+
+ZTEST(nrf_cloud_json_reader, test_str)
+{
+	static const char json[] = "{\"k\\u00e4y\":\"q\\\"\\\\\\/\\n\\ud83d\\ude00\"}";
+	static const char expected[] = "q\"\\/\n\xf0\x9f\x98\x80";
+	struct nrf_cloud_json_reader_val val;
+	char buf[sizeof(expected)];
+
+	zassert_ok(get(json, "k\xc3\xa4y", &val));
+	zassert_true(nrf_cloud_json_reader_str_eq(&val, expected));
+	zassert_false(nrf_cloud_json_reader_str_eq(&val, "q"));
+
+	zassert_equal(nrf_cloud_json_reader_str_get(&val, NULL, 0), strlen(expected));
+	zassert_equal(nrf_cloud_json_reader_str_get(&val, buf, sizeof(buf)), strlen(expected));
+	zassert_str_equal(buf, expected);
+	zassert_equal(nrf_cloud_json_reader_str_get(&val, buf, sizeof(buf) - 1), -ENOMEM);
+}
+
+ZTEST(nrf_cloud_json_reader, test_array_next)
+{
+	struct nrf_cloud_json_reader_val array;
+	struct nrf_cloud_json_reader_val item = {0};
+	int cnt = 0;
+
+	zassert_ok(get("[\"a\", 1, [2, 3], {\"b\": \"]\"}, null]", NULL, &array));
+
+	while (nrf_cloud_json_reader_array_next(&array, &item) == 0) {
+		cnt++;
+	}
+
+	zassert_equal(cnt, 5);
+
+	item.ptr = NULL;
+	zassert_ok(get("[ ]", NULL, &array));
+	zassert_equal(nrf_cloud_json_reader_array_next(&array, &item), -ENOENT);
+
+	zassert_ok(get("{}", NULL, &array));
+	zassert_equal(nrf_cloud_json_reader_array_next(&array, &item), -ENOMSG);
+}
+
+ZTEST(nrf_cloud_json_reader, test_invalid)
+{
+	struct nrf_cloud_json_reader_val val;
+	char deep[2 * 33 + 1] = {0};
+
+	zassert_equal(get("", NULL, &val), -EBADMSG);
+	zassert_equal(get("{\"a\":1,}", NULL, &val), -EBADMSG);
+	zassert_equal(get("{\"a\":[1}", NULL, &val), -EBADMSG);
+	zassert_equal(get("{\"a\" 1}", "a", &val), -EBADMSG);
+	zassert_equal(get("{\"a\":01}", NULL, &val), -EBADMSG);
+	zassert_equal(get("{\"a\":tru}", NULL, &val), -EBADMSG);
+	zassert_equal(get("{\"a\":\"\\x\"}", NULL, &val), -EBADMSG);
+	zassert_equal(get("{\"a\":\"\\ud83d\"}", NULL, &val), -EBADMSG);
+	zassert_equal(get("{\"a\":\"abc", NULL, &val), -EBADMSG);
+
+	/* Only the text up to the end of the value is checked */
+	zassert_ok(get("{\"a\":1,}", "a", &val));
+	zassert_ok(nrf_cloud_json_reader_get("[1,2]", 3, "0", &val));
+	zassert_equal(nrf_cloud_json_reader_get("[1,2]", 3, NULL, &val), -EBADMSG);
+
+	memset(deep, '[', 32);
+	memset(&deep[32], ']', 32);
+	zassert_ok(get(deep, NULL, &val));
+
+	memset(deep, '[', 33);
+	memset(&deep[33], ']', 33);
+	zassert_equal(get(deep, NULL, &val), -E2BIG);
+}
+
+ZTEST(nrf_cloud_json_reader, test_fota_job_decode)
+{
+	static const char missing_path[] = "[\"" FOTA_JOB_ID "\",0,295632,\"" FOTA_JOB_HOST "\"]";
+	struct nrf_cloud_fota_job_info job;
+	struct nrf_cloud_data input = {
+		.ptr = fota_job,
+		.len = sizeof(fota_job),
+	};
+
+	zassert_ok(nrf_cloud_fota_job_decode(&job, NULL, &input));
+	zassert_str_equal(job.id, FOTA_JOB_ID);
+	zassert_str_equal(job.host, FOTA_JOB_HOST);
+	zassert_str_equal(job.path, "v1/firmwares/app/update.bin");
+	zassert_equal(job.type, NRF_CLOUD_FOTA_APPLICATION);
+	zassert_equal(job.file_size, 295632);
+	nrf_cloud_fota_job_free(&job);
+
+	/* The job ID is kept, so that the job can be rejected */
+	input.ptr = missing_path;
+	input.len = sizeof(missing_path);
+	zassert_equal(nrf_cloud_fota_job_decode(&job, NULL, &input), -ENOMSG);
+	zassert_str_equal(job.id, FOTA_JOB_ID);
+	zassert_is_null(job.host);
+	zassert_equal(job.type, NRF_CLOUD_FOTA_TYPE__INVALID);
+	nrf_cloud_fota_job_free(&job);
+
+	input.ptr = location_rest;
+	input.len = sizeof(location_rest);
+	zassert_equal(nrf_cloud_fota_job_decode(&job, NULL, &input), -EINVAL);
+	zassert_is_null(job.id);
+}
+
+ZTEST(nrf_cloud_json_reader, test_location_response_decode)
+{
+	struct nrf_cloud_location_result result = {
+		.anchor_buf = anchor_buf,
+		.anchor_buf_sz = sizeof(anchor_buf),
+	};
+	struct nrf_cloud_anchor_list_node *node;
+	static const char *const names[] = { "Lab \"A\"", "Caf\xc3\xa9" };
+	int idx = 0;
+
+	zassert_ok(nrf_cloud_location_response_decode(location_mqtt, &result));
+	zassert_equal(result.type, LOCATION_TYPE_WIFI);
+	zassert_equal(result.lat, 61.49213831214847);
+	zassert_equal(result.lon, 23.773485504184917);
+	zassert_equal(result.unc, 41);
+	zassert_equal(result.anchor_cnt, 2);
+
+	SYS_SLIST_FOR_EACH_CONTAINER(&result.anchor_list, node, node) {
+		zassert_true(idx < ARRAY_SIZE(names));
+		zassert_str_equal(node->name, names[idx++]);
+	}
+	zassert_equal(idx, 2);
+
+	zassert_ok(nrf_cloud_location_response_decode(location_rest, &result));
+	zassert_equal(result.type, LOCATION_TYPE_SINGLE_CELL);
+	zassert_equal(result.unc, 2500);
+
+	zassert_equal(nrf_cloud_location_response_decode(location_error, &result), -EFAULT);
+	zassert_equal(result.err, NRF_CLOUD_ERROR_DATA_NOT_FOUND);
+	zassert_equal(result.type, LOCATION_TYPE__INVALID);
+
+	zassert_equal(nrf_cloud_location_response_decode(fota_job, &result), 1,
+		      "Expected no location message");
+	zassert_equal(nrf_cloud_location_response_decode("not json", &result), 1,
+		      "Expected no JSON");
+}
+
+ZTEST(nrf_cloud_json_reader, test_peak_heap)
+{
+	struct nrf_cloud_location_result result = {
+		.anchor_buf = anchor_buf,
+		.anchor_buf_sz = sizeof(anchor_buf),
+	};
+	struct nrf_cloud_fota_job_info job;
+	struct nrf_cloud_json_reader_val val;
+	struct nrf_cloud_data input = {
+		.ptr = fota_job,
+		.len = sizeof(fota_job),
+	};
+	size_t cjson_peak;
+	size_t peak;
+
+	/* Only the job strings are allocated */
+	cjson_peak = cjson_peak_get(fota_job);
+	heap_peak_reset();
+	zassert_ok(nrf_cloud_fota_job_decode(&job, NULL, &input));
+	peak = heap_peak_get();
+	zassert_equal(peak, strlen(job.id) + strlen(job.host) + strlen(job.path) + 3);
+	nrf_cloud_fota_job_free(&job);
+	TC_PRINT("FOTA job (%u bytes): cJSON %u bytes, reader %u bytes\n",
+		 (uint32_t)strlen(fota_job), (uint32_t)cjson_peak, (uint32_t)peak);
+
+	cjson_peak = cjson_peak_get(location_mqtt);
+	heap_peak_reset();
+	zassert_ok(nrf_cloud_location_response_decode(location_mqtt, &result));
+	peak = heap_peak_get();
+	zassert_equal(peak, 0);
+	TC_PRINT("Location (%u bytes): cJSON %u bytes, reader %u bytes\n",
+		 (uint32_t)strlen(location_mqtt), (uint32_t)cjson_peak, (uint32_t)peak);
+
+	cjson_peak = cjson_peak_get(shadow_delta);
+	heap_peak_reset();
+	zassert_ok(get(shadow_delta, "state.pairing.state", &val));
+	zassert_true(nrf_cloud_json_reader_str_eq(&val, "paired"));
+	peak = heap_peak_get();
+	zassert_equal(peak, 0);
+	TC_PRINT("Shadow delta (%u bytes): cJSON %u bytes, reader %u bytes\n",
+		 (uint32_t)strlen(shadow_delta), (uint32_t)cjson_peak, (uint32_t)peak);
+}
+
+ZTEST_SUITE(nrf_cloud_json_reader, NULL, setup, NULL, NULL, NULL);
@@ -0,0 +1,355 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <string.h>
+#include <zephyr/kernel.h>
+#include <zephyr/ztest.h>
+#include <zephyr/tc_util.h>
+#include <net/nrf_cloud.h>
+#include <net/nrf_cloud_codec.h>
+#include <net/nrf_cloud_os.h>
+#include "nrf_cloud_json_writer.h"
+
+/* Number of times each message is encoded in the benchmark */
+#define BENCH_ITERATIONS 50
+
+#define WIFI_AP_CNT 20
+#define NCELL_CNT 5
+#define GCI_CELL_CNT 4
+
+/* Large enough for the location request with all Wi-Fi parameters */
+#define MSG_BUF_SIZE 3072
+
+static struct wifi_scan_result aps[WIFI_AP_CNT];
+static struct lte_lc_ncell ncells[NCELL_CNT];
+static struct lte_lc_cell gci_cells[GCI_CELL_CNT];
+
+static const struct wifi_scan_info wifi_info = {
+	.ap_info = aps,
+	.cnt = WIFI_AP_CNT,
+};
+
+static const struct lte_lc_cells_info cells_info = {
+	.current_cell = {
+		.mcc = 242,
+		.mnc = 1,
+		.id = 21858829,
+		.tac = 2305,
+		.earfcn = 6400,
+		.timing_advance = 80,
+		.rsrp = 27,
+		.rsrq = 13,
+	},
+	.ncells_count = NCELL_CNT,
+	.neighbor_cells = ncells,
+	.gci_cells_count = GCI_CELL_CNT,
+	.gci_cells = gci_cells,
+};
+
+static const struct nrf_cloud_location_config location_config = {
+	.do_reply = false,
+	.hi_conf = true,
+	.fallback = false,
+};
+
+static const struct nrf_cloud_gnss_data gnss_data = {
+	.type = NRF_CLOUD_GNSS_TYPE_PVT,
+	.ts_ms = 1700000000123,
+	.pvt = {
+		.lat = 61.49213831214847,
+		.lon = 23.773485504184917,
+		.accuracy = 12.5,
+		.alt = 110.25,
+		.has_alt = true,
+		.speed = 0.3,
+		.has_speed = true,
+		.heading = 181,
+		.has_heading = true,
+	},
+};
+
+static char json_buf[MSG_BUF_SIZE];
+static char writer_buf[MSG_BUF_SIZE];
+static char child_buf[64];
+
+/* Allocations made through the nRF Cloud and cJSON memory hooks */
+static uint32_t alloc_cnt;
+
+static void *count_malloc(size_t size)
+{
+	alloc_cnt++;
+	return k_malloc(size);
+}
+
+static void *count_calloc(size_t count, size_t size)
+{
+	alloc_cnt++;
+	return k_calloc(count, size);
+}
+
+static struct nrf_cloud_os_mem_hooks count_hooks = {
+	.malloc_fn = count_malloc,
+	.calloc_fn = count_calloc,
+	.free_fn = k_free,
+};
+
+typedef int (*msg_create_t)(struct nrf_cloud_obj *const obj);
+
+static int location_request_create(struct nrf_cloud_obj *const obj)
+{
+	return nrf_cloud_obj_location_request_create(obj, &cells_info, &wifi_info,
+						     &location_config);
+}
+
+static int gnss_msg_create(struct nrf_cloud_obj *const obj)
+{
+	return nrf_cloud_obj_gnss_msg_create(obj, &gnss_data);
+}
+
+static int sensor_msg_create(struct nrf_cloud_obj *const obj)
+{
+	static const uint32_t ints[] = { 1, 22, 333, UINT32_MAX };
+	static const char *const strs[] = { "a", "quote\"", "tab\t" };
+	int err;
+
+	err = nrf_cloud_obj_msg_init(obj, NRF_CLOUD_JSON_APPID_VAL_TEMP,
+				     NRF_CLOUD_JSON_MSG_TYPE_VAL_DATA);
+	err = err ? err : nrf_cloud_obj_num_add(obj, "temp", 23.4, true);
+	err = err ? err : nrf_cloud_obj_str_add(obj, "unit", "C", true);
+	err = err ? err : nrf_cloud_obj_bool_add(obj, "ok", true, true);
+	err = err ? err : nrf_cloud_obj_int_array_add(obj, "ints", ints, ARRAY_SIZE(ints), true);
+	err = err ? err : nrf_cloud_obj_str_array_add(obj, "strs", strs, ARRAY_SIZE(strs), true);
+	err = err ? err : nrf_cloud_obj_ts_add(obj, 1700000000123);
+	err = err ? err : nrf_cloud_obj_null_add(obj, "none", false);
+
+	return err;
+}
+
+/* Encode the message with the JSON and JSON writer object types, and compare the results */
+static void encode_compare(msg_create_t create)
+{
+	NRF_CLOUD_OBJ_JSON_DEFINE(json_obj);
+	NRF_CLOUD_OBJ_JSON_WRITER_DEFINE(writer_obj, writer_buf, sizeof(writer_buf));
+
+	zassert_ok(create(&json_obj));
+	zassert_ok(nrf_cloud_obj_cloud_encode(&json_obj));
+	zassert_true(json_obj.encoded_data.len < sizeof(json_buf));
+	memcpy(json_buf, json_obj.encoded_data.ptr, json_obj.encoded_data.len + 1);
+	(void)nrf_cloud_obj_cloud_encoded_free(&json_obj);
+	(void)nrf_cloud_obj_free(&json_obj);
+
+	zassert_ok(create(&writer_obj));
+	zassert_ok(nrf_cloud_obj_cloud_encode(&writer_obj));
+	zassert_equal_ptr(writer_obj.encoded_data.ptr, writer_buf);
+	zassert_equal(writer_obj.encoded_data.len, strlen(json_buf));
+	zassert_str_equal(writer_obj.encoded_data.ptr, json_buf);
+	zassert_ok(nrf_cloud_obj_cloud_encoded_free(&writer_obj));
+	zassert_ok(nrf_cloud_obj_free(&writer_obj));
+}
+
+static void *setup(void)
+{
+	nrf_cloud_os_mem_hooks_init(&count_hooks);
+
+	for (int i = 0; i < WIFI_AP_CNT; i++) {
+		static const uint8_t mac[WIFI_MAC_ADDR_LEN] = { 0xf4, 0x92, 0xbf, 0x1d, 0x00, 0x00 };
+
+		memcpy(aps[i].mac, mac, sizeof(mac));
+		aps[i].mac[4] = 0x10 + i;
+		aps[i].mac[5] = 0xa0 + i;
+		aps[i].mac_length = WIFI_MAC_ADDR_LEN;
+		aps[i].rssi = -40 - i;
+		aps[i].channel = 1 + (i % 13);
+		aps[i].ssid_length = snprintf((char *)aps[i].ssid, sizeof(aps[i].ssid), "ap-%d", i);
+	}
+
+	/* A locally administered address, which is left out of the request */
+	aps[3].mac[0] |= 0x02;
+
+	for (int i = 0; i < NCELL_CNT; i++) {
+		ncells[i].earfcn = 6400 + i;
+		ncells[i].phys_cell_id = 100 + i;
+		ncells[i].rsrp = 20 + i;
+		ncells[i].rsrq = i;
+		ncells[i].time_diff = (i % 2) ? LTE_LC_CELL_TIME_DIFF_INVALID : 10 * i;
+	}
+
+	for (int i = 0; i < GCI_CELL_CNT; i++) {
+		gci_cells[i] = cells_info.current_cell;
+		gci_cells[i].id += i + 1;
+		gci_cells[i].timing_advance = 5000;
+	}
+
+	return NULL;
+}
+
+ZTEST(nrf_cloud_json_writer, test_location_request)
+{
+	encode_compare(location_request_create);
+}
+
+ZTEST(nrf_cloud_json_writer, test_gnss_msg)
+{
+	encode_compare(gnss_msg_create);
+}
+
+ZTEST(nrf_cloud_json_writer, test_sensor_msg)
+{
+	encode_compare(sensor_msg_create);
+}
+
+ZTEST(nrf_cloud_json_writer, test_object_add)
+{
+	NRF_CLOUD_OBJ_JSON_WRITER_DEFINE(obj, writer_buf, sizeof(writer_buf));
+	NRF_CLOUD_OBJ_JSON_WRITER_DEFINE(child, child_buf, sizeof(child_buf));
+	NRF_CLOUD_OBJ_JSON_DEFINE(json_child);
+
+	zassert_ok(nrf_cloud_obj_init(&obj));
+	zassert_ok(nrf_cloud_obj_init(&child));
+	zassert_ok(nrf_cloud_obj_num_add(&child, "x", 1, false));
+	zassert_ok(nrf_cloud_obj_object_add(&obj, "child", &child, true));
+	zassert_equal(nrf_cloud_obj_object_add(&obj, "child", &child, false), -ENOENT,
+		      "Expected the added child to be reset");
+
+	zassert_ok(nrf_cloud_obj_init(&json_child));
+	zassert_equal(nrf_cloud_obj_object_add(&obj, "json", &json_child, false), -ENOTSUP);
+	(void)nrf_cloud_obj_free(&json_child);
+
+	zassert_ok(nrf_cloud_obj_cloud_encode(&obj));
+	zassert_str_equal(obj.encoded_data.ptr, "{\"data\":{\"child\":{\"x\":1}}}");
+}
+
+ZTEST(nrf_cloud_json_writer, test_bulk)
+{
+	NRF_CLOUD_OBJ_JSON_WRITER_DEFINE(bulk, writer_buf, sizeof(writer_buf));
+	NRF_CLOUD_OBJ_JSON_WRITER_DEFINE(msg, child_buf, sizeof(child_buf));
+
+	zassert_ok(nrf_cloud_obj_bulk_init(&bulk));
+	zassert_true(nrf_cloud_obj_bulk_check(&bulk));
+
+	for (int i = 0; i < 2; i++) {
+		zassert_ok(nrf_cloud_obj_msg_init(&msg, NRF_CLOUD_JSON_APPID_VAL_TEMP, NULL));
+		zassert_ok(nrf_cloud_obj_num_add(&msg, NRF_CLOUD_JSON_DATA_KEY, i, false));
+		zassert_false(nrf_cloud_obj_bulk_check(&msg));
+		zassert_ok(nrf_cloud_obj_bulk_add(&bulk, &msg));
+	}
+
+	zassert_ok(nrf_cloud_obj_cloud_encode(&bulk));
+	zassert_str_equal(bulk.encoded_data.ptr,
+			  "[{\"appId\":\"TEMP\",\"data\":0},{\"appId\":\"TEMP\",\"data\":1}]");
+}
+
+ZTEST(nrf_cloud_json_writer, test_data_child_order)
+{
+	NRF_CLOUD_OBJ_JSON_WRITER_DEFINE(obj, writer_buf, sizeof(writer_buf));
+
+	zassert_equal(nrf_cloud_obj_num_add(&obj, "a", 1, false), -ENOENT);
+	zassert_ok(nrf_cloud_obj_init(&obj));
+	zassert_equal(nrf_cloud_obj_init(&obj), -ENOTEMPTY);
+	zassert_ok(nrf_cloud_obj_num_add(&obj, "a", 1, true));
+	zassert_ok(nrf_cloud_obj_num_add(&obj, "b", 2, true));
+	zassert_ok(nrf_cloud_obj_num_add(&obj, "c", 3, false));
+
+	/* The "data" object has been written out */
+	zassert_equal(nrf_cloud_obj_num_add(&obj, "d", 4, true), -ENOTSUP);
+
+	zassert_ok(nrf_cloud_obj_cloud_encode(&obj));
+	zassert_str_equal(obj.encoded_data.ptr, "{\"data\":{\"a\":1,\"b\":2},\"c\":3}");
+
+	/* Encoding closes the object */
+	zassert_equal(nrf_cloud_obj_num_add(&obj, "e", 5, false), -ENOENT);
+	zassert_ok(nrf_cloud_obj_free(&obj));
+	zassert_ok(nrf_cloud_obj_init(&obj));
+}
+
+ZTEST(nrf_cloud_json_writer, test_buffer_too_small)
+{
+	static char small_buf[256];
+	NRF_CLOUD_OBJ_JSON_WRITER_DEFINE(obj, small_buf, sizeof(small_buf));
+	NRF_CLOUD_OBJ_JSON_WRITER_DEFINE(msg, small_buf, 26);
+
+	zassert_equal(location_request_create(&obj), -ENOMEM);
+	zassert_equal(nrf_cloud_obj_cloud_encode(&obj), -ENOENT,
+		      "Expected the object to be freed");
+
+	/* A failed item leaves the object as it was */
+	zassert_ok(nrf_cloud_obj_init(&msg));
+	zassert_ok(nrf_cloud_obj_str_add(&msg, "a", "1234567", false));
+	zassert_equal(nrf_cloud_obj_str_add(&msg, "b", "1234567", false), -ENOMEM);
+	zassert_ok(nrf_cloud_obj_bool_add(&msg, "b", true, false));
+	zassert_ok(nrf_cloud_obj_cloud_encode(&msg));
+	zassert_str_equal(msg.encoded_data.ptr, "{\"a\":\"1234567\",\"b\":true}");
+}
+
+ZTEST(nrf_cloud_json_writer, test_data_msg_add)
+{
+	/* Room for one message */
+	static char buf[100];
+	struct nrf_cloud_obj_json_writer writer = { .buf = buf, .size = sizeof(buf) };
+	const char *expected = "[{\"appId\":\"TEMP\",\"messageType\":\"DATA\","
+			       "\"ts\":1700000000000,\"data\":23.5}]";
+
+	zassert_ok(nrf_cloud_json_writer_start(&writer, true));
+	zassert_ok(nrf_cloud_json_writer_data_msg_add(&writer, NRF_CLOUD_JSON_APPID_VAL_TEMP,
+						      23.5, 1700000000000));
+
+	/* A second message does not fit, and is not partially written */
+	zassert_equal(nrf_cloud_json_writer_data_msg_add(&writer, NRF_CLOUD_JSON_APPID_VAL_TEMP,
+							 23.5, 1700000000000), -ENOMEM);
+
+	zassert_ok(nrf_cloud_json_writer_finish(&writer));
+	zassert_str_equal(writer.buf, expected);
+}
+
+static uint32_t bench_run(msg_create_t create, struct nrf_cloud_obj *const obj,
+			  uint32_t *allocs)
+{
+	uint32_t start = k_cycle_get_32();
+
+	alloc_cnt = 0;
+
+	for (int i = 0; i < BENCH_ITERATIONS; i++) {
+		zassert_ok(create(obj));
+		zassert_ok(nrf_cloud_obj_cloud_encode(obj));
+		(void)nrf_cloud_obj_cloud_encoded_free(obj);
+		(void)nrf_cloud_obj_free(obj);
+	}
+
+	*allocs = alloc_cnt / BENCH_ITERATIONS;
+
+	return k_cyc_to_us_floor32(k_cycle_get_32() - start) / BENCH_ITERATIONS;
+}
+
+ZTEST(nrf_cloud_json_writer, test_benchmark)
+{
+	static const struct {
+		const char *name;
+		msg_create_t create;
+	} msgs[] = {
+		{ "location request", location_request_create },
+		{ "GNSS PVT", gnss_msg_create },
+		{ "sensor", sensor_msg_create },
+	};
+
+	ARRAY_FOR_EACH(msgs, i) {
+		NRF_CLOUD_OBJ_JSON_DEFINE(json_obj);
+		NRF_CLOUD_OBJ_JSON_WRITER_DEFINE(writer_obj, writer_buf, sizeof(writer_buf));
+		uint32_t json_allocs;
+		uint32_t writer_allocs;
+		uint32_t json_us;
+		uint32_t writer_us;
+
+		json_us = bench_run(msgs[i].create, &json_obj, &json_allocs);
+		writer_us = bench_run(msgs[i].create, &writer_obj, &writer_allocs);
+
+		zassert_equal(writer_allocs, 0, "Expected no allocations by the writer");
+
+		TC_PRINT("%-16s: cJSON %5u us, %3u allocations; writer %5u us, %u allocations\n",
+			 msgs[i].name, json_us, json_allocs, writer_us, writer_allocs);
+	}
+}
+
+ZTEST_SUITE(nrf_cloud_json_writer, NULL, setup, NULL, NULL, NULL);
@@ -0,0 +1,323 @@
+/*
+ * Copyright (c) 2025 Nordic Semiconductor ASA
+ *
+ * SPDX-License-Identifier: LicenseRef-Nordic-5-Clause
+ */
+
+#include <stdio.h>
+#include <zephyr/ztest.h>
+#include <zephyr/kernel.h>
+#include <nrf_compress/implementation.h>
+
+/* ARM thumb code */
+static const uint8_t arm_thumb_data[] = {
+#include "arm_thumb.inc"
+};
+
+/* The same code with the ARM thumb filter applied */
+static const uint8_t arm_thumb_filtered[] = {
+#include "arm_thumb_compressed.inc"
+};
+
+#define TEST_DATA_SIZE 16384
+
+/* Worst case expansion of incompressible data with the chunk headers and the stream header. */
+#define COMPRESSED_SIZE_MAX(size) ((size) + (size) / 32 + 64)
+
+#define DATA_BUFFER_SIZE MAX(TEST_DATA_SIZE, sizeof(arm_thumb_data))
+
+static uint8_t test_data[TEST_DATA_SIZE];
+static uint8_t filtered[DATA_BUFFER_SIZE];
+static uint8_t compressed[COMPRESSED_SIZE_MAX(DATA_BUFFER_SIZE)];
+static uint8_t decompressed[DATA_BUFFER_SIZE];
+
+/* Streams the whole input through one implementation in the given direction. Input is
+ * provided in steps of the given size when compressing and in the requested amounts when
+ * decompressing.
+ */
+static size_t stream_process(uint16_t type, bool compress, const uint8_t *input,
+			     size_t input_size, size_t step, uint8_t *output, size_t output_max)
+{
+	struct nrf_compress_implementation *implementation;
+	size_t pos = 0;
+	size_t total = 0;
+	int rc;
+
+	implementation = nrf_compress_implementation_find(type);
+	zassert_not_null(implementation, "Expected implementation to not be NULL");
+
+	rc = implementation->init(NULL, 0);
+	zassert_ok(rc, "Expected init to be successful");
+
+	while (true) {
+		size_t chunk_size;
+		uint32_t offset;
+		uint8_t *output_data;
+		size_t output_size;
+		bool last;
+
+		if (compress) {
+			chunk_size = MIN(step, input_size - pos);
+		} else {
+			chunk_size = implementation->decompress_bytes_needed(NULL);
+			zassert_true(chunk_size > 0, "Expected bytes needed to be non-zero");
+			chunk_size = MIN(chunk_size, input_size - pos);
+		}
+
+		last = (pos + chunk_size) == input_size;
+
+		if (compress) {
+			rc = implementation->compress(NULL, &input[pos], chunk_size, last, &offset,
+						      &output_data, &output_size);
+		} else {
+			rc = implementation->decompress(NULL, &input[pos], chunk_size, last,
+							&offset, &output_data, &output_size);
+		}
+
+		zassert_ok(rc, "Expected data processing to be successful");
+		zassert_true(offset <= chunk_size, "Expected offset within input");
+		zassert_true(total + output_size <= output_max, "Output buffer overflow");
+
+		if (output_size > 0) {
+			memcpy(&output[total], output_data, output_size);
+			total += output_size;
+		}
+
+		pos += offset;
+
+		if (compress) {
+			/* The stream is finished once all data is provided and nothing is left */
+			if (last && offset == chunk_size && output_size == 0) {
+				break;
+			}
+		} else if (pos == input_size) {
+			break;
+		}
+	}
+
+	rc = implementation->deinit(NULL);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	return total;
+}
+
+static size_t lz_round_trip(const uint8_t *data, size_t data_size, size_t step)
+{
+	size_t compressed_size;
+	size_t decompressed_size;
+
+	compressed_size = stream_process(NRF_COMPRESS_TYPE_LZ, true, data, data_size, step,
+					 compressed, sizeof(compressed));
+	decompressed_size = stream_process(NRF_COMPRESS_TYPE_LZMA, false, compressed,
+					   compressed_size, 0, decompressed,
+					   sizeof(decompressed));
+
+	zassert_equal(decompressed_size, data_size, "Expected decompressed size to match");
+	zassert_mem_equal(decompressed, data, data_size, "Expected decompressed data to match");
+
+	return compressed_size;
+}
+
+static void test_data_text_fill(void)
+{
+	size_t pos = 0;
+	uint32_t i = 0;
+
+	while (pos < sizeof(test_data)) {
+		char line[48];
+		int len = snprintf(line, sizeof(line), "sensor %u: temperature %u.%u C\n",
+				   i % 7, 20 + (i * 13) % 9, (i * 7) % 10);
+
+		len = MIN(len, sizeof(test_data) - pos);
+		memcpy(&test_data[pos], line, len);
+		pos += len;
+		i++;
+	}
+}
+
+static void test_data_random_fill(void)
+{
+	uint32_t state = 0x12345678;
+
+	for (size_t i = 0; i < sizeof(test_data); i++) {
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		test_data[i] = (uint8_t)state;
+	}
+}
+
+ZTEST(nrf_compress_compression, test_valid_implementation_elements)
+{
+	struct nrf_compress_implementation *implementation;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZ);
+	zassert_not_null(implementation, "Expected implementation to not be NULL");
+	zassert_not_null(implementation->init, "Expected init element to not be NULL");
+	zassert_not_null(implementation->deinit, "Expected deinit element to not be NULL");
+	zassert_not_null(implementation->reset, "Expected reset element to not be NULL");
+	zassert_not_null(implementation->compress, "Expected compress element to not be NULL");
+	zassert_is_null(implementation->decompress_bytes_needed,
+			"Expected decompress bytes needed element to be NULL");
+	zassert_is_null(implementation->decompress, "Expected decompress element to be NULL");
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_ARM_THUMB);
+	zassert_not_null(implementation, "Expected implementation to not be NULL");
+	zassert_not_null(implementation->compress, "Expected compress element to not be NULL");
+	zassert_not_null(implementation->decompress, "Expected decompress element to not be NULL");
+}
+
+ZTEST(nrf_compress_compression, test_arm_thumb_filter)
+{
+	size_t size;
+
+	zassert_equal(sizeof(arm_thumb_data), sizeof(arm_thumb_filtered),
+		      "Expected test data sizes to match");
+
+	size = stream_process(NRF_COMPRESS_TYPE_ARM_THUMB, true, arm_thumb_data,
+			      sizeof(arm_thumb_data), CONFIG_NRF_COMPRESS_CHUNK_SIZE, filtered,
+			      sizeof(filtered));
+
+	zassert_equal(size, sizeof(arm_thumb_filtered), "Expected filtered size to match");
+	zassert_mem_equal(filtered, arm_thumb_filtered, size, "Expected filtered data to match");
+}
+
+ZTEST(nrf_compress_compression, test_arm_thumb_lz_round_trip)
+{
+	size_t filtered_size;
+	size_t compressed_size;
+	size_t decompressed_size;
+
+	filtered_size = stream_process(NRF_COMPRESS_TYPE_ARM_THUMB, true, arm_thumb_data,
+				       sizeof(arm_thumb_data), CONFIG_NRF_COMPRESS_CHUNK_SIZE,
+				       filtered, sizeof(filtered));
+	compressed_size = stream_process(NRF_COMPRESS_TYPE_LZ, true, filtered, filtered_size,
+					 CONFIG_NRF_COMPRESS_CHUNK_SIZE, compressed,
+					 sizeof(compressed));
+	zassert_true(compressed_size < sizeof(arm_thumb_data),
+		     "Expected ARM thumb code to be compressed");
+
+	/* Decompress in the same order as MCUboot: LZMA first, then the ARM thumb filter */
+	decompressed_size = stream_process(NRF_COMPRESS_TYPE_LZMA, false, compressed,
+					   compressed_size, 0, decompressed,
+					   sizeof(decompressed));
+	zassert_equal(decompressed_size, filtered_size, "Expected decompressed size to match");
+
+	memcpy(filtered, decompressed, decompressed_size);
+	decompressed_size = stream_process(NRF_COMPRESS_TYPE_ARM_THUMB, false, filtered,
+					   filtered_size, 0, decompressed, sizeof(decompressed));
+
+	zassert_equal(decompressed_size, sizeof(arm_thumb_data),
+		      "Expected decompressed size to match");
+	zassert_mem_equal(decompressed, arm_thumb_data, sizeof(arm_thumb_data),
+			  "Expected decompressed data to match");
+
+	TC_PRINT("ARM thumb code: %u bytes compressed to %u bytes\n",
+		 (uint32_t)sizeof(arm_thumb_data), (uint32_t)compressed_size);
+}
+
+ZTEST(nrf_compress_compression, test_lz_text)
+{
+	static const size_t steps[] = {1, 100, CONFIG_NRF_COMPRESS_CHUNK_SIZE, TEST_DATA_SIZE};
+
+	test_data_text_fill();
+
+	for (size_t i = 0; i < ARRAY_SIZE(steps); i++) {
+		size_t size = lz_round_trip(test_data, sizeof(test_data), steps[i]);
+
+		zassert_true(size < (sizeof(test_data) / 4), "Expected text to be compressed");
+	}
+}
+
+ZTEST(nrf_compress_compression, test_lz_incompressible)
+{
+	size_t size;
+
+	test_data_random_fill();
+	size = lz_round_trip(test_data, sizeof(test_data), CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+
+	zassert_true(size <= COMPRESSED_SIZE_MAX(sizeof(test_data)),
+		     "Expected limited expansion of incompressible data");
+}
+
+ZTEST(nrf_compress_compression, test_lz_repeated_byte)
+{
+	size_t size;
+
+	memset(test_data, 0xff, sizeof(test_data));
+	size = lz_round_trip(test_data, sizeof(test_data), CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+
+	zassert_true(size < 256, "Expected repeated byte to be compressed");
+}
+
+ZTEST(nrf_compress_compression, test_lz_short_input)
+{
+	static const uint8_t single_byte = 0x5a;
+
+	lz_round_trip(&single_byte, sizeof(single_byte), CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+	lz_round_trip(arm_thumb_data, 3, CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+}
+
+ZTEST(nrf_compress_compression, test_lz_reset)
+{
+	struct nrf_compress_implementation *implementation;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	size_t size;
+	int rc;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZ);
+	zassert_not_null(implementation, "Expected implementation to not be NULL");
+
+	test_data_text_fill();
+
+	rc = implementation->init(NULL, 0);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = implementation->compress(NULL, test_data, sizeof(test_data) / 2, false, &offset,
+				      &output, &output_size);
+	zassert_ok(rc, "Expected data compress to be successful");
+
+	rc = implementation->reset(NULL, 0);
+	zassert_ok(rc, "Expected reset to be successful");
+
+	rc = implementation->deinit(NULL);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	/* An aborted stream does not affect the next one */
+	size = lz_round_trip(test_data, sizeof(test_data), CONFIG_NRF_COMPRESS_CHUNK_SIZE);
+	zassert_true(size > 0, "Expected compressed data");
+}
+
+ZTEST(nrf_compress_compression, test_lz_finished_stream)
+{
+	struct nrf_compress_implementation *implementation;
+	uint32_t offset;
+	uint8_t *output;
+	size_t output_size;
+	int rc;
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZ);
+	zassert_not_null(implementation, "Expected implementation to not be NULL");
+
+	rc = implementation->init(NULL, 0);
+	zassert_ok(rc, "Expected init to be successful");
+
+	/* Empty stream consists of the header and the end marker */
+	rc = implementation->compress(NULL, NULL, 0, true, &offset, &output, &output_size);
+	zassert_ok(rc, "Expected data compress to be successful");
+	zassert_equal(output_size, 3, "Expected header and end marker");
+
+	rc = implementation->compress(NULL, NULL, 0, true, &offset, &output, &output_size);
+	zassert_ok(rc, "Expected data compress to be successful");
+	zassert_equal(output_size, 0, "Expected no output after end of stream");
+
+	rc = implementation->compress(NULL, test_data, 1, true, &offset, &output, &output_size);
+	zassert_equal(rc, -EINVAL, "Expected data after end of stream to be rejected");
+
+	rc = implementation->deinit(NULL);
+	zassert_ok(rc, "Expected deinit to be successful");
+}
+
+ZTEST_SUITE(nrf_compress_compression, NULL, NULL, NULL, NULL, NULL);
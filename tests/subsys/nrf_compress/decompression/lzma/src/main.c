@@ -50,9 +50,22 @@ const uint8_t dummy_data_lzma1_input[] = {
 #include "dummy_data_input_lzma1.inc"
 };
 
+/* Decompressed size used when the size is not known up front */
+#if defined(CONFIG_NRF_COMPRESS_OUTPUT_DICTIONARY)
+/* Output dictionary must hold the whole output, so the size must always be known. */
+#define UNKNOWN_OUTPUT_SIZE dummy_data_output_size
+#else
+#define UNKNOWN_OUTPUT_SIZE 0
+#endif
+
 #if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
 
+#if defined(CONFIG_NRF_COMPRESS_OUTPUT_DICTIONARY)
+/* Holds the whole output of the large data */
+#define LOCAL_DICT_SIZE 1024 * 136
+#else
 #define LOCAL_DICT_SIZE 1024 * 128
+#endif
 static uint8_t local_dictionary[LOCAL_DICT_SIZE];
 
 static size_t open_dict_cnt;
@@ -68,6 +81,11 @@ int open_dictionary(size_t dict_size, size_t *buff_size)
 		return -ENOMEM;
 	}
 
+#if defined(CONFIG_NRF_COMPRESS_OUTPUT_DICTIONARY)
+	/* Mimic erased flash to detect dictionary positions written more than once. */
+	memset(local_dictionary, 0xff, sizeof(local_dictionary));
+#endif
+
 	open_dict_cnt++;
 	return 0;
 }
@@ -80,6 +98,14 @@ int close_dictionary(void)
 
 size_t write_dictionary(size_t pos, const uint8_t *data, size_t len)
 {
+#if defined(CONFIG_NRF_COMPRESS_OUTPUT_DICTIONARY)
+	for (size_t i = 0; i < len; i++) {
+		if (local_dictionary[pos + i] != 0xff) {
+			return 0;
+		}
+	}
+#endif
+
 	memcpy(local_dictionary + pos, data, len);
 	write_dict_cnt++;
 	return len;
@@ -608,7 +634,7 @@ ZTEST(nrf_compress_decompression, test_valid_data_decompression_reset)
 
 	pos = 0;
 
-	rc = implementation->init(inst, 0);
+	rc = implementation->init(inst, UNKNOWN_OUTPUT_SIZE);
 	zassert_ok(rc, "Expected init to be successful");
 
 	rc = implementation->decompress_bytes_needed(inst);
@@ -629,7 +655,7 @@ ZTEST(nrf_compress_decompression, test_valid_data_decompression_reset)
 	zassert_ok(rc, "Expected data decompress to be successful");
 
 	pos = 0;
-	implementation->reset(inst, 0);
+	implementation->reset(inst, UNKNOWN_OUTPUT_SIZE);
 
 	rc = implementation->decompress_bytes_needed(inst);
 	zassert_equal(rc, 2, "Expected to need 2 bytes for LZMA header");
@@ -821,6 +847,101 @@ ZTEST(nrf_compress_decompression, test_data_decompression_output_too_large)
 	zassert_ok(rc, "Expected deinit to be successful");
 }
 
+ZTEST(nrf_compress_decompression, test_output_dictionary_unknown_size)
+{
+#if defined(CONFIG_NRF_COMPRESS_OUTPUT_DICTIONARY)
+	int rc;
+	uint32_t offset;
+	uint8_t *output;
+	uint32_t output_size;
+	struct nrf_compress_implementation *implementation;
+	void *inst = &lzma_inst;
+
+	reset_dictionary_counters();
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+
+	rc = implementation->init(inst, 0);
+	zassert_ok(rc, "Expected init to be successful");
+
+	rc = implementation->decompress_bytes_needed(inst);
+	zassert_equal(rc, 2, "Expected to need 2 bytes for LZMA header");
+
+	rc = implementation->decompress(inst, dummy_data_input, rc, false, &offset, &output,
+					&output_size);
+	(void)implementation->deinit(inst);
+	zassert_not_ok(rc, "Expected header decompress to fail");
+
+	zassert_equal(open_dict_cnt, 0,
+		      "Expected 0 dictionary 'open' calls");
+#else
+	ztest_test_skip();
+#endif
+}
+
+ZTEST(nrf_compress_decompression, test_decompression_throughput)
+{
+	int rc;
+	uint32_t pos;
+	uint32_t offset;
+	uint8_t *output;
+	uint32_t output_size;
+	uint32_t total_output_size = 0;
+	uint32_t start_cycles;
+	uint64_t time_us;
+	struct nrf_compress_implementation *implementation;
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	void *inst = &lzma_inst;
+
+	reset_dictionary_counters();
+#else
+	void *inst = NULL;
+#endif
+
+	implementation = nrf_compress_implementation_find(NRF_COMPRESS_TYPE_LZMA);
+
+	start_cycles = k_cycle_get_32();
+
+	rc = implementation->init(inst, dummy_data_large_output_size);
+	zassert_ok(rc, "Expected init to be successful");
+
+	pos = 0;
+
+	while (pos < sizeof(dummy_data_large_input)) {
+		rc = implementation->decompress_bytes_needed(inst);
+
+		if ((pos + rc) >= sizeof(dummy_data_large_input)) {
+			rc = implementation->decompress(inst, &dummy_data_large_input[pos],
+							(sizeof(dummy_data_large_input) - pos),
+							true, &offset, &output, &output_size);
+		} else {
+			rc = implementation->decompress(inst, &dummy_data_large_input[pos], rc,
+							false, &offset, &output, &output_size);
+		}
+
+		zassert_ok(rc, "Expected data decompress to be successful");
+
+		total_output_size += output_size;
+		pos += offset;
+	}
+
+	rc = implementation->deinit(inst);
+	zassert_ok(rc, "Expected deinit to be successful");
+
+	time_us = k_cyc_to_us_ceil64(k_cycle_get_32() - start_cycles);
+
+	zassert_equal(total_output_size, dummy_data_large_output_size,
+		      "Expected decompressed data size to match");
+
+	TC_PRINT("Decompressed %u bytes in %llu us (%llu kB/s)\n", total_output_size,
+		 (unsigned long long)time_us,
+		 (unsigned long long)((time_us > 0) ?
+				      ((uint64_t)total_output_size * 1000 / time_us) : 0));
+#if defined(CONFIG_NRF_COMPRESS_EXTERNAL_DICTIONARY)
+	TC_PRINT("Dictionary calls: %zu 'read', %zu 'write'\n", read_dict_cnt, write_dict_cnt);
+#endif
+}
+
 static void cleanup_test(void *p)
 {
 #if defined(CONFIG_NRF_COMPRESS_MEMORY_TYPE_MALLOC) && !defined(CONFIG_SOC_POSIX)